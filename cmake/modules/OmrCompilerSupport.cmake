@@ -298,6 +298,7 @@ function(create_omr_compiler_library)
 	target_link_libraries(${COMPILER_NAME}
 		PUBLIC
 			omr_base
+			${OMR_THREAD_LIB}
 	)
 
 	# Grab the list of core compiler objects from the global property.
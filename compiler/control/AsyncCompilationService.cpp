@@ -0,0 +1,366 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/AsyncCompilationService.hpp"
+
+#include <new>
+#include "AtomicSupport.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/CompilationTypes.hpp"
+#include "control/CompileMethod.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentAllocator.hpp"
+#include "ilgen/IlGeneratorMethodDetails.hpp"
+#include "infra/Assert.hpp"
+#include "infra/ThreadLocal.hpp"
+#include "thread_api.h"
+
+TR::AsyncCompilationService::AsyncCompilationService(uint32_t numThreads) :
+   _monitor(NULL),
+   _numThreads(numThreads),
+   _numActive(0),
+   _queue(NULL),
+   _numQueued(0),
+   _sequence(0),
+   _numCompleted(0),
+   _numDuplicates(0),
+   _running(false),
+   _shuttingDown(false)
+   {
+#if !defined(SUPPORTS_THREAD_LOCAL)
+   // TR::comp() is a process-wide global without thread local storage, so
+   // compilations must not overlap
+   _numThreads = 1;
+#endif
+   if (_numThreads < 1)
+      _numThreads = 1;
+   else if (_numThreads > MAX_THREADS)
+      _numThreads = MAX_THREADS;
+
+   for (uint32_t i = 0; i < MAX_THREADS; i++)
+      {
+      _slots[i]._service = this;
+      _slots[i]._thread = NULL;
+      _slots[i]._active = NULL;
+      }
+   }
+
+TR::AsyncCompilationService::~AsyncCompilationService()
+   {
+   shutdown();
+   }
+
+bool
+TR::AsyncCompilationService::startup()
+   {
+   if (_running || (NULL == omrthread_self()))
+      return false;
+
+   if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "JIT-AsyncCompilationServiceMonitor"))
+      {
+      _monitor = NULL;
+      return false;
+      }
+
+   _shuttingDown = false;
+   _running = true;
+
+   for (uint32_t i = 0; i < _numThreads; i++)
+      {
+      omrthread_attr_t attr = NULL;
+      intptr_t rc = omrthread_attr_init(&attr);
+      if (J9THREAD_SUCCESS == rc)
+         {
+         rc = omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+         // the default omrthread stack is far too small for the optimizer
+         if (J9THREAD_SUCCESS == rc)
+            rc = omrthread_attr_set_stacksize(&attr, COMPILATION_THREAD_STACK_SIZE);
+         if (J9THREAD_SUCCESS == rc)
+            rc = omrthread_create_ex(&_slots[i]._thread, &attr, 0, compilationThreadProc, &_slots[i]);
+         omrthread_attr_destroy(&attr);
+         }
+
+      if (J9THREAD_SUCCESS != rc)
+         {
+         _slots[i]._thread = NULL;
+         stopThreads(i);
+         return false;
+         }
+      }
+
+   return true;
+   }
+
+void
+TR::AsyncCompilationService::shutdown()
+   {
+   if (!_running)
+      return;
+
+   omrthread_monitor_enter(_monitor);
+   _shuttingDown = true;
+   Request *discarded = _queue;
+   _queue = NULL;
+   _numQueued = 0;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_monitor_exit(_monitor);
+
+   stopThreads(_numThreads);
+
+   while (NULL != discarded)
+      {
+      Request *next = discarded->_next;
+      complete(discarded, NULL, COMPILATION_REQUESTED);
+      discarded = next;
+      }
+   }
+
+void
+TR::AsyncCompilationService::stopThreads(uint32_t numStarted)
+   {
+   omrthread_monitor_enter(_monitor);
+   _shuttingDown = true;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_monitor_exit(_monitor);
+
+   for (uint32_t i = 0; i < numStarted; i++)
+      {
+      if (NULL != _slots[i]._thread)
+         {
+         omrthread_join(_slots[i]._thread);
+         _slots[i]._thread = NULL;
+         }
+      }
+
+   omrthread_monitor_destroy(_monitor);
+   _monitor = NULL;
+   _running = false;
+   }
+
+TR::AsyncCompilationService::SubmitResult
+TR::AsyncCompilationService::submit(
+      TR_ResolvedMethod *method,
+      TR_Hotness hotness,
+      int32_t priority,
+      CompletionCallback callback,
+      void *userData,
+      void * volatile *installAddress)
+   {
+   TR_ASSERT_FATAL(NULL != method, "Cannot submit a NULL method for compilation");
+
+   if (!_running)
+      return Rejected;
+
+   omrthread_monitor_enter(_monitor);
+
+   if (_shuttingDown)
+      {
+      omrthread_monitor_exit(_monitor);
+      return Rejected;
+      }
+
+   Request *pending = findQueued(method);
+   if ((NULL != pending) || isActive(method))
+      {
+      if ((NULL != pending) && (priority > pending->_priority))
+         {
+         unlink(pending);
+         pending->_priority = priority;
+         enqueue(pending);
+         }
+      _numDuplicates += 1;
+      omrthread_monitor_exit(_monitor);
+      return Duplicate;
+      }
+
+   Request *request = new (TR::Compiler->persistentAllocator(), std::nothrow) Request;
+   if (NULL == request)
+      {
+      omrthread_monitor_exit(_monitor);
+      return Rejected;
+      }
+
+   request->_next = NULL;
+   request->_method = method;
+   request->_hotness = hotness;
+   request->_priority = priority;
+   request->_sequence = _sequence++;
+   request->_callback = callback;
+   request->_userData = userData;
+   request->_installAddress = installAddress;
+
+   enqueue(request);
+   omrthread_monitor_notify(_monitor);
+   omrthread_monitor_exit(_monitor);
+   return Queued;
+   }
+
+void
+TR::AsyncCompilationService::waitForIdle()
+   {
+   if (!_running)
+      return;
+
+   omrthread_monitor_enter(_monitor);
+   while ((NULL != _queue) || (0 != _numActive))
+      omrthread_monitor_wait(_monitor);
+   omrthread_monitor_exit(_monitor);
+   }
+
+uint32_t
+TR::AsyncCompilationService::getNumQueued()
+   {
+   if (!_running)
+      return 0;
+
+   omrthread_monitor_enter(_monitor);
+   uint32_t numQueued = _numQueued;
+   omrthread_monitor_exit(_monitor);
+   return numQueued;
+   }
+
+int J9THREAD_PROC
+TR::AsyncCompilationService::compilationThreadProc(void *arg)
+   {
+   ThreadSlot *slot = static_cast<ThreadSlot *>(arg);
+   slot->_service->run(slot);
+   return 0;
+   }
+
+void
+TR::AsyncCompilationService::run(ThreadSlot *slot)
+   {
+   omrthread_monitor_enter(_monitor);
+   while (true)
+      {
+      while ((NULL == _queue) && !_shuttingDown)
+         omrthread_monitor_wait(_monitor);
+
+      if (_shuttingDown)
+         break;
+
+      Request *request = _queue;
+      unlink(request);
+      slot->_active = request->_method;
+      _numActive += 1;
+      omrthread_monitor_exit(_monitor);
+
+      compile(request);
+
+      omrthread_monitor_enter(_monitor);
+      slot->_active = NULL;
+      _numActive -= 1;
+      _numCompleted += 1;
+      // wake waitForIdle() as well as other compilation threads
+      omrthread_monitor_notify_all(_monitor);
+      }
+   omrthread_monitor_exit(_monitor);
+   }
+
+void
+TR::AsyncCompilationService::compile(Request *request)
+   {
+   TR::IlGeneratorMethodDetails details(request->_method);
+   int32_t rc = COMPILATION_REQUESTED;
+   uint8_t *entryPoint = NULL;
+
+   try
+      {
+      entryPoint = compileMethodFromDetails(NULL, details, request->_hotness, rc);
+      }
+   catch (...)
+      {
+      // a failed compilation must not take the compilation thread down
+      entryPoint = NULL;
+      rc = COMPILATION_FAILED;
+      }
+
+   if (COMPILATION_SUCCEEDED != rc)
+      entryPoint = NULL;
+
+   complete(request, entryPoint, rc);
+   }
+
+void
+TR::AsyncCompilationService::complete(Request *request, uint8_t *entryPoint, int32_t rc)
+   {
+   if ((NULL != entryPoint) && (NULL != request->_installAddress))
+      {
+      // publish the body before any thread can observe the new entry point
+      VM_AtomicSupport::writeBarrier();
+      *request->_installAddress = entryPoint;
+      }
+
+   if (NULL != request->_callback)
+      request->_callback(request->_method, entryPoint, rc, request->_userData);
+
+   ::operator delete(request, TR::Compiler->persistentAllocator());
+   }
+
+void
+TR::AsyncCompilationService::enqueue(Request *request)
+   {
+   Request **cursor = &_queue;
+   while ((NULL != *cursor)
+          && (((*cursor)->_priority > request->_priority)
+              || (((*cursor)->_priority == request->_priority) && ((*cursor)->_sequence < request->_sequence))))
+      {
+      cursor = &(*cursor)->_next;
+      }
+
+   request->_next = *cursor;
+   *cursor = request;
+   _numQueued += 1;
+   }
+
+void
+TR::AsyncCompilationService::unlink(Request *request)
+   {
+   Request **cursor = &_queue;
+   while (*cursor != request)
+      cursor = &(*cursor)->_next;
+
+   *cursor = request->_next;
+   request->_next = NULL;
+   _numQueued -= 1;
+   }
+
+TR::AsyncCompilationService::Request *
+TR::AsyncCompilationService::findQueued(TR_ResolvedMethod *method)
+   {
+   for (Request *cursor = _queue; NULL != cursor; cursor = cursor->_next)
+      {
+      if (cursor->_method == method)
+         return cursor;
+      }
+   return NULL;
+   }
+
+bool
+TR::AsyncCompilationService::isActive(TR_ResolvedMethod *method)
+   {
+   for (uint32_t i = 0; i < _numThreads; i++)
+      {
+      if (_slots[i]._active == method)
+         return true;
+      }
+   return false;
+   }
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef ASYNC_COMPILATION_SERVICE_INCL
+#define ASYNC_COMPILATION_SERVICE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "omrthread.h"
+
+class TR_ResolvedMethod;
+
+namespace TR
+{
+
+/**
+ * @brief Compiles methods on a pool of background compilation threads.
+ *
+ * Requests are kept in a single queue ordered by priority (highest first,
+ * FIFO among equal priorities) and are compiled through
+ * compileMethodFromDetails() on one of the service's omrthreads, so the
+ * submitting thread never runs the optimizer or code generator itself.
+ *
+ * A method that is already queued or being compiled is not queued a
+ * second time: the duplicate submission only raises the priority of the
+ * pending request. Once a compilation finishes the entry point is stored
+ * to the requester's install address (if any) and the completion callback
+ * is invoked on the compilation thread.
+ *
+ * All public functions must be called from threads attached to the
+ * thread library. The service must be shut down before the JIT itself is
+ * shut down, and the compilee must stay alive until its completion
+ * callback has run.
+ */
+class AsyncCompilationService
+   {
+   public:
+
+   /**
+    * @brief Called on a compilation thread when a request completes.
+    *
+    * @param method the method that was compiled
+    * @param entryPoint the entry point of the compiled body, or NULL on failure
+    * @param rc the compilation return code (see CompilationReturnCodes);
+    *        COMPILATION_REQUESTED if the request was discarded at shutdown
+    * @param userData the value passed to submit()
+    */
+   typedef void (*CompletionCallback)(TR_ResolvedMethod *method, uint8_t *entryPoint, int32_t rc, void *userData);
+
+   enum SubmitResult
+      {
+      Queued,     ///< a new request was queued
+      Duplicate,  ///< the method is already queued or being compiled
+      Rejected    ///< the service is not running or out of memory
+      };
+
+   /**
+    * @param numThreads the number of compilation threads to start; at least
+    *        one thread is always used, and exactly one on platforms where
+    *        the current compilation is not thread local
+    */
+   AsyncCompilationService(uint32_t numThreads = 1);
+   ~AsyncCompilationService();
+
+   /**
+    * @brief Create the monitor and start the compilation threads.
+    *
+    * Requests may be submitted after startup() has returned true. Until the
+    * first compilation thread runs, submitted requests simply accumulate.
+    *
+    * @return true on success, false if the calling thread is not attached
+    *         or the monitor or a thread could not be created (any started
+    *         threads are stopped again)
+    */
+   bool startup();
+
+   /**
+    * @brief Stop accepting requests and wait for the compilation threads.
+    *
+    * Compilations that are in progress run to completion; requests still in
+    * the queue are discarded and their callbacks invoked with a NULL entry
+    * point and COMPILATION_REQUESTED.
+    */
+   void shutdown();
+
+   /**
+    * @brief Queue a method for compilation.
+    *
+    * @param method the method to compile; also the deduplication key
+    * @param hotness the optimization level to compile at
+    * @param priority higher values are compiled first
+    * @param callback invoked once the request completes; may be NULL
+    * @param userData passed through to the callback
+    * @param installAddress if non-NULL, receives the entry point on success
+    *        before the callback runs
+    */
+   SubmitResult submit(
+         TR_ResolvedMethod *method,
+         TR_Hotness hotness,
+         int32_t priority,
+         CompletionCallback callback,
+         void *userData = NULL,
+         void * volatile *installAddress = NULL);
+
+   /**
+    * @brief Block until the queue is empty and no compilation is running.
+    */
+   void waitForIdle();
+
+   uint32_t getNumThreads() { return _numThreads; }
+   uint32_t getNumQueued();
+   uint64_t getNumCompleted() { return _numCompleted; }
+   uint64_t getNumDuplicates() { return _numDuplicates; }
+
+   private:
+
+   struct Request
+      {
+      Request *_next;
+      TR_ResolvedMethod *_method;
+      TR_Hotness _hotness;
+      int32_t _priority;
+      uint64_t _sequence;
+      CompletionCallback _callback;
+      void *_userData;
+      void * volatile *_installAddress;
+      };
+
+   struct ThreadSlot
+      {
+      AsyncCompilationService *_service;
+      omrthread_t _thread;
+      TR_ResolvedMethod *_active;   ///< method being compiled, NULL when idle
+      };
+
+   static const uint32_t MAX_THREADS = 16;
+   static const uintptr_t COMPILATION_THREAD_STACK_SIZE = 4 * 1024 * 1024;
+
+   static int J9THREAD_PROC compilationThreadProc(void *arg);
+
+   void run(ThreadSlot *slot);
+   void compile(Request *request);
+   void complete(Request *request, uint8_t *entryPoint, int32_t rc);
+   void enqueue(Request *request);
+   void unlink(Request *request);
+   Request *findQueued(TR_ResolvedMethod *method);
+   bool isActive(TR_ResolvedMethod *method);
+   void stopThreads(uint32_t numStarted);
+
+   omrthread_monitor_t _monitor;
+   ThreadSlot _slots[MAX_THREADS];
+   uint32_t _numThreads;
+   uint32_t _numActive;
+   Request *_queue;
+   uint32_t _numQueued;
+   uint64_t _sequence;
+   uint64_t _numCompleted;
+   uint64_t _numDuplicates;
+   bool _running;
+   bool _shuttingDown;
+   };
+
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "codegen/CodeGenerator.hpp"
+#include "codegen/Instruction.hpp"
 #include "env/FrontEnd.hpp"
 #include "codegen/LinkageConventionsEnum.hpp"
 #include "compile/Compilation.hpp"
@@ -59,67 +60,51 @@
 #include "env/DebugSegmentProvider.hpp"
 #include "omrformatconsts.h"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeEventPublisher.hpp"
 
 #if defined (_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
 #endif
 
-static void
-writePerfToolEntry(void *start, uint32_t size, const char *name)
+// Collect the line number of each run of instructions in the compiled body,
+// as far as the front end is able to provide them
+static uint32_t
+collectLineNumbers(TR::Compilation &comp, uint8_t *startPC, uint8_t *endPC, TR::CodeEventPublisher::LineEntry *&lines)
    {
-   // race condition
-   static bool firstAttempt = true;
-   static FILE *perfFile = 0;
+   uint32_t numInstructions = 0;
+   for (TR::Instruction *instr = comp.cg()->getFirstInstruction(); instr; instr = instr->getNext())
+      numInstructions++;
 
-   if (firstAttempt)
-      {
-      firstAttempt = false;
-#if defined(OMR_OS_WINDOWS)
-      int jvmPid = _getpid();
-#else
-      pid_t jvmPid = getpid();
-#endif
-      static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
-      char perfFilename[maxPerfFilenameSize] = { 0 };
+   lines = (TR::CodeEventPublisher::LineEntry *)comp.trMemory()->allocateHeapMemory(numInstructions * sizeof(TR::CodeEventPublisher::LineEntry));
 
-      int numCharsWritten = snprintf(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
-      if (numCharsWritten > 0 && numCharsWritten < maxPerfFilenameSize)
-         {
-         perfFile = fopen(perfFilename, "a");
-         }
-      if (!perfFile) // couldn't open the file
-         {
-         }
-      }
-   if (perfFile)
+   uint32_t numLines = 0;
+   int32_t lastLineNumber = -1;
+   for (TR::Instruction *instr = comp.cg()->getFirstInstruction(); instr; instr = instr->getNext())
       {
-      // perf does not want 0x leading the hex start address and length of the compiled code region
-      // the rest of the line is considered to be the name of the region
-
-      // j9jit_fprintf(getPerfFile(), "%lX %lX %s_%s\n", (intptr_t) getMetadata()->startPC, getMetadata()->endWarmPC - getMetadata()->startPC,
-      //               getCompilation()->signature(), getCompilation()->getHotnessName(getCompilation()->getMethodHotness()));
-      fprintf(perfFile, "%lX %lX %s\n", (intptr_t) start, (intptr_t) size, name);
-
-      // If there is a cold section, add another line
-      // if (getMetadata()->startColdPC)
-      //    {
-      //    j9jit_fprintf(getPerfFile(), "%lX %lX %s_%s\n", (intptr_t) getMetadata()->startColdPC, getMetadata()->endPC - getMetadata()->startColdPC,
-      //                  TR::comp()()->signature(), getCompilation()->getHotnessName(getCompilation()->getMethodHotness())); // should we change the name of the method?
-      //    }
-      // Flushing degrades performance, but ensures that we have the data
-      // written even if the JVM is abruptly terminated
-      //j9jit_fflush(getPerfFile());
-      fflush(perfFile);
+      uint8_t *pc = instr->getBinaryEncoding();
+      if (!instr->getNode() || pc < startPC || pc >= endPC)
+         continue;
+
+      int32_t lineNumber = comp.getLineNumberInCurrentMethod(instr->getNode());
+      if (lineNumber < 0 || lineNumber == lastLineNumber)
+         continue;
+
+      lines[numLines]._pc = pc;
+      lines[numLines]._lineNumber = lineNumber;
+      numLines++;
+      lastLineNumber = lineNumber;
       }
-   }
-
 
+   return numLines;
+   }
 
 static void
-generatePerfToolEntry(uint8_t *startPC, uint8_t *endPC, const char *sig, const char *hotness)
+publishCompiledMethod(TR::CodeEventPublisher *publisher, TR::Compilation &comp, uint8_t *startPC, uint8_t *endPC)
    {
+   const char *sig = comp.signature();
+   const char *hotness = comp.getHotnessName(comp.getMethodHotness());
    char buffer[1024];
-   char *name;
+   const char *name;
    if (strlen(sig) + 1 + strlen(hotness) + 1 < 1024)
       {
       sprintf(buffer, "%s_%s (compiled code)", sig, hotness);
@@ -128,7 +113,14 @@ generatePerfToolEntry(uint8_t *startPC, uint8_t *endPC, const char *sig, const c
    else
       name = "(compiled code)";
 
-   writePerfToolEntry(startPC, endPC - startPC, name);
+   TR::CodeEventPublisher::LineEntry *lines = NULL;
+   uint32_t numLines = 0;
+   if (publisher->wantsLineNumbers())
+      numLines = collectLineNumbers(comp, startPC, endPC, lines);
+
+   // The front end has no query for the source file of a method, so the
+   // signature stands in for the file the line numbers refer to
+   publisher->publishLoad(startPC, endPC - startPC, name, sig, lines, numLines);
    }
 
 #if defined(TR_TARGET_POWER)
@@ -229,8 +221,9 @@ static bool methodCanBeCompiled(OMR::FrontEnd *fe, TR_ResolvedMethod &method, TR
 void
 registerTrampoline(uint8_t *start, uint32_t size, const char *name)
    {
-   if (TR::Options::getCmdLineOptions()->getOption(TR_PerfTool))
-      writePerfToolEntry(start, size, name);
+   TR::CodeEventPublisher *publisher = OMR::FrontEnd::singleton().codeCacheManager().codeEventPublisher();
+   if (publisher)
+      publisher->publishLoad(start, size, name);
    }
 
 static void
@@ -417,10 +410,12 @@ compileMethodFromDetails(
                   codeCacheManager.registerStaticRelocation(*it);
                   }
                }
-            if (compiler.getOption(TR_PerfTool))
-               {
-               generatePerfToolEntry(startPC, codeGenerator.getCodeEnd(), compiler.signature(), compiler.getHotnessName(compiler.getMethodHotness()));
-               }
+            }
+
+         TR::CodeEventPublisher *publisher = fe.codeCacheManager().codeEventPublisher();
+         if (publisher)
+            {
+            publishCompiledMethod(publisher, compiler, startPC, compiler.cg()->getCodeEnd());
             }
 
          if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
@@ -1001,6 +1001,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"paintAllocatedFrameSlotsFauxObject",   "C\tpaint all slots allocated in method prologue with faux object pointer",    SET_OPTION_BIT(TR_PaintAllocatedFrameSlotsFauxObject), "F"},
    {"paintDataCacheOnFree",     "I\tpaint data cache allocations that are being returned to the pool", SET_OPTION_BIT(TR_PaintDataCacheOnFree), "F"},
    {"paranoidOptCheck",   "O\tcheck the trees and cfgs after every optimization phase", SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F"},
+   {"perfJitDump", "M\tenable writing a perf jitdump file for perf inject", SET_OPTION_BIT(TR_PerfJitDump), "F", NOT_IN_SUBSET },
    {"performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm", SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F"},
    {"perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
    {"poisonDeadSlots",    "O\tpaints all dead slots with deadf00d", SET_OPTION_BIT(TR_PoisonDeadSlots), "F"},
@@ -21,25 +21,669 @@
 
 #include "env/PersistentAllocator.hpp"
 
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "infra/ThreadLocal.hpp"
+
+#if defined(SUPPORTS_THREAD_LOCAL) && !defined(OMR_OS_WINDOWS)
+#include <pthread.h>
+#endif
+
+namespace
+{
+
+/**
+ * Usable sizes of the slab size classes: 16 byte steps up to 128 bytes, then
+ * four classes per power of two up to 1KB.
+ */
+const uint16_t sizeClassBlockSizes[OMR::PersistentAllocator::NUM_SIZE_CLASSES] =
+   {
+     16,  32,  48,  64,  80,  96, 112, 128,
+    160, 192, 224, 256,
+    320, 384, 448, 512,
+    640, 768, 896, 1024
+   };
+
+const size_t MAX_SLAB_BLOCK_SIZE = 1024;
+
+/**
+ * Alignment of every pointer handed out when slabs are in use; matches what
+ * the raw allocator guarantees for any fundamental type.
+ */
+const size_t ALLOCATION_ALIGNMENT = 16;
+
+/**
+ * Every block carries its size class in the word in front of it so that
+ * deallocate() does not depend on the caller's size hint. The header is
+ * padded so that the block behind it stays aligned.
+ */
+const size_t BLOCK_HEADER_SIZE = ALLOCATION_ALIGNMENT;
+
+/**
+ * Offset of the first block in a slab; the Slab link is padded out to it.
+ */
+const size_t SLAB_HEADER_SIZE = ALLOCATION_ALIGNMENT;
+
+volatile uintptr_t nextAllocatorId = 0;
+volatile uintptr_t nextThreadId = 0;
+
+uintptr_t *
+sizeClassWord(void *p)
+   {
+   return static_cast<uintptr_t *>(p) - 1;
+   }
+
+}
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+/*
+ * A thread's cache is only valid for the allocator whose id is recorded next
+ * to it; anything else (including a destroyed allocator) bypasses the cache.
+ */
+tlsDefine(void *, persistentAllocatorThreadCache);
+tlsDefine(void *, persistentAllocatorThreadCacheOwner);
+
+namespace OMR
+{
+void releaseExitingThreadCaches(uintptr_t thread);
+}
+
+namespace
+{
+
+/*
+ * Every slab allocator is on this list so that the caches a thread holds in
+ * any of them can be handed back to their size classes when the thread exits.
+ */
+MUTEX slabAllocatorsLock;
+OMR::PersistentAllocator *slabAllocators = NULL;
+
+/*
+ * The id of the calling thread, used to find the cache an allocator already
+ * holds for it. The key's destructor runs when a thread that has been given
+ * an id exits.
+ */
+#if defined(OMR_OS_WINDOWS)
+DWORD threadIdKey = FLS_OUT_OF_INDEXES;
+
+VOID WINAPI
+threadIdKeyDestructor(PVOID thread)
+   {
+   if (NULL != thread)
+      OMR::releaseExitingThreadCaches(reinterpret_cast<uintptr_t>(thread));
+   }
+
+void
+allocateThreadIdKey()
+   {
+   threadIdKey = FlsAlloc(threadIdKeyDestructor);
+   TR_ASSERT_FATAL(threadIdKey != FLS_OUT_OF_INDEXES, "FlsAlloc failed with GetLastError = %d", GetLastError());
+   }
+
+uintptr_t
+getThreadId()
+   {
+   return reinterpret_cast<uintptr_t>(FlsGetValue(threadIdKey));
+   }
+
+void
+setThreadId(uintptr_t thread)
+   {
+   FlsSetValue(threadIdKey, reinterpret_cast<PVOID>(thread));
+   }
+#else
+pthread_key_t threadIdKey;
+
+extern "C" void
+threadIdKeyDestructor(void *thread)
+   {
+   OMR::releaseExitingThreadCaches(reinterpret_cast<uintptr_t>(thread));
+   }
+
+void
+allocateThreadIdKey()
+   {
+   int rc = pthread_key_create(&threadIdKey, threadIdKeyDestructor);
+   TR_ASSERT_FATAL(rc == 0, "pthread_key_create failed with rc = %d", rc);
+   }
+
+uintptr_t
+getThreadId()
+   {
+   return reinterpret_cast<uintptr_t>(pthread_getspecific(threadIdKey));
+   }
+
+void
+setThreadId(uintptr_t thread)
+   {
+   pthread_setspecific(threadIdKey, reinterpret_cast<void *>(thread));
+   }
+#endif
+
+enum
+   {
+   THREAD_LOCALS_UNALLOCATED = 0,
+   THREAD_LOCALS_ALLOCATING,
+   THREAD_LOCALS_ALLOCATED
+   };
+
+volatile uintptr_t threadLocalsState = THREAD_LOCALS_UNALLOCATED;
+
+/**
+ * Allocate the thread local keys exactly once, however many allocators are
+ * being constructed concurrently.
+ */
+void
+allocateThreadLocals()
+   {
+   if (THREAD_LOCALS_ALLOCATED == threadLocalsState)
+      {
+      VM_AtomicSupport::readBarrier();
+      return;
+      }
+
+   if (THREAD_LOCALS_UNALLOCATED == VM_AtomicSupport::lockCompareExchange(&threadLocalsState, THREAD_LOCALS_UNALLOCATED, THREAD_LOCALS_ALLOCATING))
+      {
+      tlsAlloc(persistentAllocatorThreadCache);
+      tlsAlloc(persistentAllocatorThreadCacheOwner);
+      allocateThreadIdKey();
+      MUTEX_INIT(slabAllocatorsLock);
+      VM_AtomicSupport::writeBarrier();
+      threadLocalsState = THREAD_LOCALS_ALLOCATED;
+      return;
+      }
+
+   while (THREAD_LOCALS_ALLOCATED != threadLocalsState)
+      VM_AtomicSupport::yieldCPU();
+   VM_AtomicSupport::readBarrier();
+   }
+
+}
+
+void
+OMR::releaseExitingThreadCaches(uintptr_t thread)
+   {
+   MUTEX_ENTER(slabAllocatorsLock);
+   for (PersistentAllocator *allocator = slabAllocators; allocator; allocator = allocator->_nextSlabAllocator)
+      allocator->releaseThreadCache(thread);
+   MUTEX_EXIT(slabAllocatorsLock);
+   }
+#endif
+
 OMR::PersistentAllocator::PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit) :
-   _rawAllocator(allocatorKit.rawAllocator)
+   _rawAllocator(allocatorKit.rawAllocator),
+   _useSlabs(allocatorKit.useSlabAllocator),
+   _id(0),
+   _largeBlocks(NULL),
+   _largeCount(0),
+   _largeBytes(0),
+   _threadCaches(NULL),
+   _nextSlabAllocator(NULL)
+   {
+   if (!_useSlabs)
+      return;
+
+   _id = VM_AtomicSupport::add(&nextAllocatorId, 1);
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+   allocateThreadLocals();
+#endif
+
+   uint32_t sizeClass = 0;
+   for (size_t i = 0; i < sizeof(_sizeClassIndex) / sizeof(_sizeClassIndex[0]); ++i)
+      {
+      while (sizeClassBlockSizes[sizeClass] < i * SIZE_CLASS_GRANULE)
+         sizeClass++;
+      _sizeClassIndex[i] = static_cast<uint8_t>(sizeClass);
+      }
+
+   for (uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+      {
+      SizeClass &sc = _sizeClasses[i];
+      MUTEX_INIT(sc.lock);
+      sc.freeList = NULL;
+      sc.slabs = NULL;
+      sc.blockSize = sizeClassBlockSizes[i];
+      sc.slabCount = 0;
+      sc.blockCount = 0;
+      sc.freeCount = 0;
+      }
+
+   MUTEX_INIT(_largeLock);
+   MUTEX_INIT(_threadCacheLock);
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+   MUTEX_ENTER(slabAllocatorsLock);
+   _nextSlabAllocator = slabAllocators;
+   slabAllocators = this;
+   MUTEX_EXIT(slabAllocatorsLock);
+#endif
+   }
+
+OMR::PersistentAllocator::~PersistentAllocator() throw()
    {
+   if (!_useSlabs)
+      return;
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+   // Once off the list, exiting threads no longer hand caches back to us.
+   //
+   MUTEX_ENTER(slabAllocatorsLock);
+   PersistentAllocator **link = &slabAllocators;
+   while (*link != this)
+      link = &(*link)->_nextSlabAllocator;
+   *link = _nextSlabAllocator;
+   MUTEX_EXIT(slabAllocatorsLock);
+#endif
+
+   // Everything is released in bulk; individual blocks are never walked.
+   //
+   for (uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+      {
+      SizeClass &sc = _sizeClasses[i];
+      Slab *slab = sc.slabs;
+      while (slab)
+         {
+         Slab *next = slab->next;
+         _rawAllocator.deallocate(slab, SLAB_SIZE);
+         slab = next;
+         }
+      MUTEX_DESTROY(sc.lock);
+      }
+
+   LargeBlock *large = _largeBlocks;
+   while (large)
+      {
+      LargeBlock *next = large->next;
+      _rawAllocator.deallocate(large, large->size);
+      large = next;
+      }
+   MUTEX_DESTROY(_largeLock);
+
+   ThreadCache *cache = _threadCaches;
+   while (cache)
+      {
+      ThreadCache *next = cache->next;
+      _rawAllocator.deallocate(cache, sizeof(ThreadCache));
+      cache = next;
+      }
+   MUTEX_DESTROY(_threadCacheLock);
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+   if (tlsGet(persistentAllocatorThreadCacheOwner, void *) == reinterpret_cast<void *>(_id))
+      {
+      tlsSet(persistentAllocatorThreadCache, NULL);
+      tlsSet(persistentAllocatorThreadCacheOwner, NULL);
+      }
+#endif
    }
 
 void *
 OMR::PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void * hint) throw()
    {
+   if (_useSlabs)
+      return allocateFromSlabs(size);
    return _rawAllocator.allocate(size, tag, hint);
    }
 
 void *
 OMR::PersistentAllocator::allocate(size_t size, void * hint)
    {
+   if (_useSlabs)
+      {
+      void * const alloc = allocateFromSlabs(size);
+      if (!alloc) throw std::bad_alloc();
+      return alloc;
+      }
    return _rawAllocator.allocate(size, hint);
    }
 
 void
 OMR::PersistentAllocator::deallocate(void * p, const size_t sizeHint) throw()
    {
+   if (_useSlabs)
+      {
+      if (p)
+         deallocateToSlabs(p);
+      return;
+      }
    _rawAllocator.deallocate(p, sizeHint);
    }
+
+OMR::PersistentAllocator::ThreadCache *
+OMR::PersistentAllocator::threadCache() throw()
+   {
+#if defined(SUPPORTS_THREAD_LOCAL)
+   if (tlsGet(persistentAllocatorThreadCacheOwner, void *) == reinterpret_cast<void *>(_id))
+      return static_cast<ThreadCache *>(tlsGet(persistentAllocatorThreadCache, void *));
+
+   uintptr_t thread = getThreadId();
+   if (0 == thread)
+      {
+      thread = VM_AtomicSupport::add(&nextThreadId, 1);
+      setThreadId(thread);
+      }
+
+   // The thread has been using another allocator since it last came here;
+   // pick its existing cache back up rather than stranding the blocks in it.
+   //
+   ThreadCache *cache = findThreadCache(thread);
+   if (!cache)
+      {
+      cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+      if (!cache)
+         return NULL;
+      memset(cache, 0, sizeof(ThreadCache));
+      cache->thread = thread;
+
+      MUTEX_ENTER(_threadCacheLock);
+      cache->next = _threadCaches;
+      _threadCaches = cache;
+      MUTEX_EXIT(_threadCacheLock);
+      }
+
+   tlsSet(persistentAllocatorThreadCache, cache);
+   tlsSet(persistentAllocatorThreadCacheOwner, reinterpret_cast<void *>(_id));
+   return cache;
+#else
+   return NULL;
+#endif
+   }
+
+void *
+OMR::PersistentAllocator::allocateFromSlabs(size_t size) throw()
+   {
+   if (size > MAX_SLAB_BLOCK_SIZE)
+      return allocateLarge(size);
+
+   uint32_t sizeClass = _sizeClassIndex[(size + SIZE_CLASS_GRANULE - 1) / SIZE_CLASS_GRANULE];
+   FreeBlock *block = NULL;
+
+   ThreadCache *cache = threadCache();
+   if (cache)
+      {
+      if (!cache->freeList[sizeClass]
+          && !refillFromSizeClass(sizeClass, THREAD_CACHE_BATCH, &cache->freeList[sizeClass], &cache->count[sizeClass]))
+         return NULL;
+      block = cache->freeList[sizeClass];
+      cache->freeList[sizeClass] = block->next;
+      cache->count[sizeClass]--;
+      }
+   else
+      {
+      uint32_t count = 0;
+      if (!refillFromSizeClass(sizeClass, 1, &block, &count))
+         return NULL;
+      }
+
+   void *p = reinterpret_cast<uint8_t *>(block) + BLOCK_HEADER_SIZE;
+   *sizeClassWord(p) = sizeClass;
+   return p;
+   }
+
+void
+OMR::PersistentAllocator::deallocateToSlabs(void *p) throw()
+   {
+   uintptr_t sizeClass = *sizeClassWord(p);
+   if (sizeClass >= NUM_SIZE_CLASSES)
+      {
+      deallocateLarge(static_cast<LargeBlock *>(p) - 1);
+      return;
+      }
+
+   FreeBlock *block = reinterpret_cast<FreeBlock *>(static_cast<uint8_t *>(p) - BLOCK_HEADER_SIZE);
+   ThreadCache *cache = threadCache();
+   if (!cache)
+      {
+      block->next = NULL;
+      releaseToSizeClass(static_cast<uint32_t>(sizeClass), block, 1);
+      return;
+      }
+
+   block->next = cache->freeList[sizeClass];
+   cache->freeList[sizeClass] = block;
+   if (++cache->count[sizeClass] >= THREAD_CACHE_LIMIT)
+      {
+      // Hand the older half back in one batch so that a thread that only
+      // frees does not hoard memory other threads could use.
+      //
+      FreeBlock *last = block;
+      for (size_t i = 1; i < THREAD_CACHE_LIMIT - THREAD_CACHE_BATCH; ++i)
+         last = last->next;
+      FreeBlock *released = last->next;
+      last->next = NULL;
+      cache->count[sizeClass] -= THREAD_CACHE_BATCH;
+      releaseToSizeClass(static_cast<uint32_t>(sizeClass), released, THREAD_CACHE_BATCH);
+      }
+   }
+
+bool
+OMR::PersistentAllocator::refillFromSizeClass(uint32_t sizeClass, uint32_t maxBlocks, FreeBlock **head, uint32_t *count) throw()
+   {
+   SizeClass &sc = _sizeClasses[sizeClass];
+   MUTEX_ENTER(sc.lock);
+
+   if (!sc.freeList)
+      {
+      Slab *slab = static_cast<Slab *>(_rawAllocator.allocate(SLAB_SIZE, std::nothrow));
+      if (!slab)
+         {
+         MUTEX_EXIT(sc.lock);
+         return false;
+         }
+      slab->next = sc.slabs;
+      sc.slabs = slab;
+      sc.slabCount++;
+
+      size_t stride = BLOCK_HEADER_SIZE + sc.blockSize;
+      size_t blocks = (SLAB_SIZE - SLAB_HEADER_SIZE) / stride;
+      uint8_t *cursor = reinterpret_cast<uint8_t *>(slab) + SLAB_HEADER_SIZE + (blocks - 1) * stride;
+      FreeBlock *freeList = NULL;
+      for (size_t i = 0; i < blocks; ++i, cursor -= stride)
+         {
+         FreeBlock *block = reinterpret_cast<FreeBlock *>(cursor);
+         block->next = freeList;
+         freeList = block;
+         }
+      sc.freeList = freeList;
+      sc.blockCount += blocks;
+      sc.freeCount += blocks;
+      }
+
+   FreeBlock *first = sc.freeList;
+   FreeBlock *last = first;
+   uint32_t taken = 1;
+   while (taken < maxBlocks && last->next)
+      {
+      last = last->next;
+      taken++;
+      }
+   sc.freeList = last->next;
+   sc.freeCount -= taken;
+
+   MUTEX_EXIT(sc.lock);
+
+   last->next = *head;
+   *head = first;
+   *count += taken;
+   return true;
+   }
+
+void
+OMR::PersistentAllocator::releaseToSizeClass(uint32_t sizeClass, FreeBlock *head, uint32_t count) throw()
+   {
+   FreeBlock *last = head;
+   while (last->next)
+      last = last->next;
+
+   SizeClass &sc = _sizeClasses[sizeClass];
+   MUTEX_ENTER(sc.lock);
+   last->next = sc.freeList;
+   sc.freeList = head;
+   sc.freeCount += count;
+   MUTEX_EXIT(sc.lock);
+   }
+
+void *
+OMR::PersistentAllocator::allocateLarge(size_t size) throw()
+   {
+   size_t allocSize = sizeof(LargeBlock) + size;
+   LargeBlock *block = static_cast<LargeBlock *>(_rawAllocator.allocate(allocSize, std::nothrow));
+   if (!block)
+      return NULL;
+   block->size = allocSize;
+   block->sizeClass = NUM_SIZE_CLASSES;
+   block->prev = NULL;
+
+   MUTEX_ENTER(_largeLock);
+   block->next = _largeBlocks;
+   if (_largeBlocks)
+      _largeBlocks->prev = block;
+   _largeBlocks = block;
+   _largeCount++;
+   _largeBytes += allocSize;
+   MUTEX_EXIT(_largeLock);
+
+   return block + 1;
+   }
+
+void
+OMR::PersistentAllocator::deallocateLarge(LargeBlock *block) throw()
+   {
+   MUTEX_ENTER(_largeLock);
+   if (block->prev)
+      block->prev->next = block->next;
+   else
+      _largeBlocks = block->next;
+   if (block->next)
+      block->next->prev = block->prev;
+   _largeCount--;
+   _largeBytes -= block->size;
+   MUTEX_EXIT(_largeLock);
+
+   _rawAllocator.deallocate(block, block->size);
+   }
+
+OMR::PersistentAllocator::ThreadCache *
+OMR::PersistentAllocator::findThreadCache(uintptr_t thread) throw()
+   {
+   MUTEX_ENTER(_threadCacheLock);
+   ThreadCache *cache = _threadCaches;
+   while (cache && cache->thread != thread)
+      cache = cache->next;
+   MUTEX_EXIT(_threadCacheLock);
+   return cache;
+   }
+
+void
+OMR::PersistentAllocator::releaseCachedBlocks(ThreadCache *cache) throw()
+   {
+   for (uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+      {
+      if (cache->freeList[i])
+         {
+         releaseToSizeClass(i, cache->freeList[i], cache->count[i]);
+         cache->freeList[i] = NULL;
+         cache->count[i] = 0;
+         }
+      }
+   }
+
+void
+OMR::PersistentAllocator::releaseThreadCache(uintptr_t thread) throw()
+   {
+   MUTEX_ENTER(_threadCacheLock);
+   ThreadCache **link = &_threadCaches;
+   while (*link && (*link)->thread != thread)
+      link = &(*link)->next;
+   ThreadCache *cache = *link;
+   if (cache)
+      *link = cache->next;
+   MUTEX_EXIT(_threadCacheLock);
+
+   if (cache)
+      {
+      releaseCachedBlocks(cache);
+      _rawAllocator.deallocate(cache, sizeof(ThreadCache));
+      }
+   }
+
+void
+OMR::PersistentAllocator::flushThreadCache() throw()
+   {
+#if defined(SUPPORTS_THREAD_LOCAL)
+   if (!_useSlabs)
+      return;
+
+   ThreadCache *cache = NULL;
+   if (tlsGet(persistentAllocatorThreadCacheOwner, void *) == reinterpret_cast<void *>(_id))
+      {
+      cache = static_cast<ThreadCache *>(tlsGet(persistentAllocatorThreadCache, void *));
+      }
+   else
+      {
+      uintptr_t thread = getThreadId();
+      if (0 != thread)
+         cache = findThreadCache(thread);
+      }
+
+   if (cache)
+      releaseCachedBlocks(cache);
+#endif
+   }
+
+size_t
+OMR::PersistentAllocator::getSizeClassStatistics(SizeClassStatistics *stats, size_t *largeBlocks, size_t *largeBytes)
+   {
+   if (!_useSlabs)
+      return 0;
+
+   for (uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+      {
+      SizeClass &sc = _sizeClasses[i];
+      MUTEX_ENTER(sc.lock);
+      stats[i].blockSize = sc.blockSize;
+      stats[i].slabs = sc.slabCount;
+      stats[i].blocks = sc.blockCount;
+      stats[i].blocksInUse = sc.blockCount - sc.freeCount;
+      MUTEX_EXIT(sc.lock);
+      }
+
+   if (largeBlocks || largeBytes)
+      {
+      MUTEX_ENTER(_largeLock);
+      if (largeBlocks)
+         *largeBlocks = _largeCount;
+      if (largeBytes)
+         *largeBytes = _largeBytes;
+      MUTEX_EXIT(_largeLock);
+      }
+
+   return NUM_SIZE_CLASSES;
+   }
+
+void
+OMR::PersistentAllocator::printSizeClassStatistics(FILE *file)
+   {
+   SizeClassStatistics stats[NUM_SIZE_CLASSES];
+   size_t largeBlocks = 0;
+   size_t largeBytes = 0;
+   size_t classes = getSizeClassStatistics(stats, &largeBlocks, &largeBytes);
+
+   fprintf(file, "Persistent allocator size classes:\n");
+   fprintf(file, "%10s %8s %10s %10s %8s\n", "blockSize", "slabs", "blocks", "inUse", "occ%");
+   for (size_t i = 0; i < classes; ++i)
+      {
+      if (stats[i].blocks == 0)
+         continue;
+      fprintf(file, "%10llu %8llu %10llu %10llu %7.1f%%\n",
+              (unsigned long long)stats[i].blockSize,
+              (unsigned long long)stats[i].slabs,
+              (unsigned long long)stats[i].blocks,
+              (unsigned long long)stats[i].blocksInUse,
+              100.0 * stats[i].blocksInUse / stats[i].blocks);
+      }
+   fprintf(file, "Large allocations: %llu (%llu bytes)\n",
+           (unsigned long long)largeBlocks,
+           (unsigned long long)largeBytes);
+   }
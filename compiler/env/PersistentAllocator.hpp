@@ -34,9 +34,11 @@ namespace TR { using OMR::PersistentAllocator; }
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #include "env/RawAllocator.hpp"
 #include "env/PersistentAllocatorKit.hpp"
+#include "omrmutex.h"
 
 namespace OMR {
 
@@ -44,13 +46,55 @@ class PersistentAllocator
    {
 public:
    PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit);
+   ~PersistentAllocator() throw();
 
    void *allocate(size_t size, const std::nothrow_t tag, void * hint = 0) throw();
    void * allocate(size_t size, void * hint = 0);
    void deallocate(void * p, const size_t sizeHint = 0) throw();
 
+   /**
+    * Number of segregated size classes used when the slab allocator is enabled.
+    * Requests larger than the biggest class go directly to the raw allocator.
+    */
+   static const size_t NUM_SIZE_CLASSES = 20;
+
+   struct SizeClassStatistics
+      {
+      size_t blockSize;    ///< usable bytes per block in this class
+      size_t slabs;        ///< slabs obtained from the raw allocator
+      size_t blocks;       ///< blocks carved out of those slabs
+      size_t blocksInUse;  ///< blocks handed out, including those parked in per-thread caches
+      };
+
+   bool usesSlabs() const { return _useSlabs; }
+
+   /**
+    * Report the occupancy of each size class.
+    *
+    * @param[out] stats array of at least NUM_SIZE_CLASSES entries
+    * @param[out] largeBlocks number of live allocations served by the raw allocator
+    * @param[out] largeBytes bytes held by those allocations
+    * @return the number of entries filled in; 0 if slabs are not in use
+    */
+   size_t getSizeClassStatistics(SizeClassStatistics *stats, size_t *largeBlocks = NULL, size_t *largeBytes = NULL);
+   void printSizeClassStatistics(FILE *file);
+
+   /**
+    * Return the blocks cached by the calling thread to the shared size class
+    * free lists. This happens by itself when the thread exits; threads that
+    * stop allocating persistent memory but keep running should call this so
+    * their cached blocks can be reused by others.
+    */
+   void flushThreadCache() throw();
+
+   /**
+    * Slab allocators only take back blocks they handed out, so they are only
+    * equal to themselves, even when they share a raw allocator.
+    */
    friend bool operator ==(const PersistentAllocator &left, const PersistentAllocator &right)
       {
+      if (left._useSlabs || right._useSlabs)
+         return &left == &right;
       return left._rawAllocator == right._rawAllocator;
       }
 
@@ -62,8 +106,81 @@ public:
 private:
    PersistentAllocator(const PersistentAllocator &);
 
+   struct FreeBlock
+      {
+      FreeBlock *next;
+      };
+
+   struct Slab
+      {
+      Slab *next;
+      };
+
+   /**
+    * Header in front of allocations that bypass the slabs so that they can
+    * all be released together when the allocator is destroyed. Its size is a
+    * multiple of 16 bytes and sizeClass is its last word, where
+    * deallocate() looks for the size class of any block.
+    */
+   struct LargeBlock
+      {
+      LargeBlock *prev;
+      LargeBlock *next;
+      size_t size;
+      uintptr_t sizeClass;
+      };
+
+   struct SizeClass
+      {
+      MUTEX lock;
+      FreeBlock *freeList;
+      Slab *slabs;
+      size_t blockSize;
+      size_t slabCount;
+      size_t blockCount;
+      size_t freeCount;
+      };
+
+   struct ThreadCache
+      {
+      ThreadCache *next;
+      uintptr_t thread;
+      FreeBlock *freeList[NUM_SIZE_CLASSES];
+      uint32_t count[NUM_SIZE_CLASSES];
+      };
+
+   static const size_t SLAB_SIZE = 64 * 1024;
+   static const size_t SIZE_CLASS_GRANULE = 16;
+   static const size_t THREAD_CACHE_BATCH = 16;
+   static const size_t THREAD_CACHE_LIMIT = 2 * THREAD_CACHE_BATCH;
+
+   void *allocateFromSlabs(size_t size) throw();
+   void deallocateToSlabs(void *p) throw();
+   void *allocateLarge(size_t size) throw();
+   void deallocateLarge(LargeBlock *block) throw();
+   bool refillFromSizeClass(uint32_t sizeClass, uint32_t maxBlocks, FreeBlock **head, uint32_t *count) throw();
+   void releaseToSizeClass(uint32_t sizeClass, FreeBlock *head, uint32_t count) throw();
+   ThreadCache *threadCache() throw();
+   ThreadCache *findThreadCache(uintptr_t thread) throw();
+   void releaseCachedBlocks(ThreadCache *cache) throw();
+   void releaseThreadCache(uintptr_t thread) throw();
+
+   friend void releaseExitingThreadCaches(uintptr_t thread);
+
    TR::RawAllocator _rawAllocator;
 
+   bool _useSlabs;
+   uintptr_t _id;
+   uint8_t _sizeClassIndex[(1024 / SIZE_CLASS_GRANULE) + 1];
+   SizeClass _sizeClasses[NUM_SIZE_CLASSES];
+   MUTEX _largeLock;
+   LargeBlock *_largeBlocks;
+   size_t _largeCount;
+   size_t _largeBytes;
+   MUTEX _threadCacheLock;
+   ThreadCache *_threadCaches;
+   PersistentAllocator *_nextSlabAllocator;
+
    };
 
 }
@@ -38,12 +38,20 @@ namespace OMR
 
 struct PersistentAllocatorKit
    {
-   PersistentAllocatorKit(TR::RawAllocator rawAllocator) :
-      rawAllocator(rawAllocator)
+   PersistentAllocatorKit(TR::RawAllocator rawAllocator, bool useSlabAllocator = false) :
+      rawAllocator(rawAllocator),
+      useSlabAllocator(useSlabAllocator)
       {
       }
 
    TR::RawAllocator rawAllocator;
+
+   /**
+    * When set, small persistent allocations are carved out of segregated
+    * size-class slabs with per-thread caches instead of going to the raw
+    * allocator one at a time.
+    */
+   bool useSlabAllocator;
    };
 
 }
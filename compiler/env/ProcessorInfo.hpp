@@ -184,6 +184,7 @@ enum TR_X86ProcessorFeatures8
 inline uint32_t getFeatureFlags8Mask()
    {
    return  TR_HLE
+         | TR_AVX2
          | TR_RTM;
    }
 
@@ -35,6 +35,9 @@ namespace TR
          MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState)
             : OMR::MethodBuilder(types, vmState)
             { }
+         MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState, TR::JitBuilderRecorder *recorder)
+            : OMR::MethodBuilder(types, vmState, recorder)
+            { }
          MethodBuilder(TR::MethodBuilder *callerMB)
             : OMR::MethodBuilder(callerMB)
             { }
@@ -28,6 +28,8 @@
 #include "ilgen/IlBuilder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
+#include "ilgen/StatementNames.hpp"
 #include "ilgen/TypeDictionary.hpp"
 
 // should really move into IlInjector.hpp
@@ -51,6 +53,11 @@ OMR::BytecodeBuilder::BytecodeBuilder(TR::MethodBuilder *methodBuilder,
    initialize(methodBuilder->details(), methodBuilder->methodSymbol(),
               methodBuilder->fe(), methodBuilder->symRefTab());
    initSequence();
+
+   // bytecode builders carry VM state and successor links that replay cannot rebuild
+   TR::JitBuilderRecorder::ServiceScope scope(methodBuilder->recorder());
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->UnsupportedStatement(methodBuilder, StatementName::STATEMENT_NEWBYTECODEBUILDER);
    }
 
 /**
@@ -44,6 +44,8 @@
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlReference.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "infra/Cfg.hpp"
@@ -54,6 +56,57 @@
 #define TraceEnabled    (comp()->getOption(TR_TraceILGen))
 #define TraceIL(m, ...) {if (TraceEnabled) {traceMsg(comp(), m, ##__VA_ARGS__);}}
 
+// Helpers for recording the common statement shapes; each writes the complete
+// statement for a service that has already been carried out on builder b.
+
+static void
+recordValueOp(TR::JitBuilderRecorder *rec, TR::IlBuilder *b, const char *s, TR::IlValue *result, TR::IlValue *left, TR::IlValue *right = NULL)
+   {
+   rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Value(left);
+   if (right)
+      rec->Value(right);
+   rec->EndStatement();
+   }
+
+static void
+recordTypedValueOp(TR::JitBuilderRecorder *rec, TR::IlBuilder *b, const char *s, TR::IlValue *result, TR::IlType *type, TR::IlValue *v)
+   {
+   rec->EnsureTypeDefined(type);
+   rec->EnsureAvailableID(result);
+   rec->BeginStatement(b, s);
+   rec->Value(result);
+   rec->Type(type);
+   rec->Value(v);
+   rec->EndStatement();
+   }
+
+static void
+recordBranch(TR::JitBuilderRecorder *rec, TR::IlBuilder *b, const char *s, TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right = NULL)
+   {
+   rec->BeginStatement(b, s);
+   rec->Builder(target);
+   rec->Value(left);
+   if (right)
+      rec->Value(right);
+   rec->EndStatement();
+   }
+
+static void
+recordTransaction(TR::JitBuilderRecorder *rec, TR::IlBuilder *b, TR::IlBuilder **persistentFailureBuilder, TR::IlBuilder **transientFailureBuilder, TR::IlBuilder **transactionBuilder)
+   {
+   rec->EnsureAvailableID(*persistentFailureBuilder);
+   rec->EnsureAvailableID(*transientFailureBuilder);
+   rec->EnsureAvailableID(*transactionBuilder);
+   rec->BeginStatement(b, OMR::StatementName::STATEMENT_TRANSACTION);
+   rec->Builder(*persistentFailureBuilder);
+   rec->Builder(*transientFailureBuilder);
+   rec->Builder(*transactionBuilder);
+   rec->EndStatement();
+   }
+
 
 // IlBuilder is a class designed to help build Testarossa IL quickly without
 // a lot of knowledge of the intricacies of commoned references, symbols,
@@ -116,6 +169,18 @@ OMR::IlBuilder::TraceIL_log(const char* s, ...){
     va_end(argp);
 }
 
+TR::IlBuilder *
+OMR::IlBuilder::self()
+   {
+   return static_cast<TR::IlBuilder *>(this);
+   }
+
+TR::JitBuilderRecorder *
+OMR::IlBuilder::recorder()
+   {
+   return _methodBuilder->recorder();
+   }
+
 void
 OMR::IlBuilder::initSequence()
    {
@@ -259,6 +324,7 @@ OMR::IlBuilder::NewValue(TR::IlType *dt)
 TR::IlValue *
 OMR::IlBuilder::Copy(TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::DataType dt = value->getDataType();
    TR::SymbolReference *newSymRef = symRefTab()->createTemporary(_methodSymbol, dt);
    char *name = (char *) _comp->trMemory()->allocateHeapMemory((2+10+1) * sizeof(char)); // 2 ("_T") + max 10 digits + trailing zero
@@ -273,6 +339,9 @@ OMR::IlBuilder::Copy(TR::IlValue *value)
 
    TraceIL("IlBuilder[ %p ]::Copy value (%d) dataType (%d) to newVal (%d) at cpIndex (%d)\n", this, value->getID(), dt, newVal->getID(), newSymRef->getCPIndex());
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_COPY, newVal, value);
+
    return newVal;
    }
 
@@ -479,9 +548,19 @@ OMR::IlBuilder::zeroForValue(TR::IlValue *v)
 TR::IlBuilder *
 OMR::IlBuilder::OrphanBuilder()
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlBuilder *orphan = new (comp()->trHeapMemory()) TR::IlBuilder(_methodBuilder, _types);
    orphan->initialize(_details, _methodSymbol, _fe, _symRefTab);
    orphan->setupForBuildIL();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->StoreID(orphan);
+      rec->BeginStatement(self(), StatementName::STATEMENT_NEWILBUILDER);
+      rec->Builder(orphan);
+      rec->EndStatement();
+      }
+
    return orphan;
    }
 
@@ -546,6 +625,7 @@ OMR::IlBuilder::appendBlock(TR::Block *newBlock, bool addEdge)
 void
 OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(builder->_partOfSequence == false, "builder cannot be in two places");
 
    builder->_partOfSequence = true;
@@ -562,6 +642,13 @@ OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
    // need to add edge explicitly because of this exit block sleight of hand
    appendNoFallThroughBlock();
    cfg()->addEdge(builder->getExit(), _currentBlock);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_APPENDBUILDER);
+      rec->Builder(builder);
+      rec->EndStatement();
+      }
    }
 
 TR::Node *
@@ -620,12 +707,21 @@ OMR::IlBuilder::indirectLoadNode(TR::IlType *dt, TR::Node *addr, bool isVectorLo
 void
 OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    if (!_methodBuilder->symbolDefined(varName))
       _methodBuilder->defineValue(varName, _types->PrimitiveType(value->getDataType()));
    TR::SymbolReference *symRef = lookupSymbol(varName);
 
    TraceIL("IlBuilder[ %p ]::Store %s %d (%d) gets %d\n", this, varName, symRef->getCPIndex(), symRef->getReferenceNumber(), value->getID());
    storeNode(symRef, loadValue(value));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_STORE);
+      rec->String(varName);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -636,8 +732,17 @@ OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
 void
 OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::StoreOver %d gets %d\n", this, dest->getID(), value->getID());
    dest->storeOver(value, _currentBlock);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_STOREOVER);
+      rec->Value(dest);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -650,6 +755,7 @@ OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
 void
 OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *valueNode = loadValue(value);
    TR::DataType dt = valueNode->getDataType();
    if (!dt.isVector())
@@ -664,6 +770,14 @@ OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
 
    TraceIL("IlBuilder[ %p ]::VectorStore %s %d gets %d\n", this, varName, symRef->getCPIndex(), value->getID());
    storeNode(symRef, valueNode);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_VECTORSTORE);
+      rec->String(varName);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -674,10 +788,19 @@ OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
 void
 OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "StoreAt needs an address operand");
 
    TraceIL("IlBuilder[ %p ]::StoreAt address %d gets %d\n", this, address->getID(), value->getID());
    indirectStoreNode(loadValue(address), loadValue(value));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_STOREAT);
+      rec->Value(address);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -689,6 +812,7 @@ OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
 void
 OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "VectorStoreAt needs an address operand");
 
    TraceIL("IlBuilder[ %p ]::VectorStoreAt address %d gets %d\n", this, address->getID(), value->getID());
@@ -699,11 +823,20 @@ OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
       valueNode = TR::Node::create(TR::vsplats, 1, valueNode);
 
    indirectStoreNode(loadValue(address), valueNode);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_VECTORSTOREAT);
+      rec->Value(address);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 TR::IlValue *
 OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    uint32_t size = numElements * elementType->getSize();
    TR::SymbolReference *localArraySymRef = symRefTab()->createLocalPrimArray(size,
                                                                              methodSymbol(),
@@ -718,6 +851,18 @@ OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
    TR::IlValue *arrayAddressValue = newValue(TR::Address, arrayAddress);
 
    TraceIL("IlBuilder[ %p ]::CreateLocalArray array allocated %d bytes, address in %d\n", this, size, arrayAddressValue->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureTypeDefined(elementType);
+      rec->EnsureAvailableID(arrayAddressValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CREATELOCALARRAY);
+      rec->Value(arrayAddressValue);
+      rec->Number(numElements);
+      rec->Type(elementType);
+      rec->EndStatement();
+      }
+
    return arrayAddressValue;
 
    }
@@ -725,6 +870,7 @@ OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
 TR::IlValue *
 OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    //similar to CreateLocalArray except writing a method in StructType to get the struct size
    uint32_t size = structType->getSize();
    TR::SymbolReference *localStructSymRef = symRefTab()->createLocalPrimArray(size,
@@ -740,33 +886,53 @@ OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
    TR::IlValue *structAddressValue = newValue(TR::Address, structAddress);
 
    TraceIL("IlBuilder[ %p ]::CreateLocalStruct struct allocated %d bytes, address in %d\n", this, size, structAddressValue->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->UnsupportedStatement(self(), StatementName::STATEMENT_CREATELOCALSTRUCT);
+
    return structAddressValue;
    }
 
 void
 OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlValue *object, TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlReference *fieldRef = _types->FieldReference(type, field);
    TR::SymbolReference *symRef = fieldRef->symRef();
    TR::DataType fieldType = symRef->getSymbol()->getDataType();
    TraceIL("IlBuilder[ %p ]::StoreIndirect %s.%s (%d) into (%d)\n", this, type, field, value->getID(), object->getID());
    TR::ILOpCodes storeOp = comp()->il.opCodeForIndirectStore(fieldType);
    genTreeTop(TR::Node::createWithSymRef(storeOp, 2, loadValue(object), loadValue(value), 0, symRef));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->UnsupportedStatement(self(), StatementName::STATEMENT_STOREINDIRECT);
    }
 
 TR::IlValue *
 OMR::IlBuilder::Load(const char *name)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::SymbolReference *symRef = lookupSymbol(name);
    TR::Node *valueNode = TR::Node::createLoad(symRef);
    TR::IlValue *returnValue = newValue(symRef->getSymbol()->getDataType(), valueNode);
    TraceIL("IlBuilder[ %p ]::Load %s into %d from symref %d\n", this, name, returnValue->getID(), symRef->getReferenceNumber());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_LOAD);
+      rec->Value(returnValue);
+      rec->String(name);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::VectorLoad(const char *name)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::SymbolReference *nameSymRef = lookupSymbol(name);
    TR::DataType returnType = nameSymRef->getSymbol()->getDataType();
    TR_ASSERT_FATAL(returnType.isVector(), "VectorLoad must load symbol with a vector type");
@@ -775,41 +941,66 @@ OMR::IlBuilder::VectorLoad(const char *name)
    TR::IlValue *returnValue = newValue(returnType, loadNode);
    TraceIL("IlBuilder[ %p ]::%d is VectorLoad %s (%d)\n", this, returnValue->getID(), name, nameSymRef->getCPIndex());
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_VECTORLOAD);
+      rec->Value(returnValue);
+      rec->String(name);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LoadIndirect(const char *type, const char *field, TR::IlValue *object)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlReference *fieldRef = _types->FieldReference(type, field);
    TR::SymbolReference *symRef = fieldRef->symRef();
    TR::DataType fieldType = symRef->getSymbol()->getDataType();
    TR::IlValue *returnValue = newValue(fieldType, TR::Node::createWithSymRef(comp()->il.opCodeForIndirectLoad(fieldType), 1, loadValue(object), 0, symRef));
    TraceIL("IlBuilder[ %p ]::%d is LoadIndirect %s.%s from (%d)\n", this, returnValue->getID(), type, field, object->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->UnsupportedStatement(self(), StatementName::STATEMENT_LOADINDIRECT);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LoadAt(TR::IlType *dt, TR::IlValue *address)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
    TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address));
    TraceIL("IlBuilder[ %p ]::%d is LoadAt type %d address %d\n", this, returnValue->getID(), dt->getPrimitiveType(), address->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTypedValueOp(rec, self(), StatementName::STATEMENT_LOADAT, returnValue, dt, address);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::VectorLoadAt(TR::IlType *dt, TR::IlValue *address)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
    TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address), true);
    TraceIL("IlBuilder[ %p ]::%d is VectorLoadAt type %d address %d\n", this, returnValue->getID(), dt->getPrimitiveType(), address->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTypedValueOp(rec, self(), StatementName::STATEMENT_VECTORLOADAT, returnValue, dt, address);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlType *elemType = dt->baseType();
    TR_ASSERT_FATAL(base->getDataType() == TR::Address, "IndexAt must be called with a pointer base");
    TR_ASSERT_FATAL(elemType != NULL, "IndexAt should be called with pointer type");
@@ -850,6 +1041,18 @@ OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
 
    TraceIL("IlBuilder[ %p ]::%d is IndexAt(%s) base %d index %d\n", this, address->getID(), dt->getName(), base->getID(), index->getID());
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureTypeDefined(dt);
+      rec->EnsureAvailableID(address);
+      rec->BeginStatement(self(), StatementName::STATEMENT_INDEXAT);
+      rec->Value(address);
+      rec->Type(dt);
+      rec->Value(base);
+      rec->Value(index);
+      rec->EndStatement();
+      }
+
    return address;
    }
 
@@ -892,76 +1095,174 @@ OMR::IlBuilder::UnionFieldInstanceAddress(const char* unionName, const char* fie
 TR::IlValue *
 OMR::IlBuilder::NullAddress()
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst(0));
    TraceIL("IlBuilder[ %p ]::%d is NullAddress\n", this, returnValue->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_NULLADDRESS);
+      rec->Value(returnValue);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt8(int8_t value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Int8, TR::Node::bconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt8 %d\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTINT8);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt16(int16_t value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Int16, TR::Node::sconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt16 %d\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTINT16);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt32(int32_t value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Int32, TR::Node::iconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt32 %d\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTINT32);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstInt64(int64_t value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Int64, TR::Node::lconst(value));
    TraceIL("IlBuilder[ %p ]::%d is ConstInt64 %lld\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTINT64);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstFloat(float value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *fconstNode = TR::Node::create(0, TR::fconst, 0);
    fconstNode->setFloat(value);
    TR::IlValue *returnValue = newValue(Float, fconstNode);
    TraceIL("IlBuilder[ %p ]::%d is ConstFloat %f\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTFLOAT);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstDouble(double value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *dconstNode = TR::Node::create(0, TR::dconst, 0);
    dconstNode->setDouble(value);
    TR::IlValue *returnValue = newValue(Double, dconstNode);
    TraceIL("IlBuilder[ %p ]::%d is ConstDouble %lf\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTDOUBLE);
+      rec->Value(returnValue);
+      rec->Number(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstString(const char * const value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
    TraceIL("IlBuilder[ %p ]::%d is ConstString %p\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTSTRING);
+      rec->Value(returnValue);
+      rec->String(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ConstAddress(const void * const value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
    TraceIL("IlBuilder[ %p ]::%d is ConstAddress %p\n", this, returnValue->getID(), value);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CONSTADDRESS);
+      rec->Value(returnValue);
+      rec->Location(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
@@ -980,36 +1281,51 @@ OMR::IlBuilder::ConstInteger(TR::IlType *intType, int64_t value)
 TR::IlValue *
 OMR::IlBuilder::ConvertTo(TR::IlType *t, TR::IlValue *v)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
    if (typeFrom == typeTo)
       {
       TraceIL("IlBuilder[ %p ]::%d is ConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
+      if (TR::JitBuilderRecorder *rec = scope.recorder())
+         recordTypedValueOp(rec, self(), StatementName::STATEMENT_CONVERTTO, v, t, v);
       return v;
       }
    TR::IlValue *convertedValue = convertTo(typeTo, v, false);
    TraceIL("IlBuilder[ %p ]::%d is ConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTypedValueOp(rec, self(), StatementName::STATEMENT_CONVERTTO, convertedValue, t, v);
+
    return convertedValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedConvertTo(TR::IlType *t, TR::IlValue *v)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
    if (typeFrom == typeTo)
       {
       TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
+      if (TR::JitBuilderRecorder *rec = scope.recorder())
+         recordTypedValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDCONVERTTO, v, t, v);
       return v;
       }
    TR::IlValue *convertedValue = convertTo(typeTo, v, true);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTypedValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDCONVERTTO, convertedValue, t, v);
+
    return convertedValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Negate(TR::IlValue *v)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::DataType dataType = v->getDataType();
 
    TR::ILOpCodes negateOp = ILOpCode::negateOpCode(dataType);
@@ -1018,6 +1334,10 @@ OMR::IlBuilder::Negate(TR::IlValue *v)
    TR::Node *result = TR::Node::create(negateOp, 1, loadValue(v));
    TR::IlValue *negatedValue = newValue(dataType, result);
    TraceIL("IlBuilder[ %p ]::%d is Negated %d\n", this, negatedValue->getID(), v->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_NEGATE, negatedValue, v);
+
    return negatedValue;
    }
 
@@ -1037,12 +1357,15 @@ OMR::IlBuilder::convertTo(TR::DataType typeTo, TR::IlValue *v, bool needUnsigned
 TR::IlValue*
 OMR::IlBuilder::ConvertBitsTo(TR::IlType* t, TR::IlValue* v)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::DataType typeFrom = v->getDataType();
    TR::DataType typeTo = t->getPrimitiveType();
 
    if (typeTo == typeFrom)
       {
       TraceIL("IlBuilder[ %p ]::%d is ConvertBitsTo (already has type %s) %d\n", this, v->getID(), t->getName(), v->getID());
+      if (TR::JitBuilderRecorder *rec = scope.recorder())
+         recordTypedValueOp(rec, self(), StatementName::STATEMENT_CONVERTBITSTO, v, t, v);
       return v;
       }
 
@@ -1055,6 +1378,10 @@ OMR::IlBuilder::ConvertBitsTo(TR::IlType* t, TR::IlValue* v)
    TR::Node *result = TR::Node::create(convertOpcode, 1, loadValue(v));
    TR::IlValue *convertedValue = newValue(t, result);
    TraceIL("IlBuilder[ %p ]::%d is CoerceTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTypedValueOp(rec, self(), StatementName::STATEMENT_CONVERTBITSTO, convertedValue, t, v);
+
    return convertedValue;
    }
 
@@ -1175,30 +1502,53 @@ OMR::IlBuilder::compareOp(TR_ComparisonTypes ct,
 TR::IlValue *
 OMR::IlBuilder::NotEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=compareOp(TR_cmpNE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is NotEqualTo %d != %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_NOTEQUALTO, returnValue, left, right);
+
    return returnValue;
    }
 
 void
 OMR::IlBuilder::Goto(TR::IlBuilder **dest)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *dest = createBuilderIfNeeded(*dest);
    Goto(*dest);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*dest);
+      rec->BeginStatement(self(), StatementName::STATEMENT_GOTO);
+      rec->Builder(*dest);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::Goto(TR::IlBuilder *dest)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(dest != NULL, "This goto implementation requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::Goto %p\n", this, dest);
    appendGoto(dest->getEntry());
    setDoesNotComeBack();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_GOTO);
+      rec->Builder(dest);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::Return()
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
    if (returnBuilder != NULL)
       {
@@ -1216,11 +1566,18 @@ OMR::IlBuilder::Return()
       cfg()->addEdge(_currentBlock, cfg()->getEnd());
       setDoesNotComeBack();
       }
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_RETURN);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::Return(TR::IlValue *value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
    if (returnBuilder != NULL)
       {
@@ -1252,11 +1609,20 @@ OMR::IlBuilder::Return(TR::IlValue *value)
       cfg()->addEdge(_currentBlock, cfg()->getEnd());
       setDoesNotComeBack();
       }
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_RETURNVALUE);
+      rec->Value(value);
+      rec->EndStatement();
+      }
    }
 
 TR::IlValue *
 OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalRight = right;
    TR::IlValue *returnValue = NULL;
    if (left->getDataType() == TR::Address)
       {
@@ -1276,6 +1642,10 @@ OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
       returnValue=binaryOpFromOpMap(TR::ILOpCode::subtractOpCode, left, right);
       }
    TraceIL("IlBuilder[ %p ]::%d is Sub %d - %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_SUB, returnValue, left, originalRight);
+
    return returnValue;
    }
 
@@ -1292,6 +1662,8 @@ static TR::ILOpCodes unsignedAddOpCode(TR::DataType type)
 TR::IlValue *
 OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalRight = right;
    TR::IlValue *returnValue = NULL;
    if (left->getDataType() == TR::Address)
       {
@@ -1310,6 +1682,10 @@ OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
       returnValue = binaryOpFromOpMap(addOpCode, left, right);
       }
    TraceIL("IlBuilder[ %p ]::%d is Add %d + %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_ADD, returnValue, left, originalRight);
+
    return returnValue;
    }
 
@@ -1417,74 +1793,157 @@ OMR::IlBuilder::getOpCode(TR::IlValue *leftValue, TR::IlValue *rightValue)
 TR::IlValue *
 OMR::IlBuilder::AddWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::ILOpCodes opcode = getOpCode(left, right);
    TR::IlValue *addValue = genOperationWithOverflowCHK(opcode, leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is AddWithOverflow %d + %d\n", this, addValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*handler);
+      rec->EnsureAvailableID(addValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_ADDWITHOVERFLOW);
+      rec->Value(addValue);
+      rec->Builder(*handler);
+      rec->Value(left);
+      rec->Value(right);
+      rec->EndStatement();
+      }
+
    return addValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::AddWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::ILOpCodes opcode = getOpCode(left, right);
    TR::IlValue *addValue = genOperationWithOverflowCHK(opcode, leftNode, rightNode, handler, TR::UnsignedOverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is AddWithUnsignedOverflow %d + %d\n", this, addValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*handler);
+      rec->EnsureAvailableID(addValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_ADDWITHUNSIGNEDOVERFLOW);
+      rec->Value(addValue);
+      rec->Builder(*handler);
+      rec->Value(left);
+      rec->Value(right);
+      rec->EndStatement();
+      }
+
    return addValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::SubWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *subValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is SubWithOverflow %d + %d\n", this, subValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*handler);
+      rec->EnsureAvailableID(subValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_SUBWITHOVERFLOW);
+      rec->Value(subValue);
+      rec->Builder(*handler);
+      rec->Value(left);
+      rec->Value(right);
+      rec->EndStatement();
+      }
+
    return subValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::SubWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *unsignedSubValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::UnsignedOverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedSubWithOverflow %d + %d\n", this, unsignedSubValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*handler);
+      rec->EnsureAvailableID(unsignedSubValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_SUBWITHUNSIGNEDOVERFLOW);
+      rec->Value(unsignedSubValue);
+      rec->Builder(*handler);
+      rec->Value(left);
+      rec->Value(right);
+      rec->EndStatement();
+      }
+
    return unsignedSubValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::MulWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::Node *leftNode = loadValue(left);
    TR::Node *rightNode = loadValue(right);
    TR::IlValue *mulValue = genOperationWithOverflowCHK(TR::ILOpCode::multiplyOpCode(leftNode->getDataType()), leftNode, rightNode, handler, TR::OverflowCHK);
    TraceIL("IlBuilder[ %p ]::%d is MulWithOverflow %d + %d\n", this, mulValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*handler);
+      rec->EnsureAvailableID(mulValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_MULWITHOVERFLOW);
+      rec->Value(mulValue);
+      rec->Builder(*handler);
+      rec->Value(left);
+      rec->Value(right);
+      rec->EndStatement();
+      }
+
    return mulValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Mul(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::multiplyOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Mul %d * %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_MUL, returnValue, left, right);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Div(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::divideOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Div %d / %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_DIV, returnValue, left, right);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    TR::DataType returnType = left->getDataType();
 
    // There are no opcodes for performing unsigned division on 8-bit or 16-bit
@@ -1499,12 +1958,18 @@ OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDDIV, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    TR::DataType returnType = left->getDataType();
 
    // No code generators currently support the brem or srem opcodes. If we
@@ -1520,12 +1985,18 @@ OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = ConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_REM, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    TR::DataType returnType = left->getDataType();
    TR::IlValue *returnValue;
 
@@ -1557,30 +2028,48 @@ OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
    if (returnValue->getDataType() != returnType)
       returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDREM, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::And(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::andOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is And %d & %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_AND, returnValue, left, right);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Or(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::orOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Or %d | %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_OR, returnValue, left, right);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::Xor(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=binaryOpFromOpMap(TR::ILOpCode::xorOpCode, left, right);
    TraceIL("IlBuilder[ %p ]::%d is Xor %d ^ %d\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_XOR, returnValue, left, right);
+
    return returnValue;
    }
 
@@ -1627,24 +2116,39 @@ OMR::IlBuilder::shiftOpFromOpMap(OpCodeMapper mapOp,
 TR::IlValue *
 OMR::IlBuilder::ShiftL(TR::IlValue *v, TR::IlValue *amount)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::shiftLeftOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is shr %d << %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_SHIFTL, returnValue, v, amount);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::ShiftR(TR::IlValue *v, TR::IlValue *amount)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::shiftRightOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_SHIFTR, returnValue, v, amount);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=shiftOpFromOpMap(TR::ILOpCode::unsignedShiftRightOpCode, v, amount);
    TraceIL("IlBuilder[ %p ]::%d is unsigned shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDSHIFTR, returnValue, v, amount);
+
    return returnValue;
    }
 
@@ -1673,6 +2177,7 @@ OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
 void
 OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBuilder, int32_t numTerms, JBCondition **terms)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlBuilder *mergePoint = OrphanBuilder();
    *allTrueBuilder = createBuilderIfNeeded(*allTrueBuilder);
    *anyFalseBuilder = createBuilderIfNeeded(*anyFalseBuilder);
@@ -1698,6 +2203,22 @@ OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBu
 
    // return state for "this" can get confused by the Goto's in this service
    setComesBack();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*allTrueBuilder);
+      rec->EnsureAvailableID(*anyFalseBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_IFAND);
+      rec->Builder(*allTrueBuilder);
+      rec->Builder(*anyFalseBuilder);
+      rec->Number(numTerms);
+      for (int32_t t=0;t < numTerms;t++)
+         {
+         rec->Builder(terms[t]->_builder);
+         rec->Value(terms[t]->_condition);
+         }
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -1764,6 +2285,7 @@ OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBu
 void
 OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBuilder, int32_t numTerms, JBCondition **terms)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlBuilder *mergePoint = OrphanBuilder();
    *anyTrueBuilder = createBuilderIfNeeded(*anyTrueBuilder);
    *allFalseBuilder = createBuilderIfNeeded(*allFalseBuilder);
@@ -1795,6 +2317,22 @@ OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBui
 
    // return state for "this" can get confused by the Goto's in this service
    setComesBack();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*anyTrueBuilder);
+      rec->EnsureAvailableID(*allFalseBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_IFOR);
+      rec->Builder(*anyTrueBuilder);
+      rec->Builder(*allFalseBuilder);
+      rec->Number(numTerms);
+      for (int32_t t=0;t < numTerms;t++)
+         {
+         rec->Builder(terms[t]->_builder);
+         rec->Value(terms[t]->_condition);
+         }
+      rec->EndStatement();
+      }
    }
 
 /**
@@ -1847,8 +2385,13 @@ OMR::IlBuilder::MakeCondition(TR::IlBuilder *conditionBuilder, TR::IlValue *cond
 TR::IlValue *
 OMR::IlBuilder::EqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR::IlValue *returnValue=compareOp(TR_cmpEQ, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is EqualTo %d == %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_EQUALTO, returnValue, left, right);
+
    return returnValue;
    }
 
@@ -1867,72 +2410,128 @@ OMR::IlBuilder::integerizeAddresses(TR::IlValue **leftPtr, TR::IlValue **rightPt
 TR::IlValue *
 OMR::IlBuilder::LessThan(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLT, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is LessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_LESSTHAN, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedLessThan(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLT, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedLessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDLESSTHAN, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::LessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is LessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_LESSOREQUALTO, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedLessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpLE, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedLessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDLESSOREQUALTO, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::GreaterThan(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGT, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is GreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_GREATERTHAN, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedGreaterThan(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGT, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDGREATERTHAN, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::GreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGE, false, left, right);
    TraceIL("IlBuilder[ %p ]::%d is GreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_GREATEROREQUALTO, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
 TR::IlValue *
 OMR::IlBuilder::UnsignedGreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalLeft = left;
+   TR::IlValue *originalRight = right;
    integerizeAddresses(&left, &right);
    TR::IlValue *returnValue=compareOp(TR_cmpGE, true, left, right);
    TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordValueOp(rec, self(), StatementName::STATEMENT_UNSIGNEDGREATEROREQUALTO, returnValue, originalLeft, originalRight);
+
    return returnValue;
    }
 
@@ -1956,18 +2555,12 @@ OMR::IlBuilder::processCallArgs(TR::Compilation *comp, int numArgs, va_list args
 TR::IlValue *
 OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, ...)
    {
-   TraceIL("IlBuilder[ %p ]::ComputedCall %s\n", this, functionName);
    va_list args;
    va_start(args, numArgs);
    TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
    va_end(args);
-   TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
-      resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
-   TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateComputedStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   return genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+   return ComputedCall(functionName, numArgs, argValues);
    }
 
 /*
@@ -1980,13 +2573,31 @@ TR::IlValue *
 OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
    {
    TraceIL("IlBuilder[ %p ]::ComputedCall %s\n", this, functionName);
+   // resolve before opening the service scope so that a function the client defines
+   // on request is recorded ahead of the call rather than swallowed by it
    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
       resolvedMethod = _methodBuilder->lookupFunction(functionName);
    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+
    TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateComputedStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   return genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+   TR::IlValue *returnValue = genCall(methodSymRef, numArgs, argValues, false /*isDirectCall*/);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_COMPUTEDCALL);
+      rec->Value(returnValue);
+      rec->String(functionName);
+      rec->Number(numArgs);
+      for (int32_t a=0;a < numArgs;a++)
+         rec->Value(argValues[a]);
+      rec->EndStatement();
+      }
+
+   return returnValue;
    }
 
 /*
@@ -2025,6 +2636,10 @@ OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, ...)
 TR::IlValue *
 OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue **argValues)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->UnsupportedStatement(self(), StatementName::STATEMENT_CALLMETHODBUILDER);
+
    TraceIL("IlBuilder[ %p ]::Call %s\n", this, calleeMB->GetMethodName());
 
    // set up callee's inline site index
@@ -2077,31 +2692,43 @@ OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue *
 TR::IlValue *
 OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, ...)
    {
-   TraceIL("IlBuilder[ %p ]::Call %s\n", this, functionName);
    va_list args;
    va_start(args, numArgs);
    TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
    va_end(args);
-   TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
-      resolvedMethod = _methodBuilder->lookupFunction(functionName);
-   TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
-   TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   return genCall(methodSymRef, numArgs, argValues);
+   return Call(functionName, numArgs, argValues);
    }
 
 TR::IlValue *
 OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR::IlValue ** argValues)
    {
    TraceIL("IlBuilder[ %p ]::Call %s\n", this, functionName);
+   // resolve before opening the service scope so that a function the client defines
+   // on request is recorded ahead of the call rather than swallowed by it
    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
       resolvedMethod = _methodBuilder->lookupFunction(functionName);
    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+
    TR::SymbolReference *methodSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-   return genCall(methodSymRef, numArgs, argValues);
+   TR::IlValue *returnValue = genCall(methodSymRef, numArgs, argValues);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_CALL);
+      rec->Value(returnValue);
+      rec->String(functionName);
+      rec->Number(numArgs);
+      for (int32_t a=0;a < numArgs;a++)
+         rec->Value(argValues[a]);
+      rec->EndStatement();
+      }
+
+   return returnValue;
    }
 
 TR::IlValue *
@@ -2151,6 +2778,7 @@ OMR::IlBuilder::genCall(TR::SymbolReference *methodSymRef, int32_t numArgs, TR::
 TR::IlValue *
 OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(baseAddress->getDataType() == TR::Address, "baseAddress must be TR::Address");
 
    //Determine the implementation type and returnType by detecting "value"'s type
@@ -2165,6 +2793,17 @@ OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
    callNode->setAndIncChild(1, loadValue(value));
 
    TR::IlValue *returnValue = newValue(callNode->getDataType(), callNode);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(returnValue);
+      rec->BeginStatement(self(), StatementName::STATEMENT_ATOMICADD);
+      rec->Value(returnValue);
+      rec->Value(baseAddress);
+      rec->Value(value);
+      rec->EndStatement();
+      }
+
    return returnValue;
    }
 
@@ -2242,6 +2881,7 @@ OMR::IlBuilder::AtomicAdd(TR::IlValue * baseAddress, TR::IlValue * value)
 void
 OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuilder **transientFailureBuilder, TR::IlBuilder **transactionBuilder)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    //This assertion is to rule out platforms which don't have tstart evaluator yet.
    TR_ASSERT_FATAL(comp()->cg()->hasTMEvaluator(), "this platform doesn't support tstart or tfinish evaluator yet");
 
@@ -2266,6 +2906,9 @@ OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuil
 
       AppendBuilder(*persistentFailureBuilder);
       appendBlock(mergeBlock);
+
+      if (TR::JitBuilderRecorder *rec = scope.recorder())
+         recordTransaction(rec, self(), persistentFailureBuilder, transientFailureBuilder, transactionBuilder);
       return;
       }
 
@@ -2300,6 +2943,9 @@ OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuil
 
    //Three IlBuilders above merged here
    appendBlock(mergeBlock);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      recordTransaction(rec, self(), persistentFailureBuilder, transientFailureBuilder, transactionBuilder);
    }
 
 
@@ -2309,186 +2955,349 @@ OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuil
 void
 OMR::IlBuilder::TransactionAbort()
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::transactionAbort", this);
    TR::Node *tAbortNode = TR::Node::create(TR::tabort, 0);
    tAbortNode->setSymbolReference(comp()->getSymRefTab()->findOrCreateTransactionAbortSymbolRef(comp()->getMethodSymbol()));
    genTreeTop(tAbortNode);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(self(), StatementName::STATEMENT_TRANSACTIONABORT);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpNotEqualZero(*target, condition);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPNOTEQUALZERO, *target, condition);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqualZero requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpNotEqualZero %d? -> [ %p ] B%d\n", this, condition->getID(), target, target->getEntry()->getNumber());
    ifCmpNotEqualZero(condition, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPNOTEQUALZERO, target, condition);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpNotEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPNOTEQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpNotEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpNE, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPNOTEQUAL, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpEqualZero(*target, condition);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPEQUALZERO, *target, condition);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpEqualZero requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpEqualZero %d == 0? -> [ %p ] B%d\n", this, condition->getID(), target, target->getEntry()->getNumber());
    ifCmpEqualZero(condition, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPEQUALZERO, target, condition);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPEQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpEQ, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPEQUAL, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpLessThan(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPLESSTHAN, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpLessThan requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLT, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPLESSTHAN, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpUnsignedLessThan(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessThan requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLT, true, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpLessOrEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPLESSOREQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpLessOrEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLE, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPLESSOREQUAL, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpUnsignedLessOrEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessOrEqual requires a non-NULL builder object");
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpLE, true, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpGreaterThan(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPGREATERTHAN, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGT, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPGREATERTHAN, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpUnsignedGreaterThan(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGT, true, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpGreaterOrEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPGREATEROREQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGE, false, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPGREATEROREQUAL, target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    *target = createBuilderIfNeeded(*target);
    IfCmpUnsignedGreaterOrEqual(*target, left, right);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*target);
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, *target, left, right);
+      }
    }
 
 void
 OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target, target->getEntry()->getNumber());
    ifCmpCondition(TR_cmpGE, true, left, right, target->getEntry());
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      recordBranch(rec, self(), StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, target, left, right);
+      }
    }
 
 void
@@ -2536,6 +3345,7 @@ OMR::IlBuilder::appendGoto(TR::Block *destBlock)
 void
 OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePath, TR::IlValue *condition)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(thenPath != NULL || elsePath != NULL, "IfThenElse needs at least one conditional path");
 
    TR::Block *thenEntry = NULL;
@@ -2598,6 +3408,19 @@ OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePath, T
 
    // all paths possibly merge back here
    appendBlock(mergeBlock);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      if (thenPath)
+         rec->EnsureAvailableID(*thenPath);
+      if (elsePath)
+         rec->EnsureAvailableID(*elsePath);
+      rec->BeginStatement(self(), StatementName::STATEMENT_IFTHENELSE);
+      rec->Builder(thenPath ? *thenPath : NULL);
+      rec->Builder(elsePath ? *elsePath : NULL);
+      rec->Value(condition);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -2606,6 +3429,7 @@ OMR::IlBuilder::Switch(TR::IlValue *selectorValue,
                   uint32_t numCases,
                   JBCase **cases)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "Switch only supports selector having type Int32");
    *defaultBuilder = createBuilderIfNeeded(*defaultBuilder);
 
@@ -2613,6 +3437,22 @@ OMR::IlBuilder::Switch(TR::IlValue *selectorValue,
    TR::Node *lookupNode = TR::Node::create(TR::lookup, numCases + 2, loadValue(selectorValue), defaultNode);
 
    generateSwitchCases(lookupNode, defaultNode, defaultBuilder, numCases, cases);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*defaultBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_SWITCH);
+      rec->Value(selectorValue);
+      rec->Builder(*defaultBuilder);
+      rec->Number((int32_t)numCases);
+      for (uint32_t c=0;c < numCases;c++)
+         {
+         rec->Number(cases[c]->_value);
+         rec->Builder(cases[c]->_builder);
+         rec->Number(cases[c]->_fallsThrough);
+         }
+      rec->EndStatement();
+      }
    }
 
 void
@@ -2636,6 +3476,8 @@ OMR::IlBuilder::TableSwitch(TR::IlValue * selectorValue,
                uint32_t numCases,
                JBCase** cases)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
+   TR::IlValue *originalSelectorValue = selectorValue;
    TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "TableSwitch only supports selector having type Int32");
    TR_ASSERT_FATAL(numCases > 0, "TableSwitch requires at least 1 case");
    int32_t low = cases[0]->_value;
@@ -2653,6 +3495,23 @@ OMR::IlBuilder::TableSwitch(TR::IlValue * selectorValue,
        tableNode->setIsSafeToSkipTableBoundCheck(true);
 
    generateSwitchCases(tableNode, defaultNode, defaultBuilder, numCases, cases);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*defaultBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_TABLESWITCH);
+      rec->Value(originalSelectorValue);
+      rec->Builder(*defaultBuilder);
+      rec->Number((int8_t)generateBoundsCheck);
+      rec->Number((int32_t)numCases);
+      for (uint32_t c=0;c < numCases;c++)
+         {
+         rec->Number(cases[c]->_value);
+         rec->Builder(cases[c]->_builder);
+         rec->Number(cases[c]->_fallsThrough);
+         }
+      rec->EndStatement();
+      }
    }
 
 void
@@ -2682,6 +3541,7 @@ OMR::IlBuilder::MakeCase(int32_t caseValue, TR::IlBuilder **caseBuilder, int32_t
 TR::IlValue *
 OMR::IlBuilder::Select(TR::IlValue * condition, TR::IlValue * trueValue, TR::IlValue * falseValue)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    TR_ASSERT_FATAL(condition != NULL && trueValue != NULL && falseValue != NULL,
                      "Select requires condition, trueValue and falseValue");
    TR::DataType dt = trueValue->getDataType();
@@ -2707,6 +3567,18 @@ OMR::IlBuilder::Select(TR::IlValue * condition, TR::IlValue * trueValue, TR::IlV
       TR::Node * resultNode = createWithoutSymRef(opCode, 3, conditionNode, ifTrueNode, ifFalseNode);
       result = newValue(dt, resultNode);
       }
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(result);
+      rec->BeginStatement(self(), StatementName::STATEMENT_SELECT);
+      rec->Value(result);
+      rec->Value(condition);
+      rec->Value(trueValue);
+      rec->Value(falseValue);
+      rec->EndStatement();
+      }
+
    return result;
    }
 
@@ -2781,6 +3653,7 @@ OMR::IlBuilder::ForLoop(bool countsUp,
                    TR::IlValue *end,
                    TR::IlValue *increment)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(loopCode != NULL, "ForLoop needs to have loopCode builder");
    *loopCode = createBuilderIfNeeded(*loopCode);
@@ -2833,11 +3706,31 @@ OMR::IlBuilder::ForLoop(bool countsUp,
 
    // make sure any subsequent operations go into their own block *after* the loop
    appendBlock();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*loopCode);
+      if (breakBuilder)
+         rec->EnsureAvailableID(*breakBuilder);
+      if (continueBuilder)
+         rec->EnsureAvailableID(*continueBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_FORLOOP);
+      rec->Number((int8_t)countsUp);
+      rec->String(indVar);
+      rec->Builder(*loopCode);
+      rec->Builder(breakBuilder ? *breakBuilder : NULL);
+      rec->Builder(continueBuilder ? *continueBuilder : NULL);
+      rec->Value(initial);
+      rec->Value(end);
+      rec->Value(increment);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(body != NULL, "doWhileLoop needs to have a body");
 
@@ -2871,11 +3764,27 @@ OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR
 
    // make sure any subsequent operations go into their own block *after* the loop
    appendBlock();
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*body);
+      if (breakBuilder)
+         rec->EnsureAvailableID(*breakBuilder);
+      if (continueBuilder)
+         rec->EnsureAvailableID(*continueBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_DOWHILELOOP);
+      rec->String(whileCondition);
+      rec->Builder(*body);
+      rec->Builder(breakBuilder ? *breakBuilder : NULL);
+      rec->Builder(continueBuilder ? *continueBuilder : NULL);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(recorder());
    methodSymbol()->setMayHaveLoops(true);
    TR_ASSERT_FATAL(body != NULL, "WhileDo needs to have a body");
    TraceIL("IlBuilder[ %p ]::WhileDoLoop while %s do body %p\n", this, whileCondition, *body);
@@ -2905,6 +3814,21 @@ OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR
    setComesBack(); // this goto is on one particular flow path, doesn't mean every path does a goto
 
    AppendBuilder(done);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureAvailableID(*body);
+      if (breakBuilder)
+         rec->EnsureAvailableID(*breakBuilder);
+      if (continueBuilder)
+         rec->EnsureAvailableID(*continueBuilder);
+      rec->BeginStatement(self(), StatementName::STATEMENT_WHILEDOLOOP);
+      rec->String(whileCondition);
+      rec->Builder(*body);
+      rec->Builder(breakBuilder ? *breakBuilder : NULL);
+      rec->Builder(continueBuilder ? *continueBuilder : NULL);
+      rec->EndStatement();
+      }
    }
 
 void *
@@ -36,6 +36,7 @@ namespace TR { class Block; }
 namespace TR { class BytecodeBuilder; }
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class IlBuilder; }
+namespace TR { class JitBuilderRecorder; }
 namespace TR { class ResolvedMethodSymbol; } 
 namespace TR { class SymbolReference; }
 namespace TR { class SymbolReferenceTable; }
@@ -732,6 +733,13 @@ protected:
       return true;
       }
 
+   TR::IlBuilder *self();
+
+   /**
+    * @brief returns the recorder for the MethodBuilder this builder belongs to, or NULL if it is not being recorded
+    */
+   TR::JitBuilderRecorder *recorder();
+
    TR::SymbolReference *lookupSymbol(const char *name);
    void defineSymbol(const char *name, TR::SymbolReference *v);
    TR::IlValue *newValue(TR::IlType *dt, TR::Node *n=NULL);
@@ -19,40 +19,67 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "env/TRMemory.hpp"    // must precede MethodBuilder.hpp to get TR_ALLOC
 #include "infra/Assert.hpp"
 #include "ilgen/JitBuilderRecorder.hpp"
-
-namespace TR { class MethodBuilder; }
+#include "ilgen/IlType.hpp"
+#include "ilgen/MethodBuilder.hpp"
 
 OMR::JitBuilderRecorder::JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName)
-: _mb(mb), _nextID(0), _idSize(8),  _file(fileName, std::fstream::out | std::fstream::trunc)
+: _mb(mb), _nextID(0), _idSize(8), _started(false), _disabled(false), _serviceDepth(0), _file()
    {
-   start(); // initializes IDs 0 and 1 (reserved)
+   if (fileName != NULL)
+      _file.open(fileName, std::fstream::out | std::fstream::trunc);
+
+   // special reserved value, must do it first !
+   StoreID(0);
+
+   // another special reserved value, so do it first
+   StoreID((const void *)1);
    }
 
 OMR::JitBuilderRecorder::~JitBuilderRecorder()
    {
    }
 
+OMR::JitBuilderRecorder::ServiceScope::ServiceScope(TR::JitBuilderRecorder *rec)
+   : _rec(rec), _record(false)
+   {
+   if (_rec != NULL)
+      _record = (_rec->_serviceDepth++ == 0) && !_rec->_disabled;
+   }
+
+OMR::JitBuilderRecorder::ServiceScope::~ServiceScope()
+   {
+   if (_rec != NULL)
+      _rec->_serviceDepth--;
+   }
+
 void
 OMR::JitBuilderRecorder::start()
    {
-   // special reserved value, must do it first !
-   StoreID(0);
-
-   // another special reserved value, so do it first
-   StoreID((const void *)1);
+   // the header cannot be written by the constructor because it calls the output functions
+   //  that subclasses override, so it is written just before the first statement
+   if (_started)
+      return;
+   _started = true;
 
    String(StatementName::RECORDER_SIGNATURE);
    Number(StatementName::VERSION_MAJOR);
    Number(StatementName::VERSION_MINOR);
    Number(StatementName::VERSION_PATCH);
    EndStatement();
+
+   // these are needed when IDs no longer fit in 8 (or 16) bits, and must be defined
+   //  before then because defining a statement needs an ID
+   ensureStatementDefined(StatementName::STATEMENT_ID16BIT);
+   ensureStatementDefined(StatementName::STATEMENT_ID32BIT);
    }
 
 void 
 OMR::JitBuilderRecorder::Close()                                       
    { 
+   start();
    end();
    EndStatement();
    }
@@ -63,17 +90,21 @@ OMR::JitBuilderRecorder::getNewID()
    // support for variable sized ID encoding
    //  to avoid any synchronization issues in how decoders/encoders count IDs, use a statement to signal change
    // check if we're close to 8-bit / 16-bit boundary
-   // need to leave space for one ID because these statements will not have been defined yet
-   //  and defining the statement needs an ID!
+   // IDs are only allocated between statements, so the change can be signalled with a complete
+   //  statement, written with the old ID size before switching to the new one
    if (_nextID == (1 << 8) - 2)
       {
-      _idSize = 16;
+      Builder(0);
       Statement(StatementName::STATEMENT_ID16BIT);
+      EndStatement();
+      _idSize = 16;
       }
    else if (_nextID == (1 << 16) - 2)
       {
-      _idSize = 32;
+      Builder(0);
       Statement(StatementName::STATEMENT_ID32BIT);
+      EndStatement();
+      _idSize = 32;
       }
 
    return _nextID++;
@@ -126,12 +157,13 @@ OMR::JitBuilderRecorder::end()
 void
 OMR::JitBuilderRecorder::BeginStatement(const char *s)
    {
-   BeginStatement(_mb, s);
+   BeginStatement(static_cast<const TR::IlBuilder *>(_mb), s);
    }
 
 void
-OMR::JitBuilderRecorder::BeginStatement(const TR::MethodBuilder *b, const char *s)
+OMR::JitBuilderRecorder::BeginStatement(const TR::IlBuilder *b, const char *s)
    {
+   start();
    ensureStatementDefined(s);
    Builder(b);
    Statement(s);
@@ -156,3 +188,46 @@ OMR::JitBuilderRecorder::EnsureAvailableID(const void *ptr)
    StoreID(ptr);
    return false; // ID was not available, but is now
    }
+
+void
+OMR::JitBuilderRecorder::EnsureTypeDefined(TR::IlType *type)
+   {
+   if (knownID(type))
+      return;
+
+   if (type->isPointer())
+      {
+      TR::IlType *baseType = type->baseType();
+      EnsureTypeDefined(baseType);
+      StoreID(type);
+      BeginStatement(StatementName::STATEMENT_POINTERTYPE);
+      Type(type);
+      Type(baseType);
+      EndStatement();
+      }
+   else if (type->isStruct() || type->isUnion())
+      {
+      // struct and union layouts are not recorded, so these types can only be marked
+      StoreID(type);
+      BeginStatement(type->isStruct() ? StatementName::STATEMENT_DEFINESTRUCT : StatementName::STATEMENT_DEFINEUNION);
+      Type(type);
+      String(type->getName());
+      EndStatement();
+      }
+   else
+      {
+      StoreID(type);
+      BeginStatement(StatementName::STATEMENT_PRIMITIVETYPE);
+      Type(type);
+      Number((int32_t)type->getPrimitiveType());
+      EndStatement();
+      }
+   }
+
+void
+OMR::JitBuilderRecorder::UnsupportedStatement(const TR::IlBuilder *b, const char *s)
+   {
+   BeginStatement(b, s);
+   EndStatement();
+   _disabled = true;
+   }
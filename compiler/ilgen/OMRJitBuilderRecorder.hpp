@@ -31,6 +31,7 @@ namespace TR { class IlBuilder; }
 namespace TR { class MethodBuilder; }
 namespace TR { class IlType; }
 namespace TR { class IlValue; }
+namespace TR { class JitBuilderRecorder; }
 
 namespace OMR
 {
@@ -42,6 +43,31 @@ class JitBuilderRecorder
    typedef uint32_t                      TypeID;
    typedef std::map<const void *,TypeID> TypeMapID;
 
+   /**
+    * @brief Brackets a call to a JitBuilder service.
+    *
+    * Many services are implemented by calling other services. Only the outermost
+    * call may be recorded, otherwise replaying the recording would generate the IL
+    * of the inner calls twice.
+    */
+   class ServiceScope
+      {
+      public:
+      ServiceScope(TR::JitBuilderRecorder *rec);
+      ~ServiceScope();
+
+      /** @brief returns the recorder if this service should be recorded, otherwise NULL */
+      TR::JitBuilderRecorder *recorder() { return _record ? _rec : NULL; }
+
+      private:
+      TR::JitBuilderRecorder *_rec;
+      bool                    _record;
+      };
+
+   /**
+    * @param mb the MethodBuilder being recorded, can also be set later via setMethodBuilderRecorder()
+    * @param fileName the file to write the recording to, or NULL if it should not be written to a file
+    */
    JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName);
    virtual ~JitBuilderRecorder();
 
@@ -62,17 +88,30 @@ class JitBuilderRecorder
    virtual void Statement(const char *s)                      { }
    virtual void Type(const TR::IlType *type)                  { }
    virtual void Value(const TR::IlValue *v)                   { }
-   virtual void Builder(const TR::MethodBuilder *b)           { }
-   virtual void Builder()                                     { }
+   virtual void Builder(const TR::IlBuilder *b)               { }
    virtual void Location(const void * location)               { }
 
-   virtual void BeginStatement(const TR::MethodBuilder *b, const char *s);
+   virtual void BeginStatement(const TR::IlBuilder *b, const char *s);
    virtual void BeginStatement(const char *s);
    virtual void EndStatement()                                { }
 
    void StoreID(const void *ptr);
    bool EnsureAvailableID(const void *ptr);
 
+   /**
+    * @brief Records the statements needed to define type (and any type it points to)
+    *        unless that has already been done. Must be called before BeginStatement
+    *        of any statement referring to type.
+    */
+   void EnsureTypeDefined(TR::IlType *type);
+
+   /**
+    * @brief Records a statement for a service that cannot be replayed, with no operands.
+    *        Objects created by such a service are unknown to the recording, so nothing
+    *        more is recorded for the MethodBuilder after this statement.
+    */
+   void UnsupportedStatement(const TR::IlBuilder *b, const char *s);
+
    protected:
 
    void start();
@@ -88,6 +127,9 @@ class JitBuilderRecorder
    TypeID                            _nextID;
    TypeMapID                         _idMap;
    uint8_t                           _idSize;
+   bool                              _started;
+   bool                              _disabled;
+   int32_t                           _serviceDepth;
 
    std::fstream _file;
    
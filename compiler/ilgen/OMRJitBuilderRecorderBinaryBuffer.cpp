@@ -59,8 +59,9 @@ OMR::JitBuilderRecorderBinaryBuffer::Number(int8_t num)
 void
 OMR::JitBuilderRecorderBinaryBuffer::Number(int16_t num)
    {
-   _buf.push_back((uint8_t)num&0xFF);
-   _buf.push_back((uint8_t)(num&0xFF00)>>8);
+   uint16_t *unsignedNum = (uint16_t *)&num;
+   _buf.push_back((uint8_t) (*unsignedNum & 0x00FF));
+   _buf.push_back((uint8_t)((*unsignedNum & 0xFF00) >> 8));
    }
 
 void
@@ -28,6 +28,8 @@
 OMR::JitBuilderRecorderTextFile::JitBuilderRecorderTextFile(const TR::MethodBuilder *mb, const char *fileName)
    : TR::JitBuilderRecorder(mb, fileName)
    {
+   // enough digits that every float and double reads back exactly
+   _file.precision(17);
    }
 
 void
@@ -0,0 +1,794 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "env/TRMemory.hpp"    // must precede MethodBuilder.hpp to get TR_ALLOC
+#include "infra/Assert.hpp"
+#include "ilgen/JitBuilderReplay.hpp"
+#include "ilgen/IlBuilder.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/StatementNames.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+typedef TR::IlValue *(OMR::IlBuilder::*TypedValueOp)(TR::IlType *, TR::IlValue *);
+typedef TR::IlValue *(OMR::IlBuilder::*UnaryValueOp)(TR::IlValue *);
+typedef TR::IlValue *(OMR::IlBuilder::*BinaryValueOp)(TR::IlValue *, TR::IlValue *);
+typedef TR::IlValue *(OMR::IlBuilder::*OverflowOp)(TR::IlBuilder **, TR::IlValue *, TR::IlValue *);
+typedef void (OMR::IlBuilder::*IfCmpOp)(TR::IlBuilder **, TR::IlValue *, TR::IlValue *);
+typedef void (OMR::IlBuilder::*IfCmpZeroOp)(TR::IlBuilder **, TR::IlValue *);
+
+struct OMR::JitBuilderReplay::StatementInfo
+   {
+   const char    *_name;
+   StatementKind  _kind;
+   TypedValueOp   _typedValueOp;
+   UnaryValueOp   _unaryValueOp;
+   BinaryValueOp  _binaryValueOp;
+   OverflowOp     _overflowOp;
+   IfCmpOp        _ifCmpOp;
+   IfCmpZeroOp    _ifCmpZeroOp;
+   };
+
+#define STATEMENT(name, kind)  { StatementName::name, kind, NULL, NULL, NULL, NULL, NULL, NULL }
+#define TYPEDVALUE(name, op)   { StatementName::name, TypedValueStatement, &OMR::IlBuilder::op, NULL, NULL, NULL, NULL, NULL }
+#define UNARYVALUE(name, op)   { StatementName::name, UnaryValueStatement, NULL, &OMR::IlBuilder::op, NULL, NULL, NULL, NULL }
+#define BINARYVALUE(name, op)  { StatementName::name, BinaryValueStatement, NULL, NULL, &OMR::IlBuilder::op, NULL, NULL, NULL }
+#define WITHOVERFLOW(name, op) { StatementName::name, OverflowStatement, NULL, NULL, NULL, &OMR::IlBuilder::op, NULL, NULL }
+#define IFCMP(name, op)        { StatementName::name, IfCmpStatement, NULL, NULL, NULL, NULL, &OMR::IlBuilder::op, NULL }
+#define IFCMPZERO(name, op)    { StatementName::name, IfCmpZeroStatement, NULL, NULL, NULL, NULL, NULL, &OMR::IlBuilder::op }
+
+const OMR::JitBuilderReplay::StatementInfo OMR::JitBuilderReplay::_statementInfo[] =
+   {
+   STATEMENT(STATEMENT_ID16BIT,                    ID16BitStatement),
+   STATEMENT(STATEMENT_ID32BIT,                    ID32BitStatement),
+   STATEMENT(STATEMENT_NEWMETHODBUILDER,           NewMethodBuilderStatement),
+   STATEMENT(STATEMENT_DONECONSTRUCTOR,            DoneConstructorStatement),
+   STATEMENT(STATEMENT_DEFINENAME,                 DefineNameStatement),
+   STATEMENT(STATEMENT_DEFINEFILE,                 DefineFileStatement),
+   STATEMENT(STATEMENT_DEFINELINESTRING,           DefineLineStringStatement),
+   STATEMENT(STATEMENT_DEFINELINENUMBER,           DefineLineNumberStatement),
+   STATEMENT(STATEMENT_DEFINEPARAMETER,            DefineParameterStatement),
+   STATEMENT(STATEMENT_DEFINEARRAYPARAMETER,       DefineArrayParameterStatement),
+   STATEMENT(STATEMENT_DEFINERETURNTYPE,           DefineReturnTypeStatement),
+   STATEMENT(STATEMENT_DEFINELOCAL,                DefineLocalStatement),
+   STATEMENT(STATEMENT_DEFINEMEMORY,               DefineMemoryStatement),
+   STATEMENT(STATEMENT_DEFINEGLOBAL,               DefineGlobalStatement),
+   STATEMENT(STATEMENT_DEFINEFUNCTION,             DefineFunctionStatement),
+   STATEMENT(STATEMENT_ALLLOCALSHAVEBEENDEFINED,   AllLocalsHaveBeenDefinedStatement),
+   STATEMENT(STATEMENT_PRIMITIVETYPE,              PrimitiveTypeStatement),
+   STATEMENT(STATEMENT_POINTERTYPE,                PointerTypeStatement),
+   STATEMENT(STATEMENT_NEWILBUILDER,               NewIlBuilderStatement),
+   STATEMENT(STATEMENT_APPENDBUILDER,              AppendBuilderStatement),
+   STATEMENT(STATEMENT_COPY,                       CopyStatement),
+   STATEMENT(STATEMENT_STORE,                      StoreStatement),
+   STATEMENT(STATEMENT_STOREOVER,                  StoreOverStatement),
+   STATEMENT(STATEMENT_VECTORSTORE,                VectorStoreStatement),
+   STATEMENT(STATEMENT_STOREAT,                    StoreAtStatement),
+   STATEMENT(STATEMENT_VECTORSTOREAT,              VectorStoreAtStatement),
+   STATEMENT(STATEMENT_CREATELOCALARRAY,           CreateLocalArrayStatement),
+   STATEMENT(STATEMENT_LOAD,                       LoadStatement),
+   STATEMENT(STATEMENT_VECTORLOAD,                 VectorLoadStatement),
+   STATEMENT(STATEMENT_LOADAT,                     LoadAtStatement),
+   STATEMENT(STATEMENT_VECTORLOADAT,               VectorLoadAtStatement),
+   STATEMENT(STATEMENT_INDEXAT,                    IndexAtStatement),
+   STATEMENT(STATEMENT_NULLADDRESS,                NullAddressStatement),
+   STATEMENT(STATEMENT_CONSTINT8,                  ConstInt8Statement),
+   STATEMENT(STATEMENT_CONSTINT16,                 ConstInt16Statement),
+   STATEMENT(STATEMENT_CONSTINT32,                 ConstInt32Statement),
+   STATEMENT(STATEMENT_CONSTINT64,                 ConstInt64Statement),
+   STATEMENT(STATEMENT_CONSTFLOAT,                 ConstFloatStatement),
+   STATEMENT(STATEMENT_CONSTDOUBLE,                ConstDoubleStatement),
+   STATEMENT(STATEMENT_CONSTSTRING,                ConstStringStatement),
+   STATEMENT(STATEMENT_CONSTADDRESS,               ConstAddressStatement),
+   TYPEDVALUE(STATEMENT_CONVERTTO,                 ConvertTo),
+   TYPEDVALUE(STATEMENT_UNSIGNEDCONVERTTO,         UnsignedConvertTo),
+   TYPEDVALUE(STATEMENT_CONVERTBITSTO,             ConvertBitsTo),
+   UNARYVALUE(STATEMENT_NEGATE,                    Negate),
+   BINARYVALUE(STATEMENT_ADD,                      Add),
+   BINARYVALUE(STATEMENT_SUB,                      Sub),
+   BINARYVALUE(STATEMENT_MUL,                      Mul),
+   BINARYVALUE(STATEMENT_DIV,                      Div),
+   BINARYVALUE(STATEMENT_UNSIGNEDDIV,              UnsignedDiv),
+   BINARYVALUE(STATEMENT_REM,                      Rem),
+   BINARYVALUE(STATEMENT_UNSIGNEDREM,              UnsignedRem),
+   BINARYVALUE(STATEMENT_AND,                      And),
+   BINARYVALUE(STATEMENT_OR,                       Or),
+   BINARYVALUE(STATEMENT_XOR,                      Xor),
+   BINARYVALUE(STATEMENT_SHIFTL,                   ShiftL),
+   BINARYVALUE(STATEMENT_SHIFTR,                   ShiftR),
+   BINARYVALUE(STATEMENT_UNSIGNEDSHIFTR,           UnsignedShiftR),
+   BINARYVALUE(STATEMENT_EQUALTO,                  EqualTo),
+   BINARYVALUE(STATEMENT_NOTEQUALTO,               NotEqualTo),
+   BINARYVALUE(STATEMENT_LESSTHAN,                 LessThan),
+   BINARYVALUE(STATEMENT_UNSIGNEDLESSTHAN,         UnsignedLessThan),
+   BINARYVALUE(STATEMENT_LESSOREQUALTO,            LessOrEqualTo),
+   BINARYVALUE(STATEMENT_UNSIGNEDLESSOREQUALTO,    UnsignedLessOrEqualTo),
+   BINARYVALUE(STATEMENT_GREATERTHAN,              GreaterThan),
+   BINARYVALUE(STATEMENT_UNSIGNEDGREATERTHAN,      UnsignedGreaterThan),
+   BINARYVALUE(STATEMENT_GREATEROREQUALTO,         GreaterOrEqualTo),
+   BINARYVALUE(STATEMENT_UNSIGNEDGREATEROREQUALTO, UnsignedGreaterOrEqualTo),
+   WITHOVERFLOW(STATEMENT_ADDWITHOVERFLOW,             AddWithOverflow),
+   WITHOVERFLOW(STATEMENT_ADDWITHUNSIGNEDOVERFLOW,     AddWithUnsignedOverflow),
+   WITHOVERFLOW(STATEMENT_SUBWITHOVERFLOW,             SubWithOverflow),
+   WITHOVERFLOW(STATEMENT_SUBWITHUNSIGNEDOVERFLOW,     SubWithUnsignedOverflow),
+   WITHOVERFLOW(STATEMENT_MULWITHOVERFLOW,             MulWithOverflow),
+   STATEMENT(STATEMENT_GOTO,                       GotoStatement),
+   STATEMENT(STATEMENT_RETURN,                     ReturnStatement),
+   STATEMENT(STATEMENT_RETURNVALUE,                ReturnValueStatement),
+   IFCMP(STATEMENT_IFCMPNOTEQUAL,                  IfCmpNotEqual),
+   IFCMP(STATEMENT_IFCMPEQUAL,                     IfCmpEqual),
+   IFCMP(STATEMENT_IFCMPLESSTHAN,                  IfCmpLessThan),
+   IFCMP(STATEMENT_IFCMPUNSIGNEDLESSTHAN,          IfCmpUnsignedLessThan),
+   IFCMP(STATEMENT_IFCMPLESSOREQUAL,               IfCmpLessOrEqual),
+   IFCMP(STATEMENT_IFCMPUNSIGNEDLESSOREQUAL,       IfCmpUnsignedLessOrEqual),
+   IFCMP(STATEMENT_IFCMPGREATERTHAN,               IfCmpGreaterThan),
+   IFCMP(STATEMENT_IFCMPUNSIGNEDGREATERTHAN,       IfCmpUnsignedGreaterThan),
+   IFCMP(STATEMENT_IFCMPGREATEROREQUAL,            IfCmpGreaterOrEqual),
+   IFCMP(STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL,    IfCmpUnsignedGreaterOrEqual),
+   IFCMPZERO(STATEMENT_IFCMPNOTEQUALZERO,          IfCmpNotEqualZero),
+   IFCMPZERO(STATEMENT_IFCMPEQUALZERO,             IfCmpEqualZero),
+   STATEMENT(STATEMENT_IFAND,                      IfAndStatement),
+   STATEMENT(STATEMENT_IFOR,                       IfOrStatement),
+   STATEMENT(STATEMENT_IFTHENELSE,                 IfThenElseStatement),
+   STATEMENT(STATEMENT_SWITCH,                     SwitchStatement),
+   STATEMENT(STATEMENT_TABLESWITCH,                TableSwitchStatement),
+   STATEMENT(STATEMENT_SELECT,                     SelectStatement),
+   STATEMENT(STATEMENT_FORLOOP,                    ForLoopStatement),
+   STATEMENT(STATEMENT_DOWHILELOOP,                DoWhileLoopStatement),
+   STATEMENT(STATEMENT_WHILEDOLOOP,                WhileDoLoopStatement),
+   STATEMENT(STATEMENT_CALL,                       CallStatement),
+   STATEMENT(STATEMENT_COMPUTEDCALL,               ComputedCallStatement),
+   STATEMENT(STATEMENT_ATOMICADD,                  AtomicAddStatement),
+   STATEMENT(STATEMENT_TRANSACTION,                TransactionStatement),
+   STATEMENT(STATEMENT_TRANSACTIONABORT,           TransactionAbortStatement),
+
+   // recorded so a recording says why it stops, but not replayable: struct and union
+   //  layouts, bytecode builders and inlined MethodBuilders are not part of the recording
+   STATEMENT(STATEMENT_DEFINESTRUCT,               UnsupportedStatement),
+   STATEMENT(STATEMENT_DEFINEUNION,                UnsupportedStatement),
+   STATEMENT(STATEMENT_DEFINEFIELD,                UnsupportedStatement),
+   STATEMENT(STATEMENT_NEWBYTECODEBUILDER,         UnsupportedStatement),
+   STATEMENT(STATEMENT_APPENDBYTECODEBUILDER,      UnsupportedStatement),
+   STATEMENT(STATEMENT_CREATELOCALSTRUCT,          UnsupportedStatement),
+   STATEMENT(STATEMENT_LOADINDIRECT,               UnsupportedStatement),
+   STATEMENT(STATEMENT_STOREINDIRECT,              UnsupportedStatement),
+   STATEMENT(STATEMENT_STRUCTFIELDINSTANCEADDRESS, UnsupportedStatement),
+   STATEMENT(STATEMENT_UNIONFIELDINSTANCEADDRESS,  UnsupportedStatement),
+   STATEMENT(STATEMENT_CALLMETHODBUILDER,          UnsupportedStatement),
+
+   STATEMENT(JBIL_COMPLETE,                        UnknownStatement)   // marks end of table
+   };
+
+#undef STATEMENT
+#undef TYPEDVALUE
+#undef UNARYVALUE
+#undef BINARYVALUE
+#undef WITHOVERFLOW
+#undef IFCMP
+#undef IFCMPZERO
+
+
+OMR::JitBuilderReplay::JitBuilderReplay()
+   : _idSize(8),
+   _mb(NULL),
+   _objects(),
+   _statements(),
+   _strings(),
+   _readHeader(false),
+   _done(false),
+   _failed(false)
+   {
+   _failureReason[0] = '\0';
+
+   // reserved IDs, see JitBuilderRecorder
+   define(0, NULL);
+   }
+
+OMR::JitBuilderReplay::~JitBuilderReplay()
+   {
+   for (std::vector<char *>::iterator it = _strings.begin(); it != _strings.end(); ++it)
+      delete [] *it;
+   }
+
+const char *
+OMR::JitBuilderReplay::persistString(const char *s, size_t len)
+   {
+   char *copy = new char[len + 1];
+   memcpy(copy, s, len);
+   copy[len] = '\0';
+   _strings.push_back(copy);
+   return copy;
+   }
+
+void
+OMR::JitBuilderReplay::fail(const char *format, ...)
+   {
+   va_list args;
+   va_start(args, format);
+   vsnprintf(_failureReason, sizeof(_failureReason), format, args);
+   va_end(args);
+   _failed = true;
+   }
+
+void
+OMR::JitBuilderReplay::define(TypeID id, void *object)
+   {
+   _objects[id] = object;
+   }
+
+void *
+OMR::JitBuilderReplay::lookup(TypeID id)
+   {
+   std::map<TypeID, void *>::iterator it = _objects.find(id);
+   TR_ASSERT_FATAL(it != _objects.end(), "JBIL replay: reference to undefined ID %u", id);
+   return it->second;
+   }
+
+TR::IlBuilder *
+OMR::JitBuilderReplay::builderSlot(TypeID id)
+   {
+   std::map<TypeID, void *>::iterator it = _objects.find(id);
+   if (it == _objects.end())
+      return NULL;
+   return static_cast<TR::IlBuilder *>(it->second);
+   }
+
+void
+OMR::JitBuilderReplay::defineBuilderSlot(TypeID id, TR::IlBuilder *b)
+   {
+   if (_objects.find(id) == _objects.end())
+      define(id, b);
+   }
+
+bool
+OMR::JitBuilderReplay::ReplayConstructor(TR::MethodBuilder *mb)
+   {
+   return replay(mb, true);
+   }
+
+bool
+OMR::JitBuilderReplay::ReplayIL(TR::MethodBuilder *mb)
+   {
+   return replay(mb, false);
+   }
+
+void
+OMR::JitBuilderReplay::readHeader()
+   {
+   const char *signature = readString();
+   TR_ASSERT_FATAL(strcmp(signature, StatementName::RECORDER_SIGNATURE) == 0, "JBIL replay: input is not a JitBuilder recording");
+   int16_t major = readInt16();
+   int16_t minor = readInt16();
+   int16_t patch = readInt16();
+   TR_ASSERT_FATAL(major == StatementName::VERSION_MAJOR, "JBIL replay: cannot replay version %d.%d.%d", major, minor, patch);
+   readEndStatement();
+   _readHeader = true;
+   }
+
+void
+OMR::JitBuilderReplay::defineStatement(TypeID id)
+   {
+   const char *name = readString();
+   const StatementInfo *info = _statementInfo;
+   while (info->_kind != UnknownStatement && strcmp(info->_name, name) != 0)
+      info++;
+
+   // an unknown statement may be defined but never used, so only fail if it is replayed
+   _statements[id] = info;
+   }
+
+bool
+OMR::JitBuilderReplay::replay(TR::MethodBuilder *mb, bool stopAtEndOfConstructor)
+   {
+   TR_ASSERT_FATAL(_mb == NULL || _mb == mb, "JBIL replay: a recording can only be replayed into one MethodBuilder");
+   _mb = mb;
+
+   if (!_readHeader)
+      readHeader();
+
+   while (!_done && !_failed)
+      {
+      TypeID builderID = readBuilderID();
+      if (builderID == 1)
+         {
+         const char *complete = readString();
+         TR_ASSERT_FATAL(strcmp(complete, StatementName::JBIL_COMPLETE) == 0, "JBIL replay: malformed end of recording");
+         _done = true;
+         break;
+         }
+
+      TypeID statementID = readStatementID();
+      std::map<TypeID, const StatementInfo *>::iterator it = _statements.find(statementID);
+      if (builderID == 0 && it == _statements.end())
+         {
+         defineStatement(statementID);
+         readEndStatement();
+         continue;
+         }
+
+      TR_ASSERT_FATAL(it != _statements.end(), "JBIL replay: reference to undefined statement ID %u", statementID);
+      const StatementInfo *info = it->second;
+      switch (info->_kind)
+         {
+         case ID16BitStatement:
+            _idSize = 16;
+            break;
+         case ID32BitStatement:
+            _idSize = 32;
+            break;
+         case NewMethodBuilderStatement:
+            define(builderID, _mb);
+            break;
+         case DoneConstructorStatement:
+            if (stopAtEndOfConstructor)
+               {
+               readEndStatement();
+               return true;
+               }
+            break;
+         default:
+            replayStatement(builder(builderID), info);
+            break;
+         }
+
+      if (!_failed)
+         readEndStatement();
+      }
+
+   return !_failed;
+   }
+
+void
+OMR::JitBuilderReplay::replayStatement(TR::IlBuilder *b, const StatementInfo *info)
+   {
+   TR::MethodBuilder *mb = _mb;
+   TR::TypeDictionary *types = mb->typeDictionary();
+
+   switch (info->_kind)
+      {
+      case DefineNameStatement:
+         mb->DefineName(readString());
+         break;
+      case DefineFileStatement:
+         mb->DefineFile(readString());
+         break;
+      case DefineLineStringStatement:
+         mb->DefineLine(readString());
+         break;
+      case DefineLineNumberStatement:
+         mb->DefineLine((int)readInt32());
+         break;
+      case DefineParameterStatement:
+         {
+         const char *name = readString();
+         mb->DefineParameter(name, type(readTypeID()));
+         break;
+         }
+      case DefineArrayParameterStatement:
+         {
+         const char *name = readString();
+         mb->DefineArrayParameter(name, type(readTypeID()));
+         break;
+         }
+      case DefineReturnTypeStatement:
+         mb->DefineReturnType(type(readTypeID()));
+         break;
+      case DefineLocalStatement:
+         {
+         const char *name = readString();
+         mb->DefineLocal(name, type(readTypeID()));
+         break;
+         }
+      case DefineMemoryStatement:
+      case DefineGlobalStatement:
+         {
+         const char *name = readString();
+         TR::IlType *dt = type(readTypeID());
+         void *location = readLocation();
+         if (info->_kind == DefineMemoryStatement)
+            mb->DefineMemory(name, dt, location);
+         else
+            mb->DefineGlobal(name, dt, location);
+         break;
+         }
+      case DefineFunctionStatement:
+         {
+         const char *name = readString();
+         const char *fileName = readString();
+         const char *lineNumber = readString();
+         void *entryPoint = readLocation();
+         TR::IlType *returnType = type(readTypeID());
+         int32_t numParms = readInt32();
+         std::vector<TR::IlType *> parmTypes(numParms + 1);
+         for (int32_t p=0;p < numParms;p++)
+            parmTypes[p] = type(readTypeID());
+         mb->DefineFunction(name, fileName, lineNumber, entryPoint, returnType, numParms, &parmTypes[0]);
+         break;
+         }
+      case AllLocalsHaveBeenDefinedStatement:
+         mb->AllLocalsHaveBeenDefined();
+         break;
+      case PrimitiveTypeStatement:
+         {
+         TypeID id = readTypeID();
+         define(id, types->PrimitiveType((TR::DataTypes)readInt32()));
+         break;
+         }
+      case PointerTypeStatement:
+         {
+         TypeID id = readTypeID();
+         define(id, types->PointerTo(type(readTypeID())));
+         break;
+         }
+
+      case NewIlBuilderStatement:
+         {
+         TypeID id = readBuilderID();
+         define(id, b->OrphanBuilder());
+         break;
+         }
+      case AppendBuilderStatement:
+         b->AppendBuilder(builder(readBuilderID()));
+         break;
+      case CopyStatement:
+         {
+         TypeID result = readValueID();
+         define(result, b->Copy(value(readValueID())));
+         break;
+         }
+      case StoreStatement:
+      case VectorStoreStatement:
+         {
+         const char *name = readString();
+         TR::IlValue *v = value(readValueID());
+         if (info->_kind == StoreStatement)
+            b->Store(name, v);
+         else
+            b->VectorStore(name, v);
+         break;
+         }
+      case StoreOverStatement:
+      case StoreAtStatement:
+      case VectorStoreAtStatement:
+         {
+         TR::IlValue *dest = value(readValueID());
+         TR::IlValue *v = value(readValueID());
+         if (info->_kind == StoreOverStatement)
+            b->StoreOver(dest, v);
+         else if (info->_kind == StoreAtStatement)
+            b->StoreAt(dest, v);
+         else
+            b->VectorStoreAt(dest, v);
+         break;
+         }
+      case CreateLocalArrayStatement:
+         {
+         TypeID result = readValueID();
+         int32_t numElements = readInt32();
+         define(result, b->CreateLocalArray(numElements, type(readTypeID())));
+         break;
+         }
+      case LoadStatement:
+      case VectorLoadStatement:
+         {
+         TypeID result = readValueID();
+         const char *name = readString();
+         define(result, (info->_kind == LoadStatement) ? b->Load(name) : b->VectorLoad(name));
+         break;
+         }
+      case LoadAtStatement:
+      case VectorLoadAtStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlType *dt = type(readTypeID());
+         TR::IlValue *address = value(readValueID());
+         define(result, (info->_kind == LoadAtStatement) ? b->LoadAt(dt, address) : b->VectorLoadAt(dt, address));
+         break;
+         }
+      case IndexAtStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlType *dt = type(readTypeID());
+         TR::IlValue *base = value(readValueID());
+         TR::IlValue *index = value(readValueID());
+         define(result, b->IndexAt(dt, base, index));
+         break;
+         }
+      case NullAddressStatement:
+         define(readValueID(), b->NullAddress());
+         break;
+      case ConstInt8Statement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstInt8(readInt8()));
+         break;
+         }
+      case ConstInt16Statement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstInt16(readInt16()));
+         break;
+         }
+      case ConstInt32Statement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstInt32(readInt32()));
+         break;
+         }
+      case ConstInt64Statement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstInt64(readInt64()));
+         break;
+         }
+      case ConstFloatStatement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstFloat(readFloat()));
+         break;
+         }
+      case ConstDoubleStatement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstDouble(readDouble()));
+         break;
+         }
+      case ConstStringStatement:
+         {
+         TypeID result = readValueID();
+         define(result, b->ConstString(readString()));
+         break;
+         }
+      case ConstAddressStatement:
+         {
+         // addresses are replayed verbatim, so they are only meaningful in the recording process
+         TypeID result = readValueID();
+         define(result, b->ConstAddress(readLocation()));
+         break;
+         }
+      case TypedValueStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlType *dt = type(readTypeID());
+         TR::IlValue *v = value(readValueID());
+         define(result, (b->*(info->_typedValueOp))(dt, v));
+         break;
+         }
+      case UnaryValueStatement:
+         {
+         TypeID result = readValueID();
+         define(result, (b->*(info->_unaryValueOp))(value(readValueID())));
+         break;
+         }
+      case BinaryValueStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlValue *left = value(readValueID());
+         TR::IlValue *right = value(readValueID());
+         define(result, (b->*(info->_binaryValueOp))(left, right));
+         break;
+         }
+      case OverflowStatement:
+         {
+         TypeID result = readValueID();
+         TypeID handlerID = readBuilderID();
+         TR::IlValue *left = value(readValueID());
+         TR::IlValue *right = value(readValueID());
+         TR::IlBuilder *handler = builderSlot(handlerID);
+         define(result, (b->*(info->_overflowOp))(&handler, left, right));
+         defineBuilderSlot(handlerID, handler);
+         break;
+         }
+      case GotoStatement:
+         {
+         TypeID destID = readBuilderID();
+         TR::IlBuilder *dest = builderSlot(destID);
+         b->Goto(&dest);
+         defineBuilderSlot(destID, dest);
+         break;
+         }
+      case ReturnStatement:
+         b->Return();
+         break;
+      case ReturnValueStatement:
+         b->Return(value(readValueID()));
+         break;
+      case IfCmpStatement:
+      case IfCmpZeroStatement:
+         {
+         TypeID targetID = readBuilderID();
+         TR::IlValue *left = value(readValueID());
+         TR::IlBuilder *target = builderSlot(targetID);
+         if (info->_kind == IfCmpStatement)
+            (b->*(info->_ifCmpOp))(&target, left, value(readValueID()));
+         else
+            (b->*(info->_ifCmpZeroOp))(&target, left);
+         defineBuilderSlot(targetID, target);
+         break;
+         }
+      case IfAndStatement:
+      case IfOrStatement:
+         {
+         TypeID firstID = readBuilderID();
+         TypeID secondID = readBuilderID();
+         int32_t numTerms = readInt32();
+         std::vector<TR::IlBuilder::JBCondition *> terms(numTerms + 1);
+         for (int32_t t=0;t < numTerms;t++)
+            {
+            TR::IlBuilder *termBuilder = builder(readBuilderID());
+            terms[t] = b->MakeCondition(termBuilder, value(readValueID()));
+            }
+         TR::IlBuilder *first = builderSlot(firstID);
+         TR::IlBuilder *second = builderSlot(secondID);
+         if (info->_kind == IfAndStatement)
+            b->IfAnd(&first, &second, numTerms, &terms[0]);
+         else
+            b->IfOr(&first, &second, numTerms, &terms[0]);
+         defineBuilderSlot(firstID, first);
+         defineBuilderSlot(secondID, second);
+         break;
+         }
+      case IfThenElseStatement:
+         {
+         TypeID thenID = readBuilderID();
+         TypeID elseID = readBuilderID();
+         TR::IlValue *condition = value(readValueID());
+         TR::IlBuilder *thenPath = builderSlot(thenID);
+         TR::IlBuilder *elsePath = builderSlot(elseID);
+         b->IfThenElse(thenID ? &thenPath : NULL, elseID ? &elsePath : NULL, condition);
+         if (thenID)
+            defineBuilderSlot(thenID, thenPath);
+         if (elseID)
+            defineBuilderSlot(elseID, elsePath);
+         break;
+         }
+      case SwitchStatement:
+      case TableSwitchStatement:
+         {
+         TR::IlValue *selector = value(readValueID());
+         TypeID defaultID = readBuilderID();
+         bool generateBoundsCheck = (info->_kind == TableSwitchStatement) ? (readInt8() != 0) : false;
+         int32_t numCases = readInt32();
+         std::vector<TR::IlBuilder::JBCase *> cases(numCases + 1);
+         for (int32_t c=0;c < numCases;c++)
+            {
+            int32_t caseValue = readInt32();
+            TypeID caseID = readBuilderID();
+            int32_t fallsThrough = readInt32();
+            TR::IlBuilder *caseBuilder = builderSlot(caseID);
+            cases[c] = b->MakeCase(caseValue, &caseBuilder, fallsThrough);
+            defineBuilderSlot(caseID, caseBuilder);
+            }
+         TR::IlBuilder *defaultBuilder = builderSlot(defaultID);
+         if (info->_kind == SwitchStatement)
+            b->Switch(selector, &defaultBuilder, numCases, &cases[0]);
+         else
+            b->TableSwitch(selector, &defaultBuilder, generateBoundsCheck, numCases, &cases[0]);
+         defineBuilderSlot(defaultID, defaultBuilder);
+         break;
+         }
+      case SelectStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlValue *condition = value(readValueID());
+         TR::IlValue *trueValue = value(readValueID());
+         TR::IlValue *falseValue = value(readValueID());
+         define(result, b->Select(condition, trueValue, falseValue));
+         break;
+         }
+      case ForLoopStatement:
+         {
+         bool countsUp = (readInt8() != 0);
+         const char *indVar = readString();
+         TypeID bodyID = readBuilderID();
+         TypeID breakID = readBuilderID();
+         TypeID continueID = readBuilderID();
+         TR::IlValue *initial = value(readValueID());
+         TR::IlValue *end = value(readValueID());
+         TR::IlValue *increment = value(readValueID());
+         TR::IlBuilder *body = builderSlot(bodyID);
+         TR::IlBuilder *breakBuilder = builderSlot(breakID);
+         TR::IlBuilder *continueBuilder = builderSlot(continueID);
+         b->ForLoop(countsUp, indVar, &body, breakID ? &breakBuilder : NULL, continueID ? &continueBuilder : NULL, initial, end, increment);
+         defineBuilderSlot(bodyID, body);
+         if (breakID)
+            defineBuilderSlot(breakID, breakBuilder);
+         if (continueID)
+            defineBuilderSlot(continueID, continueBuilder);
+         break;
+         }
+      case DoWhileLoopStatement:
+      case WhileDoLoopStatement:
+         {
+         const char *condition = readString();
+         TypeID bodyID = readBuilderID();
+         TypeID breakID = readBuilderID();
+         TypeID continueID = readBuilderID();
+         TR::IlBuilder *body = builderSlot(bodyID);
+         TR::IlBuilder *breakBuilder = builderSlot(breakID);
+         TR::IlBuilder *continueBuilder = builderSlot(continueID);
+         if (info->_kind == DoWhileLoopStatement)
+            b->DoWhileLoop(condition, &body, breakID ? &breakBuilder : NULL, continueID ? &continueBuilder : NULL);
+         else
+            b->WhileDoLoop(condition, &body, breakID ? &breakBuilder : NULL, continueID ? &continueBuilder : NULL);
+         defineBuilderSlot(bodyID, body);
+         if (breakID)
+            defineBuilderSlot(breakID, breakBuilder);
+         if (continueID)
+            defineBuilderSlot(continueID, continueBuilder);
+         break;
+         }
+      case CallStatement:
+      case ComputedCallStatement:
+         {
+         TypeID result = readValueID();
+         const char *name = readString();
+         int32_t numArgs = readInt32();
+         std::vector<TR::IlValue *> args(numArgs + 1);
+         for (int32_t a=0;a < numArgs;a++)
+            args[a] = value(readValueID());
+         TR::IlValue *returnValue;
+         if (info->_kind == CallStatement)
+            returnValue = b->Call(name, numArgs, &args[0]);
+         else
+            returnValue = b->ComputedCall(name, numArgs, &args[0]);
+         if (result != 0)
+            define(result, returnValue);
+         break;
+         }
+      case AtomicAddStatement:
+         {
+         TypeID result = readValueID();
+         TR::IlValue *baseAddress = value(readValueID());
+         TR::IlValue *v = value(readValueID());
+         define(result, b->AtomicAdd(baseAddress, v));
+         break;
+         }
+      case TransactionStatement:
+         {
+         TypeID persistentFailureID = readBuilderID();
+         TypeID transientFailureID = readBuilderID();
+         TypeID transactionID = readBuilderID();
+         TR::IlBuilder *persistentFailure = builderSlot(persistentFailureID);
+         TR::IlBuilder *transientFailure = builderSlot(transientFailureID);
+         TR::IlBuilder *transaction = builderSlot(transactionID);
+         b->Transaction(&persistentFailure, &transientFailure, &transaction);
+         defineBuilderSlot(persistentFailureID, persistentFailure);
+         defineBuilderSlot(transientFailureID, transientFailure);
+         defineBuilderSlot(transactionID, transaction);
+         break;
+         }
+      case TransactionAbortStatement:
+         b->TransactionAbort();
+         break;
+
+      case UnsupportedStatement:
+         fail("statement %s cannot be replayed", info->_name);
+         break;
+      default:
+         fail("recording uses a statement that is not known to this replay engine");
+         break;
+      }
+   }
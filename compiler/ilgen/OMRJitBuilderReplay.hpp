@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_INCL
+#define OMR_JITBUILDERREPLAY_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+namespace TR { class IlBuilder; }
+namespace TR { class MethodBuilder; }
+namespace TR { class IlType; }
+namespace TR { class IlValue; }
+
+namespace OMR
+{
+
+/**
+ * @brief Rebuilds a MethodBuilder from a recording made by a JitBuilderRecorder.
+ *
+ * Replay is split in two parts like the recording: ReplayConstructor() replays
+ * the services called while the MethodBuilder was constructed (its name, types,
+ * parameters, locals and functions) and ReplayIL() replays the services called
+ * by its buildIL(). Subclasses read the tokens of a particular recording format.
+ *
+ * Strings read from the recording are referenced by the MethodBuilder (symbol
+ * and function names) so the replay object must live until the MethodBuilder
+ * has been compiled.
+ */
+class JitBuilderReplay
+   {
+   public:
+
+   typedef uint32_t TypeID;
+
+   JitBuilderReplay();
+   virtual ~JitBuilderReplay();
+
+   /**
+    * @brief replays the recording up to the end of the MethodBuilder's constructor
+    * @returns true if successful, false if the recording cannot be replayed (see failureReason())
+    */
+   bool ReplayConstructor(TR::MethodBuilder *mb);
+
+   /**
+    * @brief replays the rest of the recording, which builds the MethodBuilder's IL
+    * @returns true if successful, false if the recording cannot be replayed (see failureReason())
+    */
+   bool ReplayIL(TR::MethodBuilder *mb);
+
+   /**
+    * @brief returns why the recording could not be replayed, or NULL if it has not failed
+    */
+   const char *failureReason() { return _failed ? _failureReason : NULL; }
+
+   protected:
+
+   /**
+    * @brief Subclasses override these functions to read different input formats.
+    *        Malformed input is fatal.
+    */
+   virtual const char *readString() = 0;
+   virtual int8_t      readInt8() = 0;
+   virtual int16_t     readInt16() = 0;
+   virtual int32_t     readInt32() = 0;
+   virtual int64_t     readInt64() = 0;
+   virtual float       readFloat() = 0;
+   virtual double      readDouble() = 0;
+   virtual void      * readLocation() = 0;
+   virtual TypeID      readBuilderID() = 0;
+   virtual TypeID      readStatementID() = 0;
+   virtual TypeID      readTypeID() = 0;
+   virtual TypeID      readValueID() = 0;
+   virtual void        readEndStatement() { }
+
+   /**
+    * @brief returns a copy of the len characters at s that lives as long as this object
+    */
+   const char *persistString(const char *s, size_t len);
+
+   uint8_t _idSize;
+
+   private:
+
+   enum StatementKind
+      {
+      UnknownStatement,
+      UnsupportedStatement,
+      ID16BitStatement,
+      ID32BitStatement,
+      NewMethodBuilderStatement,
+      DoneConstructorStatement,
+      DefineNameStatement,
+      DefineFileStatement,
+      DefineLineStringStatement,
+      DefineLineNumberStatement,
+      DefineParameterStatement,
+      DefineArrayParameterStatement,
+      DefineReturnTypeStatement,
+      DefineLocalStatement,
+      DefineMemoryStatement,
+      DefineGlobalStatement,
+      DefineFunctionStatement,
+      AllLocalsHaveBeenDefinedStatement,
+      PrimitiveTypeStatement,
+      PointerTypeStatement,
+      NewIlBuilderStatement,
+      AppendBuilderStatement,
+      CopyStatement,
+      StoreStatement,
+      StoreOverStatement,
+      VectorStoreStatement,
+      StoreAtStatement,
+      VectorStoreAtStatement,
+      CreateLocalArrayStatement,
+      LoadStatement,
+      VectorLoadStatement,
+      LoadAtStatement,
+      VectorLoadAtStatement,
+      IndexAtStatement,
+      NullAddressStatement,
+      ConstInt8Statement,
+      ConstInt16Statement,
+      ConstInt32Statement,
+      ConstInt64Statement,
+      ConstFloatStatement,
+      ConstDoubleStatement,
+      ConstStringStatement,
+      ConstAddressStatement,
+      TypedValueStatement,          // result = service(type, value)
+      UnaryValueStatement,          // result = service(value)
+      BinaryValueStatement,         // result = service(left, right)
+      OverflowStatement,            // result = service(&handler, left, right)
+      GotoStatement,
+      ReturnStatement,
+      ReturnValueStatement,
+      IfCmpStatement,               // service(&target, left, right)
+      IfCmpZeroStatement,           // service(&target, condition)
+      IfAndStatement,
+      IfOrStatement,
+      IfThenElseStatement,
+      SwitchStatement,
+      TableSwitchStatement,
+      SelectStatement,
+      ForLoopStatement,
+      DoWhileLoopStatement,
+      WhileDoLoopStatement,
+      CallStatement,
+      ComputedCallStatement,
+      AtomicAddStatement,
+      TransactionStatement,
+      TransactionAbortStatement
+      };
+
+   struct StatementInfo;
+   static const StatementInfo _statementInfo[];
+
+   bool replay(TR::MethodBuilder *mb, bool stopAtEndOfConstructor);
+   void readHeader();
+   void defineStatement(TypeID id);
+   void replayStatement(TR::IlBuilder *b, const StatementInfo *info);
+   void fail(const char *format, ...);
+
+   void define(TypeID id, void *object);
+   void *lookup(TypeID id);
+   TR::IlBuilder *builder(TypeID id)           { return static_cast<TR::IlBuilder *>(lookup(id)); }
+   TR::IlType *type(TypeID id)                 { return static_cast<TR::IlType *>(lookup(id)); }
+   TR::IlValue *value(TypeID id)               { return static_cast<TR::IlValue *>(lookup(id)); }
+
+   /*
+    * Services that take an IlBuilder ** create the builder if it is NULL. The
+    * recording only refers to such a builder by ID, so a builder that has not
+    * been seen yet is passed as NULL and the ID is defined from the result.
+    */
+   TR::IlBuilder *builderSlot(TypeID id);
+   void defineBuilderSlot(TypeID id, TR::IlBuilder *b);
+
+   TR::MethodBuilder                     * _mb;
+   std::map<TypeID, void *>                _objects;
+   std::map<TypeID, const StatementInfo *> _statements;
+   std::vector<char *>                     _strings;
+   bool                                    _readHeader;
+   bool                                    _done;
+   bool                                    _failed;
+   char                                    _failureReason[256];
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_INCL)
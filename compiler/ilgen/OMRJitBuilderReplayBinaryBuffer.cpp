@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "infra/Assert.hpp"
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer(const uint8_t *buffer, size_t size)
+   : TR::JitBuilderReplay(), _buf(buffer, buffer + size), _pos(0)
+   {
+   }
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer(const std::vector<uint8_t> &buffer)
+   : TR::JitBuilderReplay(), _buf(buffer), _pos(0)
+   {
+   }
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer()
+   : TR::JitBuilderReplay(), _buf(), _pos(0)
+   {
+   }
+
+uint64_t
+OMR::JitBuilderReplayBinaryBuffer::readLittleEndian(size_t numBytes)
+   {
+   TR_ASSERT_FATAL(_pos + numBytes <= _buf.size(), "JBIL replay: truncated recording at offset %lu", (unsigned long)_pos);
+   uint64_t num = 0;
+   for (size_t b=0;b < numBytes;b++)
+      num |= ((uint64_t)_buf[_pos + b]) << (8 * b);
+   _pos += numBytes;
+   return num;
+   }
+
+const char *
+OMR::JitBuilderReplayBinaryBuffer::readString()
+   {
+   // length(int16) characters
+   size_t len = (size_t)(uint16_t) readInt16();
+   TR_ASSERT_FATAL(_pos + len <= _buf.size(), "JBIL replay: truncated string at offset %lu", (unsigned long)_pos);
+   const char *s = persistString(reinterpret_cast<const char *>(&_buf[0]) + _pos, len);
+   _pos += len;
+   return s;
+   }
+
+int8_t
+OMR::JitBuilderReplayBinaryBuffer::readInt8()
+   {
+   return (int8_t) readLittleEndian(1);
+   }
+
+int16_t
+OMR::JitBuilderReplayBinaryBuffer::readInt16()
+   {
+   return (int16_t) readLittleEndian(2);
+   }
+
+int32_t
+OMR::JitBuilderReplayBinaryBuffer::readInt32()
+   {
+   return (int32_t) readLittleEndian(4);
+   }
+
+int64_t
+OMR::JitBuilderReplayBinaryBuffer::readInt64()
+   {
+   return (int64_t) readLittleEndian(8);
+   }
+
+float
+OMR::JitBuilderReplayBinaryBuffer::readFloat()
+   {
+   int32_t bits = readInt32();
+   float num;
+   memcpy(&num, &bits, sizeof(num));
+   return num;
+   }
+
+double
+OMR::JitBuilderReplayBinaryBuffer::readDouble()
+   {
+   int64_t bits = readInt64();
+   double num;
+   memcpy(&num, &bits, sizeof(num));
+   return num;
+   }
+
+OMR::JitBuilderReplay::TypeID
+OMR::JitBuilderReplayBinaryBuffer::readID()
+   {
+   // IDs are written in as many bits as the recorder was using at the time
+   return (TypeID) readLittleEndian(_idSize / 8);
+   }
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+#define OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+
+#include <vector>
+#include "ilgen/JitBuilderReplay.hpp"
+
+namespace OMR
+{
+
+/**
+ * @brief Replays a recording made by JitBuilderRecorderBinaryBuffer
+ */
+class JitBuilderReplayBinaryBuffer : public TR::JitBuilderReplay
+   {
+   public:
+   JitBuilderReplayBinaryBuffer(const uint8_t *buffer, size_t size);
+   JitBuilderReplayBinaryBuffer(const std::vector<uint8_t> &buffer);
+   virtual ~JitBuilderReplayBinaryBuffer() { }
+
+   protected:
+   JitBuilderReplayBinaryBuffer();
+
+   virtual const char *readString();
+   virtual int8_t      readInt8();
+   virtual int16_t     readInt16();
+   virtual int32_t     readInt32();
+   virtual int64_t     readInt64();
+   virtual float       readFloat();
+   virtual double      readDouble();
+   virtual void      * readLocation()     { return (void *) readInt64(); }
+   virtual TypeID      readBuilderID()    { return readID(); }
+   virtual TypeID      readStatementID()  { return readID(); }
+   virtual TypeID      readTypeID()       { return readID(); }
+   virtual TypeID      readValueID()      { return readID(); }
+
+   TypeID readID();
+   uint64_t readLittleEndian(size_t numBytes);
+
+   std::vector<uint8_t> _buf;
+   size_t               _pos;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL)
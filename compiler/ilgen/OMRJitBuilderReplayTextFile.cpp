@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+
+#include "infra/Assert.hpp"
+#include "ilgen/JitBuilderReplayTextFile.hpp"
+
+OMR::JitBuilderReplayTextFile::JitBuilderReplayTextFile(const char *fileName)
+   : TR::JitBuilderReplay(), _text(), _pos(0)
+   {
+   std::ifstream file(fileName, std::ifstream::in);
+   TR_ASSERT_FATAL(file.is_open(), "JBIL replay: cannot open %s", fileName);
+   std::stringstream contents;
+   contents << file.rdbuf();
+   _text = contents.str();
+   }
+
+void
+OMR::JitBuilderReplayTextFile::skipSpaces()
+   {
+   while (_pos < _text.length() && _text[_pos] == ' ')
+      _pos++;
+   }
+
+bool
+OMR::JitBuilderReplayTextFile::lookingAt(const char *s)
+   {
+   return _text.compare(_pos, strlen(s), s) == 0;
+   }
+
+void
+OMR::JitBuilderReplayTextFile::expect(const char *s)
+   {
+   TR_ASSERT_FATAL(lookingAt(s), "JBIL replay: expected '%s' at offset %lu", s, (unsigned long)_pos);
+   _pos += strlen(s);
+   }
+
+const char *
+OMR::JitBuilderReplayTextFile::readString()
+   {
+   // "length [characters]"
+   skipSpaces();
+   expect("\"");
+   size_t len = (size_t) readInteger();
+   expect(" [");
+   TR_ASSERT_FATAL(_pos + len <= _text.length(), "JBIL replay: truncated string at offset %lu", (unsigned long)_pos);
+   const char *s = persistString(_text.data() + _pos, len);
+   _pos += len;
+   expect("]\"");
+   return s;
+   }
+
+int64_t
+OMR::JitBuilderReplayTextFile::readInteger()
+   {
+   skipSpaces();
+   const char *start = _text.c_str() + _pos;
+   char *end = NULL;
+   int64_t num = (int64_t) strtoll(start, &end, 10);
+   TR_ASSERT_FATAL(end != start, "JBIL replay: expected a number at offset %lu", (unsigned long)_pos);
+   _pos += end - start;
+   return num;
+   }
+
+double
+OMR::JitBuilderReplayTextFile::readFloatingPoint()
+   {
+   skipSpaces();
+   const char *start = _text.c_str() + _pos;
+   char *end = NULL;
+   double num = strtod(start, &end);
+   TR_ASSERT_FATAL(end != start, "JBIL replay: expected a number at offset %lu", (unsigned long)_pos);
+   _pos += end - start;
+   return num;
+   }
+
+void *
+OMR::JitBuilderReplayTextFile::readLocation()
+   {
+   skipSpaces();
+   expect("{");
+   const char *start = _text.c_str() + _pos;
+   char *end = NULL;
+   uintptr_t location = (uintptr_t) strtoull(start, &end, 16);
+   TR_ASSERT_FATAL(end != start, "JBIL replay: expected an address at offset %lu", (unsigned long)_pos);
+   _pos += end - start;
+   expect("}");
+   return (void *) location;
+   }
+
+OMR::JitBuilderReplay::TypeID
+OMR::JitBuilderReplayTextFile::readPrefixedID(const char *prefix)
+   {
+   skipSpaces();
+   expect(prefix);
+   return (TypeID) readInteger();
+   }
+
+OMR::JitBuilderReplay::TypeID
+OMR::JitBuilderReplayTextFile::readBuilderID()
+   {
+   skipSpaces();
+   if (lookingAt("Def"))
+      {
+      _pos += 3;
+      return 0;
+      }
+
+   // the end of the recording is marked by a bare reserved ID
+   if (lookingAt("ID"))
+      return readPrefixedID("ID");
+
+   return readPrefixedID("B");
+   }
+
+void
+OMR::JitBuilderReplayTextFile::readEndStatement()
+   {
+   skipSpaces();
+   expect("\n");
+   }
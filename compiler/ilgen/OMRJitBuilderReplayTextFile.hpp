@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_TEXTFILE_INCL
+#define OMR_JITBUILDERREPLAY_TEXTFILE_INCL
+
+#include <string>
+#include "ilgen/JitBuilderReplay.hpp"
+
+namespace OMR
+{
+
+/**
+ * @brief Replays a recording written by JitBuilderRecorderTextFile
+ */
+class JitBuilderReplayTextFile : public TR::JitBuilderReplay
+   {
+   public:
+   JitBuilderReplayTextFile(const char *fileName);
+   virtual ~JitBuilderReplayTextFile() { }
+
+   protected:
+   virtual const char *readString();
+   virtual int8_t      readInt8()         { return (int8_t) readInteger(); }
+   virtual int16_t     readInt16()        { return (int16_t) readInteger(); }
+   virtual int32_t     readInt32()        { return (int32_t) readInteger(); }
+   virtual int64_t     readInt64()        { return readInteger(); }
+   virtual float       readFloat()        { return (float) readFloatingPoint(); }
+   virtual double      readDouble()       { return readFloatingPoint(); }
+   virtual void      * readLocation();
+   virtual TypeID      readBuilderID();
+   virtual TypeID      readStatementID()  { return readPrefixedID("S"); }
+   virtual TypeID      readTypeID()       { return readPrefixedID("T"); }
+   virtual TypeID      readValueID()      { return readPrefixedID("V"); }
+   virtual void        readEndStatement();
+
+   int64_t readInteger();
+   double readFloatingPoint();
+   TypeID readPrefixedID(const char *prefix);
+   void skipSpaces();
+   bool lookingAt(const char *s);
+   void expect(const char *s);
+
+   std::string _text;
+   size_t      _pos;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_TEXTFILE_INCL)
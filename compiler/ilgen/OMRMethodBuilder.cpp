@@ -21,6 +21,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include <stdint.h>
 #include "compile/Method.hpp"
@@ -47,6 +49,8 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlBuilder.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/JitBuilderRecorderBinaryBuffer.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
@@ -97,7 +101,7 @@ OMR::MethodBuilder::MemoryManager::~MemoryManager()
    ::operator delete(_segmentProvider, TR::Compiler->persistentAllocator());
    }
 
-OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState)
+OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState, TR::JitBuilderRecorder *recorder)
    : TR::IlBuilder(asMethodBuilder(), types),
    _clientCallbackRequestFunction(0),
    _methodName("NoName"),
@@ -125,9 +129,27 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _recorder(recorder),
+   _ownsRecorder(false)
    {
    _definingLine[0] = '\0';
+
+   // capture every method compiled through the client API without changing the client
+   if (_recorder == NULL && feGetEnv("TR_JitBuilderRecordDirectory") != NULL)
+      {
+      _recorder = new TR::JitBuilderRecorderBinaryBuffer(NULL, NULL);
+      _ownsRecorder = true;
+      }
+
+   if (_recorder)
+      {
+      TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+      _recorder->setMethodBuilderRecorder(asMethodBuilder());
+      _recorder->StoreID(static_cast<TR::IlBuilder *>(asMethodBuilder()));
+      _recorder->BeginStatement(StatementName::STATEMENT_NEWMETHODBUILDER);
+      _recorder->EndStatement();
+      }
    }
 
 // used when inlining:
@@ -158,7 +180,9 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _recorder(NULL),
+   _ownsRecorder(false)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -175,6 +199,9 @@ OMR::MethodBuilder::~MethodBuilder()
    _symbolIsArray.clear();
    _memoryLocations.clear();
    _functions.clear();
+
+   if (_ownsRecorder)
+      delete _recorder;
    }
 
 TR::MethodBuilder *
@@ -489,52 +516,145 @@ OMR::MethodBuilder::isSymbolAnArray(const char *name)
    return _symbolIsArray.find(name) != _symbolIsArray.end();
    }
 
+void
+OMR::MethodBuilder::AllLocalsHaveBeenDefined()
+   {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   _newSymbolsAreTemps = true;
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+      rec->EndStatement();
+      }
+   }
+
+void
+OMR::MethodBuilder::DefineFile(const char *file)
+   {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   _definingFile = file;
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEFILE);
+      rec->String(file);
+      rec->EndStatement();
+      }
+   }
+
 void
 OMR::MethodBuilder::DefineLine(const char *line)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
    snprintf(_definingLine, MAX_LINE_NUM_LEN * sizeof(char), "%s", line);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINELINESTRING);
+      rec->String(line);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineLine(int line)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
    snprintf(_definingLine, MAX_LINE_NUM_LEN * sizeof(char), "%d", line);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINELINENUMBER);
+      rec->Number((int32_t)line);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineName(const char *name)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
    _methodName = name;
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINENAME);
+      rec->String(name);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineLocal(const char *name, TR::IlType *dt)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(dt);
+
    TR_ASSERT_FATAL(_symbolTypes.find(name) == _symbolTypes.end(), "Symbol '%s' already defined", name);
    _symbolTypes.insert(std::make_pair(name, dt));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINELOCAL);
+      rec->String(name);
+      rec->Type(dt);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineMemory(const char *name, TR::IlType *dt, void *location)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(dt);
+
    TR_ASSERT_FATAL(_memoryLocations.find(name) == _memoryLocations.end(), "Memory '%s' already defined", name);
 
    _symbolTypes.insert(std::make_pair(name, dt));
    _memoryLocations.insert(std::make_pair(name, location));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEMEMORY);
+      rec->String(name);
+      rec->Type(dt);
+      rec->Location(location);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineGlobal(const char *name, TR::IlType *dt, void *location)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(dt);
+
    TR_ASSERT_FATAL(_globals.find(name) == _globals.end(), "Global '%s' already defined", name);
 
    _globals.insert(std::make_pair(name, location));
    _symbolTypes.insert(std::make_pair(name, dt));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEGLOBAL);
+      rec->String(name);
+      rec->Type(dt);
+      rec->Location(location);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineParameter(const char *name, TR::IlType *dt)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(dt);
+
    TR_ASSERT_FATAL(_parameterSlot.find(name) == _parameterSlot.end(), "Parameter '%s' already defined", name);
 
    _parameterSlot.insert(std::make_pair(name, _numParameters));
@@ -542,20 +662,51 @@ OMR::MethodBuilder::DefineParameter(const char *name, TR::IlType *dt)
    _symbolTypes.insert(std::make_pair(name, dt));
 
    _numParameters++;
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEPARAMETER);
+      rec->String(name);
+      rec->Type(dt);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineArrayParameter(const char *name, TR::IlType *elementType)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(elementType);
+
    DefineParameter(name, elementType);
 
    _symbolIsArray.insert(name);
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEARRAYPARAMETER);
+      rec->String(name);
+      rec->Type(elementType);
+      rec->EndStatement();
+      }
    }
 
 void
 OMR::MethodBuilder::DefineReturnType(TR::IlType *dt)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      rec->EnsureTypeDefined(dt);
+
    _returnType = dt;
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINERETURNTYPE);
+      rec->Type(dt);
+      rec->EndStatement();
+      }
    }
 
 void
@@ -586,6 +737,14 @@ OMR::MethodBuilder::DefineFunction(const char* const name,
                               int32_t          numParms,
                               TR::IlType     ** parmTypes)
    {
+   TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->EnsureTypeDefined(returnType);
+      for (int32_t p=0;p < numParms;p++)
+         rec->EnsureTypeDefined(parmTypes[p]);
+      }
+
    TR_ASSERT_FATAL(_functions.find(name) == _functions.end(), "Function '%s' already defined", name);
 
    // copy parameter types so don't have to force caller to keep the parmTypes array alive
@@ -604,6 +763,20 @@ OMR::MethodBuilder::DefineFunction(const char* const name,
                                                                         0);
 
    _functions.insert(std::make_pair(name, method));
+
+   if (TR::JitBuilderRecorder *rec = scope.recorder())
+      {
+      rec->BeginStatement(StatementName::STATEMENT_DEFINEFUNCTION);
+      rec->String(name);
+      rec->String(fileName ? fileName : "");
+      rec->String(lineNumber ? lineNumber : "");
+      rec->Location(entryPoint);
+      rec->Type(returnType);
+      rec->Number(numParms);
+      for (int32_t p=0;p < numParms;p++)
+         rec->Type(parmTypes[p]);
+      rec->EndStatement();
+      }
    }
 
 const char *
@@ -722,6 +895,17 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
 int32_t
 OMR::MethodBuilder::Compile(void **entry)
    {
+   if (_recorder)
+      {
+      // everything after this statement is recorded while the compilation runs buildIL()
+      TR::JitBuilderRecorder::ServiceScope scope(_recorder);
+      if (TR::JitBuilderRecorder *rec = scope.recorder())
+         {
+         rec->BeginStatement(StatementName::STATEMENT_DONECONSTRUCTOR);
+         rec->EndStatement();
+         }
+      }
+
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
@@ -738,9 +922,32 @@ OMR::MethodBuilder::Compile(void **entry)
    _symbols.clear();
    _connectedTrees = false;
 
+   if (_ownsRecorder)
+      writeRecording();
+
    return rc;
    }
 
+void
+OMR::MethodBuilder::writeRecording()
+   {
+   TR::JitBuilderRecorderBinaryBuffer *recorder = static_cast<TR::JitBuilderRecorderBinaryBuffer *>(_recorder);
+   recorder->Close();
+
+   const char *directory = feGetEnv("TR_JitBuilderRecordDirectory");
+   std::string fileName = std::string(directory) + "/" + _methodName + ".jbil";
+   std::ofstream file(fileName.c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+   std::vector<uint8_t> &buffer = recorder->buffer();
+   if (!buffer.empty())
+      file.write(reinterpret_cast<const char *>(&buffer[0]), buffer.size());
+   file.close();
+
+   // a MethodBuilder is only recorded the first time it is compiled
+   delete _recorder;
+   _recorder = NULL;
+   _ownsRecorder = false;
+   }
+
 void *
 OMR::MethodBuilder::client()
    {
@@ -37,6 +37,7 @@ namespace TR { class BytecodeBuilder; }
 namespace TR { class ResolvedMethod; }
 namespace TR { class SymbolReference; }
 namespace TR { class VirtualMachineState; }
+namespace TR { class JitBuilderRecorder; }
 
 namespace TR { class SegmentProvider; }
 namespace TR { class Region; }
@@ -54,7 +55,14 @@ class MethodBuilder : public TR::IlBuilder
    public:
    TR_ALLOC(TR_Memory::IlGenerator)
 
-   MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState = NULL);
+   /**
+    * @param types the TypeDictionary used to define this method's types
+    * @param vmState the VirtualMachineState to propagate to bytecode builders, if any
+    * @param recorder if not NULL, records the services called on this method so they can be replayed
+    *        later. If NULL and the environment variable TR_JitBuilderRecordDirectory names a directory,
+    *        a recording is written to <directory>/<method name>.jbil when the method is compiled.
+    */
+   MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState = NULL, TR::JitBuilderRecorder *recorder = NULL);
    MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachineState *vmState = NULL);
    virtual ~MethodBuilder();
 
@@ -84,11 +92,16 @@ class MethodBuilder : public TR::IlBuilder
 
    TR::TypeDictionary *typeDictionary()                      { return _types; }
 
+   /**
+    * @brief returns the recorder for this method, or NULL if it is not being recorded
+    */
+   TR::JitBuilderRecorder *recorder()                        { return _recorder; }
+
    const char *getDefiningFile()                             { return _definingFile; }
    const char *getDefiningLine()                             { return _definingLine; }
 
    const char *GetMethodName()                               { return _methodName; }
-   void AllLocalsHaveBeenDefined()                           { _newSymbolsAreTemps = true; }
+   void AllLocalsHaveBeenDefined();
 
    TR::IlType *getReturnType()                               { return _returnType; }
    int32_t getNumParameters()                                { return _numParameters; }
@@ -111,7 +124,7 @@ class MethodBuilder : public TR::IlBuilder
    void AppendBuilder(TR::BytecodeBuilder *bb) { AppendBytecodeBuilder(bb); }
    void AppendBuilder(TR::IlBuilder *b)    { this->OMR::IlBuilder::AppendBuilder(b); }
 
-   void DefineFile(const char *file)                         { _definingFile = file; }
+   void DefineFile(const char *file);
 
    void DefineLine(const char *line);
    void DefineLine(int line);
@@ -296,6 +309,11 @@ class MethodBuilder : public TR::IlBuilder
     */
    const char * adjustNameForInlinedSite(const char *name);
 
+   /*
+    * @brief writes the recording made because TR_JitBuilderRecordDirectory is set, then stops recording
+    */
+   void writeRecording();
+
    private:
    // We have MemoryManager as the first member of TypeDictionary, so that
    // it is the last one to get destroyed and all objects allocated using
@@ -388,6 +406,9 @@ class MethodBuilder : public TR::IlBuilder
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   TR::JitBuilderRecorder    * _recorder;
+   bool                        _ownsRecorder;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
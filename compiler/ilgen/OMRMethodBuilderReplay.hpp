@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_METHODBUILDERREPLAY_INCL
+#define OMR_METHODBUILDERREPLAY_INCL
+
+#include "ilgen/MethodBuilder.hpp"
+
+namespace TR { class JitBuilderReplay; }
+namespace TR { class JitBuilderRecorder; }
+
+namespace OMR
+{
+
+/**
+ * @brief A MethodBuilder whose definitions and IL come from a recording.
+ *
+ * The constructor replays the recorded constructor of the original MethodBuilder
+ * and buildIL() replays the rest of the recording, so compiling this object
+ * compiles the recorded method. If the recording cannot be replayed, buildIL()
+ * fails and the replay's failureReason() says why.
+ */
+class MethodBuilderReplay : public TR::MethodBuilder
+   {
+   public:
+   TR_ALLOC(TR_Memory::IlGenerator)
+
+   /**
+    * @param types the TypeDictionary used to look up the recorded types
+    * @param replay the recording to replay, which must outlive this object
+    * @param recorder optionally records the replayed services, which should match the original recording
+    */
+   MethodBuilderReplay(TR::TypeDictionary *types, TR::JitBuilderReplay *replay, TR::JitBuilderRecorder *recorder = NULL);
+
+   virtual bool buildIL();
+
+   TR::JitBuilderReplay *replay()   { return _replay; }
+
+   protected:
+   TR::JitBuilderReplay *_replay;
+   bool                  _replayedConstructor;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_METHODBUILDERREPLAY_INCL)
@@ -44,6 +44,7 @@ static const char * const STATEMENT_DEFINEARRAYPARAMETER         = "DefineArrayP
 static const char * const STATEMENT_DEFINERETURNTYPE             = "DefineReturnType";
 static const char * const STATEMENT_DEFINELOCAL                  = "DefineLocal";
 static const char * const STATEMENT_DEFINEMEMORY                 = "DefineMemory";
+static const char * const STATEMENT_DEFINEGLOBAL                 = "DefineGlobal";
 static const char * const STATEMENT_DEFINEFUNCTION               = "DefineFunction";
 static const char * const STATEMENT_DEFINESTRUCT                 = "DefineStruct";
 static const char * const STATEMENT_DEFINEUNION                  = "DefineUnion";
@@ -54,6 +55,7 @@ static const char * const STATEMENT_NEWMETHODBUILDER             = "NewMethodBui
 static const char * const STATEMENT_NEWILBUILDER                 = "NewIlBuilder";
 static const char * const STATEMENT_NEWBYTECODEBUILDER           = "NewBytecodeBuilder";
 static const char * const STATEMENT_ALLLOCALSHAVEBEENDEFINED     = "AllLocalsHaveBeenDefined";
+static const char * const STATEMENT_COPY                         = "Copy";
 static const char * const STATEMENT_NULLADDRESS                  = "NullAddress";
 static const char * const STATEMENT_CONSTINT8                    = "ConstInt8";
 static const char * const STATEMENT_CONSTINT16                   = "ConstInt16";
@@ -91,7 +93,9 @@ static const char * const STATEMENT_SUBWITHUNSIGNEDOVERFLOW      = "SubWithUnsig
 static const char * const STATEMENT_MUL                          = "Mul";
 static const char * const STATEMENT_MULWITHOVERFLOW              = "MulWithOverflow";
 static const char * const STATEMENT_DIV                          = "Div";
+static const char * const STATEMENT_UNSIGNEDDIV                  = "UnsignedDiv";
 static const char * const STATEMENT_REM                          = "Rem";
+static const char * const STATEMENT_UNSIGNEDREM                  = "UnsignedRem";
 static const char * const STATEMENT_AND                          = "And";
 static const char * const STATEMENT_OR                           = "Or";
 static const char * const STATEMENT_XOR                          = "Xor";
@@ -133,11 +137,13 @@ static const char * const STATEMENT_DOWHILELOOP                  = "DoWhileLoop"
 static const char * const STATEMENT_WHILEDOLOOP                  = "WhileDoLoop";
 static const char * const STATEMENT_FORLOOP                      = "ForLoop";
 static const char * const STATEMENT_CALL                         = "Call";
+static const char * const STATEMENT_CALLMETHODBUILDER            = "CallMethodBuilder";
 static const char * const STATEMENT_COMPUTEDCALL                 = "ComputedCall";
 static const char * const STATEMENT_DONECONSTRUCTOR              = "DoneConstructor";
 static const char * const STATEMENT_IFAND                        = "IfAnd";
 static const char * const STATEMENT_IFOR                         = "IfOr";
 static const char * const STATEMENT_SWITCH                       = "Switch";
+static const char * const STATEMENT_TABLESWITCH                  = "TableSwitch";
 static const char * const STATEMENT_TRANSACTION                  = "Transaction";
 static const char * const STATEMENT_TRANSACTIONABORT             = "TransactionAbort";
 
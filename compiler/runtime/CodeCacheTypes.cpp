@@ -21,6 +21,7 @@
 
 #include "runtime/CodeCacheTypes.hpp"
 #include "runtime/CodeCacheManager.hpp"
+#include "infra/Bit.hpp"
 
 namespace OMR
 {
@@ -185,4 +186,284 @@ CodeCacheHashTable::remove(CodeCacheHashEntry *entry)
    return false;
    }
 
+
+
+// Treap priority of a free block, derived from its address so that no
+// space is needed to store it
+//
+static uint32_t
+freeBlockPriority(CodeCacheFreeCacheBlock *block)
+   {
+   uint64_t key = (uint64_t)(uintptr_t)block;
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdULL;
+   key ^= key >> 33;
+   return (uint32_t)key;
+   }
+
+static CodeCacheFreeCacheBlock *
+insertFreeBlockByAddress(CodeCacheFreeCacheBlock *root, CodeCacheFreeCacheBlock *block)
+   {
+   if (!root)
+      {
+      block->_left = NULL;
+      block->_right = NULL;
+      return block;
+      }
+
+   if ((uint8_t *)block < (uint8_t *)root)
+      {
+      root->_left = insertFreeBlockByAddress(root->_left, block);
+      if (freeBlockPriority(root->_left) > freeBlockPriority(root))
+         {
+         // rotate right
+         CodeCacheFreeCacheBlock *left = root->_left;
+         root->_left = left->_right;
+         left->_right = root;
+         root = left;
+         }
+      }
+   else
+      {
+      root->_right = insertFreeBlockByAddress(root->_right, block);
+      if (freeBlockPriority(root->_right) > freeBlockPriority(root))
+         {
+         // rotate left
+         CodeCacheFreeCacheBlock *right = root->_right;
+         root->_right = right->_left;
+         right->_left = root;
+         root = right;
+         }
+      }
+   return root;
+   }
+
+// Join two treaps where every block in low is at a lower address than every block in high
+//
+static CodeCacheFreeCacheBlock *
+joinFreeBlocksByAddress(CodeCacheFreeCacheBlock *low, CodeCacheFreeCacheBlock *high)
+   {
+   if (!low)
+      return high;
+   if (!high)
+      return low;
+
+   if (freeBlockPriority(low) > freeBlockPriority(high))
+      {
+      low->_right = joinFreeBlocksByAddress(low->_right, high);
+      return low;
+      }
+   high->_left = joinFreeBlocksByAddress(low, high->_left);
+   return high;
+   }
+
+static CodeCacheFreeCacheBlock *
+removeFreeBlockByAddress(CodeCacheFreeCacheBlock *root, CodeCacheFreeCacheBlock *block)
+   {
+   TR_ASSERT(root, "Free block %p is not in the address index", block);
+   if (root == block)
+      return joinFreeBlocksByAddress(root->_left, root->_right);
+
+   if ((uint8_t *)block < (uint8_t *)root)
+      root->_left = removeFreeBlockByAddress(root->_left, block);
+   else
+      root->_right = removeFreeBlockByAddress(root->_right, block);
+   return root;
+   }
+
+
+void
+CodeCacheFreeBlockIndex::initialize()
+   {
+   _addressRoot = NULL;
+   for (size_t i = 0; i < CODECACHE_FREE_BLOCK_SIZE_CLASSES; i++)
+      _sizeClassHeads[i] = NULL;
+   for (size_t i = 0; i < CODECACHE_FREE_BLOCK_SIZE_CLASSES / 64; i++)
+      _nonEmptySizeClasses[i] = 0;
+   _blockCount = 0;
+   _totalSize = 0;
+   }
+
+
+// Size classes are CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER equal slices of
+// each power of two range of sizes, so the classes are contiguous and increasing
+//
+size_t
+CodeCacheFreeBlockIndex::sizeClass(size_t size)
+   {
+   if (size < CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER)
+      return size;
+
+   int32_t highBit = 63 - leadingZeroes((uint64_t)size);
+   size_t slice = (size >> (highBit - 2)) & (CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER - 1);
+   return ((size_t)(highBit - 1) * CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER) + slice;
+   }
+
+
+size_t
+CodeCacheFreeBlockIndex::sizeClassLowerBound(size_t sizeClass)
+   {
+   if (sizeClass < CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER)
+      return sizeClass;
+
+   size_t highBit = (sizeClass / CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER) + 1;
+   size_t slice = sizeClass % CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER;
+   return ((size_t)1 << highBit) + (slice << (highBit - 2));
+   }
+
+
+void
+CodeCacheFreeBlockIndex::add(CodeCacheFreeCacheBlock *block)
+   {
+   size_t sizeClass = CodeCacheFreeBlockIndex::sizeClass(block->_size);
+
+   block->_sizeClassPrev = NULL;
+   block->_sizeClassNext = _sizeClassHeads[sizeClass];
+   if (block->_sizeClassNext)
+      block->_sizeClassNext->_sizeClassPrev = block;
+   _sizeClassHeads[sizeClass] = block;
+   _nonEmptySizeClasses[sizeClass / 64] |= ((uint64_t)1 << (sizeClass % 64));
+
+   _addressRoot = insertFreeBlockByAddress(_addressRoot, block);
+
+   _blockCount++;
+   _totalSize += block->_size;
+   }
+
+
+void
+CodeCacheFreeBlockIndex::remove(CodeCacheFreeCacheBlock *block)
+   {
+   size_t sizeClass = CodeCacheFreeBlockIndex::sizeClass(block->_size);
+
+   if (block->_sizeClassNext)
+      block->_sizeClassNext->_sizeClassPrev = block->_sizeClassPrev;
+   if (block->_sizeClassPrev)
+      {
+      block->_sizeClassPrev->_sizeClassNext = block->_sizeClassNext;
+      }
+   else
+      {
+      TR_ASSERT(_sizeClassHeads[sizeClass] == block, "Free block %p is not in its size class", block);
+      _sizeClassHeads[sizeClass] = block->_sizeClassNext;
+      if (!_sizeClassHeads[sizeClass])
+         _nonEmptySizeClasses[sizeClass / 64] &= ~((uint64_t)1 << (sizeClass % 64));
+      }
+
+   _addressRoot = removeFreeBlockByAddress(_addressRoot, block);
+
+   _blockCount--;
+   _totalSize -= block->_size;
+   }
+
+
+size_t
+CodeCacheFreeBlockIndex::nextNonEmptySizeClass(size_t sizeClass)
+   {
+   for (size_t word = sizeClass / 64; word < CODECACHE_FREE_BLOCK_SIZE_CLASSES / 64; word++)
+      {
+      uint64_t bits = _nonEmptySizeClasses[word];
+      if (word == sizeClass / 64)
+         bits &= ~(uint64_t)0 << (sizeClass % 64);
+      if (bits)
+         return (word * 64) + trailingZeroes(bits);
+      }
+   return CODECACHE_FREE_BLOCK_SIZE_CLASSES;
+   }
+
+
+size_t
+CodeCacheFreeBlockIndex::highestNonEmptySizeClass()
+   {
+   for (size_t word = CODECACHE_FREE_BLOCK_SIZE_CLASSES / 64; word > 0; word--)
+      {
+      uint64_t bits = _nonEmptySizeClasses[word - 1];
+      if (bits)
+         return ((word - 1) * 64) + 63 - leadingZeroes(bits);
+      }
+   return CODECACHE_FREE_BLOCK_SIZE_CLASSES;
+   }
+
+
+CodeCacheFreeCacheBlock *
+CodeCacheFreeBlockIndex::findBestFit(size_t size)
+   {
+   CodeCacheFreeCacheBlock *bestFit = NULL;
+
+   // Blocks in the size class of the request may or may not be big enough;
+   // every block in a higher size class is big enough, so only the first
+   // non-empty one needs to be looked at
+   for (size_t sizeClass = CodeCacheFreeBlockIndex::sizeClass(size);
+        sizeClass < CODECACHE_FREE_BLOCK_SIZE_CLASSES && !bestFit;
+        sizeClass = nextNonEmptySizeClass(sizeClass + 1))
+      {
+      for (CodeCacheFreeCacheBlock *block = _sizeClassHeads[sizeClass]; block; block = block->_sizeClassNext)
+         {
+         if (block->_size >= size &&
+             (!bestFit ||
+              block->_size < bestFit->_size ||
+              (block->_size == bestFit->_size && (uint8_t *)block < (uint8_t *)bestFit)))
+            bestFit = block;
+         }
+      }
+   return bestFit;
+   }
+
+
+size_t
+CodeCacheFreeBlockIndex::largestBlockSize()
+   {
+   size_t largest = 0;
+   size_t sizeClass = highestNonEmptySizeClass();
+   if (sizeClass < CODECACHE_FREE_BLOCK_SIZE_CLASSES)
+      {
+      for (CodeCacheFreeCacheBlock *block = _sizeClassHeads[sizeClass]; block; block = block->_sizeClassNext)
+         {
+         if (block->_size > largest)
+            largest = block->_size;
+         }
+      }
+   return largest;
+   }
+
+
+CodeCacheFreeCacheBlock *
+CodeCacheFreeBlockIndex::findPredecessor(uint8_t *address)
+   {
+   CodeCacheFreeCacheBlock *predecessor = NULL;
+   for (CodeCacheFreeCacheBlock *node = _addressRoot; node; )
+      {
+      if ((uint8_t *)node < address)
+         {
+         predecessor = node;
+         node = node->_right;
+         }
+      else
+         {
+         node = node->_left;
+         }
+      }
+   return predecessor;
+   }
+
+
+CodeCacheFreeCacheBlock *
+CodeCacheFreeBlockIndex::findSuccessor(uint8_t *address)
+   {
+   CodeCacheFreeCacheBlock *successor = NULL;
+   for (CodeCacheFreeCacheBlock *node = _addressRoot; node; )
+      {
+      if ((uint8_t *)node >= address)
+         {
+         successor = node;
+         node = node->_left;
+         }
+      else
+         {
+         node = node->_right;
+         }
+      }
+   return successor;
+   }
+
 }
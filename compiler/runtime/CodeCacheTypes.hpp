@@ -160,10 +160,74 @@ CodeCacheMethodHeader *getCodeCacheMethodHeader(char *p, int searchLimit, Method
 struct CodeCacheFreeCacheBlock
    {
    size_t _size;
-   CodeCacheFreeCacheBlock *_next;
+   CodeCacheFreeCacheBlock *_next;          /*!< next free block by address, across the warm and cold regions */
+   CodeCacheFreeCacheBlock *_prev;          /*!< previous free block by address */
+   CodeCacheFreeCacheBlock *_sizeClassNext; /*!< next free block in the same size class list */
+   CodeCacheFreeCacheBlock *_sizeClassPrev; /*!< previous free block in the same size class list */
+   CodeCacheFreeCacheBlock *_left;          /*!< subtree of free blocks at lower addresses in the same region */
+   CodeCacheFreeCacheBlock *_right;         /*!< subtree of free blocks at higher addresses in the same region */
    };
 #define MIN_SIZE_BLOCK (sizeof(CodeCacheFreeCacheBlock) > 96 ? sizeof(CodeCacheFreeCacheBlock) : 96)
 
+// Each power of two range of block sizes is split into this many size classes
+#define CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER 4
+#define CODECACHE_FREE_BLOCK_SIZE_CLASSES (CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER * 64)
+
+/**
+ * Index over the free blocks in one region (warm or cold) of a code cache.
+ *
+ * Free blocks are kept in segregated lists by size class, so a best fit search
+ * only looks at blocks of about the requested size, and in a treap ordered by
+ * address, so the neighbours a freed block may be coalesced with are found
+ * without walking the free block list.  All the links live in the free blocks
+ * themselves; the index only holds the roots.
+ */
+struct CodeCacheFreeBlockIndex
+   {
+   void initialize();
+
+   void add(CodeCacheFreeCacheBlock *block);
+   void remove(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Find the smallest free block of at least the given size, preferring
+    *        the lowest address amongst blocks of the same size
+    * @returns The free block, or NULL if none is big enough
+    */
+   CodeCacheFreeCacheBlock *findBestFit(size_t size);
+
+   /**
+    * @returns The free block with the highest address below the given address, or NULL
+    */
+   CodeCacheFreeCacheBlock *findPredecessor(uint8_t *address);
+
+   /**
+    * @returns The free block with the lowest address at or above the given address, or NULL
+    */
+   CodeCacheFreeCacheBlock *findSuccessor(uint8_t *address);
+
+   size_t largestBlockSize();
+
+   size_t blockCount() { return _blockCount; }
+   size_t totalSize() { return _totalSize; }
+
+   CodeCacheFreeCacheBlock *sizeClassHead(size_t sizeClass) { return _sizeClassHeads[sizeClass]; }
+
+   static size_t sizeClass(size_t size);
+   static size_t sizeClassLowerBound(size_t sizeClass);
+
+   private:
+
+   size_t nextNonEmptySizeClass(size_t sizeClass);
+   size_t highestNonEmptySizeClass();
+
+   CodeCacheFreeCacheBlock *_addressRoot;
+   CodeCacheFreeCacheBlock *_sizeClassHeads[CODECACHE_FREE_BLOCK_SIZE_CLASSES];
+   uint64_t _nonEmptySizeClasses[CODECACHE_FREE_BLOCK_SIZE_CLASSES / 64];
+   size_t _blockCount;
+   size_t _totalSize;
+   };
+
 
 struct FaintCacheBlock
    {
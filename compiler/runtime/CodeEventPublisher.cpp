@@ -0,0 +1,768 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/CodeEventPublisher.hpp"
+
+#include <string.h>
+#include <new>
+#include "AtomicSupport.hpp"
+#include "omrformatconsts.h"
+#include "thread_api.h"
+
+#if defined(OMR_OS_WINDOWS)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#if defined(LINUX)
+#include <elf.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined (_MSC_VER) && _MSC_VER < 1900
+#define snprintf _snprintf
+#endif
+
+uint64_t TR::CodeEventPublisher::_nextCodeIndex = 0;
+
+// Layout of the jitdump file, see tools/perf/Documentation/jitdump-specification.txt
+// in the Linux kernel sources
+//
+namespace
+{
+
+const uint32_t JITDUMP_MAGIC = 0x4A695444;
+const uint32_t JITDUMP_VERSION = 1;
+
+enum JitDumpRecordID
+   {
+   JIT_CODE_LOAD = 0,
+   JIT_CODE_MOVE = 1,
+   JIT_CODE_DEBUG_INFO = 2,
+   JIT_CODE_CLOSE = 3
+   };
+
+struct JitDumpHeader
+   {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t totalSize;
+   uint32_t elfMach;
+   uint32_t pad1;
+   uint32_t pid;
+   uint64_t timestamp;
+   uint64_t flags;
+   };
+
+struct JitDumpRecordPrefix
+   {
+   uint32_t id;
+   uint32_t totalSize;
+   uint64_t timestamp;
+   };
+
+struct JitDumpCodeLoad
+   {
+   uint32_t pid;
+   uint32_t tid;
+   uint64_t vma;
+   uint64_t codeAddr;
+   uint64_t codeSize;
+   uint64_t codeIndex;
+   // followed by the NUL terminated name and the code bytes
+   };
+
+struct JitDumpCodeMove
+   {
+   uint32_t pid;
+   uint32_t tid;
+   uint64_t vma;
+   uint64_t oldCodeAddr;
+   uint64_t newCodeAddr;
+   uint64_t codeSize;
+   uint64_t codeIndex;
+   };
+
+struct JitDumpDebugInfo
+   {
+   uint64_t codeAddr;
+   uint64_t numEntries;
+   // followed by numEntries JitDumpDebugEntry, each followed by a NUL terminated file name
+   };
+
+struct JitDumpDebugEntry
+   {
+   uint64_t addr;
+   int32_t lineNumber;
+   int32_t discriminator;
+   };
+
+uint32_t
+processID()
+   {
+#if defined(OMR_OS_WINDOWS)
+   return static_cast<uint32_t>(_getpid());
+#else
+   return static_cast<uint32_t>(getpid());
+#endif
+   }
+
+}
+
+
+TR::CodeEventPublisher::CodeEventPublisher(TR::RawAllocator rawAllocator, uint32_t formats) :
+   _rawAllocator(rawAllocator),
+   _formats(formats),
+   _queue(NULL),
+   _numQueued(0),
+   _writing(0),
+   _numPublished(0),
+   _numWritten(0),
+   _numDropped(0),
+   _monitor(NULL),
+   _writerThread(NULL),
+   _open(false),
+   _running(false),
+   _shuttingDown(false),
+   _perfMapFile(NULL),
+   _jitDumpFile(NULL),
+   _jitDumpMarker(NULL),
+   _jitDumpMarkerSize(0),
+   _codeIndices(std::less<uint8_t *>(), CodeIndexMapAllocator(rawAllocator))
+   {
+   }
+
+TR::CodeEventPublisher::~CodeEventPublisher()
+   {
+   shutdown();
+
+   // Events that raced with the shutdown are never written
+   Event *event = _queue;
+   while (NULL != event)
+      {
+      Event *next = event->_next;
+      _rawAllocator.deallocate(event);
+      event = next;
+      }
+   _queue = NULL;
+
+   // Kept from the first startup() on, since a publisher that saw the writer
+   // running may still be about to enter it when shutdown() returns
+   if (NULL != _monitor)
+      omrthread_monitor_destroy(_monitor);
+   }
+
+bool
+TR::CodeEventPublisher::startup()
+   {
+   if (_open)
+      return false;
+
+   bool opened = false;
+   if ((_formats & PerfMap) && openPerfMap())
+      opened = true;
+   if ((_formats & PerfJitDump) && openJitDump())
+      opened = true;
+   if (!opened)
+      return false;
+
+   _open = true;
+
+   // Without an attached thread to start it from there is no writer thread,
+   // and publishing threads write the events out themselves
+   if ((0 != omrthread_init_library()) || (NULL == omrthread_self()))
+      return true;
+
+   if ((NULL == _monitor) && (0 != omrthread_monitor_init_with_name(&_monitor, 0, "JIT-CodeEventPublisherMonitor")))
+      {
+      _monitor = NULL;
+      return true;
+      }
+
+   _shuttingDown = false;
+   _running = true;
+
+   omrthread_attr_t attr = NULL;
+   intptr_t rc = omrthread_attr_init(&attr);
+   if (J9THREAD_SUCCESS == rc)
+      {
+      rc = omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+      if (J9THREAD_SUCCESS == rc)
+         rc = omrthread_create_ex(&_writerThread, &attr, 0, writerThreadProc, this);
+      omrthread_attr_destroy(&attr);
+      }
+
+   if (J9THREAD_SUCCESS != rc)
+      {
+      _writerThread = NULL;
+      _running = false;
+      }
+
+   return true;
+   }
+
+void
+TR::CodeEventPublisher::shutdown()
+   {
+   if (!_open)
+      return;
+
+   _open = false;
+
+   if (_running)
+      {
+      omrthread_monitor_enter(_monitor);
+      _shuttingDown = true;
+      omrthread_monitor_notify_all(_monitor);
+      omrthread_monitor_exit(_monitor);
+
+      omrthread_join(_writerThread);
+      _writerThread = NULL;
+      _running = false;
+      }
+
+   // Write anything published while the writer was stopping and close the
+   // files without giving up the right to write, so that a publishing thread
+   // that got past the _open check late cannot write to a closed file; such
+   // a thread finds _open clear once it gets the right to write
+   while (0 != VM_AtomicSupport::lockCompareExchange(&_writing, 0, 1))
+      {
+      }
+   writeBatch();
+
+   if (NULL != _perfMapFile)
+      {
+      fclose(_perfMapFile);
+      _perfMapFile = NULL;
+      }
+   closeJitDump();
+
+   VM_AtomicSupport::set(&_writing, 0);
+   }
+
+TR::CodeEventPublisher::Event *
+TR::CodeEventPublisher::allocateEvent(uint32_t kind, uint32_t numLines, uint32_t codeBytes, const char *name, const char *fileName)
+   {
+   size_t nameLength = (NULL != name) ? strlen(name) + 1 : 0;
+   size_t fileNameLength = (NULL != fileName) ? strlen(fileName) + 1 : 0;
+   size_t size = sizeof(Event) + (numLines * sizeof(LineEntry)) + codeBytes + nameLength + fileNameLength;
+
+   Event *event = static_cast<Event *>(_rawAllocator.allocate(size, std::nothrow));
+   if (NULL == event)
+      {
+      VM_AtomicSupport::addU64(&_numDropped, 1);
+      return NULL;
+      }
+
+   event->_next = NULL;
+   event->_timestamp = timestamp();
+   event->_start = NULL;
+   event->_oldStart = NULL;
+   event->_size = 0;
+   event->_threadID = currentThreadID();
+   event->_kind = kind;
+   event->_numLines = numLines;
+   event->_codeBytes = codeBytes;
+   event->_nameLength = static_cast<uint32_t>(nameLength);
+   if (0 != nameLength)
+      memcpy(event->name(), name, nameLength);
+   if (0 != fileNameLength)
+      memcpy(event->fileName(), fileName, fileNameLength);
+   return event;
+   }
+
+void
+TR::CodeEventPublisher::publishLoad(
+      uint8_t *start,
+      uint32_t size,
+      const char *name,
+      const char *fileName,
+      const LineEntry *lines,
+      uint32_t numLines)
+   {
+   if (!_open)
+      return;
+
+   bool jitDump = (NULL != _jitDumpFile);
+   if (!jitDump || (NULL == lines) || (NULL == fileName))
+      {
+      numLines = 0;
+      fileName = NULL;
+      }
+
+   Event *event = allocateEvent(Load, numLines, jitDump ? size : 0, name, fileName);
+   if (NULL == event)
+      return;
+
+   event->_start = start;
+   event->_size = size;
+   if (0 != numLines)
+      memcpy(event->lines(), lines, numLines * sizeof(LineEntry));
+
+   // The code may be patched after it is published; perf only needs the
+   // instructions as they were when the body was installed
+   if (jitDump)
+      memcpy(event->code(), start, size);
+
+   enqueue(event);
+   }
+
+void
+TR::CodeEventPublisher::publishUnload(uint8_t *start, uint32_t size)
+   {
+   if (!_open)
+      return;
+
+   Event *event = allocateEvent(Unload, 0, 0, NULL, NULL);
+   if (NULL == event)
+      return;
+
+   event->_start = start;
+   event->_size = size;
+   enqueue(event);
+   }
+
+void
+TR::CodeEventPublisher::publishMove(uint8_t *oldStart, uint8_t *newStart, uint32_t size, const char *name)
+   {
+   if (!_open)
+      return;
+
+   Event *event = allocateEvent(Move, 0, 0, name, NULL);
+   if (NULL == event)
+      return;
+
+   event->_start = newStart;
+   event->_oldStart = oldStart;
+   event->_size = size;
+   enqueue(event);
+   }
+
+void
+TR::CodeEventPublisher::enqueue(Event *event)
+   {
+   Event *head;
+   do
+      {
+      head = _queue;
+      event->_next = head;
+      }
+   while (reinterpret_cast<uintptr_t>(head) != VM_AtomicSupport::lockCompareExchange(
+         reinterpret_cast<volatile uintptr_t *>(&_queue),
+         reinterpret_cast<uintptr_t>(head),
+         reinterpret_cast<uintptr_t>(event)));
+
+   VM_AtomicSupport::addU64(&_numPublished, 1);
+   uintptr_t numQueued = VM_AtomicSupport::add(&_numQueued, 1);
+
+   if (_running)
+      {
+      // Otherwise the writer picks the event up the next time its wait times
+      // out; threads that are not attached cannot use the monitor at all
+      if ((WRITER_WAKE_THRESHOLD == numQueued) && (NULL != omrthread_self()))
+         {
+         omrthread_monitor_enter(_monitor);
+         omrthread_monitor_notify_all(_monitor);
+         omrthread_monitor_exit(_monitor);
+         }
+      }
+   else
+      {
+      writeOnPublishingThread();
+      }
+   }
+
+void
+TR::CodeEventPublisher::writeOnPublishingThread()
+   {
+   // A thread that finds another one writing leaves its events to that
+   // writer, which checks for new events after giving up the right to write
+   while (NULL != _queue)
+      {
+      if (0 != VM_AtomicSupport::lockCompareExchange(&_writing, 0, 1))
+         return;
+      // shutdown() closes the files while it has the right to write
+      bool open = _open;
+      if (open)
+         writeBatch();
+      VM_AtomicSupport::set(&_writing, 0);
+      if (!open)
+         return;
+      }
+   }
+
+void
+TR::CodeEventPublisher::flush()
+   {
+   uint64_t target = _numPublished;
+
+   if (_running)
+      {
+      omrthread_monitor_enter(_monitor);
+      while (_running && (_numWritten < target))
+         {
+         omrthread_monitor_notify_all(_monitor);
+         omrthread_monitor_wait_timed(_monitor, 10, 0);
+         }
+      omrthread_monitor_exit(_monitor);
+      }
+   else
+      {
+      while (_open && (_numWritten < target))
+         writeOnPublishingThread();
+      }
+   }
+
+int J9THREAD_PROC
+TR::CodeEventPublisher::writerThreadProc(void *arg)
+   {
+   TR::CodeEventPublisher *publisher = static_cast<TR::CodeEventPublisher *>(arg);
+
+   omrthread_monitor_enter(publisher->_monitor);
+   while (true)
+      {
+      bool stopping = publisher->_shuttingDown;
+      omrthread_monitor_exit(publisher->_monitor);
+
+      publisher->writeBatch();
+
+      omrthread_monitor_enter(publisher->_monitor);
+      omrthread_monitor_notify_all(publisher->_monitor);
+      if (stopping)
+         break;
+      if (!publisher->_shuttingDown && (publisher->_numQueued < WRITER_WAKE_THRESHOLD))
+         omrthread_monitor_wait_timed(publisher->_monitor, WRITER_IDLE_WAIT_MS, 0);
+      }
+   omrthread_monitor_exit(publisher->_monitor);
+
+   return 0;
+   }
+
+void
+TR::CodeEventPublisher::writeBatch()
+   {
+   Event *batch = reinterpret_cast<Event *>(VM_AtomicSupport::lockExchange(reinterpret_cast<volatile uintptr_t *>(&_queue), 0));
+   if (NULL == batch)
+      return;
+
+   // The queue is newest first; write the events in the order they were published
+   Event *ordered = NULL;
+   uintptr_t numEvents = 0;
+   while (NULL != batch)
+      {
+      Event *next = batch->_next;
+      batch->_next = ordered;
+      ordered = batch;
+      batch = next;
+      numEvents++;
+      }
+
+   while (NULL != ordered)
+      {
+      Event *next = ordered->_next;
+      writeEvent(ordered);
+      _rawAllocator.deallocate(ordered);
+      ordered = next;
+      }
+
+   if (NULL != _perfMapFile)
+      fflush(_perfMapFile);
+   if (NULL != _jitDumpFile)
+      fflush(_jitDumpFile);
+
+   VM_AtomicSupport::subtract(&_numQueued, numEvents);
+   VM_AtomicSupport::addU64(&_numWritten, numEvents);
+   }
+
+void
+TR::CodeEventPublisher::writeEvent(Event *event)
+   {
+   if (NULL != _perfMapFile)
+      writePerfMapEvent(event);
+   if (NULL != _jitDumpFile)
+      writeJitDumpEvent(event);
+   }
+
+bool
+TR::CodeEventPublisher::openPerfMap()
+   {
+   char fileName[64];
+   int numCharsWritten = snprintf(fileName, sizeof(fileName), "/tmp/perf-%" OMR_PRIu32 ".map", processID());
+   if ((numCharsWritten <= 0) || (numCharsWritten >= (int)sizeof(fileName)))
+      return false;
+
+   _perfMapFile = fopen(fileName, "a");
+   return NULL != _perfMapFile;
+   }
+
+void
+TR::CodeEventPublisher::writePerfMapEvent(Event *event)
+   {
+   // perf does not want 0x leading the hex start address and length of the
+   // compiled code region; the rest of the line is the name of the region.
+   // The format has no way to describe code going away, so unloads are not
+   // written; perf uses the most recent entry covering an address.
+   switch (event->_kind)
+      {
+      case Load:
+      case Move:
+         fprintf(_perfMapFile, "%" OMR_PRIXPTR " %" OMR_PRIX32 " %s\n",
+            reinterpret_cast<uintptr_t>(event->_start),
+            event->_size,
+            (0 != event->_nameLength) ? event->name() : "(compiled code)");
+         break;
+      default:
+         break;
+      }
+   }
+
+#if defined(LINUX)
+
+uint64_t
+TR::CodeEventPublisher::timestamp()
+   {
+   struct timespec now;
+   if (0 != clock_gettime(CLOCK_MONOTONIC, &now))
+      return 0;
+   return (static_cast<uint64_t>(now.tv_sec) * 1000000000) + static_cast<uint64_t>(now.tv_nsec);
+   }
+
+uint32_t
+TR::CodeEventPublisher::currentThreadID()
+   {
+   return static_cast<uint32_t>(syscall(SYS_gettid));
+   }
+
+bool
+TR::CodeEventPublisher::openJitDump()
+   {
+   char fileName[64];
+   int numCharsWritten = snprintf(fileName, sizeof(fileName), "/tmp/jit-%" OMR_PRIu32 ".dump", processID());
+   if ((numCharsWritten <= 0) || (numCharsWritten >= (int)sizeof(fileName)))
+      return false;
+
+   // A JIT that is shut down and started again in the same process keeps
+   // adding to the same file, which perf expects to be named after the pid
+   int fd = open(fileName, O_CREAT | O_APPEND | O_RDWR, 0666);
+   if (fd < 0)
+      return false;
+   bool writeHeader = (0 == lseek(fd, 0, SEEK_END));
+
+   // perf record notices the jitdump file through an executable mapping of
+   // it; perf inject then reads the file named by that mapping
+   size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+   void *marker = mmap(NULL, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+   if (MAP_FAILED == marker)
+      {
+      close(fd);
+      return false;
+      }
+
+   FILE *file = fdopen(fd, "ab");
+   if (NULL == file)
+      {
+      munmap(marker, pageSize);
+      close(fd);
+      return false;
+      }
+
+   JitDumpHeader header;
+   memset(&header, 0, sizeof(header));
+   header.magic = JITDUMP_MAGIC;
+   header.version = JITDUMP_VERSION;
+   header.totalSize = sizeof(header);
+   header.pid = processID();
+   header.timestamp = timestamp();
+   header.flags = 0;
+
+   // The code described by the file runs on the host
+#if defined(TR_HOST_X86)
+   header.elfMach = (sizeof(void *) == 8) ? EM_X86_64 : EM_386;
+#elif defined(TR_HOST_POWER)
+   header.elfMach = (sizeof(void *) == 8) ? EM_PPC64 : EM_PPC;
+#elif defined(TR_HOST_S390)
+   header.elfMach = EM_S390;
+#elif defined(TR_HOST_ARM64) && defined(EM_AARCH64)
+   header.elfMach = EM_AARCH64;
+#elif defined(TR_HOST_ARM)
+   header.elfMach = EM_ARM;
+#elif defined(TR_HOST_RISCV) && defined(EM_RISCV)
+   header.elfMach = EM_RISCV;
+#endif
+
+   if (writeHeader && (1 != fwrite(&header, sizeof(header), 1, file)))
+      {
+      munmap(marker, pageSize);
+      fclose(file);
+      return false;
+      }
+
+   _jitDumpFile = file;
+   _jitDumpMarker = marker;
+   _jitDumpMarkerSize = pageSize;
+   return true;
+   }
+
+void
+TR::CodeEventPublisher::closeJitDump()
+   {
+   if (NULL == _jitDumpFile)
+      return;
+
+   writeJitDumpRecord(JIT_CODE_CLOSE, sizeof(JitDumpRecordPrefix), timestamp());
+   munmap(_jitDumpMarker, _jitDumpMarkerSize);
+   fclose(_jitDumpFile);
+   _jitDumpFile = NULL;
+   _jitDumpMarker = NULL;
+   _codeIndices.clear();
+   }
+
+void
+TR::CodeEventPublisher::writeJitDumpRecord(uint32_t id, uint32_t totalSize, uint64_t timestamp)
+   {
+   JitDumpRecordPrefix prefix;
+   prefix.id = id;
+   prefix.totalSize = totalSize;
+   prefix.timestamp = timestamp;
+   fwrite(&prefix, sizeof(prefix), 1, _jitDumpFile);
+   }
+
+void
+TR::CodeEventPublisher::writeJitDumpEvent(Event *event)
+   {
+   uint32_t pid = processID();
+
+   switch (event->_kind)
+      {
+      case Load:
+         {
+         // A load record for an address replaces whatever was loaded there before
+         uint64_t codeIndex = _nextCodeIndex++;
+         _codeIndices[event->_start] = codeIndex;
+
+         // Line numbers must precede the load record they describe
+         if (0 != event->_numLines)
+            {
+            size_t fileNameLength = strlen(event->fileName()) + 1;
+            uint32_t totalSize = static_cast<uint32_t>(sizeof(JitDumpRecordPrefix) + sizeof(JitDumpDebugInfo)
+               + (event->_numLines * (sizeof(JitDumpDebugEntry) + fileNameLength)));
+            writeJitDumpRecord(JIT_CODE_DEBUG_INFO, totalSize, event->_timestamp);
+
+            JitDumpDebugInfo info;
+            info.codeAddr = reinterpret_cast<uintptr_t>(event->_start);
+            info.numEntries = event->_numLines;
+            fwrite(&info, sizeof(info), 1, _jitDumpFile);
+
+            LineEntry *lines = event->lines();
+            for (uint32_t i = 0; i < event->_numLines; i++)
+               {
+               JitDumpDebugEntry entry;
+               entry.addr = reinterpret_cast<uintptr_t>(lines[i]._pc);
+               entry.lineNumber = lines[i]._lineNumber;
+               entry.discriminator = 0;
+               fwrite(&entry, sizeof(entry), 1, _jitDumpFile);
+               fwrite(event->fileName(), fileNameLength, 1, _jitDumpFile);
+               }
+            }
+
+         static const char emptyName[] = "";
+         const char *name = (0 != event->_nameLength) ? event->name() : emptyName;
+         size_t nameLength = (0 != event->_nameLength) ? event->_nameLength : sizeof(emptyName);
+         uint32_t totalSize = static_cast<uint32_t>(sizeof(JitDumpRecordPrefix) + sizeof(JitDumpCodeLoad) + nameLength + event->_codeBytes);
+         writeJitDumpRecord(JIT_CODE_LOAD, totalSize, event->_timestamp);
+
+         JitDumpCodeLoad load;
+         load.pid = pid;
+         load.tid = event->_threadID;
+         load.vma = reinterpret_cast<uintptr_t>(event->_start);
+         load.codeAddr = reinterpret_cast<uintptr_t>(event->_start);
+         load.codeSize = event->_codeBytes;
+         load.codeIndex = codeIndex;
+         fwrite(&load, sizeof(load), 1, _jitDumpFile);
+         fwrite(name, nameLength, 1, _jitDumpFile);
+         fwrite(event->code(), event->_codeBytes, 1, _jitDumpFile);
+         break;
+         }
+
+      case Unload:
+         {
+         // jitdump has no unload record; the timestamp of the next load at
+         // the same address is what tells perf the old body is gone. Forget
+         // the bodies so that a later move cannot refer to them.
+         CodeIndexMap::iterator first = _codeIndices.lower_bound(event->_start);
+         CodeIndexMap::iterator last = _codeIndices.lower_bound(event->_start + event->_size);
+         _codeIndices.erase(first, last);
+         break;
+         }
+
+      case Move:
+         {
+         CodeIndexMap::iterator it = _codeIndices.find(event->_oldStart);
+         if (it == _codeIndices.end())
+            break;
+         uint64_t codeIndex = it->second;
+         _codeIndices.erase(it);
+         _codeIndices[event->_start] = codeIndex;
+
+         writeJitDumpRecord(JIT_CODE_MOVE, sizeof(JitDumpRecordPrefix) + sizeof(JitDumpCodeMove), event->_timestamp);
+
+         JitDumpCodeMove move;
+         move.pid = pid;
+         move.tid = event->_threadID;
+         move.vma = reinterpret_cast<uintptr_t>(event->_start);
+         move.oldCodeAddr = reinterpret_cast<uintptr_t>(event->_oldStart);
+         move.newCodeAddr = reinterpret_cast<uintptr_t>(event->_start);
+         move.codeSize = event->_size;
+         move.codeIndex = codeIndex;
+         fwrite(&move, sizeof(move), 1, _jitDumpFile);
+         break;
+         }
+
+      default:
+         break;
+      }
+   }
+
+#else
+
+uint64_t
+TR::CodeEventPublisher::timestamp()
+   {
+   return 0;
+   }
+
+uint32_t
+TR::CodeEventPublisher::currentThreadID()
+   {
+   return 0;
+   }
+
+// The jitdump format is only understood by perf on Linux
+bool TR::CodeEventPublisher::openJitDump() { return false; }
+void TR::CodeEventPublisher::closeJitDump() { }
+void TR::CodeEventPublisher::writeJitDumpRecord(uint32_t id, uint32_t totalSize, uint64_t timestamp) { }
+void TR::CodeEventPublisher::writeJitDumpEvent(Event *event) { }
+
+#endif // defined(LINUX)
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef CODE_EVENT_PUBLISHER_INCL
+#define CODE_EVENT_PUBLISHER_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <map>
+#include "env/RawAllocator.hpp"
+#include "env/TypedAllocator.hpp"
+#include "omrthread.h"
+
+namespace TR
+{
+
+/**
+ * @brief Publishes code load, unload and move events to external profilers.
+ *
+ * Events are pushed onto a lock-free list by the publishing thread, which
+ * only copies the event (and, for the jitdump format, the code bytes) and
+ * returns without doing any I/O. A background writer thread takes the whole
+ * list at once and writes it out in a single batch, flushing the output
+ * files once per batch rather than once per event.
+ *
+ * Two output formats are supported:
+ *
+ *   - PerfMap writes /tmp/perf-<pid>.map, the text format perf uses to
+ *     name anonymous executable memory. The format has no notion of
+ *     unloading, so unload events are not written to it.
+ *
+ *   - PerfJitDump writes /tmp/jit-<pid>.dump in the binary jitdump format,
+ *     including a copy of the code and its line number table, so that
+ *     `perf inject --jit` can build symbolized images of the compiled code.
+ *     Every record is timestamped with CLOCK_MONOTONIC when it is published
+ *     (record with `perf record -k mono`), so code that is reclaimed and
+ *     reused for another method is attributed correctly.
+ *
+ * If the calling thread is not attached to the thread library the writer
+ * thread cannot be started; the events are then written by whichever
+ * publishing thread finds the list non-empty and no other writer active.
+ *
+ * Publishing never waits for the writer: the writer's monitor is only
+ * entered to wake it early when a large batch is waiting (and only by
+ * attached threads), and the writer never holds it while doing I/O. This makes publishing safe on the code
+ * cache reclamation path.
+ */
+class CodeEventPublisher
+   {
+   public:
+
+   enum Format
+      {
+      PerfMap     = 0x1,
+      PerfJitDump = 0x2
+      };
+
+   /// One entry of a load event's line number table.
+   struct LineEntry
+      {
+      uint8_t *_pc;          ///< first instruction attributed to the line
+      int32_t _lineNumber;
+      };
+
+   /**
+    * @param rawAllocator allocator for the queued events
+    * @param formats a mask of Format values to write
+    */
+   CodeEventPublisher(TR::RawAllocator rawAllocator, uint32_t formats);
+   ~CodeEventPublisher();
+
+   /**
+    * @brief Open the output files and start the writer thread.
+    *
+    * @return true if at least one output file could be opened
+    */
+   bool startup();
+
+   /**
+    * @brief Write out every event published so far, stop the writer thread
+    *        and close the output files.
+    */
+   void shutdown();
+
+   /**
+    * @brief Publish the load of a compiled body.
+    *
+    * @param start the first byte of the code
+    * @param size the size of the code in bytes
+    * @param name the symbol perf reports for the code
+    * @param fileName the source file the line numbers refer to; may be NULL
+    *        if there are no line numbers
+    * @param lines the line number table, ordered by pc; may be NULL
+    * @param numLines the number of entries in the line number table
+    */
+   void publishLoad(
+         uint8_t *start,
+         uint32_t size,
+         const char *name,
+         const char *fileName = NULL,
+         const LineEntry *lines = NULL,
+         uint32_t numLines = 0);
+
+   /**
+    * @brief Publish that the code in [start, start + size) is no longer in use.
+    */
+   void publishUnload(uint8_t *start, uint32_t size);
+
+   /**
+    * @brief Publish that a body that was loaded at oldStart has been moved to newStart.
+    */
+   void publishMove(uint8_t *oldStart, uint8_t *newStart, uint32_t size, const char *name);
+
+   /**
+    * @brief Block until every event published so far has been written.
+    */
+   void flush();
+
+   /// True if load events should carry a line number table.
+   bool wantsLineNumbers() { return (_formats & PerfJitDump) != 0; }
+
+   uint64_t getNumPublished() { return _numPublished; }
+   uint64_t getNumWritten() { return _numWritten; }
+   uint64_t getNumDropped() { return _numDropped; }
+
+   private:
+
+   enum EventKind
+      {
+      Load,
+      Unload,
+      Move
+      };
+
+   /**
+    * A queued event. The line number table, the code bytes, the name and the
+    * file name are stored, in that order, directly after the event.
+    */
+   struct Event
+      {
+      Event *_next;
+      uint64_t _timestamp;
+      uint8_t *_start;
+      uint8_t *_oldStart;
+      uint32_t _size;
+      uint32_t _threadID;
+      uint32_t _kind;
+      uint32_t _numLines;
+      uint32_t _codeBytes;   ///< bytes of code copied after the line table
+      uint32_t _nameLength;  ///< including the terminating NUL
+
+      LineEntry *lines() { return reinterpret_cast<LineEntry *>(this + 1); }
+      uint8_t *code() { return reinterpret_cast<uint8_t *>(lines() + _numLines); }
+      char *name() { return reinterpret_cast<char *>(code() + _codeBytes); }
+      char *fileName() { return name() + _nameLength; }
+      };
+
+   typedef TR::typed_allocator<std::pair<uint8_t * const, uint64_t>, TR::RawAllocator> CodeIndexMapAllocator;
+   typedef std::map<uint8_t *, uint64_t, std::less<uint8_t *>, CodeIndexMapAllocator> CodeIndexMap;
+
+   /// Nothing has been published since the writer last looked; wait this long (ms) before looking again.
+   static const int64_t WRITER_IDLE_WAIT_MS = 100;
+
+   /// Wake the writer early once this many events are waiting.
+   static const uintptr_t WRITER_WAKE_THRESHOLD = 256;
+
+   static int J9THREAD_PROC writerThreadProc(void *arg);
+
+   Event *allocateEvent(uint32_t kind, uint32_t numLines, uint32_t codeBytes, const char *name, const char *fileName);
+   void enqueue(Event *event);
+   void writeOnPublishingThread();
+   void writeBatch();
+   void writeEvent(Event *event);
+
+   void writePerfMapEvent(Event *event);
+   void writeJitDumpEvent(Event *event);
+   void writeJitDumpRecord(uint32_t id, uint32_t totalSize, uint64_t timestamp);
+
+   bool openPerfMap();
+   bool openJitDump();
+   void closeJitDump();
+
+   static uint64_t timestamp();
+   static uint32_t currentThreadID();
+
+   TR::RawAllocator _rawAllocator;
+   uint32_t _formats;
+
+   Event * volatile _queue;          ///< most recently published event first
+   volatile uintptr_t _numQueued;
+   volatile uintptr_t _writing;      ///< non-zero while a thread is writing a batch or closing the files
+   volatile uint64_t _numPublished;
+   volatile uint64_t _numWritten;
+   volatile uint64_t _numDropped;
+
+   omrthread_monitor_t _monitor;
+   omrthread_t _writerThread;
+   volatile bool _open;              ///< events are accepted between startup() and shutdown()
+   bool _running;                    ///< the writer thread is running
+   bool _shuttingDown;
+
+   FILE *_perfMapFile;
+   FILE *_jitDumpFile;
+   void *_jitDumpMarker;             ///< executable mapping of the jitdump file that tells perf where it is
+   size_t _jitDumpMarkerSize;
+   static uint64_t _nextCodeIndex;   ///< names the image perf inject creates for a load; unique across restarts of the JIT
+   CodeIndexMap _codeIndices;        ///< code index of the load record describing each live body
+   };
+
+}
+
+#endif
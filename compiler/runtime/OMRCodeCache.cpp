@@ -43,6 +43,7 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeEventPublisher.hpp"
 #include "runtime/Runtime.hpp"
 
 #ifdef LINUX
@@ -292,6 +293,8 @@ OMR::CodeCache::initialize(TR::CodeCacheManager *manager,
 
    _hashEntryFreeList = NULL;
    _freeBlockList     = NULL;
+   _warmFreeBlocks.initialize();
+   _coldFreeBlocks.initialize();
    _flags = 0;
    _CCPreLoadedCodeInitialized = false;
    self()->unreserve();
@@ -963,107 +966,51 @@ OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start,
 
    uint64_t size = end - start; // Size of space to be freed
 
+   // Report the reclaimed code before the block is merged with its neighbours
+   TR::CodeEventPublisher *publisher = _manager->codeEventPublisher();
+   if (publisher)
+      publisher->publishUnload(start, (uint32_t)size);
+
    // Destroy the eyeCatcher; note that there might not be an eyecatcher at all
    //
    if (size >= sizeof(CodeCacheMethodHeader))
       ((CodeCacheMethodHeader*)start)->_eyeCatcher[0] = 0;
 
-   //fprintf(stderr, "--ccr-- newFreeBlock size %d at %p\n", size, start);
+   // Find the free blocks on either side of the new one. Warm and cold blocks are
+   // indexed separately, so a warm block is never merged with a cold one
+   CodeCacheFreeBlockIndex &index = self()->freeBlockIndex((CodeCacheFreeCacheBlock *)start);
+   CodeCacheFreeCacheBlock *prev = index.findPredecessor(start);
+   CodeCacheFreeCacheBlock *next = index.findSuccessor(start);
    CodeCacheFreeCacheBlock *mergedBlock = NULL;
    CodeCacheFreeCacheBlock *link = NULL;
-   if (_freeBlockList)
+
+   if (next && (uint8_t *)next - end < sizeof(CodeCacheFreeCacheBlock))
       {
-      CodeCacheFreeCacheBlock *curr;
-      // find the insertion point
-      for (curr = _freeBlockList; curr->_next && (uint8_t *)(curr->_next) < start; curr = curr->_next)
-         {}
+      // merge with the next block
+      TR_ASSERT(end <= (uint8_t *)next, "assertion failure"); // check for no overlap of blocks
+      mergedBlock = next;
+      end = (uint8_t *)next + next->_size;
+      self()->unlinkFreeBlock(next);
+      }
 
-      if (start < (uint8_t *)curr && (uint8_t *)curr - end < sizeof(CodeCacheFreeCacheBlock))
-         {
-         // merge with the curr block ahead, which is also the first block
-         TR_ASSERT(end <= (uint8_t *)curr, "assertion failure"); // check for no overlap of blocks
-         // we should not merge warm block with cold blocks
-         if (!(start < _warmCodeAlloc && (uint8_t *)curr >= _coldCodeAlloc))
-            {
-            // which is also the first block
-            link = (CodeCacheFreeCacheBlock *) start;
-            mergedBlock = curr;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n", size, curr->size, link);
-            link->_size = (uint8_t *)curr + curr->_size - start;
-            link->_next = curr->_next;
-            _freeBlockList = link;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->size);
-            }
-         }
-      else if (curr->_next && ((uint8_t *)curr->_next - end < sizeof(CodeCacheFreeCacheBlock)) &&
-         !(start < _warmCodeAlloc && (uint8_t *)curr->_next >= _coldCodeAlloc))
-         {
-         // merge with the next block, but don't merge warm blocks with cold blocks
-         if ((start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock)) &&
-             !((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc))
-            {
-            // merge with the previous and the next blocks
-            mergedBlock = curr;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with blocks of the size %d and %d at %p\n", size, curr->_size, curr->_next->_size, curr);
-            curr->_size = (uint8_t *)curr->_next + curr->_next->_size - (uint8_t *)curr;
-            curr->_next = curr->_next->_next;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
-            link = curr;
-#ifdef DEBUG
-            start = (uint8_t *)curr;
-#endif
-            }
-         else
-            {
-            mergedBlock = curr->_next;
-            link = (CodeCacheFreeCacheBlock *) start;
-            //fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n", size, curr->next->size, link);
-            link->_size = (uint8_t *)curr->_next + curr->_next->_size - start;
-            link->_next = curr->_next->_next;
-            curr->_next = link;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->_size);
-            }
-         }
-      else if ((uint8_t *)curr < start && start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock))
-         {
-         // merge with the previous block
-         if (!((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc))
-            {
-            mergedBlock = curr;
-            curr->_size = start + size - (uint8_t *)curr;
-            //fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
-            link = curr;
+   if (prev && start - ((uint8_t *)prev + prev->_size) < sizeof(CodeCacheFreeCacheBlock))
+      {
+      // merge with the previous block
+      mergedBlock = prev;
+      self()->unlinkFreeBlock(prev);
+      link = prev;
 #ifdef DEBUG
-            start = (uint8_t *)curr;
+      start = (uint8_t *)prev;
 #endif
-            }
-         }
-      if (!link) // no merging happened
-         {
-         link = (CodeCacheFreeCacheBlock *) start;
-         link->_size = size;
-         if (start < (uint8_t *)curr)
-            {
-            link->_next = _freeBlockList;
-            _freeBlockList = link;
-            }
-         else
-            {
-            link->_next = curr->_next;
-            curr->_next = link;
-            }
-         }
       }
-   else // This is the first block in the list
+   else
       {
-      _freeBlockList = (CodeCacheFreeCacheBlock *) start;
-      _freeBlockList->_size = size;
-      _freeBlockList->_next = NULL;
-      //updateMaxSizeOfFreeBlocks(_freeBlockList, _freeBlockList->_size);
-      link = _freeBlockList;
+      link = (CodeCacheFreeCacheBlock *) start;
       }
 
-   self()->updateMaxSizeOfFreeBlocks(link, link->_size);
+   link->_size = end - (uint8_t *)link;
+   self()->linkFreeBlock(link);
+   self()->updateMaxSizeOfFreeBlocks(&index == &_coldFreeBlocks);
 
    _manager->decreaseCurrTotalUsedInBytes(size);
 
@@ -1085,27 +1032,58 @@ OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start,
 
 
 void
-OMR::CodeCache::updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize)
+OMR::CodeCache::updateMaxSizeOfFreeBlocks(bool isCold)
    {
    TR::CodeCacheConfig &config = _manager->codeCacheConfig();
    if (config.codeCacheFreeBlockRecylingEnabled())
       {
-      if ((uint8_t *)blockPtr < _warmCodeAlloc)
-         {
-         if (blockSize > _sizeOfLargestFreeWarmBlock)
-            {
-            //fprintf(stderr, "_sizeOfLargestFreeBlock for cache %p increased to %d\n", this, blockSize);
-            _sizeOfLargestFreeWarmBlock = blockSize;
-            }
-         }
-      else // block belongs to cold code
-         {
-         if (blockSize > _sizeOfLargestFreeColdBlock)
-            _sizeOfLargestFreeColdBlock = blockSize;
-         }
+      if (isCold)
+         _sizeOfLargestFreeColdBlock = _coldFreeBlocks.largestBlockSize();
+      else
+         _sizeOfLargestFreeWarmBlock = _warmFreeBlocks.largestBlockSize();
       }
    }
 
+
+void
+OMR::CodeCache::linkFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   CodeCacheFreeBlockIndex &index = self()->freeBlockIndex(block);
+
+   // The free block list is in address order, and every warm block comes before
+   // every cold block, so the block goes after its predecessor in its own region
+   // or, failing that, after the last warm block
+   CodeCacheFreeCacheBlock *prev = index.findPredecessor((uint8_t *)block);
+   if (!prev && &index == &_coldFreeBlocks)
+      prev = _warmFreeBlocks.findPredecessor(_warmCodeAlloc);
+
+   block->_prev = prev;
+   block->_next = prev ? prev->_next : _freeBlockList;
+   if (block->_next)
+      block->_next->_prev = block;
+   if (prev)
+      prev->_next = block;
+   else
+      _freeBlockList = block;
+
+   index.add(block);
+   }
+
+
+void
+OMR::CodeCache::unlinkFreeBlock(CodeCacheFreeCacheBlock *block)
+   {
+   self()->freeBlockIndex(block).remove(block);
+
+   if (block->_next)
+      block->_next->_prev = block->_prev;
+   if (block->_prev)
+      block->_prev->_next = block->_next;
+   else
+      _freeBlockList = block->_next;
+   }
+
+
 // Find the smallest free block that will satisfy the request.
 //
 // isCold indicates whether a warm or cold block of memory is required.
@@ -1113,105 +1091,23 @@ OMR::CodeCache::updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, siz
 uint8_t *
 OMR::CodeCache::findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeeded)
    {
-   CodeCacheFreeCacheBlock *currLink;
-   CodeCacheFreeCacheBlock *prevLink;
-   CodeCacheFreeCacheBlock *bestFitLink = NULL, *bestFitLinkPrev = NULL;
-   CodeCacheFreeCacheBlock *biggestLink = NULL;
-   CodeCacheFreeCacheBlock *secondBiggestLink = NULL;
-
    TR_ASSERT(_freeBlockList, "Because we first checked that a freeBlockExists, freeBlockList cannot be null");
 
-   // Find the smallest free link to fit the requested blockSize
-   for (currLink = _freeBlockList, prevLink = NULL; currLink; prevLink = currLink, currLink = currLink->_next)
-      {
-      if (isCold)
-         {
-         if ((void*)currLink < (void*)_coldCodeAlloc)
-            continue;
-         }
-      else
-         {
-         if ((void*)currLink >= (void*)_warmCodeAlloc)
-            continue;
-         // curLink is warm code
-         }
-
-      //fprintf(stderr, "cache %p findFreeBlock bs=%u\n", this, currLink->size);
-      if (!biggestLink)
-         {
-         biggestLink = currLink;
-         }
-      else
-         {
-         if (currLink->_size >= biggestLink->_size) // >= is important; do not use > only as secondBiggestLink may be wrong
-            {
-            secondBiggestLink = biggestLink;
-            biggestLink = currLink;
-            }
-         else
-            {
-            if (secondBiggestLink)
-               {
-               if (currLink->_size >= secondBiggestLink->_size)
-                  secondBiggestLink = currLink;
-               }
-            else
-               {
-               secondBiggestLink = currLink;
-               }
-            }
-         }
-
-      if (currLink->_size >= size)
-         {
-         if (!bestFitLink)
-            {
-            bestFitLink = currLink;
-            bestFitLinkPrev = prevLink;
-            }
-         else if (bestFitLink->_size > currLink->_size)
-            {
-            bestFitLink = currLink;
-            bestFitLinkPrev = prevLink;
-            }
-         }
-      } // end for
+   CodeCacheFreeBlockIndex &index = isCold ? _coldFreeBlocks : _warmFreeBlocks;
+   CodeCacheFreeCacheBlock *bestFitLink = index.findBestFit(size);
 
    // safety net
-   TR_ASSERT(biggestLink, "There must be a biggestLink");
    TR_ASSERT(bestFitLink, "There must be a bestFitLink");
 
    TR::CodeCacheConfig & config = _manager->codeCacheConfig();
-   if (!isCold)
-      {
-      TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() ||
-              _sizeOfLargestFreeWarmBlock == biggestLink->_size, "_sizeOfLargestFreeWarmBlock=%d  biggestLink->_size=%d",
-           _sizeOfLargestFreeWarmBlock, (int32_t)biggestLink->_size);
-      }
-   else
-      {
-      TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() ||
-         _sizeOfLargestFreeColdBlock == biggestLink->_size, "assertion failure");
-      }
 
    if (bestFitLink)
       {
-      // Fix the linked list by removing the allocated block AND if there is any unused
-      // space left in the currLink chunk, reclaim it and put back on the freeList
-      CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, bestFitLinkPrev, bestFitLink);
+      // Remove the allocated block AND if there is any unused space left in
+      // the chunk, reclaim it and put it back on the free list
+      CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, bestFitLink);
+      self()->updateMaxSizeOfFreeBlocks(isCold);
 
-      if (bestFitLink == biggestLink)  // Size of biggest might have changed
-         {
-         uint64_t leftBlockSize     = leftBlock ? leftBlock->_size : 0;
-         uint64_t secondBiggestSize = secondBiggestLink ? secondBiggestLink->_size : 0;
-         uint64_t biggestSize       = leftBlockSize > secondBiggestSize ? leftBlockSize : secondBiggestSize;
-         if (!isCold)
-            {
-            _sizeOfLargestFreeWarmBlock = (size_t)biggestSize;
-            }
-         else
-            _sizeOfLargestFreeColdBlock = (size_t)biggestSize;
-         }
      //fprintf(stderr, "--ccr-- reallocate free'd block of size %d\n", size);
      if (config.verboseReclamation())
          {
@@ -1241,11 +1137,9 @@ OMR::CodeCache::findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeede
 //
 // The function returns the remaining part of the block that was split
 OMR::CodeCacheFreeCacheBlock *
-OMR::CodeCache::removeFreeBlock(size_t blockSize,
-                              CodeCacheFreeCacheBlock *prev,
-                              CodeCacheFreeCacheBlock *curr)
+OMR::CodeCache::removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *curr)
    {
-   CodeCacheFreeCacheBlock *next = curr->_next;
+   self()->unlinkFreeBlock(curr);
 
    // Is there any left over space in the current link? Save it as a
    // separate link and adjust the sizes of the two split resulting blocks
@@ -1253,22 +1147,13 @@ OMR::CodeCache::removeFreeBlock(size_t blockSize,
       {
       size_t splitSize = curr->_size - blockSize; // remaining portion
       curr->_size = blockSize;
-      curr = (CodeCacheFreeCacheBlock *) ((uint8_t *) curr + blockSize);
-      curr->_size = splitSize;
-      curr->_next = next;
-
-      if (prev)
-         prev->_next = curr;
-      else
-         _freeBlockList = curr;
-      return curr;
+      CodeCacheFreeCacheBlock *leftBlock = (CodeCacheFreeCacheBlock *) ((uint8_t *) curr + blockSize);
+      leftBlock->_size = splitSize;
+      self()->linkFreeBlock(leftBlock);
+      return leftBlock;
       }
    else // Use the entire block
       {
-      if (prev)
-         prev->_next = next;
-      else
-         _freeBlockList = next;
       return NULL;
       }
    }
@@ -1306,8 +1191,10 @@ OMR::CodeCache::printOccupancyStats()
             fprintf(stderr, " %" OMR_PRIuSIZE, currLink->_size);
             totalReclaimed += currLink->_size;
             }
+         fprintf(stderr, "\n");
+         self()->printFreeBlockIndexStats("warm", _warmFreeBlocks);
+         self()->printFreeBlockIndexStats("cold", _coldFreeBlocks);
          }
-      fprintf(stderr, "\n");
       }
 
    TR::CodeCacheConfig &config = _manager->codeCacheConfig();
@@ -1326,6 +1213,36 @@ OMR::CodeCache::printOccupancyStats()
    }
 
 
+// Print how fragmented the free space of one region is: the number of free
+// blocks, how much of the free space lies outside the largest block, and how
+// the blocks are spread over the size classes. Called with the cache monitor held.
+//
+void
+OMR::CodeCache::printFreeBlockIndexStats(const char *regionName, CodeCacheFreeBlockIndex &index)
+   {
+   size_t totalSize = index.totalSize();
+   size_t largestSize = index.largestBlockSize();
+   size_t fragmentation = totalSize ? (size_t)(((uint64_t)(totalSize - largestSize) * 100) / totalSize) : 0;
+
+   fprintf(stderr, "   %s free blocks = %" OMR_PRIuSIZE " total = %" OMR_PRIuSIZE " bytes largest = %" OMR_PRIuSIZE " bytes fragmentation = %" OMR_PRIuSIZE "%%\n",
+      regionName, index.blockCount(), totalSize, largestSize, fragmentation);
+
+   if (index.blockCount())
+      {
+      fprintf(stderr, "   %s free blocks by size (bytes:count):", regionName);
+      for (size_t sizeClass = 0; sizeClass < CODECACHE_FREE_BLOCK_SIZE_CLASSES; sizeClass++)
+         {
+         size_t count = 0;
+         for (CodeCacheFreeCacheBlock *block = index.sizeClassHead(sizeClass); block; block = block->_sizeClassNext)
+            count++;
+         if (count)
+            fprintf(stderr, " %" OMR_PRIuSIZE "+:%" OMR_PRIuSIZE, CodeCacheFreeBlockIndex::sizeClassLowerBound(sizeClass), count);
+         }
+      fprintf(stderr, "\n");
+      }
+   }
+
+
 void
 OMR::CodeCache::printFreeBlocks()
    {
@@ -1353,6 +1270,7 @@ OMR::CodeCache::checkForErrors()
       {
       bool doCrash = false;
       size_t maxFreeWarmSize = 0, maxFreeColdSize = 0;
+      size_t freeWarmBlocks = 0, freeWarmSize = 0, freeColdBlocks = 0, freeColdSize = 0;
       // scope for cache walk
          {
          CacheCriticalSection walkFreeList(self());
@@ -1415,13 +1333,25 @@ OMR::CodeCache::checkForErrors()
                {
                if (currLink->_size > maxFreeWarmSize)
                   maxFreeWarmSize = currLink->_size;
+               freeWarmBlocks++;
+               freeWarmSize += currLink->_size;
                }
             else // cold block
                {
                if (currLink->_size > maxFreeColdSize)
                   maxFreeColdSize = currLink->_size;
+               freeColdBlocks++;
+               freeColdSize += currLink->_size;
                }
             } // end for
+         if (freeWarmBlocks != _warmFreeBlocks.blockCount() || freeWarmSize != _warmFreeBlocks.totalSize() ||
+             freeColdBlocks != _coldFreeBlocks.blockCount() || freeColdSize != _coldFreeBlocks.totalSize())
+            {
+            fprintf(stderr, "checkForErrors cache %p: Error: free block index (warm %" OMR_PRIuSIZE " blocks %" OMR_PRIuSIZE " bytes, cold %" OMR_PRIuSIZE " blocks %" OMR_PRIuSIZE " bytes) does not match the free block list (warm %" OMR_PRIuSIZE " blocks %" OMR_PRIuSIZE " bytes, cold %" OMR_PRIuSIZE " blocks %" OMR_PRIuSIZE " bytes)\n",
+               this, _warmFreeBlocks.blockCount(), _warmFreeBlocks.totalSize(), _coldFreeBlocks.blockCount(), _coldFreeBlocks.totalSize(),
+               freeWarmBlocks, freeWarmSize, freeColdBlocks, freeColdSize);
+            doCrash = true;
+            }
          if (_sizeOfLargestFreeWarmBlock != maxFreeWarmSize)
             {
             fprintf(stderr, "checkForErrors cache %p: Error: _sizeOfLargestFreeWarmBlock(%" OMR_PRIuSIZE ") != maxFreeWarmSize(%" OMR_PRIuSIZE ")\n", this, _sizeOfLargestFreeWarmBlock, maxFreeWarmSize);
@@ -220,11 +220,29 @@ public:
                                          size_t allocatedCodeCacheSizeInBytes);
 
 private:
-   void                       updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize);
+   /**
+    * @brief Recompute the size of the largest free block in the warm or cold region
+    */
+   void                       updateMaxSizeOfFreeBlocks(bool isCold);
+
+   CodeCacheFreeBlockIndex &  freeBlockIndex(CodeCacheFreeCacheBlock *block)
+      {
+      return (uint8_t *)block < _warmCodeAlloc ? _warmFreeBlocks : _coldFreeBlocks;
+      }
+
+   /**
+    * @brief Add a block to the address ordered free block list and to the index of its region
+    */
+   void                       linkFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   /**
+    * @brief Remove a block from the address ordered free block list and from the index of its region
+    */
+   void                       unlinkFreeBlock(CodeCacheFreeCacheBlock *block);
+
+   CodeCacheFreeCacheBlock *  removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *curr);
 
-   CodeCacheFreeCacheBlock *  removeFreeBlock(size_t blockSize,
-                                              CodeCacheFreeCacheBlock *prev,
-                                              CodeCacheFreeCacheBlock *curr);
+   void                       printFreeBlockIndexStats(const char *regionName, CodeCacheFreeBlockIndex &index);
 
 public:
    bool                       addFreeBlock2WithCallSite(uint8_t *start,
@@ -415,6 +433,8 @@ public:
    TR::CodeCacheMemorySegment *_segment;
 
    CodeCacheFreeCacheBlock *_freeBlockList;
+   CodeCacheFreeBlockIndex _warmFreeBlocks;
+   CodeCacheFreeBlockIndex _coldFreeBlocks;
 
    // This is used in an attempt to enforce mutually exclusive ownership.
    // flag accessed under mutex <== This is deceiving! There are two different monitors we may hold (not at the same time!) when we write to this.
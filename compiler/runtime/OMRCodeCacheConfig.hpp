@@ -106,7 +106,9 @@ class OMR_EXTENSIBLE CodeCacheConfig
          _doSanityChecks(false),
          _codeCacheFreeBlockRecylingEnabled(false),
          _emitExecutableELF(false),
-         _emitRelocatableELF(false)
+         _emitRelocatableELF(false),
+         _emitPerfMap(false),
+         _emitPerfJitDump(false)
       {
       #if defined(J9ZOS390)     // EBCDIC
       _warmEyeCatcher[0] = '\xD1';
@@ -176,6 +178,8 @@ class OMR_EXTENSIBLE CodeCacheConfig
 
    bool emitExecutableELF() const { return _emitExecutableELF; }
    bool emitRelocatableELF() const { return _emitRelocatableELF; }
+   bool emitPerfMap() const { return _emitPerfMap; }
+   bool emitPerfJitDump() const { return _emitPerfJitDump; }
 
    int32_t _trampolineCodeSize;          /*!< size of the trampoline code in bytes */
    int32_t _CCPreLoadedCodeSize;         /*!< size of the pre-Loaded CodeCache Helpers code in bytes */
@@ -206,6 +210,8 @@ class OMR_EXTENSIBLE CodeCacheConfig
 
    bool _emitExecutableELF;                  /*!< emit code cache as ELF object on shutdown */
    bool _emitRelocatableELF;
+   bool _emitPerfMap;                        /*!< publish code events to a perf map file */
+   bool _emitPerfJitDump;                    /*!< publish code events to a perf jitdump file */
 
    char * const warmEyeCatcher() { return _warmEyeCatcher; }
 
@@ -43,6 +43,7 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeEventPublisher.hpp"
 #include "runtime/Runtime.hpp"
 
 #if (HOST_OS == OMR_LINUX)
@@ -59,7 +60,8 @@ OMR::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator) :
    _initialized(false),
    _codeCacheFull(false),
    _currTotalUsedInBytes(0),
-   _maxUsedInBytes(0)
+   _maxUsedInBytes(0),
+   _codeEventPublisher(NULL)
    {
    }
 
@@ -151,6 +153,19 @@ OMR::CodeCacheManager::initialize(
    if (!(_usageMonitor = TR::Monitor::create("CodeCacheUsageMonitor")))
       return NULL;
 
+   if (config.emitPerfMap() || config.emitPerfJitDump())
+      {
+      uint32_t formats = (config.emitPerfMap() ? TR::CodeEventPublisher::PerfMap : 0)
+                       | (config.emitPerfJitDump() ? TR::CodeEventPublisher::PerfJitDump : 0);
+      _codeEventPublisher = new (_rawAllocator, std::nothrow) TR::CodeEventPublisher(_rawAllocator, formats);
+      if (_codeEventPublisher && !_codeEventPublisher->startup())
+         {
+         _codeEventPublisher->~CodeEventPublisher();
+         _rawAllocator.deallocate(_codeEventPublisher);
+         _codeEventPublisher = NULL;
+         }
+      }
+
 #if defined(TR_HOST_POWER)
    #define REACHEABLE_RANGE_KB (32*1024)
 #elif defined(TR_HOST_ARM64)
@@ -225,6 +240,13 @@ OMR::CodeCacheManager::destroy()
    }
 #endif // HOST_OS == OMR_LINUX
 
+   if (_codeEventPublisher)
+      {
+      _codeEventPublisher->~CodeEventPublisher();
+      _rawAllocator.deallocate(_codeEventPublisher);
+      _codeEventPublisher = NULL;
+      }
+
    TR::CodeCache *codeCache = self()->getFirstCodeCache();
    while (codeCache != NULL)
       {
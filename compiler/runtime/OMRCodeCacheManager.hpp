@@ -41,6 +41,7 @@ class TR_Memory;
 namespace TR { class CodeCache; }
 namespace TR { class CodeCacheManager; }
 namespace TR { class CodeCacheMemorySegment; }
+namespace TR { class CodeEventPublisher; }
 namespace TR { class CodeGenerator; }
 namespace TR { class Monitor; }
 namespace OMR { class CodeCacheHashEntrySlab; }
@@ -325,6 +326,14 @@ public:
    size_t getCurrTotalUsedInBytes() const { return _currTotalUsedInBytes; }
    size_t getMaxUsedInBytes() const { return _maxUsedInBytes; }
 
+   /**
+    * @brief The publisher code load and unload events are reported to.
+    *
+    * @return the publisher, or NULL if no perf map or jitdump output was
+    *         requested in the code cache configuration
+    */
+   TR::CodeEventPublisher *codeEventPublisher() { return _codeEventPublisher; }
+
 protected:
 
    TR::RawAllocator               _rawAllocator;
@@ -345,6 +354,8 @@ protected:
    TR::Monitor                   *_usageMonitor;
    size_t                         _currTotalUsedInBytes;
    size_t                         _maxUsedInBytes;
+
+   TR::CodeEventPublisher        *_codeEventPublisher;
 #if (HOST_OS == OMR_LINUX)
    public:
    /**
@@ -407,68 +407,68 @@
 #define _BBStartEvaluator TR::TreeEvaluator::BBStartEvaluator
 #define _BBEndEvaluator TR::TreeEvaluator::BBEndEvaluator
 #define _viremEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _viminEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vimaxEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vigetelemEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _visetelemEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _viminEvaluator TR::TreeEvaluator::SIMDminmaxEvaluator
+#define _vimaxEvaluator TR::TreeEvaluator::SIMDminmaxEvaluator
+#define _vigetelemEvaluator TR::TreeEvaluator::SIMDgetvelemEvaluator
+#define _visetelemEvaluator TR::TreeEvaluator::SIMDsetvelemEvaluator
 #define _vimergelEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vimergehEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpeqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpgtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpgeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpalleqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpallneEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpallgtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpallgeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpallltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpallleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanyeqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanyneEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanygtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanygeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanyltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vicmpanyleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vnotEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vbitselectEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vicmpeqEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vicmpgtEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vicmpgeEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vicmpltEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vicmpleEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vicmpalleqEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpallneEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpallgtEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpallgeEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpallltEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpallleEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanyeqEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanyneEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanygtEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanygeEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanyltEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vicmpanyleEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vnotEvaluator TR::TreeEvaluator::SIMDnotEvaluator
+#define _vbitselectEvaluator TR::TreeEvaluator::SIMDbitselectEvaluator
 #define _vpermEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vsplatsEvaluator TR::TreeEvaluator::SIMDsplatsEvaluator
 #define _vdmergelEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdmergehEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdsetelemEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdgetelemEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vdsetelemEvaluator TR::TreeEvaluator::SIMDsetvelemEvaluator
+#define _vdgetelemEvaluator TR::TreeEvaluator::SIMDgetvelemEvaluator
 #define _vdselEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdremEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdmaddEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdnmsubEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdmsubEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdmaxEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdminEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpeqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpneEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpgtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpgeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpalleqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpallneEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpallgtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpallgeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpallltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpallleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanyeqEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanyneEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanygtEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanygeEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanyltEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdcmpanyleEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vdsqrtEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vdmaxEvaluator TR::TreeEvaluator::SIMDminmaxEvaluator
+#define _vdminEvaluator TR::TreeEvaluator::SIMDminmaxEvaluator
+#define _vdcmpeqEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpneEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpgtEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpgeEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpltEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpleEvaluator TR::TreeEvaluator::SIMDcompareEvaluator
+#define _vdcmpalleqEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpallneEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpallgtEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpallgeEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpallltEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpallleEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanyeqEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanyneEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanygtEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanygeEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanyltEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdcmpanyleEvaluator TR::TreeEvaluator::SIMDcompareAllAnyEvaluator
+#define _vdsqrtEvaluator TR::TreeEvaluator::SIMDsqrtEvaluator
 #define _vdlogEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vincEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vdecEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vnegEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vcomEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vnegEvaluator TR::TreeEvaluator::SIMDnegEvaluator
+#define _vcomEvaluator TR::TreeEvaluator::SIMDnotEvaluator
 #define _vaddEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
 #define _vsubEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
 #define _vmulEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
@@ -477,9 +477,9 @@
 #define _vandEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
 #define _vorEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
 #define _vxorEvaluator TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator
-#define _vshlEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vushrEvaluator TR::TreeEvaluator::unImpOpEvaluator
-#define _vshrEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vshlEvaluator TR::TreeEvaluator::SIMDshiftEvaluator
+#define _vushrEvaluator TR::TreeEvaluator::SIMDshiftEvaluator
+#define _vshrEvaluator TR::TreeEvaluator::SIMDshiftEvaluator
 #define _vcmpeqEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vcmpneEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vcmpltEvaluator TR::TreeEvaluator::unImpOpEvaluator
@@ -503,7 +503,7 @@
 #define _vl2vdEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _vconstEvaluator TR::TreeEvaluator::unImpOpEvaluator
 #define _getvelemEvaluator TR::TreeEvaluator::SIMDgetvelemEvaluator
-#define _vsetelemEvaluator TR::TreeEvaluator::unImpOpEvaluator
+#define _vsetelemEvaluator TR::TreeEvaluator::SIMDsetvelemEvaluator
 #define _vbRegLoadEvaluator TR::TreeEvaluator::SIMDRegLoadEvaluator
 #define _vsRegLoadEvaluator TR::TreeEvaluator::SIMDRegLoadEvaluator
 #define _viRegLoadEvaluator TR::TreeEvaluator::SIMDRegLoadEvaluator
@@ -291,6 +291,15 @@ class OMR_EXTENSIBLE TreeEvaluator: public OMR::TreeEvaluator
    static TR::Register *SIMDstoreEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *SIMDsplatsEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *SIMDgetvelemEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDsetvelemEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDcompareEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDcompareAllAnyEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDminmaxEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDsqrtEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDnegEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDnotEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDshiftEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *SIMDbitselectEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
    static TR::Register *icmpsetEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *bztestnsetEvaluator(TR::Node *node, TR::CodeGenerator *cg);
@@ -228,12 +228,13 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
       if (4 == elementCount)
          {
          /*
-          * if elem = 0, access the most significant 32 bits (set shufconst to 0x03)
-          * if elem = 1, access the second most significant 32 bits (set shufconst to 0x02)
-          * if elem = 2, access the third most significant 32 bits (set shufconst to 0x01)
-          * if elem = 3, access the least significant 32 bits (set shufconst to 0x00)
+          * elements are numbered in memory order, i.e. the same way vloadi/vstorei lay them out
+          * if elem = 0, access the least significant 32 bits (set shufconst to 0x00)
+          * if elem = 1, access the second least significant 32 bits (set shufconst to 0x01)
+          * if elem = 2, access the second most significant 32 bits (set shufconst to 0x02)
+          * if elem = 3, access the most significant 32 bits (set shufconst to 0x03)
           */
-         shufconst = (uint8_t)((3 - elem) & 0x03);
+         shufconst = (uint8_t)(elem & 0x03);
 
          /*
           * the value to be read (indicated by shufconst) from srcVectorReg is splatted into all 4 slots in the dstReg
@@ -251,10 +252,10 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
             }
 
          /*
-          * if elem = 3, the value we want is already in the least significant 32 bits
+          * if elem = 0, the value we want is already in the least significant 32 bits
           * as a result, a mov instruction is good enough and splatting the value is unnecessary
           */
-         if (3 == elem)
+         if (0 == elem)
             {
             generateRegRegInstruction(MOVDQURegReg, node, dstReg, srcVectorReg, cg);
             }
@@ -286,16 +287,16 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
 
          /*
           * the value to be read needs to be in the least significant 64 bits.
-          * if elem = 0, the value we want is in the most significant 64 bits and needs to be splatted into
+          * if elem = 1, the value we want is in the most significant 64 bits and needs to be splatted into
           * the least significant 64 bits (the other bits affected by the splat are never read)
-          * if elem = 1, the value we want is already in the least significant 64 bits
+          * if elem = 0, the value we want is already in the least significant 64 bits
           * as a result, a mov instruction is good enough and splatting the value is unnecessary
           */
-         if (1 == elem)
+         if (0 == elem)
             {
             generateRegRegInstruction(MOVDQURegReg, node, dstReg, srcVectorReg, cg);
             }
-         else //0 == elem
+         else //1 == elem
             {
             generateRegRegImmInstruction(PSHUFDRegRegImm1, node, dstReg, srcVectorReg, 0x0e, cg);
             }
@@ -305,7 +306,7 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
             if (cg->comp()->target().is32Bit())
                {
                generateRegRegInstruction(MOVDReg4Reg, node, lowResReg, dstReg, cg);
-               generateRegRegImmInstruction(PSHUFDRegRegImm1, node, dstReg, srcVectorReg, (0 == elem) ? 0x03 : 0x01, cg);
+               generateRegRegImmInstruction(PSHUFDRegRegImm1, node, dstReg, srcVectorReg, (1 == elem) ? 0x03 : 0x01, cg);
                generateRegRegInstruction(MOVDReg4Reg, node, highResReg, dstReg, cg);
                }
             else
@@ -329,3 +330,555 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
    return resReg;
    }
 
+TR::Register* OMR::X86::TreeEvaluator::SIMDsetvelemEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* vectorChild = node->getChild(0);
+   TR::Node* elemChild = node->getChild(1);
+   TR::Node* valueChild = node->getChild(2);
+
+   TR_ASSERT_FATAL(cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1), "SIMDsetvelemEvaluator requires SSE4.1\n");
+   TR_ASSERT_FATAL(elemChild->getOpCode().isLoadConst(), "non-const second child not currently supported in SIMDsetvelemEvaluator.\n");
+
+   TR::Register* srcVectorReg = cg->evaluate(vectorChild);
+   TR::Register* valueReg = cg->evaluate(valueChild);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+   int32_t elem = elemChild->getInt();
+
+   // elements are numbered in memory order, consistent with SIMDgetvelemEvaluator
+   generateRegRegInstruction(MOVDQURegReg, node, resultReg, srcVectorReg, cg);
+   switch (node->getDataType())
+      {
+      case TR::VectorInt32:
+         TR_ASSERT(elem >= 0 && elem < 4, "Element can only be 0 to 3\n");
+         generateRegRegImmInstruction(PINSRDRegRegImm1, node, resultReg, valueReg, elem, cg);
+         break;
+      case TR::VectorInt64:
+         TR_ASSERT(elem >= 0 && elem < 2, "Element can only be 0 to 1\n");
+         if (cg->comp()->target().is32Bit())
+            {
+            generateRegRegImmInstruction(PINSRDRegRegImm1, node, resultReg, valueReg->getLowOrder(), 2 * elem, cg);
+            generateRegRegImmInstruction(PINSRDRegRegImm1, node, resultReg, valueReg->getHighOrder(), 2 * elem + 1, cg);
+            }
+         else
+            {
+            generateRegRegImmInstruction(PINSRQRegRegImm1, node, resultReg, valueReg, elem, cg);
+            }
+         break;
+      case TR::VectorFloat:
+         {
+         TR_ASSERT(elem >= 0 && elem < 4, "Element can only be 0 to 3\n");
+         TR::Register* tempReg = cg->allocateRegister();
+         generateRegRegInstruction(MOVDReg4Reg, node, tempReg, valueReg, cg);
+         generateRegRegImmInstruction(PINSRDRegRegImm1, node, resultReg, tempReg, elem, cg);
+         cg->stopUsingRegister(tempReg);
+         break;
+         }
+      case TR::VectorDouble:
+         {
+         TR_ASSERT(elem >= 0 && elem < 2, "Element can only be 0 to 1\n");
+         TR_ASSERT_FATAL(cg->comp()->target().is64Bit(), "VectorDouble is not currently supported in SIMDsetvelemEvaluator on 32-bit.\n");
+         TR::Register* tempReg = cg->allocateRegister();
+         generateRegRegInstruction(MOVQReg8Reg, node, tempReg, valueReg, cg);
+         generateRegRegImmInstruction(PINSRQRegRegImm1, node, resultReg, tempReg, elem, cg);
+         cg->stopUsingRegister(tempReg);
+         break;
+         }
+      default:
+         if (cg->comp()->getOption(TR_TraceCG))
+            traceMsg(cg->comp(), "Unsupported data type, Node = %p\n", node);
+         TR_ASSERT_FATAL(false, "unsupported vector type %s in SIMDsetvelemEvaluator.\n", node->getDataType().toString());
+         break;
+      }
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(vectorChild);
+   cg->decReferenceCount(elemChild);
+   cg->decReferenceCount(valueChild);
+   return resultReg;
+   }
+
+/*
+ * Emit resultReg = lhsReg <op> rhsReg for a two-operand SSE instruction, using the non-destructive
+ * VEX form when AVX is available.
+ */
+static void generateVectorBinaryInstruction(TR_X86OpCodes opCode, TR::Node* node, TR::Register* resultReg, TR::Register* lhsReg, TR::Register* rhsReg, TR::CodeGenerator* cg)
+   {
+   if (cg->comp()->target().cpu.supportsAVX())
+      {
+      generateRegRegRegInstruction(opCode, node, resultReg, lhsReg, rhsReg, cg);
+      }
+   else
+      {
+      generateRegRegInstruction(MOVDQURegReg, node, resultReg, lhsReg, cg);
+      generateRegRegInstruction(opCode, node, resultReg, rhsReg, cg);
+      }
+   }
+
+/*
+ * Set every bit of reg.
+ */
+static void generateVectorAllOnes(TR::Node* node, TR::Register* reg, TR::CodeGenerator* cg)
+   {
+   generateRegRegInstruction(PCMPEQDRegReg, node, reg, reg, cg);
+   }
+
+enum VectorCompareCondition
+   {
+   VectorCompareEQ,
+   VectorCompareNE,
+   VectorCompareGT,
+   VectorCompareGE,
+   VectorCompareLT,
+   VectorCompareLE,
+   };
+
+static VectorCompareCondition getVectorCompareCondition(TR::ILOpCodes op)
+   {
+   switch (op)
+      {
+      case TR::vicmpeq:
+      case TR::vicmpalleq:
+      case TR::vicmpanyeq:
+      case TR::vdcmpeq:
+      case TR::vdcmpalleq:
+      case TR::vdcmpanyeq:
+         return VectorCompareEQ;
+      case TR::vicmpallne:
+      case TR::vicmpanyne:
+      case TR::vdcmpne:
+      case TR::vdcmpallne:
+      case TR::vdcmpanyne:
+         return VectorCompareNE;
+      case TR::vicmpgt:
+      case TR::vicmpallgt:
+      case TR::vicmpanygt:
+      case TR::vdcmpgt:
+      case TR::vdcmpallgt:
+      case TR::vdcmpanygt:
+         return VectorCompareGT;
+      case TR::vicmpge:
+      case TR::vicmpallge:
+      case TR::vicmpanyge:
+      case TR::vdcmpge:
+      case TR::vdcmpallge:
+      case TR::vdcmpanyge:
+         return VectorCompareGE;
+      case TR::vicmplt:
+      case TR::vicmpalllt:
+      case TR::vicmpanylt:
+      case TR::vdcmplt:
+      case TR::vdcmpalllt:
+      case TR::vdcmpanylt:
+         return VectorCompareLT;
+      case TR::vicmple:
+      case TR::vicmpallle:
+      case TR::vicmpanyle:
+      case TR::vdcmple:
+      case TR::vdcmpallle:
+      case TR::vdcmpanyle:
+         return VectorCompareLE;
+      default:
+         TR_ASSERT_FATAL(false, "unrecognized vector compare %s\n", TR::ILOpCode(op).getName());
+         return VectorCompareEQ;
+      }
+   }
+
+/*
+ * Evaluate both children of a vector compare and return a register holding an all-ones
+ * lane for every element where the comparison holds and zero elsewhere.
+ */
+static TR::Register* generateVectorCompareMask(TR::Node* node, VectorCompareCondition cond, bool isDouble, TR::CodeGenerator* cg)
+   {
+   TR::Register* lhsReg = cg->evaluate(node->getChild(0));
+   TR::Register* rhsReg = cg->evaluate(node->getChild(1));
+   TR::Register* maskReg = cg->allocateRegister(TR_VRF);
+
+   if (isDouble)
+      {
+      // CMPPD predicates: 0 = EQ_OQ, 1 = LT_OS, 2 = LE_OS, 4 = NEQ_UQ; GT and GE swap the operands
+      uint8_t predicate = 0;
+      bool swap = false;
+      switch (cond)
+         {
+         case VectorCompareEQ: predicate = 0; break;
+         case VectorCompareNE: predicate = 4; break;
+         case VectorCompareLT: predicate = 1; break;
+         case VectorCompareLE: predicate = 2; break;
+         case VectorCompareGT: predicate = 1; swap = true; break;
+         case VectorCompareGE: predicate = 2; swap = true; break;
+         }
+      generateRegRegInstruction(MOVDQURegReg, node, maskReg, swap ? rhsReg : lhsReg, cg);
+      generateRegRegImmInstruction(CMPPDRegRegImm1, node, maskReg, swap ? lhsReg : rhsReg, predicate, cg);
+      }
+   else
+      {
+      // SSE only provides signed 32-bit EQ and GT; everything else is a swap and/or a complement
+      bool invert = false;
+      switch (cond)
+         {
+         case VectorCompareEQ:
+            generateVectorBinaryInstruction(PCMPEQDRegReg, node, maskReg, lhsReg, rhsReg, cg);
+            break;
+         case VectorCompareNE:
+            generateVectorBinaryInstruction(PCMPEQDRegReg, node, maskReg, lhsReg, rhsReg, cg);
+            invert = true;
+            break;
+         case VectorCompareGT:
+            generateVectorBinaryInstruction(PCMPGTDRegReg, node, maskReg, lhsReg, rhsReg, cg);
+            break;
+         case VectorCompareLE:
+            generateVectorBinaryInstruction(PCMPGTDRegReg, node, maskReg, lhsReg, rhsReg, cg);
+            invert = true;
+            break;
+         case VectorCompareLT:
+            generateVectorBinaryInstruction(PCMPGTDRegReg, node, maskReg, rhsReg, lhsReg, cg);
+            break;
+         case VectorCompareGE:
+            generateVectorBinaryInstruction(PCMPGTDRegReg, node, maskReg, rhsReg, lhsReg, cg);
+            invert = true;
+            break;
+         }
+
+      if (invert)
+         {
+         TR::Register* onesReg = cg->allocateRegister(TR_VRF);
+         generateVectorAllOnes(node, onesReg, cg);
+         generateRegRegInstruction(PXORRegReg, node, maskReg, onesReg, cg);
+         cg->stopUsingRegister(onesReg);
+         }
+      }
+
+   return maskReg;
+   }
+
+static bool isDoubleVectorCompare(TR::Node* node)
+   {
+   return node->getChild(0)->getDataType() == TR::VectorDouble;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDcompareEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Register* resultReg = generateVectorCompareMask(node, getVectorCompareCondition(node->getOpCodeValue()), isDoubleVectorCompare(node), cg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(node->getChild(0));
+   cg->decReferenceCount(node->getChild(1));
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDcompareAllAnyEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::ILOpCodes op = node->getOpCodeValue();
+   bool isAll = false;
+   switch (op)
+      {
+      case TR::vicmpalleq:
+      case TR::vicmpallne:
+      case TR::vicmpallgt:
+      case TR::vicmpallge:
+      case TR::vicmpalllt:
+      case TR::vicmpallle:
+      case TR::vdcmpalleq:
+      case TR::vdcmpallne:
+      case TR::vdcmpallgt:
+      case TR::vdcmpallge:
+      case TR::vdcmpalllt:
+      case TR::vdcmpallle:
+         isAll = true;
+         break;
+      default:
+         break;
+      }
+
+   TR::Register* maskReg = generateVectorCompareMask(node, getVectorCompareCondition(op), isDoubleVectorCompare(node), cg);
+   TR::Register* resultReg = cg->allocateRegister();
+
+   // Every lane of the mask is either all ones or all zeros, so the byte sign mask tells us
+   // whether all (0xffff) or any (non-zero) of the lanes satisfied the comparison.
+   generateRegRegInstruction(PMOVMSKB4RegReg, node, resultReg, maskReg, cg);
+   if (isAll)
+      {
+      generateRegImmInstruction(CMP4RegImm4, node, resultReg, 0xffff, cg);
+      generateRegInstruction(SETE1Reg, node, resultReg, cg);
+      }
+   else
+      {
+      generateRegRegInstruction(TEST4RegReg, node, resultReg, resultReg, cg);
+      generateRegInstruction(SETNE1Reg, node, resultReg, cg);
+      }
+   generateRegRegInstruction(MOVZXReg4Reg1, node, resultReg, resultReg, cg);
+   cg->stopUsingRegister(maskReg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(node->getChild(0));
+   cg->decReferenceCount(node->getChild(1));
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDminmaxEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* lhsChild = node->getChild(0);
+   TR::Node* rhsChild = node->getChild(1);
+
+   TR_X86OpCodes opCode = BADIA32Op;
+   switch (node->getOpCodeValue())
+      {
+      case TR::vimin:
+         opCode = PMINSDRegReg;
+         break;
+      case TR::vimax:
+         opCode = PMAXSDRegReg;
+         break;
+      case TR::vdmin:
+         opCode = MINPDRegReg;
+         break;
+      case TR::vdmax:
+         opCode = MAXPDRegReg;
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "unrecognized opcode %s in SIMDminmaxEvaluator.\n", node->getOpCode().getName());
+         break;
+      }
+
+   if (opCode == PMINSDRegReg || opCode == PMAXSDRegReg)
+      TR_ASSERT_FATAL(cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_SSE4_1), "%s requires SSE4.1\n", node->getOpCode().getName());
+
+   TR::Register* lhsReg = cg->evaluate(lhsChild);
+   TR::Register* rhsReg = cg->evaluate(rhsChild);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+   generateVectorBinaryInstruction(opCode, node, resultReg, lhsReg, rhsReg, cg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(lhsChild);
+   cg->decReferenceCount(rhsChild);
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDsqrtEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* child = node->getChild(0);
+   TR::Register* srcReg = cg->evaluate(child);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+
+   generateRegRegInstruction(SQRTPDRegReg, node, resultReg, srcReg, cg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(child);
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDnegEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* child = node->getChild(0);
+   TR::Register* srcReg = cg->evaluate(child);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+
+   TR_X86OpCodes subOpCode = BADIA32Op;
+   switch (node->getDataType())
+      {
+      case TR::VectorInt8:
+         subOpCode = PSUBBRegReg;
+         break;
+      case TR::VectorInt16:
+         subOpCode = PSUBWRegReg;
+         break;
+      case TR::VectorInt32:
+         subOpCode = PSUBDRegReg;
+         break;
+      case TR::VectorInt64:
+         subOpCode = PSUBQRegReg;
+         break;
+      case TR::VectorFloat:
+      case TR::VectorDouble:
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "unsupported vector type %s in SIMDnegEvaluator.\n", node->getDataType().toString());
+         break;
+      }
+
+   if (subOpCode != BADIA32Op)
+      {
+      // 0 - x
+      generateRegRegInstruction(PXORRegReg, node, resultReg, resultReg, cg);
+      generateRegRegInstruction(subOpCode, node, resultReg, srcReg, cg);
+      }
+   else
+      {
+      // flip the sign bits so that -0.0 and NaNs are handled the same way as scalar negation
+      TR::Register* signReg = cg->allocateRegister(TR_VRF);
+      generateVectorAllOnes(node, signReg, cg);
+      if (node->getDataType() == TR::VectorFloat)
+         {
+         generateRegImmInstruction(PSLLDRegImm1, node, signReg, 31, cg);
+         generateVectorBinaryInstruction(XORPSRegReg, node, resultReg, srcReg, signReg, cg);
+         }
+      else
+         {
+         generateRegImmInstruction(PSLLQRegImm1, node, signReg, 63, cg);
+         generateVectorBinaryInstruction(XORPDRegReg, node, resultReg, srcReg, signReg, cg);
+         }
+      cg->stopUsingRegister(signReg);
+      }
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(child);
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDnotEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* child = node->getChild(0);
+   TR::Register* srcReg = cg->evaluate(child);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+
+   generateVectorAllOnes(node, resultReg, cg);
+   generateRegRegInstruction(PXORRegReg, node, resultReg, srcReg, cg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(child);
+   return resultReg;
+   }
+
+/*
+ * Shift each element of valueReg by the count in the matching element of amountReg without AVX2.
+ * The SSE2 shifts take a single count from the low quadword of a register, so every element is
+ * moved to element 0 together with its zero-extended count, shifted on its own, and the partial
+ * results are interleaved back together.
+ */
+static void generateVectorShiftByElement(TR::Node* node, TR_X86OpCodes shiftOpCode, bool is64Bit, TR::Register* resultReg, TR::Register* valueReg, TR::Register* amountReg, TR::CodeGenerator* cg)
+   {
+   int32_t numElements = is64Bit ? 2 : 4;
+   TR::Register* elementRegs[4];
+   TR::Register* countReg = cg->allocateRegister(TR_VRF);
+
+   for (int32_t i = 0; i < numElements; i++)
+      {
+      elementRegs[i] = cg->allocateRegister(TR_VRF);
+      if (is64Bit)
+         {
+         // copy dwords 2i and 2i+1 of the value and of the count into the low quadword
+         uint8_t selector = (2 * i) | ((2 * i + 1) << 2);
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, elementRegs[i], valueReg, selector, cg);
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, countReg, amountReg, selector, cg);
+         }
+      else
+         {
+         // copy element i of the value into dword 0, and of the count into dword 1 so that shifting the
+         // quadword right by 32 leaves it zero-extended in the low quadword
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, elementRegs[i], valueReg, i, cg);
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, countReg, amountReg, i << 2, cg);
+         generateRegImmInstruction(PSRLQRegImm1, node, countReg, 32, cg);
+         }
+      generateRegRegInstruction(shiftOpCode, node, elementRegs[i], countReg, cg);
+      }
+
+   if (is64Bit)
+      {
+      generateVectorBinaryInstruction(PUNPCKLQDQRegReg, node, resultReg, elementRegs[0], elementRegs[1], cg);
+      }
+   else
+      {
+      generateRegRegInstruction(PUNPCKLDQRegReg, node, elementRegs[0], elementRegs[1], cg);
+      generateRegRegInstruction(PUNPCKLDQRegReg, node, elementRegs[2], elementRegs[3], cg);
+      generateVectorBinaryInstruction(PUNPCKLQDQRegReg, node, resultReg, elementRegs[0], elementRegs[2], cg);
+      }
+
+   for (int32_t i = 0; i < numElements; i++)
+      cg->stopUsingRegister(elementRegs[i]);
+   cg->stopUsingRegister(countReg);
+   }
+
+/*
+ * Emit resultReg = valueReg shifted by the per-element counts in amountReg, using the AVX2 variable
+ * shifts when available.
+ */
+static void generateVectorShift(TR::Node* node, TR_X86OpCodes avx2OpCode, TR_X86OpCodes sseOpCode, bool is64Bit, TR::Register* resultReg, TR::Register* valueReg, TR::Register* amountReg, TR::CodeGenerator* cg)
+   {
+   if (cg->comp()->target().cpu.supportsAVX2())
+      generateRegRegRegInstruction(avx2OpCode, node, resultReg, valueReg, amountReg, cg);
+   else
+      generateVectorShiftByElement(node, sseOpCode, is64Bit, resultReg, valueReg, amountReg, cg);
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDshiftEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* valueChild = node->getChild(0);
+   TR::Node* amountChild = node->getChild(1);
+   TR::DataType type = node->getDataType();
+
+   TR_ASSERT_FATAL(type == TR::VectorInt32 || type == TR::VectorInt64, "unsupported vector type %s in SIMDshiftEvaluator.\n", type.toString());
+
+   TR::Register* valueReg = cg->evaluate(valueChild);
+   TR::Register* amountReg = cg->evaluate(amountChild);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+   bool is64Bit = type == TR::VectorInt64;
+
+   switch (node->getOpCodeValue())
+      {
+      case TR::vshl:
+         if (is64Bit)
+            generateVectorShift(node, VPSLLVQRegRegReg, PSLLQRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+         else
+            generateVectorShift(node, VPSLLVDRegRegReg, PSLLDRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+         break;
+      case TR::vushr:
+         if (is64Bit)
+            generateVectorShift(node, VPSRLVQRegRegReg, PSRLQRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+         else
+            generateVectorShift(node, VPSRLVDRegRegReg, PSRLDRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+         break;
+      case TR::vshr:
+         if (is64Bit)
+            {
+            // there is no packed arithmetic quadword shift: compute ((x >>> n) ^ m) - m where m = (1 << 63) >>> n
+            TR::Register* signReg = cg->allocateRegister(TR_VRF);
+            TR::Register* maskReg = cg->allocateRegister(TR_VRF);
+            generateVectorAllOnes(node, signReg, cg);
+            generateRegImmInstruction(PSLLQRegImm1, node, signReg, 63, cg);
+            generateVectorShift(node, VPSRLVQRegRegReg, PSRLQRegReg, is64Bit, maskReg, signReg, amountReg, cg);
+            generateVectorShift(node, VPSRLVQRegRegReg, PSRLQRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+            generateRegRegInstruction(PXORRegReg, node, resultReg, maskReg, cg);
+            generateRegRegInstruction(PSUBQRegReg, node, resultReg, maskReg, cg);
+            cg->stopUsingRegister(signReg);
+            cg->stopUsingRegister(maskReg);
+            }
+         else
+            {
+            generateVectorShift(node, VPSRAVDRegRegReg, PSRADRegReg, is64Bit, resultReg, valueReg, amountReg, cg);
+            }
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "unrecognized opcode %s in SIMDshiftEvaluator.\n", node->getOpCode().getName());
+         break;
+      }
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(valueChild);
+   cg->decReferenceCount(amountChild);
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDbitselectEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   TR::Node* falseChild = node->getChild(0);
+   TR::Node* trueChild = node->getChild(1);
+   TR::Node* maskChild = node->getChild(2);
+
+   TR::Register* falseReg = cg->evaluate(falseChild);
+   TR::Register* trueReg = cg->evaluate(trueChild);
+   TR::Register* maskReg = cg->evaluate(maskChild);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+   TR::Register* tempReg = cg->allocateRegister(TR_VRF);
+
+   // (trueValue & mask) | (falseValue & ~mask)
+   generateVectorBinaryInstruction(PANDRegReg, node, resultReg, trueReg, maskReg, cg);
+   generateVectorBinaryInstruction(PANDNRegReg, node, tempReg, maskReg, falseReg, cg);
+   generateRegRegInstruction(PORRegReg, node, resultReg, tempReg, cg);
+   cg->stopUsingRegister(tempReg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(falseChild);
+   cg->decReferenceCount(trueChild);
+   cg->decReferenceCount(maskChild);
+   return resultReg;
+   }
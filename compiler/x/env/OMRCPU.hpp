@@ -101,6 +101,7 @@ public:
    bool supportsSFence();
    bool prefersMultiByteNOP();
    bool supportsAVX();
+   bool supportsAVX2();
    bool testOSForSSESupport() { return false; }
    
    /**
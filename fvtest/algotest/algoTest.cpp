@@ -111,6 +111,11 @@ static const PoolInputData poolParams[] = {
 	{"larger pool - default alignment size",				16,		256,	0,						0,		0},
 	{"larger pool - 8 alignment size",						16,		256,	8,						0,		0},
 	{"larger pool - large alignment size",					16,		256,	64,						0,		0},
+	{"concurrent small pool",								4,		10,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"concurrent page size pool - with 8-byte elements",	8,		0,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"concurrent larger pool",								16,		256,	sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"concurrent larger pool - large alignment size",		16,		256,	64,						0,		POOL_CONCURRENT},
+	{"concurrent large element pool",						48,		100,	sizeof(uintptr_t),		0,		POOL_CONCURRENT},
 	{"large struct, small number",							9999,	5,		sizeof(uintptr_t),		0,		0},
 	{"small struct, large number",							4,		9999,	sizeof(uintptr_t),		0,		0},
 	{"zero minElements - should default to 1",				64,		0,		sizeof(uintptr_t),		0,		0},
@@ -187,6 +192,16 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+TEST(OmrAlgoTest, PoolTestThreadCaches)
+{
+	ASSERT_EQ(0, testPoolThreadCaches(omrTestEnv->getPortLibrary()));
+}
+
+TEST(OmrAlgoTest, PoolTestConcurrentThreadCaches)
+{
+	ASSERT_EQ(0, testPoolConcurrentThreadCaches(omrTestEnv->getPortLibrary()));
+}
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -208,6 +223,7 @@ TEST_P(HashtableTest, Force)
 	HashtableInputData params = GetParam();
 	params.forceCollisions = TRUE;
 	params.collisionResistant = FALSE;
+	params.openAddressing = FALSE;
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
@@ -217,12 +233,39 @@ TEST_P(HashtableTest, NoForce)
 	HashtableInputData params = GetParam();
 	params.forceCollisions = FALSE;
 	params.collisionResistant = FALSE;
+	params.openAddressing = FALSE;
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
+class OpenAddressingHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(OpenAddressingHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(OpenAddressingHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, OpenAddressingHashtableTest, ::testing::ValuesIn(hastableParams));
+
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
 {
 };
@@ -232,6 +275,7 @@ TEST_P(CollisionResilientHashtableTest, Force)
 	HashtableInputData params = ::testing::get<0>(GetParam());
 	params.forceCollisions = TRUE;
 	params.collisionResistant = TRUE;
+	params.openAddressing = FALSE;
 	params.listToTreeThreshold = ::testing::get<1>(GetParam());
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
@@ -242,6 +286,7 @@ TEST_P(CollisionResilientHashtableTest, NoForce)
 	HashtableInputData params = ::testing::get<0>(GetParam());
 	params.forceCollisions = FALSE;
 	params.collisionResistant = TRUE;
+	params.openAddressing = FALSE;
 	params.listToTreeThreshold = ::testing::get<1>(GetParam());
 
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
@@ -50,6 +50,7 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -82,6 +83,22 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolThreadCaches(OMRPortLibrary *portLib);
+
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolConcurrentThreadCaches(OMRPortLibrary *portLib);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
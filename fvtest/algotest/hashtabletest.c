@@ -216,12 +216,17 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 				NULL,
 				userData);
 	} else {
+		if (TRUE == inputData->openAddressing) {
+			flags |= J9HASH_TABLE_OPEN_ADDRESSING;
+		} else {
+			flags |= J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION;
+		}
 		hashtable = hashTableNew(portLib,
 				tableName,
 				tableSize,
 				entrySize,
 				sizeof(char *),
-				flags | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION,
+				flags,
 				OMRMEM_CATEGORY_VM,
 				hashFn,
 				hashEqualFn,
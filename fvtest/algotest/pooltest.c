@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "omrutil.h"
 #include "pool_api.h"
 #include "algorithm_test_internal.h"
@@ -33,6 +34,11 @@ static int32_t sharedPuddleListReferenceCount = 0;
 
 #define NUM_POOLS_TO_SHARE_PUDDLE_LIST 16
 
+#define NUM_CACHED_ELEMENTS (3 * J9POOL_MAGAZINE_SIZE + 5)
+#define NUM_CACHE_THREADS 4
+#define NUM_CACHE_ITERATIONS 2000
+#define NUM_CACHE_LIVE_ELEMENTS 40
+
 #define FIRST_BYTE_MARKER 1
 #define BYTE_MARKER 2
 #define LAST_BYTE_MARKER 4
@@ -401,3 +407,220 @@ error:
 
 	return result;
 }
+
+/**
+ * Elements freed into a thread cache must no longer be visible to pool walks,
+ * and flushing the cache must return them to their puddles.
+ */
+int32_t
+testPoolThreadCaches(OMRPortLibrary *portLib)
+{
+	J9PoolThreadCache cache;
+	void *elements[NUM_CACHED_ELEMENTS];
+	pool_state state;
+	void *element = NULL;
+	uintptr_t capacity = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+	J9Pool *pool = pool_new(sizeof(uintptr_t) * 4, 0, 0, POOL_CONCURRENT,
+							OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+
+	if (NULL == pool) {
+		return -1;
+	}
+	memset(&cache, 0, sizeof(cache));
+
+	for (i = 0; i < NUM_CACHED_ELEMENTS; i++) {
+		elements[i] = pool_newElementCached(pool, &cache);
+		if (NULL == elements[i]) {
+			result = -2;
+			goto done;
+		}
+		*(uintptr_t *)elements[i] = i + 1;
+	}
+	if (NUM_CACHED_ELEMENTS != pool_numElements(pool)) {
+		result = -3;
+		goto done;
+	}
+
+	/* Free every other element into the cache. */
+	for (i = 0; i < NUM_CACHED_ELEMENTS; i += 2) {
+		pool_removeElementCached(pool, &cache, elements[i]);
+		if (pool_includesElement(pool, elements[i])) {
+			result = -4;
+			goto done;
+		}
+	}
+	if ((NUM_CACHED_ELEMENTS / 2) != pool_numElements(pool)) {
+		result = -5;
+		goto done;
+	}
+	for (element = pool_startDo(pool, &state); NULL != element; element = pool_nextDo(&state)) {
+		/* only the elements with odd indices (even values) are still allocated */
+		if (0 != (*(uintptr_t *)element & 1)) {
+			result = -6;
+			goto done;
+		}
+	}
+
+	/* A double free is ignored. */
+	pool_removeElementCached(pool, &cache, elements[0]);
+	if ((NUM_CACHED_ELEMENTS / 2) != pool_numElements(pool)) {
+		result = -7;
+		goto done;
+	}
+
+	/* Reallocating from the cache hands out zeroed elements. */
+	for (i = 0; i < NUM_CACHED_ELEMENTS; i += 2) {
+		elements[i] = pool_newElementCached(pool, &cache);
+		if ((NULL == elements[i]) || (0 != *(uintptr_t *)elements[i])) {
+			result = -8;
+			goto done;
+		}
+	}
+	if (NUM_CACHED_ELEMENTS != pool_numElements(pool)) {
+		result = -9;
+		goto done;
+	}
+
+	capacity = pool_capacity(pool);
+	for (i = 0; i < NUM_CACHED_ELEMENTS; i++) {
+		pool_removeElementCached(pool, &cache, elements[i]);
+	}
+	pool_flushThreadCache(pool, &cache);
+	if ((0 != pool_numElements(pool)) || (NULL != pool_startDo(pool, &state))) {
+		result = -10;
+		goto done;
+	}
+	if ((NULL != cache.loaded) || (NULL != cache.previous)) {
+		result = -11;
+		goto done;
+	}
+
+	/* The slots parked in the depot are reclaimed before the pool grows. */
+	for (i = 0; i < capacity; i++) {
+		if (NULL == pool_newElement(pool)) {
+			result = -12;
+			goto done;
+		}
+	}
+	if (capacity != pool_capacity(pool)) {
+		result = -13;
+	}
+
+done:
+	pool_flushThreadCache(pool, &cache);
+	pool_kill(pool);
+	return result;
+}
+
+typedef struct PoolCacheThreadData {
+	J9Pool *pool;
+	uintptr_t id;
+	volatile int32_t result;
+} PoolCacheThreadData;
+
+static int J9THREAD_PROC
+poolCacheThreadMain(void *arg)
+{
+	PoolCacheThreadData *data = (PoolCacheThreadData *)arg;
+	J9PoolThreadCache cache;
+	uintptr_t *live[NUM_CACHE_LIVE_ELEMENTS];
+	uintptr_t iteration = 0;
+	uintptr_t i = 0;
+
+	memset(&cache, 0, sizeof(cache));
+	memset(live, 0, sizeof(live));
+
+	for (iteration = 0; (iteration < NUM_CACHE_ITERATIONS) && (0 == data->result); iteration++) {
+		/* Vary the number of elements held so that magazines move to and from the depot. */
+		uintptr_t count = 1 + ((iteration * 7 + data->id) % NUM_CACHE_LIVE_ELEMENTS);
+
+		for (i = 0; i < count; i++) {
+			live[i] = (uintptr_t *)pool_newElementCached(data->pool, &cache);
+			if (NULL == live[i]) {
+				data->result = -1;
+				break;
+			}
+			if ((0 != live[i][0]) || (0 != live[i][1])) {
+				data->result = -2;
+				break;
+			}
+			live[i][0] = data->id;
+			live[i][1] = iteration;
+		}
+		for (i = 0; i < count; i++) {
+			if (NULL == live[i]) {
+				break;
+			}
+			/* Another thread handed the same element out while we held it. */
+			if ((data->id != live[i][0]) || (iteration != live[i][1])) {
+				data->result = -3;
+			}
+			pool_removeElementCached(data->pool, &cache, live[i]);
+			live[i] = NULL;
+		}
+	}
+
+	pool_flushThreadCache(data->pool, &cache);
+	return 0;
+}
+
+/**
+ * Several threads allocate and free through their own caches without any
+ * external locking.
+ */
+int32_t
+testPoolConcurrentThreadCaches(OMRPortLibrary *portLib)
+{
+	omrthread_t threads[NUM_CACHE_THREADS];
+	PoolCacheThreadData data[NUM_CACHE_THREADS];
+	pool_state state;
+	uintptr_t i = 0;
+	int32_t result = 0;
+	J9Pool *pool = pool_new(sizeof(uintptr_t) * 2, 0, 0, POOL_CONCURRENT,
+							OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+
+	if (NULL == pool) {
+		return -1;
+	}
+
+	for (i = 0; i < NUM_CACHE_THREADS; i++) {
+		omrthread_attr_t attr = NULL;
+
+		threads[i] = NULL;
+		data[i].pool = pool;
+		data[i].id = i + 1;
+		data[i].result = 0;
+		if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+			result = -2;
+			break;
+		}
+		if ((J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			|| (J9THREAD_SUCCESS != omrthread_create_ex(&threads[i], &attr, 0, poolCacheThreadMain, &data[i]))
+		) {
+			threads[i] = NULL;
+			result = -3;
+		}
+		omrthread_attr_destroy(&attr);
+		if (0 != result) {
+			break;
+		}
+	}
+
+	for (i = 0; i < NUM_CACHE_THREADS; i++) {
+		if (NULL != threads[i]) {
+			omrthread_join(threads[i]);
+			if ((0 == result) && (0 != data[i].result)) {
+				result = -10 + data[i].result;
+			}
+		}
+	}
+
+	if ((0 == result) && ((0 != pool_numElements(pool)) || (NULL != pool_startDo(pool, &state)))) {
+		result = -20;
+	}
+
+	pool_kill(pool);
+	return result;
+}
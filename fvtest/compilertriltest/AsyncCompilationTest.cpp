@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <atomic>
+#include <vector>
+#include "gtest/gtest.h"
+#include "JitTest.hpp"
+#include "compile/CompilationTypes.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/AsyncCompilationService.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TypeDictionary.hpp"
+#include "omrthread.h"
+
+class AsyncCompilationTest : public TRTest::JitTest {};
+
+/**
+ * @brief Builds a method returning a constant.
+ */
+class ConstantBuilder : public TR::MethodBuilder
+   {
+   public:
+   ConstantBuilder(TR::TypeDictionary *types, const char *name, int32_t value)
+      : TR::MethodBuilder(types), _value(value)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName(name);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         ConstInt32(_value));
+      return true;
+      }
+
+   private:
+   int32_t _value;
+   };
+
+/**
+ * @brief A constant method together with everything that has to outlive
+ * its asynchronous compilation.
+ *
+ * The service does not notify the type dictionary when a compilation is
+ * done, so every method gets a type dictionary of its own.
+ */
+class ConstantMethod
+   {
+   public:
+   typedef int32_t (*FunctionPtr)();
+
+   ConstantMethod(const char *name, int32_t value)
+      : _value(value), _builder(&_types, name, value), _resolvedMethod(&_builder), _entry(NULL)
+      {}
+
+   TR_ResolvedMethod *compilee() { return &_resolvedMethod; }
+   int32_t value() { return _value; }
+   FunctionPtr entry() { return reinterpret_cast<FunctionPtr>(_entry); }
+   void * volatile *installAddress() { return &_entry; }
+
+   private:
+   int32_t _value;
+   TR::TypeDictionary _types;
+   ConstantBuilder _builder;
+   TR::ResolvedMethod _resolvedMethod;
+   void * volatile _entry;
+   };
+
+/**
+ * @brief Records the order in which compilations complete.
+ *
+ * Completion callbacks only ever run on the service's single compilation
+ * thread, and the results are read after waitForIdle(), so no additional
+ * synchronization is needed.
+ */
+struct CompletionLog
+   {
+   std::vector<int32_t> values;
+   std::vector<int32_t> returnCodes;
+   };
+
+static void
+logCompletion(TR_ResolvedMethod *method, uint8_t *entryPoint, int32_t rc, void *userData)
+   {
+   CompletionLog *log = static_cast<CompletionLog *>(userData);
+   log->values.push_back(reinterpret_cast<ConstantMethod::FunctionPtr>(entryPoint)());
+   log->returnCodes.push_back(rc);
+   }
+
+/**
+ * @brief Holds the compilation thread in a completion callback so that
+ * subsequent submissions are guaranteed to queue up behind it.
+ */
+struct Gate
+   {
+   Gate() : entered(false), released(false) {}
+   std::atomic<bool> entered;
+   std::atomic<bool> released;
+   };
+
+static void
+holdGate(TR_ResolvedMethod *method, uint8_t *entryPoint, int32_t rc, void *userData)
+   {
+   Gate *gate = static_cast<Gate *>(userData);
+   gate->entered = true;
+   while (!gate->released)
+      omrthread_sleep(1);
+   }
+
+static void
+waitForGate(Gate *gate)
+   {
+   while (!gate->entered)
+      omrthread_sleep(1);
+   }
+
+TEST_F(AsyncCompilationTest, CompilesAndInstallsEntryPoints)
+   {
+   ConstantMethod first("first", 1);
+   ConstantMethod second("second", 2);
+   ConstantMethod third("third", 3);
+   ConstantMethod *methods[] = { &first, &second, &third };
+
+   TR::AsyncCompilationService service(2);
+   ASSERT_TRUE(service.startup());
+
+   for (int i = 0; i < 3; i++)
+      {
+      ASSERT_EQ(TR::AsyncCompilationService::Queued,
+                service.submit(methods[i]->compilee(), warm, 0, NULL, NULL, methods[i]->installAddress()));
+      }
+   service.waitForIdle();
+
+   EXPECT_EQ(0u, service.getNumQueued());
+   EXPECT_EQ(3u, service.getNumCompleted());
+   for (int i = 0; i < 3; i++)
+      {
+      ASSERT_NOTNULL(methods[i]->entry()) << "Entry point of method " << i << " was not installed";
+      EXPECT_EQ(methods[i]->value(), methods[i]->entry()());
+      }
+
+   service.shutdown();
+   }
+
+TEST_F(AsyncCompilationTest, RequestsAreCompiledInPriorityOrder)
+   {
+   ConstantMethod gateMethod("gate", 0);
+   ConstantMethod low("low", 1);
+   ConstantMethod normal("normal", 2);
+   ConstantMethod high("high", 3);
+   ConstantMethod alsoNormal("alsoNormal", 4);
+
+   TR::AsyncCompilationService service(1);
+   ASSERT_TRUE(service.startup());
+
+   Gate gate;
+   ASSERT_EQ(TR::AsyncCompilationService::Queued, service.submit(gateMethod.compilee(), warm, 0, holdGate, &gate));
+   waitForGate(&gate);
+
+   CompletionLog log;
+   service.submit(low.compilee(), warm, 1, logCompletion, &log);
+   service.submit(normal.compilee(), warm, 5, logCompletion, &log);
+   service.submit(high.compilee(), warm, 10, logCompletion, &log);
+   service.submit(alsoNormal.compilee(), warm, 5, logCompletion, &log);
+   EXPECT_EQ(4u, service.getNumQueued());
+
+   gate.released = true;
+   service.waitForIdle();
+
+   ASSERT_EQ(4u, log.values.size());
+   EXPECT_EQ(3, log.values[0]);
+   EXPECT_EQ(2, log.values[1]) << "Requests of equal priority should be compiled in submission order";
+   EXPECT_EQ(4, log.values[2]);
+   EXPECT_EQ(1, log.values[3]);
+
+   service.shutdown();
+   }
+
+TEST_F(AsyncCompilationTest, DuplicateRequestsAreCoalesced)
+   {
+   ConstantMethod gateMethod("gate", 0);
+   ConstantMethod first("first", 1);
+   ConstantMethod second("second", 2);
+
+   TR::AsyncCompilationService service(1);
+   ASSERT_TRUE(service.startup());
+
+   Gate gate;
+   ASSERT_EQ(TR::AsyncCompilationService::Queued, service.submit(gateMethod.compilee(), warm, 0, holdGate, &gate));
+   waitForGate(&gate);
+
+   // the gate method is still being compiled as far as the service is concerned
+   EXPECT_EQ(TR::AsyncCompilationService::Duplicate, service.submit(gateMethod.compilee(), warm, 0, NULL));
+
+   CompletionLog log;
+   EXPECT_EQ(TR::AsyncCompilationService::Queued, service.submit(first.compilee(), warm, 1, logCompletion, &log));
+   EXPECT_EQ(TR::AsyncCompilationService::Queued, service.submit(second.compilee(), warm, 2, logCompletion, &log));
+
+   // resubmitting at a higher priority moves the pending request forward
+   EXPECT_EQ(TR::AsyncCompilationService::Duplicate, service.submit(first.compilee(), warm, 3, logCompletion, &log));
+   EXPECT_EQ(2u, service.getNumQueued());
+   EXPECT_EQ(2u, service.getNumDuplicates());
+
+   gate.released = true;
+   service.waitForIdle();
+
+   ASSERT_EQ(2u, log.values.size()) << "Duplicate requests should not be compiled again";
+   EXPECT_EQ(1, log.values[0]);
+   EXPECT_EQ(2, log.values[1]);
+
+   service.shutdown();
+   }
+
+TEST_F(AsyncCompilationTest, SubmitIsRejectedWhenNotRunning)
+   {
+   ConstantMethod method("method", 1);
+
+   TR::AsyncCompilationService service(1);
+   EXPECT_EQ(TR::AsyncCompilationService::Rejected, service.submit(method.compilee(), warm, 0, NULL));
+
+   ASSERT_TRUE(service.startup());
+   service.shutdown();
+   EXPECT_EQ(TR::AsyncCompilationService::Rejected, service.submit(method.compilee(), warm, 0, NULL));
+   }
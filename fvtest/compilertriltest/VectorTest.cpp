@@ -22,7 +22,20 @@
 #include "JitTest.hpp"
 #include "default_compiler.hpp"
 
-class VectorTest : public TRTest::JitTest {};
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+class VectorTest : public TRTest::JitTest
+   {
+   protected:
+   bool supportsProcessorFeature(uint32_t feature)
+      {
+      OMRProcessorDesc desc;
+      omrsysinfo_get_processor_description(&desc);
+      return TRUE == omrsysinfo_processor_has_feature(&desc, feature);
+      }
+   };
 
 
 TEST_F(VectorTest, VDoubleAdd) { 
@@ -542,3 +555,833 @@ TEST_F(VectorTest, VDoubleDiv) {
     EXPECT_DOUBLE_EQ(inputA[0] / inputB[0], output[0]); // Epsilon = 4ULP -- is this necessary?
     EXPECT_DOUBLE_EQ(inputA[1] / inputB[1], output[1]); // Epsilon = 4ULP -- is this necessary?
 }
+
+TEST_F(VectorTest, VInt32Compare) {
+    struct { const char *opcode; bool (*reference)(int32_t, int32_t); } compares[] = {
+        { "vicmpeq", [](int32_t a, int32_t b) { return a == b; } },
+        { "vicmpgt", [](int32_t a, int32_t b) { return a > b; } },
+        { "vicmpge", [](int32_t a, int32_t b) { return a >= b; } },
+        { "vicmplt", [](int32_t a, int32_t b) { return a < b; } },
+        { "vicmple", [](int32_t a, int32_t b) { return a <= b; } },
+    };
+
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    for (auto &compare : compares) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt32 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorInt32 (aload parm=1))       "
+            "                 (vloadi type=VectorInt32 (aload parm=2))))     "
+            "     (return)))                                                 ",
+            compare.opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[])>();
+
+        int32_t output[] = {0, 0, 0, 0};
+        int32_t inputA[] = {5, -7, 2147483647, 0};
+        int32_t inputB[] = {5, 3, -2147483647 - 1, 1};
+
+        entry_point(output, inputA, inputB);
+
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_EQ(compare.reference(inputA[i], inputB[i]) ? -1 : 0, output[i]) << compare.opcode << " element " << i;
+        }
+    }
+}
+
+TEST_F(VectorTest, VDoubleCompare) {
+    struct { const char *opcode; bool (*reference)(double, double); } compares[] = {
+        { "vdcmpeq", [](double a, double b) { return a == b; } },
+        { "vdcmpne", [](double a, double b) { return a != b; } },
+        { "vdcmpgt", [](double a, double b) { return a > b; } },
+        { "vdcmpge", [](double a, double b) { return a >= b; } },
+        { "vdcmplt", [](double a, double b) { return a < b; } },
+        { "vdcmple", [](double a, double b) { return a <= b; } },
+    };
+
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    double inputs[][2][2] = {
+        { {1.0, -2.5}, {1.0, 3.0} },
+        { {4.0, 0.0},  {-4.0, -0.0} },
+    };
+
+    for (auto &compare : compares) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt64 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorDouble (aload parm=1))      "
+            "                 (vloadi type=VectorDouble (aload parm=2))))    "
+            "     (return)))                                                 ",
+            compare.opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int64_t[],double[],double[])>();
+
+        for (auto &input : inputs) {
+            int64_t output[] = {0, 0};
+            entry_point(output, input[0], input[1]);
+
+            for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+                EXPECT_EQ(compare.reference(input[0][i], input[1][i]) ? -1 : 0, output[i]) << compare.opcode << " element " << i;
+            }
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32CompareAllAny) {
+    const char *relations[] = {"eq", "ne", "gt", "ge", "lt", "le"};
+    bool (*references[])(int32_t, int32_t) = {
+        [](int32_t a, int32_t b) { return a == b; },
+        [](int32_t a, int32_t b) { return a != b; },
+        [](int32_t a, int32_t b) { return a > b; },
+        [](int32_t a, int32_t b) { return a >= b; },
+        [](int32_t a, int32_t b) { return a < b; },
+        [](int32_t a, int32_t b) { return a <= b; },
+    };
+
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation) << "vicmpallne and vicmpanyne are not implemented on Power";
+    SKIP_ON_X86(MissingImplementation);
+
+    int32_t inputs[][2][4] = {
+        { {1, 2, 3, 4}, {1, 2, 3, 4} },
+        { {1, 2, 3, 4}, {0, 1, 2, 3} },
+        { {1, 2, 3, 4}, {1, 5, 3, 0} },
+        { {-1, -2, -3, -4}, {4, 3, 2, 1} },
+    };
+
+    for (int r = 0; r < (sizeof(relations) / sizeof(*relations)); r++) {
+        for (int all = 0; all <= 1; all++) {
+            char inputTrees[1024] = {0};
+            std::snprintf(inputTrees, sizeof(inputTrees),
+                "(method return=Int32 args=[Address,Address]                     "
+                "  (block                                                        "
+                "     (ireturn                                                   "
+                "        (vicmp%s%s                                              "
+                "             (vloadi type=VectorInt32 (aload parm=0))           "
+                "             (vloadi type=VectorInt32 (aload parm=1))))))       ",
+                all ? "all" : "any", relations[r]);
+
+            auto trees = parseString(inputTrees);
+            ASSERT_NOTNULL(trees);
+
+            Tril::DefaultCompiler compiler(trees);
+            ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+            auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t[],int32_t[])>();
+
+            for (auto &input : inputs) {
+                int32_t count = 0;
+                for (int i = 0; i < 4; i++) {
+                    count += references[r](input[0][i], input[1][i]) ? 1 : 0;
+                }
+                int32_t expected = all ? (count == 4) : (count > 0);
+                EXPECT_EQ(expected, entry_point(input[0], input[1])) << "Input trees: " << inputTrees;
+            }
+        }
+    }
+}
+
+TEST_F(VectorTest, VDoubleCompareAllAny) {
+    const char *relations[] = {"eq", "ne", "gt", "ge", "lt", "le"};
+    bool (*references[])(double, double) = {
+        [](double a, double b) { return a == b; },
+        [](double a, double b) { return a != b; },
+        [](double a, double b) { return a > b; },
+        [](double a, double b) { return a >= b; },
+        [](double a, double b) { return a < b; },
+        [](double a, double b) { return a <= b; },
+    };
+
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    double inputs[][2][2] = {
+        { {1.0, 2.0}, {1.0, 2.0} },
+        { {1.0, 2.0}, {0.5, 1.5} },
+        { {1.0, 2.0}, {1.0, 7.0} },
+        { {-1.0, -2.0}, {4.0, 3.0} },
+    };
+
+    for (int r = 0; r < (sizeof(relations) / sizeof(*relations)); r++) {
+        for (int all = 0; all <= 1; all++) {
+            char inputTrees[1024] = {0};
+            std::snprintf(inputTrees, sizeof(inputTrees),
+                "(method return=Int32 args=[Address,Address]                     "
+                "  (block                                                        "
+                "     (ireturn                                                   "
+                "        (vdcmp%s%s                                              "
+                "             (vloadi type=VectorDouble (aload parm=0))          "
+                "             (vloadi type=VectorDouble (aload parm=1))))))      ",
+                all ? "all" : "any", relations[r]);
+
+            auto trees = parseString(inputTrees);
+            ASSERT_NOTNULL(trees);
+
+            Tril::DefaultCompiler compiler(trees);
+            ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+            auto entry_point = compiler.getEntryPoint<int32_t (*)(double[],double[])>();
+
+            for (auto &input : inputs) {
+                int32_t count = 0;
+                for (int i = 0; i < 2; i++) {
+                    count += references[r](input[0][i], input[1][i]) ? 1 : 0;
+                }
+                int32_t expected = all ? (count == 2) : (count > 0);
+                EXPECT_EQ(expected, entry_point(input[0], input[1])) << "Input trees: " << inputTrees;
+            }
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32MinMax) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    const char *opcodes[] = {"vimin", "vimax"};
+    for (auto opcode : opcodes) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt32 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorInt32 (aload parm=1))       "
+            "                 (vloadi type=VectorInt32 (aload parm=2))))     "
+            "     (return)))                                                 ",
+            opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[])>();
+
+        int32_t output[] = {0, 0, 0, 0};
+        int32_t inputA[] = {5, -7, 2147483647, 0};
+        int32_t inputB[] = {5, 3, -2147483647 - 1, -1};
+
+        entry_point(output, inputA, inputB);
+
+        bool isMin = opcode == opcodes[0];
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_EQ(isMin ? std::min(inputA[i], inputB[i]) : std::max(inputA[i], inputB[i]), output[i]) << opcode;
+        }
+    }
+}
+
+TEST_F(VectorTest, VDoubleMinMax) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    const char *opcodes[] = {"vdmin", "vdmax"};
+    for (auto opcode : opcodes) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorDouble offset=0                        "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorDouble (aload parm=1))      "
+            "                 (vloadi type=VectorDouble (aload parm=2))))    "
+            "     (return)))                                                 ",
+            opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(double[],double[],double[])>();
+
+        double output[] = {0.0, 0.0};
+        double inputA[] = {1.5, -3.0};
+        double inputB[] = {-2.0, 7.25};
+
+        entry_point(output, inputA, inputB);
+
+        bool isMin = opcode == opcodes[0];
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_DOUBLE_EQ(isMin ? std::min(inputA[i], inputB[i]) : std::max(inputA[i], inputB[i]), output[i]) << opcode;
+        }
+    }
+}
+
+TEST_F(VectorTest, VDoubleSqrt) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorDouble offset=0                        "
+                     "         (aload parm=0)                                         "
+                     "            (vdsqrt                                             "
+                     "                 (vloadi type=VectorDouble (aload parm=1))))    "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double[],double[])>();
+
+    double output[] = {0.0, 0.0};
+    double input[] = {16.0, 2.0};
+
+    entry_point(output, input);
+    EXPECT_DOUBLE_EQ(std::sqrt(input[0]), output[0]);
+    EXPECT_DOUBLE_EQ(std::sqrt(input[1]), output[1]);
+}
+
+TEST_F(VectorTest, VInt32Neg) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorInt32 offset=0                         "
+                     "         (aload parm=0)                                         "
+                     "            (vneg                                               "
+                     "                 (vloadi type=VectorInt32 (aload parm=1))))     "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[])>();
+
+    int32_t output[] = {0, 0, 0, 0};
+    int32_t input[] = {0, 1, -7, 2147483647};
+
+    entry_point(output, input);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_EQ(-input[i], output[i]);
+    }
+}
+
+TEST_F(VectorTest, VInt8Neg) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorInt8 offset=0                          "
+                     "         (aload parm=0)                                         "
+                     "            (vneg                                               "
+                     "                 (vloadi type=VectorInt8 (aload parm=1))))      "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int8_t[],int8_t[])>();
+
+    int8_t output[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    int8_t input[] = {0, 1, -1, 127, -127, 5, -5, 60, 61, 62, 63, -64, -65, -66, 2, 3};
+
+    entry_point(output, input);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_EQ((int8_t)-input[i], output[i]);
+    }
+}
+
+TEST_F(VectorTest, VInt64Neg) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorInt64 offset=0                         "
+                     "         (aload parm=0)                                         "
+                     "            (vneg                                               "
+                     "                 (vloadi type=VectorInt64 (aload parm=1))))     "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int64_t[],int64_t[])>();
+
+    int64_t output[] = {0, 0};
+    int64_t input[] = {-5, 4294967296LL};
+
+    entry_point(output, input);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_EQ(-input[i], output[i]);
+    }
+}
+
+TEST_F(VectorTest, VFloatNeg) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorFloat offset=0                         "
+                     "         (aload parm=0)                                         "
+                     "            (vneg                                               "
+                     "                 (vloadi type=VectorFloat (aload parm=1))))     "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(float[],float[])>();
+
+    float output[] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float input[] = {0.0f, -0.0f, 1.5f, -3.25f};
+
+    entry_point(output, input);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_FLOAT_EQ(-input[i], output[i]);
+        EXPECT_EQ(std::signbit(-input[i]), std::signbit(output[i]));
+    }
+}
+
+TEST_F(VectorTest, VDoubleNeg) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address]                   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorDouble offset=0                        "
+                     "         (aload parm=0)                                         "
+                     "            (vneg                                               "
+                     "                 (vloadi type=VectorDouble (aload parm=1))))    "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double[],double[])>();
+
+    double output[] = {0.0, 0.0};
+    double input[] = {-0.0, 2.5};
+
+    entry_point(output, input);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_DOUBLE_EQ(-input[i], output[i]);
+        EXPECT_EQ(std::signbit(-input[i]), std::signbit(output[i]));
+    }
+}
+
+TEST_F(VectorTest, VInt32Not) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation) << "vcom is not implemented on Power";
+    SKIP_ON_X86(MissingImplementation);
+
+    const char *opcodes[] = {"vnot", "vcom"};
+    for (auto opcode : opcodes) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address]                   "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt32 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorInt32 (aload parm=1))))     "
+            "     (return)))                                                 ",
+            opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[])>();
+
+        int32_t output[] = {0, 0, 0, 0};
+        int32_t input[] = {0, -1, 0x12345678, -2147483647 - 1};
+
+        entry_point(output, input);
+
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_EQ(~input[i], output[i]) << opcode;
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32Shift) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    const char *opcodes[] = {"vshl", "vushr", "vshr"};
+    for (auto opcode : opcodes) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt32 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorInt32 (aload parm=1))       "
+            "                 (vloadi type=VectorInt32 (aload parm=2))))     "
+            "     (return)))                                                 ",
+            opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[])>();
+
+        int32_t output[] = {0, 0, 0, 0};
+        int32_t inputA[] = {1, -16, 0x7f000000, -1};
+        int32_t inputB[] = {3, 2, 24, 31};
+
+        entry_point(output, inputA, inputB);
+
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            int32_t expected = 0;
+            if (opcode == opcodes[0])
+                expected = (int32_t)((uint32_t)inputA[i] << inputB[i]);
+            else if (opcode == opcodes[1])
+                expected = (int32_t)((uint32_t)inputA[i] >> inputB[i]);
+            else
+                expected = inputA[i] >> inputB[i];
+            EXPECT_EQ(expected, output[i]) << opcode << " element " << i;
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt64Shift) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    const char *opcodes[] = {"vshl", "vushr", "vshr"};
+    int64_t inputs[][2][2] = {
+        { {-256, 0x0123456789abcdefLL}, {4, 60} },
+        { {-1, 1}, {63, 0} },
+    };
+
+    for (auto opcode : opcodes) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Address]           "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt64 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (%s                                                 "
+            "                 (vloadi type=VectorInt64 (aload parm=1))       "
+            "                 (vloadi type=VectorInt64 (aload parm=2))))     "
+            "     (return)))                                                 ",
+            opcode);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int64_t[],int64_t[],int64_t[])>();
+
+        for (auto &input : inputs) {
+            int64_t output[] = {0, 0};
+            entry_point(output, input[0], input[1]);
+
+            for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+                int64_t expected = 0;
+                if (opcode == opcodes[0])
+                    expected = (int64_t)((uint64_t)input[0][i] << input[1][i]);
+                else if (opcode == opcodes[1])
+                    expected = (int64_t)((uint64_t)input[0][i] >> input[1][i]);
+                else
+                    expected = input[0][i] >> input[1][i];
+                EXPECT_EQ(expected, output[i]) << opcode << " element " << i;
+            }
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32GetElement) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    int32_t input[] = {11, -22, 33, -44};
+
+    for (int32_t elem = 0; elem < 4; elem++) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return=Int32 args=[Address]                             "
+            "  (block                                                        "
+            "     (ireturn                                                   "
+            "        (vigetelem                                              "
+            "             (vloadi type=VectorInt32 (aload parm=0))           "
+            "             (iconst %d)))))                                    ",
+            elem);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t[])>();
+        EXPECT_EQ(input[elem], entry_point(input)) << "element " << elem;
+    }
+}
+
+TEST_F(VectorTest, VDoubleGetElement) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    double input[] = {1.25, -8.5};
+
+    for (int32_t elem = 0; elem < 2; elem++) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return=Double args=[Address]                            "
+            "  (block                                                        "
+            "     (dreturn                                                   "
+            "        (vdgetelem                                              "
+            "             (vloadi type=VectorDouble (aload parm=0))          "
+            "             (iconst %d)))))                                    ",
+            elem);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<double (*)(double[])>();
+        EXPECT_DOUBLE_EQ(input[elem], entry_point(input)) << "element " << elem;
+    }
+}
+
+TEST_F(VectorTest, VInt32SetElement) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    for (int32_t elem = 0; elem < 4; elem++) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Int32]             "
+            "  (block                                                        "
+            "     (vstorei type=VectorInt32 offset=0                         "
+            "         (aload parm=0)                                         "
+            "            (visetelem                                          "
+            "                 (vloadi type=VectorInt32 (aload parm=1))       "
+            "                 (iconst %d)                                    "
+            "                 (iload parm=2)))                               "
+            "     (return)))                                                 ",
+            elem);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t)>();
+
+        int32_t output[] = {0, 0, 0, 0};
+        int32_t input[] = {1, 2, 3, 4};
+
+        entry_point(output, input, -99);
+
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_EQ(i == elem ? -99 : input[i], output[i]) << "element " << elem;
+        }
+    }
+}
+
+TEST_F(VectorTest, VDoubleSetElement) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    for (int32_t elem = 0; elem < 2; elem++) {
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return= NoType args=[Address,Address,Double]            "
+            "  (block                                                        "
+            "     (vstorei type=VectorDouble offset=0                        "
+            "         (aload parm=0)                                         "
+            "            (vdsetelem                                          "
+            "                 (vloadi type=VectorDouble (aload parm=1))      "
+            "                 (iconst %d)                                    "
+            "                 (dload parm=2)))                               "
+            "     (return)))                                                 ",
+            elem);
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<void (*)(double[],double[],double)>();
+
+        double output[] = {0.0, 0.0};
+        double input[] = {1.5, 2.5};
+
+        entry_point(output, input, -7.75);
+
+        for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+            EXPECT_DOUBLE_EQ(i == elem ? -7.75 : input[i], output[i]) << "element " << elem;
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32BitSelect) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address,Address,Address]   "
+                     "  (block                                                        "
+                     "     (vstorei type=VectorInt32 offset=0                         "
+                     "         (aload parm=0)                                         "
+                     "            (vbitselect                                         "
+                     "                 (vloadi type=VectorInt32 (aload parm=1))       "
+                     "                 (vloadi type=VectorInt32 (aload parm=2))       "
+                     "                 (vloadi type=VectorInt32 (aload parm=3))))     "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_X86(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[],int32_t[])>();
+
+    int32_t output[] = {0, 0, 0, 0};
+    int32_t inputA[] = {0x11111111, 0x22222222, 0x33333333, 0x44444444};
+    int32_t inputB[] = {0x55555555, 0x66666666, 0x77777777, -1};
+    int32_t mask[] = {0, -1, 0x0000ffff, 0x0f0f0f0f};
+
+    entry_point(output, inputA, inputB, mask);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_EQ((inputA[i] & ~mask[i]) | (inputB[i] & mask[i]), output[i]);
+    }
+}
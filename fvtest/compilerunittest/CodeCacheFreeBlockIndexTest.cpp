@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include "runtime/CodeCacheTypes.hpp"
+
+namespace
+{
+
+using OMR::CodeCacheFreeBlockIndex;
+using OMR::CodeCacheFreeCacheBlock;
+
+/**
+ * A fake code cache region to carve free blocks out of; the index only ever
+ * looks at block addresses and sizes, so the memory does not need to be code.
+ */
+class FreeBlockArena
+   {
+   public:
+
+   FreeBlockArena(size_t size) : _memory((size + sizeof(uint64_t) - 1) / sizeof(uint64_t)) {}
+
+   uint8_t *at(size_t offset) { return reinterpret_cast<uint8_t *>(&_memory[0]) + offset; }
+
+   CodeCacheFreeCacheBlock *
+   block(size_t offset, size_t size)
+      {
+      CodeCacheFreeCacheBlock *block = reinterpret_cast<CodeCacheFreeCacheBlock *>(at(offset));
+      block->_size = size;
+      return block;
+      }
+
+   private:
+
+   std::vector<uint64_t> _memory;
+   };
+
+class CodeCacheFreeBlockIndexTest : public ::testing::Test
+   {
+   public:
+
+   CodeCacheFreeBlockIndexTest() : _arena(64 * 1024) {}
+
+   virtual void SetUp() { _index.initialize(); }
+
+   protected:
+
+   FreeBlockArena _arena;
+   CodeCacheFreeBlockIndex _index;
+   };
+
+}
+
+TEST(CodeCacheFreeBlockIndexSizeClassTest, SmallSizesAreTheirOwnClass)
+   {
+   for (size_t size = 0; size < CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER; ++size)
+      {
+      EXPECT_EQ(size, CodeCacheFreeBlockIndex::sizeClass(size));
+      EXPECT_EQ(size, CodeCacheFreeBlockIndex::sizeClassLowerBound(size));
+      }
+   }
+
+TEST(CodeCacheFreeBlockIndexSizeClassTest, LowerBoundsStartTheirClass)
+   {
+   // Stop short of the classes whose lower bound would not fit in a size_t
+   const size_t lastClass = (sizeof(size_t) * 8 - 2) * CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER;
+   for (size_t sizeClass = 1; sizeClass < lastClass; ++sizeClass)
+      {
+      size_t lowerBound = CodeCacheFreeBlockIndex::sizeClassLowerBound(sizeClass);
+      EXPECT_GT(lowerBound, CodeCacheFreeBlockIndex::sizeClassLowerBound(sizeClass - 1)) << "size class " << sizeClass;
+      EXPECT_EQ(sizeClass, CodeCacheFreeBlockIndex::sizeClass(lowerBound)) << "size class " << sizeClass;
+      EXPECT_EQ(sizeClass - 1, CodeCacheFreeBlockIndex::sizeClass(lowerBound - 1)) << "size class " << sizeClass;
+      }
+   }
+
+TEST(CodeCacheFreeBlockIndexSizeClassTest, EachPowerOfTwoIsSplitEvenly)
+   {
+   EXPECT_EQ(CodeCacheFreeBlockIndex::sizeClass(64), CodeCacheFreeBlockIndex::sizeClass(79));
+   EXPECT_EQ(CodeCacheFreeBlockIndex::sizeClass(64) + 1, CodeCacheFreeBlockIndex::sizeClass(80));
+   EXPECT_EQ(CodeCacheFreeBlockIndex::sizeClass(64) + 3, CodeCacheFreeBlockIndex::sizeClass(127));
+   EXPECT_EQ(CodeCacheFreeBlockIndex::sizeClass(64) + CODECACHE_FREE_BLOCK_SIZE_CLASSES_PER_POWER, CodeCacheFreeBlockIndex::sizeClass(128));
+   EXPECT_GT(CODECACHE_FREE_BLOCK_SIZE_CLASSES, CodeCacheFreeBlockIndex::sizeClass(SIZE_MAX));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, EmptyIndexHasNoBestFit)
+   {
+   EXPECT_EQ(0, _index.blockCount());
+   EXPECT_EQ(0, _index.totalSize());
+   EXPECT_EQ(0, _index.largestBlockSize());
+   EXPECT_EQ(NULL, _index.findBestFit(0));
+   EXPECT_EQ(NULL, _index.findBestFit(MIN_SIZE_BLOCK));
+   EXPECT_EQ(NULL, _index.findPredecessor(_arena.at(1024)));
+   EXPECT_EQ(NULL, _index.findSuccessor(_arena.at(0)));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, RequestLargerThanEveryBlockHasNoBestFit)
+   {
+   _index.add(_arena.block(0, 128));
+   _index.add(_arena.block(1024, 256));
+
+   EXPECT_EQ(256, _index.largestBlockSize());
+   EXPECT_EQ(NULL, _index.findBestFit(257));
+   EXPECT_EQ(NULL, _index.findBestFit(4096));
+   EXPECT_EQ(NULL, _index.findBestFit(SIZE_MAX));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, BestFitIsSmallestBigEnoughBlock)
+   {
+   CodeCacheFreeCacheBlock *block512 = _arena.block(0, 512);
+   CodeCacheFreeCacheBlock *block200 = _arena.block(1024, 200);
+   CodeCacheFreeCacheBlock *block220 = _arena.block(2048, 220);
+   CodeCacheFreeCacheBlock *block300 = _arena.block(4096, 300);
+   CodeCacheFreeCacheBlock *block1000 = _arena.block(8192, 1000);
+
+   // 200 and 220 share a size class, so a request in between must skip the smaller one
+   ASSERT_EQ(CodeCacheFreeBlockIndex::sizeClass(200), CodeCacheFreeBlockIndex::sizeClass(220));
+
+   _index.add(block300);
+   _index.add(block1000);
+   _index.add(block200);
+   _index.add(block512);
+   _index.add(block220);
+
+   EXPECT_EQ(5, _index.blockCount());
+   EXPECT_EQ(512 + 200 + 220 + 300 + 1000, _index.totalSize());
+   EXPECT_EQ(1000, _index.largestBlockSize());
+
+   EXPECT_EQ(block200, _index.findBestFit(1));
+   EXPECT_EQ(block200, _index.findBestFit(200));
+   EXPECT_EQ(block220, _index.findBestFit(201));
+   EXPECT_EQ(block300, _index.findBestFit(221));
+   EXPECT_EQ(block300, _index.findBestFit(300));
+   EXPECT_EQ(block512, _index.findBestFit(301));
+   EXPECT_EQ(block1000, _index.findBestFit(600));
+   EXPECT_EQ(block1000, _index.findBestFit(1000));
+   EXPECT_EQ(NULL, _index.findBestFit(1001));
+
+   _index.remove(block1000);
+   EXPECT_EQ(512, _index.largestBlockSize());
+   EXPECT_EQ(NULL, _index.findBestFit(600));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, BestFitPrefersLowestAddressAmongEqualSizes)
+   {
+   CodeCacheFreeCacheBlock *high = _arena.block(8192, 256);
+   CodeCacheFreeCacheBlock *low = _arena.block(1024, 256);
+   CodeCacheFreeCacheBlock *middle = _arena.block(4096, 256);
+
+   _index.add(high);
+   _index.add(low);
+   _index.add(middle);
+
+   EXPECT_EQ(low, _index.findBestFit(256));
+   _index.remove(low);
+   EXPECT_EQ(middle, _index.findBestFit(256));
+   _index.remove(middle);
+   EXPECT_EQ(high, _index.findBestFit(256));
+   _index.remove(high);
+   EXPECT_EQ(NULL, _index.findBestFit(256));
+   EXPECT_EQ(NULL, _index.sizeClassHead(CodeCacheFreeBlockIndex::sizeClass(256)));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, PredecessorAndSuccessorByAddress)
+   {
+   CodeCacheFreeCacheBlock *first = _arena.block(1024, 128);
+   CodeCacheFreeCacheBlock *second = _arena.block(4096, 128);
+   CodeCacheFreeCacheBlock *third = _arena.block(8192, 128);
+
+   _index.add(second);
+   _index.add(third);
+   _index.add(first);
+
+   // the predecessor is strictly below the address, the successor at or above it
+   EXPECT_EQ(NULL, _index.findPredecessor(_arena.at(0)));
+   EXPECT_EQ(NULL, _index.findPredecessor(_arena.at(1024)));
+   EXPECT_EQ(first, _index.findPredecessor(_arena.at(1025)));
+   EXPECT_EQ(first, _index.findPredecessor(_arena.at(4096)));
+   EXPECT_EQ(second, _index.findPredecessor(_arena.at(5000)));
+   EXPECT_EQ(third, _index.findPredecessor(_arena.at(60000)));
+
+   EXPECT_EQ(first, _index.findSuccessor(_arena.at(0)));
+   EXPECT_EQ(first, _index.findSuccessor(_arena.at(1024)));
+   EXPECT_EQ(second, _index.findSuccessor(_arena.at(1025)));
+   EXPECT_EQ(third, _index.findSuccessor(_arena.at(4097)));
+   EXPECT_EQ(NULL, _index.findSuccessor(_arena.at(8193)));
+
+   _index.remove(second);
+   EXPECT_EQ(first, _index.findPredecessor(_arena.at(8192)));
+   EXPECT_EQ(third, _index.findSuccessor(_arena.at(1025)));
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, NeighboursStayOrderedAcrossManyAddsAndRemoves)
+   {
+   const size_t numBlocks = 200;
+   const size_t stride = 256;
+   std::vector<CodeCacheFreeCacheBlock *> blocks;
+   for (size_t i = 0; i < numBlocks; ++i)
+      blocks.push_back(_arena.block(i * stride, MIN_SIZE_BLOCK + (i % 7) * 16));
+
+   // insert out of address order so the treap has to rotate
+   std::vector<CodeCacheFreeCacheBlock *> shuffled(blocks);
+   for (size_t i = 0; i < numBlocks; ++i)
+      std::swap(shuffled[i], shuffled[(i * 7919) % numBlocks]);
+   for (size_t i = 0; i < numBlocks; ++i)
+      _index.add(shuffled[i]);
+
+   EXPECT_EQ(numBlocks, _index.blockCount());
+   for (size_t i = 0; i < numBlocks; ++i)
+      {
+      EXPECT_EQ(i > 0 ? blocks[i - 1] : NULL, _index.findPredecessor(_arena.at(i * stride)));
+      EXPECT_EQ(blocks[i], _index.findSuccessor(_arena.at(i * stride)));
+      }
+
+   // drop every other block; the neighbours of the survivors are now two strides away
+   for (size_t i = 1; i < numBlocks; i += 2)
+      _index.remove(blocks[i]);
+
+   EXPECT_EQ(numBlocks / 2, _index.blockCount());
+   for (size_t i = 2; i < numBlocks; i += 2)
+      {
+      EXPECT_EQ(blocks[i - 2], _index.findPredecessor(_arena.at(i * stride)));
+      EXPECT_EQ(blocks[i], _index.findSuccessor(_arena.at((i - 1) * stride)));
+      }
+   }
+
+TEST_F(CodeCacheFreeBlockIndexTest, FreeingBetweenNeighboursCoalescesThem)
+   {
+   // [0, 256) and [512, 768) are free; freeing [256, 512) must leave one free block [0, 768)
+   CodeCacheFreeCacheBlock *low = _arena.block(0, 256);
+   CodeCacheFreeCacheBlock *high = _arena.block(512, 256);
+   CodeCacheFreeCacheBlock *unrelated = _arena.block(4096, 256);
+   _index.add(high);
+   _index.add(unrelated);
+   _index.add(low);
+
+   // this is the lookup OMR::CodeCache::addFreeBlock2 does to find the blocks to merge with
+   uint8_t *start = _arena.at(256);
+   uint8_t *end = _arena.at(512);
+   CodeCacheFreeCacheBlock *prev = _index.findPredecessor(start);
+   CodeCacheFreeCacheBlock *next = _index.findSuccessor(start);
+   ASSERT_EQ(low, prev);
+   ASSERT_EQ(high, next);
+   ASSERT_EQ(start, reinterpret_cast<uint8_t *>(prev) + prev->_size);
+   ASSERT_EQ(end, reinterpret_cast<uint8_t *>(next));
+
+   _index.remove(next);
+   _index.remove(prev);
+   prev->_size = (reinterpret_cast<uint8_t *>(next) + next->_size) - reinterpret_cast<uint8_t *>(prev);
+   _index.add(prev);
+
+   EXPECT_EQ(2, _index.blockCount());
+   EXPECT_EQ(768 + 256, _index.totalSize());
+   EXPECT_EQ(768, _index.largestBlockSize());
+   EXPECT_EQ(low, _index.findBestFit(257));
+   EXPECT_EQ(unrelated, _index.findBestFit(256));
+   EXPECT_EQ(low, _index.findPredecessor(_arena.at(4096)));
+   EXPECT_EQ(unrelated, _index.findSuccessor(_arena.at(1)));
+
+   // the merged block left the size class of its parts
+   CodeCacheFreeCacheBlock *head = _index.sizeClassHead(CodeCacheFreeBlockIndex::sizeClass(256));
+   EXPECT_EQ(unrelated, head);
+   EXPECT_EQ(NULL, head->_sizeClassNext);
+   EXPECT_EQ(low, _index.sizeClassHead(CodeCacheFreeBlockIndex::sizeClass(768)));
+   }
@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/CodeEventPublisher.hpp"
+#include "thread_api.h"
+
+namespace
+{
+
+std::string
+outputFileName(const char *format)
+   {
+   char name[64];
+   snprintf(name, sizeof(name), format, static_cast<int>(getpid()));
+   return name;
+   }
+
+std::vector<uint8_t>
+readFile(const std::string &name)
+   {
+   std::vector<uint8_t> contents;
+   FILE *file = fopen(name.c_str(), "rb");
+   if (file)
+      {
+      uint8_t buffer[4096];
+      size_t n;
+      while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+         contents.insert(contents.end(), buffer, buffer + n);
+      fclose(file);
+      }
+   return contents;
+   }
+
+template <typename T>
+T
+readAt(const std::vector<uint8_t> &contents, size_t offset)
+   {
+   T value;
+   memcpy(&value, &contents[offset], sizeof(T));
+   return value;
+   }
+
+struct JitDumpRecord
+   {
+   uint32_t id;
+   size_t offset;
+   uint32_t size;
+   };
+
+std::vector<JitDumpRecord>
+jitDumpRecords(const std::vector<uint8_t> &contents)
+   {
+   std::vector<JitDumpRecord> records;
+   size_t offset = readAt<uint32_t>(contents, 8);
+   while (offset + 16 <= contents.size())
+      {
+      JitDumpRecord record = { readAt<uint32_t>(contents, offset), offset, readAt<uint32_t>(contents, offset + 4) };
+      if (record.size < 16 || offset + record.size > contents.size())
+         break;
+      records.push_back(record);
+      offset += record.size;
+      }
+   return records;
+   }
+
+class AttachedThread
+   {
+   public:
+   AttachedThread() : _thread(NULL)
+      {
+      if (0 == omrthread_init_library())
+         omrthread_attach_ex(&_thread, J9THREAD_ATTR_DEFAULT);
+      }
+   ~AttachedThread()
+      {
+      if (_thread)
+         omrthread_detach(_thread);
+      }
+   bool attached() { return _thread != NULL; }
+
+   private:
+   omrthread_t _thread;
+   };
+
+}
+
+TEST(CodeEventPublisherTest, PerfMapNamesEveryLoad)
+   {
+   std::string mapName = outputFileName("/tmp/perf-%d.map");
+   remove(mapName.c_str());
+
+   uint8_t code[256];
+   memset(code, 0x90, sizeof(code));
+
+   TR::RawAllocator rawAllocator;
+   TR::CodeEventPublisher publisher(rawAllocator, TR::CodeEventPublisher::PerfMap);
+   ASSERT_TRUE(publisher.startup());
+
+   publisher.publishLoad(code, 64, "first");
+   publisher.publishUnload(code, 64);
+   publisher.publishLoad(code + 64, 32, "second");
+   publisher.publishMove(code + 64, code + 128, 32, "second");
+   publisher.flush();
+   EXPECT_EQ(4, publisher.getNumWritten());
+   publisher.shutdown();
+
+   std::vector<uint8_t> contents = readFile(mapName);
+   std::string text(contents.begin(), contents.end());
+   char expected[256];
+   snprintf(expected, sizeof(expected), "%lX 40 first\n%lX 20 second\n%lX 20 second\n",
+      (unsigned long)(uintptr_t)code, (unsigned long)(uintptr_t)(code + 64), (unsigned long)(uintptr_t)(code + 128));
+   EXPECT_EQ(std::string(expected), text);
+
+   remove(mapName.c_str());
+   }
+
+TEST(CodeEventPublisherTest, JitDumpDescribesLoadsAndMoves)
+   {
+   std::string dumpName = outputFileName("/tmp/jit-%d.dump");
+   remove(dumpName.c_str());
+
+   uint8_t code[256];
+   for (size_t i = 0; i < sizeof(code); ++i)
+      code[i] = static_cast<uint8_t>(i);
+
+   TR::CodeEventPublisher::LineEntry lines[] = { { code, 10 }, { code + 8, 11 } };
+
+   TR::RawAllocator rawAllocator;
+   TR::CodeEventPublisher publisher(rawAllocator, TR::CodeEventPublisher::PerfJitDump);
+   ASSERT_TRUE(publisher.startup());
+   ASSERT_TRUE(publisher.wantsLineNumbers());
+
+   publisher.publishLoad(code, 16, "withLines", "Source.java", lines, 2);
+   publisher.publishLoad(code + 64, 32, "moved");
+   publisher.publishMove(code + 64, code + 128, 32, "moved");
+   // a move of a body that was reclaimed is not written
+   publisher.publishUnload(code, 16);
+   publisher.publishMove(code, code + 192, 16, "withLines");
+   publisher.shutdown();
+
+   std::vector<uint8_t> contents = readFile(dumpName);
+   ASSERT_GE(contents.size(), 40);
+   EXPECT_EQ(0x4A695444, readAt<uint32_t>(contents, 0));
+   EXPECT_EQ(1, readAt<uint32_t>(contents, 4));
+   EXPECT_EQ(static_cast<uint32_t>(getpid()), readAt<uint32_t>(contents, 20));
+
+   std::vector<JitDumpRecord> records = jitDumpRecords(contents);
+   ASSERT_EQ(5, records.size());
+
+   // line numbers come first, then the load they describe
+   EXPECT_EQ(2, records[0].id);
+   EXPECT_EQ(reinterpret_cast<uintptr_t>(code), readAt<uint64_t>(contents, records[0].offset + 16));
+   EXPECT_EQ(2, readAt<uint64_t>(contents, records[0].offset + 24));
+   EXPECT_EQ(reinterpret_cast<uintptr_t>(code + 8), readAt<uint64_t>(contents, records[0].offset + 32 + 16 + strlen("Source.java") + 1));
+   EXPECT_EQ(11, readAt<int32_t>(contents, records[0].offset + 32 + 16 + strlen("Source.java") + 1 + 8));
+
+   EXPECT_EQ(0, records[1].id);
+   EXPECT_EQ(reinterpret_cast<uintptr_t>(code), readAt<uint64_t>(contents, records[1].offset + 32));
+   EXPECT_EQ(16, readAt<uint64_t>(contents, records[1].offset + 40));
+   uint64_t firstIndex = readAt<uint64_t>(contents, records[1].offset + 48);
+   EXPECT_STREQ("withLines", reinterpret_cast<const char *>(&contents[records[1].offset + 56]));
+   EXPECT_EQ(0, memcmp(code, &contents[records[1].offset + 56 + strlen("withLines") + 1], 16));
+
+   EXPECT_EQ(0, records[2].id);
+   uint64_t movedIndex = readAt<uint64_t>(contents, records[2].offset + 48);
+   EXPECT_EQ(firstIndex + 1, movedIndex);
+
+   EXPECT_EQ(1, records[3].id);
+   EXPECT_EQ(reinterpret_cast<uintptr_t>(code + 64), readAt<uint64_t>(contents, records[3].offset + 32));
+   EXPECT_EQ(reinterpret_cast<uintptr_t>(code + 128), readAt<uint64_t>(contents, records[3].offset + 40));
+   EXPECT_EQ(movedIndex, readAt<uint64_t>(contents, records[3].offset + 56));
+
+   EXPECT_EQ(3, records[4].id);
+
+   remove(dumpName.c_str());
+   }
+
+TEST(CodeEventPublisherTest, WriterThreadWritesEveryEvent)
+   {
+   AttachedThread self;
+   ASSERT_TRUE(self.attached());
+
+   std::string mapName = outputFileName("/tmp/perf-%d.map");
+   remove(mapName.c_str());
+
+   static const int numThreads = 4;
+   static const int eventsPerThread = 1000;
+   static uint8_t code[numThreads * eventsPerThread];
+
+   TR::RawAllocator rawAllocator;
+   TR::CodeEventPublisher publisher(rawAllocator, TR::CodeEventPublisher::PerfMap);
+   ASSERT_TRUE(publisher.startup());
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < numThreads; ++t)
+      {
+      threads.push_back(std::thread([&publisher, t]()
+         {
+         for (int i = 0; i < eventsPerThread; ++i)
+            publisher.publishLoad(&code[(t * eventsPerThread) + i], 1, "body");
+         }));
+      }
+   for (size_t t = 0; t < threads.size(); ++t)
+      threads[t].join();
+
+   publisher.flush();
+   EXPECT_EQ(numThreads * eventsPerThread, publisher.getNumPublished());
+   EXPECT_EQ(numThreads * eventsPerThread, publisher.getNumWritten());
+   publisher.shutdown();
+
+   std::vector<uint8_t> contents = readFile(mapName);
+   size_t numLines = 0;
+   for (size_t i = 0; i < contents.size(); ++i)
+      numLines += (contents[i] == '\n') ? 1 : 0;
+   EXPECT_EQ(numThreads * eventsPerThread, numLines);
+
+   remove(mapName.c_str());
+   }
+
+TEST(CodeEventPublisherTest, PublishingRacesWithShutdown)
+   {
+   AttachedThread self;
+   ASSERT_TRUE(self.attached());
+
+   std::string mapName = outputFileName("/tmp/perf-%d.map");
+   std::string dumpName = outputFileName("/tmp/jit-%d.dump");
+   remove(mapName.c_str());
+   remove(dumpName.c_str());
+
+   static const int numThreads = 4;
+   static uint8_t code[64];
+
+   TR::RawAllocator rawAllocator;
+   for (int round = 0; round < 20; ++round)
+      {
+      TR::CodeEventPublisher publisher(rawAllocator, TR::CodeEventPublisher::PerfMap | TR::CodeEventPublisher::PerfJitDump);
+      ASSERT_TRUE(publisher.startup());
+
+      // Attached publishers may wake the writer through its monitor, and once
+      // the writer is gone they write the events out themselves
+      volatile bool stop = false;
+      std::vector<std::thread> threads;
+      for (int t = 0; t < numThreads; ++t)
+         {
+         threads.push_back(std::thread([&publisher, &stop]()
+            {
+            AttachedThread attached;
+            while (!stop)
+               {
+               publisher.publishLoad(code, sizeof(code), "body");
+               publisher.publishUnload(code, sizeof(code));
+               }
+            }));
+         }
+
+      while (publisher.getNumPublished() < 1000)
+         std::this_thread::yield();
+      publisher.shutdown();
+      stop = true;
+      for (size_t t = 0; t < threads.size(); ++t)
+         threads[t].join();
+
+      EXPECT_LE(publisher.getNumWritten(), publisher.getNumPublished());
+      }
+
+   remove(mapName.c_str());
+   remove(dumpName.c_str());
+   }
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "env/PersistentAllocator.hpp"
+
+namespace
+{
+
+size_t
+blocksInUse(TR::PersistentAllocator &allocator)
+   {
+   TR::PersistentAllocator::SizeClassStatistics stats[TR::PersistentAllocator::NUM_SIZE_CLASSES];
+   size_t classes = allocator.getSizeClassStatistics(stats);
+   size_t inUse = 0;
+   for (size_t i = 0; i < classes; ++i)
+      inUse += stats[i].blocksInUse;
+   return inUse;
+   }
+
+}
+
+TEST(PersistentAllocatorTest, SlabsAreDisabledByDefault)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator allocator((TR::PersistentAllocatorKit(rawAllocator)));
+   TR::PersistentAllocator::SizeClassStatistics stats[TR::PersistentAllocator::NUM_SIZE_CLASSES];
+
+   EXPECT_FALSE(allocator.usesSlabs());
+   EXPECT_EQ(0, allocator.getSizeClassStatistics(stats));
+
+   void *p = allocator.allocate(64);
+   ASSERT_TRUE(p != NULL);
+   allocator.deallocate(p);
+   }
+
+TEST(PersistentAllocatorTest, SmallAllocationsComeFromSizeClasses)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator allocator(TR::PersistentAllocatorKit(rawAllocator, true));
+   ASSERT_TRUE(allocator.usesSlabs());
+
+   const size_t sizes[] = { 0, 1, 8, 16, 17, 100, 128, 129, 500, 1000, 1024 };
+   const size_t numSizes = sizeof(sizes) / sizeof(sizes[0]);
+   std::vector<void *> blocks;
+
+   for (int round = 0; round < 100; ++round)
+      {
+      for (size_t i = 0; i < numSizes; ++i)
+         {
+         void *p = allocator.allocate(sizes[i]);
+         ASSERT_TRUE(p != NULL);
+         EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % 16);
+         memset(p, static_cast<int>(i), sizes[i]);
+         blocks.push_back(p);
+         }
+      }
+
+   TR::PersistentAllocator::SizeClassStatistics stats[TR::PersistentAllocator::NUM_SIZE_CLASSES];
+   ASSERT_EQ(static_cast<size_t>(TR::PersistentAllocator::NUM_SIZE_CLASSES), allocator.getSizeClassStatistics(stats));
+   for (size_t i = 0; i < TR::PersistentAllocator::NUM_SIZE_CLASSES; ++i)
+      {
+      EXPECT_LE(stats[i].blocksInUse, stats[i].blocks);
+      if (i > 0)
+         EXPECT_LT(stats[i - 1].blockSize, stats[i].blockSize);
+      }
+   EXPECT_LE(blocks.size(), blocksInUse(allocator));
+
+   for (size_t i = 0; i < blocks.size(); ++i)
+      {
+      const size_t size = sizes[i % numSizes];
+      for (size_t b = 0; b < size; ++b)
+         ASSERT_EQ(static_cast<uint8_t>(i % numSizes), static_cast<uint8_t *>(blocks[i])[b]);
+      allocator.deallocate(blocks[i]);
+      }
+
+   allocator.flushThreadCache();
+   EXPECT_EQ(0, blocksInUse(allocator));
+   }
+
+TEST(PersistentAllocatorTest, LargeAllocationsAreTracked)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator allocator(TR::PersistentAllocatorKit(rawAllocator, true));
+   TR::PersistentAllocator::SizeClassStatistics stats[TR::PersistentAllocator::NUM_SIZE_CLASSES];
+   size_t largeBlocks = 0;
+   size_t largeBytes = 0;
+
+   void *first = allocator.allocate(4096);
+   void *second = allocator.allocate(1025);
+   memset(first, 0xab, 4096);
+   memset(second, 0xcd, 1025);
+
+   allocator.getSizeClassStatistics(stats, &largeBlocks, &largeBytes);
+   EXPECT_EQ(2, largeBlocks);
+   EXPECT_LE(4096 + 1025, largeBytes);
+   EXPECT_EQ(0, blocksInUse(allocator));
+
+   allocator.deallocate(first);
+   allocator.getSizeClassStatistics(stats, &largeBlocks, &largeBytes);
+   EXPECT_EQ(1, largeBlocks);
+
+   // The remaining block is released with the allocator.
+   }
+
+TEST(PersistentAllocatorTest, AlternatingAllocatorsReuseThreadCaches)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator first(TR::PersistentAllocatorKit(rawAllocator, true));
+   TR::PersistentAllocator second(TR::PersistentAllocatorKit(rawAllocator, true));
+
+   // Switching allocators must not leave a fresh cache (and the blocks
+   // refilled into it) behind on every switch.
+   for (int i = 0; i < 1000; ++i)
+      {
+      void *p = first.allocate(64);
+      void *q = second.allocate(64);
+      ASSERT_TRUE(p != NULL);
+      ASSERT_TRUE(q != NULL);
+      EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % 16);
+      EXPECT_EQ(0, reinterpret_cast<uintptr_t>(q) % 16);
+      first.deallocate(p);
+      second.deallocate(q);
+      }
+
+   EXPECT_GE(32, blocksInUse(first));
+   EXPECT_GE(32, blocksInUse(second));
+
+   first.flushThreadCache();
+   second.flushThreadCache();
+   EXPECT_EQ(0, blocksInUse(first));
+   EXPECT_EQ(0, blocksInUse(second));
+   }
+
+TEST(PersistentAllocatorTest, BlocksMigrateBetweenThreads)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator allocator(TR::PersistentAllocatorKit(rawAllocator, true));
+   const size_t numThreads = 4;
+   const size_t blocksPerThread = 5000;
+   std::vector<std::vector<void *> > blocks(numThreads);
+   std::vector<std::thread> threads;
+
+   // Each thread frees the blocks allocated by its neighbour so that blocks
+   // flow through the per-thread caches back to the shared free lists.
+   for (size_t t = 0; t < numThreads; ++t)
+      {
+      threads.push_back(std::thread([&allocator, &blocks, t, blocksPerThread]()
+         {
+         for (size_t i = 0; i < blocksPerThread; ++i)
+            blocks[t].push_back(allocator.allocate(8 + (i % 200)));
+         }));
+      }
+   for (size_t t = 0; t < numThreads; ++t)
+      threads[t].join();
+   threads.clear();
+
+   for (size_t t = 0; t < numThreads; ++t)
+      {
+      threads.push_back(std::thread([&allocator, &blocks, t, numThreads]()
+         {
+         std::vector<void *> &victim = blocks[(t + 1) % numThreads];
+         for (size_t i = 0; i < victim.size(); ++i)
+            allocator.deallocate(victim[i]);
+         }));
+      }
+   for (size_t t = 0; t < numThreads; ++t)
+      threads[t].join();
+
+   // Every thread exited with its cache still populated; those caches are
+   // handed back to the size classes on thread exit.
+   EXPECT_EQ(0, blocksInUse(allocator));
+   }
+
+TEST(PersistentAllocatorTest, SlabAllocatorsAreOnlyEqualToThemselves)
+   {
+   TR::RawAllocator rawAllocator;
+   TR::PersistentAllocator first(TR::PersistentAllocatorKit(rawAllocator, true));
+   TR::PersistentAllocator second(TR::PersistentAllocatorKit(rawAllocator, true));
+   TR::PersistentAllocator third((TR::PersistentAllocatorKit(rawAllocator)));
+   TR::PersistentAllocator fourth((TR::PersistentAllocatorKit(rawAllocator)));
+
+   EXPECT_TRUE(first == first);
+   EXPECT_FALSE(first == second);
+   EXPECT_FALSE(first == third);
+   EXPECT_TRUE(third == fourth);
+   }
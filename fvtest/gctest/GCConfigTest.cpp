@@ -19,9 +19,11 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AllocationStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "ObjectAllocationInterface.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
@@ -43,12 +45,21 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/async_logging_GC_config.xml"
+                        , "fvtest/gctest/configuration/free_list_size_index_GC_config.xml"
+                        , "fvtest/gctest/configuration/split_free_list_stealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/work_packet_stealing_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_pacing_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_backout_config.xml"
+                        , "fvtest/gctest/configuration/tlh_adaptive_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -57,7 +68,12 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/sweep_density_sparse.xml",
+								"perftest/gctest/configuration/sweep_density_half.xml",
+								"perftest/gctest/configuration/sweep_density_dense.xml",
+								"perftest/gctest/configuration/scavenger_fanout_noprefetch.xml",
+								"perftest/gctest/configuration/scavenger_fanout_prefetch.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -1062,5 +1078,81 @@ TEST_P(GCConfigTest, test)
 INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
         ::testing::ValuesIn(gcTests));
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+class GCConfigTLHReservationTest : public GCConfigTest
+{
+protected:
+	omrobjectptr_t
+	allocateNoGc(uintptr_t size)
+	{
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		return OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	}
+};
+
+/*
+ * A thread that abandons the remainder of its TLH and then goes idle keeps that remainder
+ * cached, so it has to stay counted in tlhReservedBytes until the next GC flushes the cache.
+ */
+TEST_P(GCConfigTLHReservationTest, abandonedRemainderStaysReserved)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_AllocationStats *stats = env->_objectAllocationInterface->getAllocationStats();
+	ASSERT_TRUE(extensions->tlhAdaptiveSizing);
+
+	/* keep the reserved limit from cutting the TLHs measured here */
+	extensions->tlhAdaptiveReservedLimit = UDATA_MAX;
+
+	uintptr_t minimumSize = extensions->tlhMinimumSize;
+	uintptr_t smallSize = extensions->objectModel.adjustSizeInBytes(64);
+	uintptr_t mediumSize = extensions->objectModel.adjustSizeInBytes(2 * minimumSize);
+
+	/* Allocate until a fresh TLH large enough to leave a cacheable remainder starts */
+	uintptr_t tlhSize = 0;
+	uintptr_t tlhTop = 0;
+	uintptr_t cursor = 0;
+	for (uintptr_t i = 0; (i < 100000) && (tlhSize < (4 * minimumSize)); i++) {
+		uintptr_t freshCount = stats->_tlhRefreshCountFresh;
+		uintptr_t freshBytes = stats->_tlhAllocatedFresh;
+		omrobjectptr_t object = allocateNoGc(smallSize);
+		ASSERT_TRUE(NULL != object) << "ran out of heap before a large enough TLH was handed out";
+		if (freshCount != stats->_tlhRefreshCountFresh) {
+			tlhSize = stats->_tlhAllocatedFresh - freshBytes;
+			tlhTop = (uintptr_t)object + tlhSize;
+		}
+		cursor = (uintptr_t)object + smallSize;
+	}
+	ASSERT_LE(4 * minimumSize, tlhSize);
+
+	/* Fill the TLH until what is left is cacheable but too small for the medium object */
+	while ((tlhTop - cursor) >= mediumSize) {
+		omrobjectptr_t object = allocateNoGc(smallSize);
+		ASSERT_EQ(cursor, (uintptr_t)object) << "TLH was refreshed while being filled";
+		cursor += smallSize;
+	}
+	uintptr_t remainder = tlhTop - cursor;
+	ASSERT_LE(minimumSize, remainder);
+
+	uintptr_t reservedBefore = extensions->tlhReservedBytes;
+	uintptr_t freshCount = stats->_tlhRefreshCountFresh;
+	uintptr_t freshBytes = stats->_tlhAllocatedFresh;
+	ASSERT_TRUE(NULL != allocateNoGc(mediumSize));
+	ASSERT_EQ(freshCount + 1, stats->_tlhRefreshCountFresh);
+	uintptr_t newTlhSize = stats->_tlhAllocatedFresh - freshBytes;
+
+	/* The old TLH's consumed part is released; its remainder moves to the abandoned list and stays counted */
+	EXPECT_EQ(reservedBefore - tlhSize + newTlhSize + remainder, extensions->tlhReservedBytes);
+
+	/* The thread goes idle; the GC flushes its TLH and the cached remainder */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	EXPECT_EQ((uintptr_t)0, extensions->tlhReservedBytes);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, GCConfigTLHReservationTest,
+        ::testing::Values("fvtest/gctest/configuration/tlh_adaptive_reservation_GC_config.xml"));
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
 INSTANTIATE_TEST_CASE_P(perfTest,GCConfigTest,
         ::testing::ValuesIn(perfTests));
@@ -101,12 +101,50 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentPacing")) {
+					extensions->concurrentPacing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentPacingCPUBudget")) {
+					int budget = atoi(attr.value());
+					if ((0 >= budget) || (100 < budget)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: concurrentPacingCPUBudget must be between 1 and 100: %s\n", attr.value());
+						result = false;
+					} else {
+						extensions->concurrentPacingCPUBudget = (uintptr_t)budget;
+					}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchDistance")) {
+					extensions->scavengerPrefetchDistance = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveReservedLimit")) {
+					extensions->tlhAdaptiveReservedLimit = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndex")) {
+					extensions->freeListSizeIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "splitFreeListSplitAmount")) {
+					extensions->splitFreeListSplitAmount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "splitFreeListStealing")) {
+					extensions->splitFreeListStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "splitFreeListRebalanceRatio")) {
+					extensions->splitFreeListRebalanceRatio = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workPacketStealing")) {
+					extensions->workPacketStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "asyncLoggingOverflow")) {
+					extensions->asyncLoggingBlockOnOverflow = (0 == j9_cmdla_stricmp(attr.value(), "block"));
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapMapSpan.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define HEAP_MAP_SLOT_COUNT 1024
+
+/**
+ * Fill a synthetic heap map where each slot is empty with the given probability (in percent).
+ * Non-empty slots alternate between fully marked and sparsely marked values.
+ */
+static void
+fillHeapMap(uintptr_t *heapMap, uintptr_t slotCount, uintptr_t emptyPercentage, uint32_t seed)
+{
+	for (uintptr_t i = 0; i < slotCount; i++) {
+		seed = (seed * 1103515245) + 12345;
+		if (((seed >> 16) % 100) < emptyPercentage) {
+			heapMap[i] = 0;
+		} else if (0 == (i & 1)) {
+			heapMap[i] = UDATA_MAX;
+		} else {
+			heapMap[i] = (uintptr_t)1 << ((seed >> 8) % J9BITS_BITS_IN_SLOT);
+		}
+	}
+}
+
+static uintptr_t *
+findNonEmptySlotSlowly(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	while ((slotCurrent < slotTop) && (0 == *slotCurrent)) {
+		slotCurrent += 1;
+	}
+	return slotCurrent;
+}
+
+static uintptr_t *
+findEmptySlotSlowly(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	while ((slotCurrent < slotTop) && (0 != *slotCurrent)) {
+		slotCurrent += 1;
+	}
+	return slotCurrent;
+}
+
+TEST(TestHeapMapSpan, FindSlotsInUniformMaps)
+{
+	uintptr_t heapMap[HEAP_MAP_SLOT_COUNT];
+
+	fillHeapMap(heapMap, HEAP_MAP_SLOT_COUNT, 100, 0);
+	EXPECT_EQ(heapMap + HEAP_MAP_SLOT_COUNT, MM_HeapMapSpan::findNonEmptySlot(heapMap, heapMap + HEAP_MAP_SLOT_COUNT));
+	EXPECT_EQ(heapMap, MM_HeapMapSpan::findEmptySlot(heapMap, heapMap + HEAP_MAP_SLOT_COUNT));
+
+	fillHeapMap(heapMap, HEAP_MAP_SLOT_COUNT, 0, 0);
+	EXPECT_EQ(heapMap, MM_HeapMapSpan::findNonEmptySlot(heapMap, heapMap + HEAP_MAP_SLOT_COUNT));
+	EXPECT_EQ(heapMap + HEAP_MAP_SLOT_COUNT, MM_HeapMapSpan::findEmptySlot(heapMap, heapMap + HEAP_MAP_SLOT_COUNT));
+
+	/* Empty ranges never read the heap map */
+	EXPECT_EQ(heapMap, MM_HeapMapSpan::findNonEmptySlot(heapMap, heapMap));
+	EXPECT_EQ(heapMap, MM_HeapMapSpan::findEmptySlot(heapMap, heapMap));
+}
+
+TEST(TestHeapMapSpan, FindSlotsAtEveryOffset)
+{
+	uintptr_t heapMap[HEAP_MAP_SLOT_COUNT];
+
+	/* A single boundary at every position of a span, for ranges that start at every position of a span */
+	for (uintptr_t base = 0; base < MM_HeapMapSpan::SLOTS_PER_SPAN; base++) {
+		for (uintptr_t boundary = base; boundary < (base + (3 * MM_HeapMapSpan::SLOTS_PER_SPAN)); boundary++) {
+			uintptr_t *top = heapMap + base + (3 * MM_HeapMapSpan::SLOTS_PER_SPAN) + 1;
+
+			fillHeapMap(heapMap, HEAP_MAP_SLOT_COUNT, 100, 0);
+			heapMap[boundary] = 1;
+			EXPECT_EQ(heapMap + boundary, MM_HeapMapSpan::findNonEmptySlot(heapMap + base, top)) << "base " << base << " boundary " << boundary;
+
+			fillHeapMap(heapMap, HEAP_MAP_SLOT_COUNT, 0, 0);
+			heapMap[boundary] = 0;
+			EXPECT_EQ(heapMap + boundary, MM_HeapMapSpan::findEmptySlot(heapMap + base, top)) << "base " << base << " boundary " << boundary;
+		}
+	}
+}
+
+TEST(TestHeapMapSpan, FindSlotsInMixedMaps)
+{
+	uintptr_t heapMap[HEAP_MAP_SLOT_COUNT];
+	uintptr_t emptyPercentages[] = { 1, 10, 50, 90, 99 };
+
+	for (uintptr_t p = 0; p < sizeof(emptyPercentages) / sizeof(emptyPercentages[0]); p++) {
+		fillHeapMap(heapMap, HEAP_MAP_SLOT_COUNT, emptyPercentages[p], (uint32_t)p);
+
+		for (uintptr_t base = 0; base < MM_HeapMapSpan::SLOTS_PER_SPAN; base++) {
+			uintptr_t *top = heapMap + HEAP_MAP_SLOT_COUNT - base;
+			uintptr_t *expected = heapMap + base;
+			uintptr_t *actual = heapMap + base;
+
+			/* Walk the whole map alternating between runs of empty and non-empty slots */
+			while (expected < top) {
+				expected = findNonEmptySlotSlowly(expected, top);
+				actual = MM_HeapMapSpan::findNonEmptySlot(actual, top);
+				ASSERT_EQ(expected, actual) << "empty " << emptyPercentages[p] << "% base " << base;
+
+				expected = findEmptySlotSlowly(expected, top);
+				actual = MM_HeapMapSpan::findEmptySlot(actual, top);
+				ASSERT_EQ(expected, actual) << "empty " << emptyPercentages[p] << "% base " << base;
+			}
+		}
+	}
+}
@@ -0,0 +1,453 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * These tests use the compiler's own MethodBuilder classes rather than the
+ * client API so that a recorder can be attached to a method and the replayed
+ * method can be compared with the original. Every method is recorded in both
+ * the binary and the text format; each recording is replayed (while being
+ * recorded again, which must reproduce it exactly) and the replayed method
+ * is compiled and run against the original.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "env/TRMemory.hpp"    // must precede MethodBuilder.hpp to get TR_ALLOC
+#include "ilgen/IlBuilder.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/IlValue.hpp"
+#include "ilgen/JitBuilderRecorderBinaryBuffer.hpp"
+#include "ilgen/JitBuilderRecorderTextFile.hpp"
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+#include "ilgen/JitBuilderReplayTextFile.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+#include "gtest/gtest.h"
+
+extern bool internal_initializeJit();
+extern int32_t internal_compileMethodBuilder(TR::MethodBuilder *methodBuilder, void **entryPoint);
+extern void internal_shutdownJit();
+
+class ReplayTest : public ::testing::Test
+   {
+   public:
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(internal_initializeJit()) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      internal_shutdownJit();
+      }
+   };
+
+static std::string
+readFile(const char *fileName)
+   {
+   std::ifstream file(fileName, std::ios::in | std::ios::binary);
+   std::stringstream contents;
+   contents << file.rdbuf();
+   return contents.str();
+   }
+
+static const char *
+reason(TR::JitBuilderReplay &replay)
+   {
+   return (NULL != replay.failureReason()) ? replay.failureReason() : "";
+   }
+
+/**
+ * @brief records method MB in both formats, checks each recording replays to
+ *        itself and returns the entry points of the original method and of the
+ *        methods compiled from the binary and the text recordings
+ */
+template <typename MB>
+static void
+recordAndReplay(const char *textFileName, void **original, void **fromBinary, void **fromText)
+   {
+   std::vector<uint8_t> recording;
+      {
+      TR::TypeDictionary types;
+      TR::JitBuilderRecorderBinaryBuffer recorder(NULL, NULL);
+      MB method(&types, &recorder);
+      ASSERT_EQ(0, internal_compileMethodBuilder(&method, original)) << "Failed to compile the recorded method";
+      recorder.Close();
+      recording = recorder.buffer();
+      }
+
+      {
+      TR::TypeDictionary types;
+      TR::JitBuilderRecorderTextFile recorder(NULL, textFileName);
+      MB method(&types, &recorder);
+      void *entry = NULL;
+      ASSERT_EQ(0, internal_compileMethodBuilder(&method, &entry)) << "Failed to compile the text recorded method";
+      recorder.Close();
+      }
+
+      {
+      TR::TypeDictionary types;
+      TR::JitBuilderReplayBinaryBuffer replay(recording);
+      TR::JitBuilderRecorderBinaryBuffer recorder(NULL, NULL);
+      TR::MethodBuilderReplay method(&types, &replay, &recorder);
+      ASSERT_EQ(0, internal_compileMethodBuilder(&method, fromBinary)) << "Failed to replay the binary recording: " << reason(replay);
+      recorder.Close();
+      EXPECT_TRUE(recording == recorder.buffer()) << "Replaying the binary recording did not record the same services";
+      }
+
+   std::string textRecording = readFile(textFileName);
+   std::string textRerecordingFileName = std::string(textFileName) + ".replayed";
+      {
+      TR::TypeDictionary types;
+      TR::JitBuilderReplayTextFile replay(textFileName);
+      TR::JitBuilderRecorderTextFile recorder(NULL, textRerecordingFileName.c_str());
+      TR::MethodBuilderReplay method(&types, &replay, &recorder);
+      ASSERT_EQ(0, internal_compileMethodBuilder(&method, fromText)) << "Failed to replay the text recording: " << reason(replay);
+      recorder.Close();
+      }
+   EXPECT_EQ(textRecording, readFile(textRerecordingFileName.c_str())) << "Replaying the text recording did not record the same services";
+
+   remove(textFileName);
+   remove(textRerecordingFileName.c_str());
+   }
+
+class ArithmeticMethod : public TR::MethodBuilder
+   {
+   public:
+   ArithmeticMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("arithmetic");
+      DefineParameter("a", Int32);
+      DefineParameter("b", Int32);
+      DefineParameter("c", Int64);
+      DefineReturnType(Int64);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlValue *a = Load("a");
+      TR::IlValue *b = Load("b");
+      Store("t",
+      Add(
+         Mul(Sub(a, b), Div(a, ConstInt32(3))),
+         Xor(Rem(a, b), Or(ShiftL(b, ConstInt32(2)), And(a, ConstInt32(0xff))))));
+      Store("t",
+      Sub(
+         Load("t"),
+         Negate(UnsignedShiftR(a, ConstInt32(1)))));
+      Return(
+         Add(
+            ConvertTo(Int64, Load("t")),
+            Mul(Load("c"), ConstInt64(-7))));
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, Arithmetic)
+   {
+   typedef int64_t (*ArithmeticFunction)(int32_t, int32_t, int64_t);
+   void *original = NULL, *fromBinary = NULL, *fromText = NULL;
+   recordAndReplay<ArithmeticMethod>("replay-arithmetic.jbil", &original, &fromBinary, &fromText);
+   ASSERT_TRUE(NULL != original);
+   ASSERT_TRUE(NULL != fromBinary);
+   ASSERT_TRUE(NULL != fromText);
+
+   int32_t args[][2] = { { 17, 5 }, { -100, 7 }, { 1 << 20, -3 } };
+   for (size_t i = 0; i < sizeof(args) / sizeof(args[0]); i++)
+      {
+      int64_t expected = ((ArithmeticFunction)original)(args[i][0], args[i][1], 1000000007LL * i);
+      EXPECT_EQ(expected, ((ArithmeticFunction)fromBinary)(args[i][0], args[i][1], 1000000007LL * i));
+      EXPECT_EQ(expected, ((ArithmeticFunction)fromText)(args[i][0], args[i][1], 1000000007LL * i));
+      }
+   }
+
+class ControlFlowMethod : public TR::MethodBuilder
+   {
+   public:
+   ControlFlowMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      DefineName("controlFlow");
+      DefineParameter("n", Int32);
+      DefineParameter("bias", Int32);
+      DefineLocal("sum", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlBuilder *tooBig = NULL;
+      IfThen(&tooBig, GreaterThan(Load("bias"), ConstInt32(1000)));
+      tooBig->Return(tooBig->ConstInt32(-1));
+
+      Store("sum", ConstInt32(0));
+
+      // sum the odd numbers below n, minus the even ones
+      TR::IlBuilder *body = NULL;
+      ForLoopUp("i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+         {
+         TR::IlBuilder *odd = NULL, *even = NULL;
+         body->IfThenElse(&odd, &even,
+         body->   EqualTo(
+         body->      And(body->Load("i"), body->ConstInt32(1)),
+         body->      ConstInt32(1)));
+         odd->Store("sum", odd->Add(odd->Load("sum"), odd->Load("i")));
+         even->Store("sum", even->Sub(even->Load("sum"), even->Load("i")));
+         }
+
+      // then halve it until it is below 10, counting the steps
+      Store("steps", ConstInt32(0));
+      Store("keepGoing", GreaterOrEqualTo(Load("sum"), ConstInt32(10)));
+      TR::IlBuilder *halve = NULL;
+      WhileDoLoop("keepGoing", &halve);
+         {
+         halve->Store("sum", halve->Div(halve->Load("sum"), halve->ConstInt32(2)));
+         halve->Store("steps", halve->Add(halve->Load("steps"), halve->ConstInt32(1)));
+         halve->Store("keepGoing", halve->GreaterOrEqualTo(halve->Load("sum"), halve->ConstInt32(10)));
+         }
+
+      Return(
+         Add(
+            Add(Mul(Load("steps"), ConstInt32(100)), Load("bias")),
+            Select(EqualTo(Load("sum"), ConstInt32(0)), ConstInt32(99), Load("sum"))));
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, ControlFlow)
+   {
+   typedef int32_t (*ControlFlowFunction)(int32_t, int32_t);
+   void *original = NULL, *fromBinary = NULL, *fromText = NULL;
+   recordAndReplay<ControlFlowMethod>("replay-controlflow.jbil", &original, &fromBinary, &fromText);
+   ASSERT_TRUE(NULL != original);
+   ASSERT_TRUE(NULL != fromBinary);
+   ASSERT_TRUE(NULL != fromText);
+
+   for (int32_t n = -1; n < 200; n += 13)
+      {
+      int32_t bias = (n % 2) ? 1001 : n;
+      int32_t expected = ((ControlFlowFunction)original)(n, bias);
+      EXPECT_EQ(expected, ((ControlFlowFunction)fromBinary)(n, bias)) << "n = " << n;
+      EXPECT_EQ(expected, ((ControlFlowFunction)fromText)(n, bias)) << "n = " << n;
+      }
+   }
+
+class ArrayMethod : public TR::MethodBuilder
+   {
+   public:
+   ArrayMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      DefineName("scaleArray");
+      DefineParameter("in", types->PointerTo(Double));
+      DefineParameter("out", types->PointerTo(Float));
+      DefineParameter("length", Int32);
+      DefineReturnType(Double);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlType *pDouble = typeDictionary()->PointerTo(Double);
+      TR::IlType *pFloat = typeDictionary()->PointerTo(Float);
+      Store("total", ConstDouble(0.1));
+
+      // out[i] = (float)(in[i] * 2.5) + 0.3f, total += in[i]
+      TR::IlBuilder *body = NULL;
+      ForLoopUp("i", &body, ConstInt32(0), Load("length"), ConstInt32(1));
+         {
+         TR::IlValue *element = body->LoadAt(pDouble, body->IndexAt(pDouble, body->Load("in"), body->Load("i")));
+         body->StoreAt(
+            body->IndexAt(pFloat, body->Load("out"), body->Load("i")),
+            body->Add(
+               body->ConvertTo(Float, body->Mul(element, body->ConstDouble(2.5))),
+               body->ConstFloat(0.3f)));
+         body->Store("total", body->Add(body->Load("total"), element));
+         }
+
+      Return(Load("total"));
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, Array)
+   {
+   typedef double (*ArrayFunction)(double *, float *, int32_t);
+   void *original = NULL, *fromBinary = NULL, *fromText = NULL;
+   recordAndReplay<ArrayMethod>("replay-array.jbil", &original, &fromBinary, &fromText);
+   ASSERT_TRUE(NULL != original);
+   ASSERT_TRUE(NULL != fromBinary);
+   ASSERT_TRUE(NULL != fromText);
+
+   double in[] = { 1.0, -2.25, 1e10, 3.0e-5, 42.0 };
+   const int32_t length = sizeof(in) / sizeof(in[0]);
+   float expectedOut[length], out[length];
+
+   double expected = ((ArrayFunction)original)(in, expectedOut, length);
+
+   memset(out, 0, sizeof(out));
+   EXPECT_EQ(expected, ((ArrayFunction)fromBinary)(in, out, length));
+   EXPECT_EQ(0, memcmp(expectedOut, out, sizeof(out)));
+
+   memset(out, 0, sizeof(out));
+   EXPECT_EQ(expected, ((ArrayFunction)fromText)(in, out, length));
+   EXPECT_EQ(0, memcmp(expectedOut, out, sizeof(out)));
+   }
+
+static int32_t
+timesThreePlus(int32_t x, int32_t y)
+   {
+   return 3 * x + y;
+   }
+
+class CallMethod : public TR::MethodBuilder
+   {
+   public:
+   CallMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      DefineName("callFunction");
+      DefineParameter("x", Int32);
+      DefineReturnType(Int32);
+      DefineFunction("timesThreePlus", __FILE__, LINETOSTR(__LINE__), (void *)&timesThreePlus, Int32, 2, Int32, Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlValue *once = Call("timesThreePlus", 2, Load("x"), ConstInt32(1));
+      Return(Call("timesThreePlus", 2, once, Load("x")));
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, Call)
+   {
+   typedef int32_t (*CallFunction)(int32_t);
+   void *original = NULL, *fromBinary = NULL, *fromText = NULL;
+   recordAndReplay<CallMethod>("replay-call.jbil", &original, &fromBinary, &fromText);
+   ASSERT_TRUE(NULL != original);
+   ASSERT_TRUE(NULL != fromBinary);
+   ASSERT_TRUE(NULL != fromText);
+
+   for (int32_t x = -5; x < 5; x++)
+      {
+      EXPECT_EQ(((CallFunction)original)(x), ((CallFunction)fromBinary)(x));
+      EXPECT_EQ(((CallFunction)original)(x), ((CallFunction)fromText)(x));
+      }
+   }
+
+class ManyValuesMethod : public TR::MethodBuilder
+   {
+   public:
+   ManyValuesMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      DefineName("manyValues");
+      DefineParameter("x", Int64);
+      DefineReturnType(Int64);
+      }
+
+   virtual bool buildIL()
+      {
+      // enough values that the recording has to switch to wider IDs part way through
+      TR::IlValue *sum = Load("x");
+      for (int64_t i = 0; i < 300; i++)
+         sum = Add(sum, ConstInt64(i * i));
+      Return(sum);
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, ManyValues)
+   {
+   typedef int64_t (*ManyValuesFunction)(int64_t);
+   void *original = NULL, *fromBinary = NULL, *fromText = NULL;
+   recordAndReplay<ManyValuesMethod>("replay-manyvalues.jbil", &original, &fromBinary, &fromText);
+   ASSERT_TRUE(NULL != original);
+   ASSERT_TRUE(NULL != fromBinary);
+   ASSERT_TRUE(NULL != fromText);
+
+   EXPECT_EQ(((ManyValuesFunction)original)(11), ((ManyValuesFunction)fromBinary)(11));
+   EXPECT_EQ(((ManyValuesFunction)original)(11), ((ManyValuesFunction)fromText)(11));
+   }
+
+struct ReplayPoint
+   {
+   int32_t x;
+   int32_t y;
+   };
+
+class StructMethod : public TR::MethodBuilder
+   {
+   public:
+   StructMethod(TR::TypeDictionary *types, TR::JitBuilderRecorder *recorder)
+      : TR::MethodBuilder(types, NULL, recorder)
+      {
+      types->DefineStruct("ReplayPoint");
+      types->DefineField("ReplayPoint", "x", Int32, offsetof(ReplayPoint, x));
+      types->DefineField("ReplayPoint", "y", Int32, offsetof(ReplayPoint, y));
+      types->CloseStruct("ReplayPoint", sizeof(ReplayPoint));
+
+      DefineName("structParameter");
+      DefineParameter("p", types->PointerTo("ReplayPoint"));
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(ConstInt32(0));
+      return true;
+      }
+   };
+
+TEST_F(ReplayTest, UnsupportedServiceFailsReplay)
+   {
+   std::vector<uint8_t> recording;
+      {
+      TR::TypeDictionary types;
+      TR::JitBuilderRecorderBinaryBuffer recorder(NULL, NULL);
+      StructMethod method(&types, &recorder);
+      void *entry = NULL;
+      ASSERT_EQ(0, internal_compileMethodBuilder(&method, &entry)) << "Recording a method must not affect its compilation";
+      recorder.Close();
+      recording = recorder.buffer();
+      }
+
+   TR::TypeDictionary types;
+   TR::JitBuilderReplayBinaryBuffer replay(recording);
+   TR::MethodBuilderReplay method(&types, &replay);
+   void *entry = NULL;
+   EXPECT_NE(0, internal_compileMethodBuilder(&method, &entry));
+   ASSERT_TRUE(NULL != replay.failureReason());
+   EXPECT_NE((const char *)NULL, strstr(replay.failureReason(), "DefineStruct")) << replay.failureReason();
+   }
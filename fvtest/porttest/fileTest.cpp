@@ -148,6 +148,14 @@ TEST(PortInitializationTest, File)
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_shutdown);
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_startup);
 
+	/* omrfile_async_test2 - omrfile_async_test7 */
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_queue_create);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_queue_destroy);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_queue_backend);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_register_buffers);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_submit);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_async_poll);
+
 	/* Verify that the file function pointers are non NULL */
 
 	/* omrfile_test5, omrfile_test6 */
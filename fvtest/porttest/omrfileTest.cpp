@@ -4805,6 +4805,547 @@ TEST_F(PortFileTest2, lastmod_failedToFindFile)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Verify the blocking-async file operations behave like their omrfile counterparts.
+ * @ref omrfile_blockingasync.c
+ */
+TEST_F(PortFileTest2, file_async_test1)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_async_test1";
+	const char *fileName = "tfileAsyncTest1.tst";
+	const char *data = "blockingasync round trip";
+	intptr_t length = (intptr_t)strlen(data);
+	char readBuffer[64];
+	intptr_t fd = -1;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrfile_unlink(fileName);
+	fd = omrfile_blockingasync_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_open() failed to create %s\n", fileName);
+		goto exit;
+	}
+	if (length != omrfile_blockingasync_write(fd, data, length)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_write() did not write %d bytes\n", (int)length);
+	}
+	if (length != omrfile_blockingasync_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_flength() did not return %d\n", (int)length);
+	}
+	omrfile_seek(fd, 0, EsSeekSet);
+	memset(readBuffer, 0, sizeof(readBuffer));
+	if ((length != omrfile_blockingasync_read(fd, readBuffer, sizeof(readBuffer))) || (0 != memcmp(readBuffer, data, length))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_read() did not read back \"%s\"\n", data);
+	}
+	if ((0 != omrfile_blockingasync_set_length(fd, 4)) || (4 != omrfile_blockingasync_flength(fd))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_set_length() failed to truncate the file\n");
+	}
+	if (0 != omrfile_blockingasync_close(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_close() failed\n");
+	}
+
+exit:
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#define ASYNC_TEST_BLOCK_SIZE 4096
+#define ASYNC_TEST_BLOCK_COUNT 32
+#define ASYNC_TEST_QUEUE_DEPTH 8
+
+/**
+ * @internal
+ * Create an asynchronous queue, returning FALSE if the platform provides none.
+ */
+static BOOLEAN
+asyncQueueCreate(struct OMRPortLibrary *portLibrary, const char *testName, uint32_t depth, uint32_t flags, OMRFileAsyncQueue **queue)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int32_t rc = omrfile_async_queue_create(depth, flags, queue);
+
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		portTestEnv->log("%s: asynchronous file queues are not supported on this platform\n", testName);
+		return FALSE;
+	}
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_queue_create(%u, 0x%x) failed, rc=%d\n", depth, flags, rc);
+		return FALSE;
+	}
+	portTestEnv->log("%s: using %s backend\n", testName,
+		(OMRPORT_FILE_ASYNC_BACKEND_IO_URING == omrfile_async_queue_backend(*queue)) ? "io_uring" : "thread pool");
+	return TRUE;
+}
+
+/**
+ * @internal
+ * Keep a queue full until all count requests have been submitted and reaped, checking
+ * every request transferred expected bytes. Answers the number of failed requests.
+ */
+static uint32_t
+asyncDrive(struct OMRPortLibrary *portLibrary, const char *testName, OMRFileAsyncQueue *queue, OMRFileAsyncRequest *requests, uint32_t count, intptr_t expected)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRFileAsyncCompletion completions[ASYNC_TEST_QUEUE_DEPTH];
+	uint32_t submitted = 0;
+	uint32_t reaped = 0;
+	uint32_t failures = 0;
+
+	while (reaped < count) {
+		int32_t rc = 0;
+		if (submitted < count) {
+			rc = omrfile_async_submit(queue, &requests[submitted], count - submitted);
+			if (rc < 0) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() failed, rc=%d\n", rc);
+				return count;
+			}
+			submitted += (uint32_t)rc;
+		}
+		rc = omrfile_async_poll(queue, completions, ASYNC_TEST_QUEUE_DEPTH, 1);
+		if (rc <= 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() with %u outstanding returned %d\n", submitted - reaped, rc);
+			return count;
+		}
+		for (int32_t i = 0; i < rc; i++) {
+			if (expected != completions[i].result) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "request %u transferred %d bytes, expected %d\n",
+					(uint32_t)completions[i].userData, (int)completions[i].result, (int)expected);
+				failures += 1;
+			}
+		}
+		reaped += (uint32_t)rc;
+	}
+	return failures;
+}
+
+/**
+ * @internal
+ * Write a file as a batch of two-element vectored writes and read it back with
+ * vectored reads whose split differs from the writes.
+ */
+static void
+asyncVectoredRoundTrip(struct OMRPortLibrary *portLibrary, const char *testName, const char *fileName, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRFileAsyncQueue *queue = NULL;
+	OMRFileAsyncRequest requests[ASYNC_TEST_BLOCK_COUNT];
+	OMRFileIOVec iov[ASYNC_TEST_BLOCK_COUNT][2];
+	uint8_t *source = NULL;
+	uint8_t *sink = NULL;
+	uintptr_t fileSize = ASYNC_TEST_BLOCK_SIZE * ASYNC_TEST_BLOCK_COUNT;
+	intptr_t fd = -1;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (!asyncQueueCreate(OMRPORTLIB, testName, ASYNC_TEST_QUEUE_DEPTH, flags, &queue)) {
+		goto exit;
+	}
+	source = (uint8_t *)omrmem_allocate_memory(fileSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	sink = (uint8_t *)omrmem_allocate_memory(fileSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == source) || (NULL == sink)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to allocate test buffers\n");
+		goto exit;
+	}
+	for (i = 0; i < fileSize; i++) {
+		source[i] = (uint8_t)((i * 7) + (i >> 12));
+	}
+	memset(sink, 0, fileSize);
+
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed to create %s\n", fileName);
+		goto exit;
+	}
+
+	/* submit the blocks in reverse order, each as a 1/4 + 3/4 split */
+	for (i = 0; i < ASYNC_TEST_BLOCK_COUNT; i++) {
+		uint32_t block = ASYNC_TEST_BLOCK_COUNT - 1 - i;
+		uint8_t *base = source + (block * ASYNC_TEST_BLOCK_SIZE);
+		iov[i][0].buffer = base;
+		iov[i][0].length = ASYNC_TEST_BLOCK_SIZE / 4;
+		iov[i][1].buffer = base + (ASYNC_TEST_BLOCK_SIZE / 4);
+		iov[i][1].length = ASYNC_TEST_BLOCK_SIZE - (ASYNC_TEST_BLOCK_SIZE / 4);
+		requests[i].fd = fd;
+		requests[i].opcode = OMRPORT_FILE_ASYNC_OP_WRITE;
+		requests[i].bufferIndex = OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX;
+		requests[i].offset = (int64_t)block * ASYNC_TEST_BLOCK_SIZE;
+		requests[i].iov = iov[i];
+		requests[i].iovCount = 2;
+		requests[i].userData = block;
+	}
+	if (0 != asyncDrive(OMRPORTLIB, testName, queue, requests, ASYNC_TEST_BLOCK_COUNT, ASYNC_TEST_BLOCK_SIZE)) {
+		goto exit;
+	}
+	if ((int64_t)fileSize != omrfile_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "file length is %lld after asynchronous writes, expected %zu\n", omrfile_flength(fd), fileSize);
+	}
+
+	/* read back as 3/4 + 1/4 splits */
+	for (i = 0; i < ASYNC_TEST_BLOCK_COUNT; i++) {
+		uint8_t *base = sink + (i * ASYNC_TEST_BLOCK_SIZE);
+		iov[i][0].buffer = base;
+		iov[i][0].length = ASYNC_TEST_BLOCK_SIZE - (ASYNC_TEST_BLOCK_SIZE / 4);
+		iov[i][1].buffer = base + iov[i][0].length;
+		iov[i][1].length = ASYNC_TEST_BLOCK_SIZE / 4;
+		requests[i].opcode = OMRPORT_FILE_ASYNC_OP_READ;
+		requests[i].offset = (int64_t)i * ASYNC_TEST_BLOCK_SIZE;
+		requests[i].userData = i;
+	}
+	if (0 != asyncDrive(OMRPORTLIB, testName, queue, requests, ASYNC_TEST_BLOCK_COUNT, ASYNC_TEST_BLOCK_SIZE)) {
+		goto exit;
+	}
+	if (0 != memcmp(source, sink, fileSize)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "data read asynchronously does not match data written\n");
+	}
+
+exit:
+	omrfile_async_queue_destroy(queue);
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	omrmem_free_memory(source);
+	omrmem_free_memory(sink);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * @internal
+ * Write and read a file through registered buffers.
+ */
+static void
+asyncRegisteredBuffers(struct OMRPortLibrary *portLibrary, const char *testName, const char *fileName, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRFileAsyncQueue *queue = NULL;
+	OMRFileAsyncRequest requests[ASYNC_TEST_BLOCK_COUNT];
+	OMRFileIOVec iov[ASYNC_TEST_BLOCK_COUNT];
+	OMRFileIOVec registered[2];
+	uint8_t *buffer = NULL;
+	uintptr_t fileSize = ASYNC_TEST_BLOCK_SIZE * ASYNC_TEST_BLOCK_COUNT;
+	intptr_t fd = -1;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (!asyncQueueCreate(OMRPORTLIB, testName, ASYNC_TEST_QUEUE_DEPTH, flags, &queue)) {
+		goto exit;
+	}
+	/* registered[0] holds the data to write, registered[1] receives it back */
+	buffer = (uint8_t *)omrmem_allocate_memory(2 * fileSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == buffer) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to allocate test buffers\n");
+		goto exit;
+	}
+	for (i = 0; i < fileSize; i++) {
+		buffer[i] = (uint8_t)(i ^ (i >> 8));
+	}
+	memset(buffer + fileSize, 0, fileSize);
+	registered[0].buffer = buffer;
+	registered[0].length = fileSize;
+	registered[1].buffer = buffer + fileSize;
+	registered[1].length = fileSize;
+	if (0 != omrfile_async_register_buffers(queue, registered, 2)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_register_buffers() failed\n");
+		goto exit;
+	}
+	if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrfile_async_register_buffers(queue, registered, 2)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_register_buffers() accepted a second registration\n");
+	}
+
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed to create %s\n", fileName);
+		goto exit;
+	}
+
+	for (i = 0; i < ASYNC_TEST_BLOCK_COUNT; i++) {
+		iov[i].buffer = buffer + (i * ASYNC_TEST_BLOCK_SIZE);
+		iov[i].length = ASYNC_TEST_BLOCK_SIZE;
+		requests[i].fd = fd;
+		requests[i].opcode = OMRPORT_FILE_ASYNC_OP_WRITE;
+		requests[i].bufferIndex = 0;
+		requests[i].offset = (int64_t)i * ASYNC_TEST_BLOCK_SIZE;
+		requests[i].iov = &iov[i];
+		requests[i].iovCount = 1;
+		requests[i].userData = i;
+	}
+	if (0 != asyncDrive(OMRPORTLIB, testName, queue, requests, ASYNC_TEST_BLOCK_COUNT, ASYNC_TEST_BLOCK_SIZE)) {
+		goto exit;
+	}
+
+	for (i = 0; i < ASYNC_TEST_BLOCK_COUNT; i++) {
+		iov[i].buffer = buffer + fileSize + (i * ASYNC_TEST_BLOCK_SIZE);
+		requests[i].opcode = OMRPORT_FILE_ASYNC_OP_READ;
+		requests[i].bufferIndex = 1;
+	}
+	if (0 != asyncDrive(OMRPORTLIB, testName, queue, requests, ASYNC_TEST_BLOCK_COUNT, ASYNC_TEST_BLOCK_SIZE)) {
+		goto exit;
+	}
+	if (0 != memcmp(buffer, buffer + fileSize, fileSize)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "data read through registered buffers does not match data written\n");
+	}
+
+	/* an iov outside the named registered buffer must be rejected */
+	iov[0].buffer = buffer + fileSize - 1;
+	requests[0].bufferIndex = 0;
+	if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrfile_async_submit(queue, requests, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() accepted an iov outside its registered buffer\n");
+	}
+
+exit:
+	omrfile_async_queue_destroy(queue);
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	omrmem_free_memory(buffer);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify batched vectored asynchronous writes and reads using the default backend
+ * (io_uring where available).
+ * @ref omrfileasync.c::omrfile_async_submit "omrfile_async_submit()"
+ */
+TEST_F(PortFileTest2, file_async_test2)
+{
+	asyncVectoredRoundTrip(portTestEnv->getPortLibrary(), "omrfile_async_test2", "tfileAsyncTest2.tst", 0);
+}
+
+/**
+ * Verify batched vectored asynchronous writes and reads using the thread pool backend.
+ * @ref omrfileasync.c::omrfile_async_submit "omrfile_async_submit()"
+ */
+TEST_F(PortFileTest2, file_async_test3)
+{
+	asyncVectoredRoundTrip(portTestEnv->getPortLibrary(), "omrfile_async_test3", "tfileAsyncTest3.tst", OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL);
+}
+
+/**
+ * Verify asynchronous transfers through registered buffers using the default backend.
+ * @ref omrfileasync.c::omrfile_async_register_buffers "omrfile_async_register_buffers()"
+ */
+TEST_F(PortFileTest2, file_async_test4)
+{
+	asyncRegisteredBuffers(portTestEnv->getPortLibrary(), "omrfile_async_test4", "tfileAsyncTest4.tst", 0);
+}
+
+/**
+ * Verify asynchronous transfers through registered buffers using the thread pool backend.
+ * @ref omrfileasync.c::omrfile_async_register_buffers "omrfile_async_register_buffers()"
+ */
+TEST_F(PortFileTest2, file_async_test5)
+{
+	asyncRegisteredBuffers(portTestEnv->getPortLibrary(), "omrfile_async_test5", "tfileAsyncTest5.tst", OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL);
+}
+
+/**
+ * Verify queue depth limits, polling without outstanding requests, read past end of file
+ * and request validation, for both backends.
+ * @ref omrfileasync.c::omrfile_async_poll "omrfile_async_poll()"
+ */
+TEST_F(PortFileTest2, file_async_test6)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_async_test6";
+	const char *fileName = "tfileAsyncTest6.tst";
+	uint32_t flags[] = { 0, OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL };
+	OMRFileAsyncRequest requests[ASYNC_TEST_QUEUE_DEPTH + 2];
+	OMRFileAsyncCompletion completions[ASYNC_TEST_QUEUE_DEPTH + 2];
+	OMRFileIOVec iov;
+	char byte = 'x';
+	intptr_t fd = -1;
+	uint32_t f = 0;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrfile_async_queue_create(0, 0, NULL)) {
+		OMRFileAsyncQueue *queue = NULL;
+		if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == omrfile_async_queue_create(1, 0, &queue)) {
+			portTestEnv->log("%s: asynchronous file queues are not supported on this platform\n", testName);
+			goto exit;
+		}
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_queue_create() accepted a zero depth\n");
+		omrfile_async_queue_destroy(queue);
+	}
+
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if ((-1 == fd) || (1 != omrfile_write(fd, &byte, 1))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to create %s\n", fileName);
+		goto exit;
+	}
+	iov.buffer = &byte;
+	iov.length = 1;
+
+	for (f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+		OMRFileAsyncQueue *queue = NULL;
+		int32_t rc = 0;
+
+		if (!asyncQueueCreate(OMRPORTLIB, testName, ASYNC_TEST_QUEUE_DEPTH, flags[f], &queue)) {
+			continue;
+		}
+		if (0 != omrfile_async_poll(queue, completions, ASYNC_TEST_QUEUE_DEPTH, 1)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() on an idle queue did not return 0\n");
+		}
+
+		/* every request reads the single byte at offset 0, except the last which reads past the end */
+		for (i = 0; i < ASYNC_TEST_QUEUE_DEPTH + 2; i++) {
+			requests[i].fd = fd;
+			requests[i].opcode = OMRPORT_FILE_ASYNC_OP_READ;
+			requests[i].bufferIndex = OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX;
+			requests[i].offset = 0;
+			requests[i].iov = &iov;
+			requests[i].iovCount = 1;
+			requests[i].userData = i;
+		}
+		requests[ASYNC_TEST_QUEUE_DEPTH - 1].offset = 1;
+
+		rc = omrfile_async_submit(queue, requests, ASYNC_TEST_QUEUE_DEPTH + 2);
+		if (ASYNC_TEST_QUEUE_DEPTH != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() queued %d requests, expected the queue depth %d\n", rc, ASYNC_TEST_QUEUE_DEPTH);
+		}
+		rc = omrfile_async_submit(queue, requests, 1);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() on a full queue returned %d, expected 0\n", rc);
+		}
+
+		/* minCompletions larger than what is outstanding must not block */
+		for (i = 0; i < ASYNC_TEST_QUEUE_DEPTH;) {
+			rc = omrfile_async_poll(queue, completions, ASYNC_TEST_QUEUE_DEPTH + 2, ASYNC_TEST_QUEUE_DEPTH + 2);
+			if (rc <= 0) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() returned %d with requests outstanding\n", rc);
+				break;
+			}
+			for (int32_t c = 0; c < rc; c++) {
+				intptr_t expected = (ASYNC_TEST_QUEUE_DEPTH - 1 == completions[c].userData) ? 0 : 1;
+				if (expected != completions[c].result) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "request %d returned %d, expected %d\n",
+						(int)completions[c].userData, (int)completions[c].result, (int)expected);
+				}
+			}
+			i += (uint32_t)rc;
+		}
+
+		requests[0].opcode = 0;
+		if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrfile_async_submit(queue, requests, 1)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() accepted an invalid opcode\n");
+		}
+		requests[0].opcode = OMRPORT_FILE_ASYNC_OP_READ;
+		requests[0].bufferIndex = 0;
+		if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrfile_async_submit(queue, requests, 1)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() accepted an unregistered buffer index\n");
+		}
+
+		omrfile_async_queue_destroy(queue);
+	}
+
+exit:
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Compare the throughput of sequential omrfile_write() with asynchronous queues writing the
+ * same data. Throughput is logged at info level (-logLevel=info); only correctness is checked.
+ * @ref omrfileasync.c::omrfile_async_submit "omrfile_async_submit()"
+ */
+TEST_F(PortFileTest2, file_async_test7)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_async_test7";
+	const char *fileName = "tfileAsyncTest7.tst";
+	const uintptr_t blockSize = 64 * 1024;
+	const uint32_t blockCount = 256;
+	uint32_t flags[] = { 0, OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL };
+	OMRFileAsyncRequest *requests = NULL;
+	OMRFileIOVec *iov = NULL;
+	uint8_t *buffer = NULL;
+	intptr_t fd = -1;
+	uint64_t start = 0;
+	uint64_t elapsed = 0;
+	uint32_t f = 0;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	buffer = (uint8_t *)omrmem_allocate_memory(blockSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	requests = (OMRFileAsyncRequest *)omrmem_allocate_memory(blockCount * sizeof(OMRFileAsyncRequest), OMRMEM_CATEGORY_PORT_LIBRARY);
+	iov = (OMRFileIOVec *)omrmem_allocate_memory(sizeof(OMRFileIOVec), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == buffer) || (NULL == requests) || (NULL == iov)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to allocate test buffers\n");
+		goto exit;
+	}
+	memset(buffer, 0x5a, blockSize);
+	iov->buffer = buffer;
+	iov->length = blockSize;
+
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed to create %s\n", fileName);
+		goto exit;
+	}
+	start = omrtime_nano_time();
+	for (i = 0; i < blockCount; i++) {
+		if ((intptr_t)blockSize != omrfile_write(fd, buffer, blockSize)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_write() of block %u failed\n", i);
+			goto exit;
+		}
+	}
+	elapsed = OMR_MAX(omrtime_nano_time() - start, 1);
+	portTestEnv->log("%s: omrfile_write: %u x %zu bytes in %llu us (%llu MB/s)\n", testName, blockCount, blockSize,
+		elapsed / 1000, ((uint64_t)blockCount * blockSize * 1000) / elapsed);
+
+	for (f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+		OMRFileAsyncQueue *queue = NULL;
+
+		if (!asyncQueueCreate(OMRPORTLIB, testName, ASYNC_TEST_QUEUE_DEPTH, flags[f], &queue)) {
+			continue;
+		}
+		omrfile_set_length(fd, 0);
+		for (i = 0; i < blockCount; i++) {
+			requests[i].fd = fd;
+			requests[i].opcode = OMRPORT_FILE_ASYNC_OP_WRITE;
+			requests[i].bufferIndex = OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX;
+			requests[i].offset = (int64_t)i * blockSize;
+			requests[i].iov = iov;
+			requests[i].iovCount = 1;
+			requests[i].userData = i;
+		}
+		start = omrtime_nano_time();
+		if (0 == asyncDrive(OMRPORTLIB, testName, queue, requests, blockCount, (intptr_t)blockSize)) {
+			elapsed = OMR_MAX(omrtime_nano_time() - start, 1);
+			portTestEnv->log("%s: %s queue (depth %d): %u x %zu bytes in %llu us (%llu MB/s)\n", testName,
+				(OMRPORT_FILE_ASYNC_BACKEND_IO_URING == omrfile_async_queue_backend(queue)) ? "io_uring" : "thread pool",
+				ASYNC_TEST_QUEUE_DEPTH, blockCount, blockSize, elapsed / 1000, ((uint64_t)blockCount * blockSize * 1000) / elapsed);
+			if ((int64_t)(blockCount * blockSize) != omrfile_flength(fd)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "file length is %lld after asynchronous writes, expected %llu\n",
+					omrfile_flength(fd), (uint64_t)blockCount * blockSize);
+			}
+		}
+		omrfile_async_queue_destroy(queue);
+	}
+
+exit:
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrfile_unlink(fileName);
+	omrmem_free_memory(buffer);
+	omrmem_free_memory(requests);
+	omrmem_free_memory(iov);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Verify port file system.
  *
@@ -1464,6 +1464,256 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+#define MEM_CATEGORY_BENCHMARK_THREADS 4
+#define MEM_CATEGORY_BENCHMARK_ITERATIONS 200000
+#define MEM_CATEGORY_BENCHMARK_RETAINED 16
+#define MEM_CATEGORY_BENCHMARK_TIMEOUT_MILLIS 60000
+
+typedef struct MemCategoryBenchmarkStruct {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor;
+	BOOLEAN tagged;
+	uintptr_t finishedCount;
+	void *retained[MEM_CATEGORY_BENCHMARK_THREADS][MEM_CATEGORY_BENCHMARK_RETAINED];
+} MemCategoryBenchmarkStruct;
+
+static uintptr_t memCategoryBenchmarkThreadIndex = 0;
+
+/**
+ * Allocates and frees small blocks in a tight loop, either through the port library with
+ * a memory category (tagged) or directly through malloc (untagged). Tagged threads leave
+ * MEM_CATEGORY_BENCHMARK_RETAINED blocks allocated for the main thread to account and free.
+ */
+static int
+J9THREAD_PROC memCategoryBenchmarkThread(void *arg)
+{
+	MemCategoryBenchmarkStruct *mbs = (MemCategoryBenchmarkStruct *)arg;
+	uintptr_t threadIndex = 0;
+	uintptr_t i = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(mbs->portLibrary);
+
+	omrthread_monitor_enter(mbs->monitor);
+	threadIndex = memCategoryBenchmarkThreadIndex++;
+	omrthread_monitor_exit(mbs->monitor);
+
+	for (i = 0; i < MEM_CATEGORY_BENCHMARK_ITERATIONS; i++) {
+		uintptr_t byteAmount = 16 + (i & 0xFF);
+		if (mbs->tagged) {
+			omrmem_free_memory(omrmem_allocate_memory(byteAmount, DUMMY_CATEGORY_TWO));
+		} else {
+			free(malloc(byteAmount));
+		}
+	}
+
+	if (mbs->tagged) {
+		for (i = 0; i < MEM_CATEGORY_BENCHMARK_RETAINED; i++) {
+			mbs->retained[threadIndex][i] = omrmem_allocate_memory(16 + i, DUMMY_CATEGORY_TWO);
+		}
+	}
+
+	omrthread_monitor_enter(mbs->monitor);
+	mbs->finishedCount += 1;
+	if (MEM_CATEGORY_BENCHMARK_THREADS == mbs->finishedCount) {
+		omrthread_monitor_notify(mbs->monitor);
+	}
+	omrthread_monitor_exit(mbs->monitor);
+
+	return 0;
+}
+
+/**
+ * Runs MEM_CATEGORY_BENCHMARK_THREADS benchmark threads to completion.
+ *
+ * @return the elapsed time in microseconds, or 0 on failure
+ */
+static uint64_t
+runMemCategoryBenchmark(struct OMRPortLibrary *portLibrary, MemCategoryBenchmarkStruct *mbs, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrthread_t threads[MEM_CATEGORY_BENCHMARK_THREADS];
+	uint64_t elapsedMicros = 0;
+	intptr_t waitRetVal = 0;
+	uintptr_t i = 0;
+
+	mbs->finishedCount = 0;
+	memCategoryBenchmarkThreadIndex = 0;
+
+	omrthread_monitor_enter(mbs->monitor);
+	uint64_t startTime = omrtime_hires_clock();
+	for (i = 0; i < MEM_CATEGORY_BENCHMARK_THREADS; i++) {
+		intptr_t rc = omrthread_create(&threads[i], 128 * 1024, J9THREAD_PRIORITY_NORMAL, 0, &memCategoryBenchmarkThread, mbs);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to create thread, rc=%zd, i=%zu\n", rc, i);
+			mbs->finishedCount += 1;
+		}
+	}
+	while ((0 == waitRetVal) && (mbs->finishedCount < MEM_CATEGORY_BENCHMARK_THREADS)) {
+		waitRetVal = omrthread_monitor_wait_timed(mbs->monitor, MEM_CATEGORY_BENCHMARK_TIMEOUT_MILLIS, 0);
+	}
+	elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	omrthread_monitor_exit(mbs->monitor);
+
+	if (0 != waitRetVal) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_monitor_wait_timed() failed, waitRetVal=%zd\n", waitRetVal);
+		elapsedMicros = 0;
+	}
+
+	return elapsedMicros;
+}
+
+/*
+ * Microbenchmark of multithreaded allocate/free throughput with memory category tagging
+ * on (omrmem_allocate_memory) versus off (malloc). Also verifies that the category totals
+ * reported by omrmem_walk_categories stay exact when blocks are counted and freed on
+ * different threads.
+ */
+TEST(PortMemTest, mem_test10_category_throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_category_throughput";
+	struct CategoriesState baseline;
+	struct CategoriesState categoriesState;
+	MemCategoryBenchmarkStruct mbs;
+	uint64_t untaggedMicros = 0;
+	uint64_t taggedMicros = 0;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, (uintptr_t) &dummyCategorySet);
+	getCategoriesState(OMRPORTLIB, &baseline);
+
+	memset(&mbs, 0, sizeof(mbs));
+	mbs.portLibrary = OMRPORTLIB;
+	if (0 != omrthread_monitor_init(&mbs.monitor, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to initialize benchmark monitor\n");
+		goto exit;
+	}
+
+	mbs.tagged = FALSE;
+	untaggedMicros = runMemCategoryBenchmark(OMRPORTLIB, &mbs, testName);
+	mbs.tagged = TRUE;
+	taggedMicros = runMemCategoryBenchmark(OMRPORTLIB, &mbs, testName);
+
+	if ((0 != untaggedMicros) && (0 != taggedMicros)) {
+		uint64_t operations = (uint64_t)MEM_CATEGORY_BENCHMARK_THREADS * MEM_CATEGORY_BENCHMARK_ITERATIONS;
+		portTestEnv->log("%zu threads x %zu allocate/free pairs: untagged %llu us (%llu pairs/ms), tagged %llu us (%llu pairs/ms)\n",
+				(uintptr_t)MEM_CATEGORY_BENCHMARK_THREADS, (uintptr_t)MEM_CATEGORY_BENCHMARK_ITERATIONS,
+				untaggedMicros, (operations * 1000) / untaggedMicros,
+				taggedMicros, (operations * 1000) / taggedMicros);
+
+		getCategoriesState(OMRPORTLIB, &categoriesState);
+		if (categoriesState.dummyCategoryTwoBlocks != (baseline.dummyCategoryTwoBlocks + (MEM_CATEGORY_BENCHMARK_THREADS * MEM_CATEGORY_BENCHMARK_RETAINED))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Block count for DUMMY_CATEGORY_TWO wrong. Expected %zu, got %zu\n",
+					baseline.dummyCategoryTwoBlocks + (MEM_CATEGORY_BENCHMARK_THREADS * MEM_CATEGORY_BENCHMARK_RETAINED), categoriesState.dummyCategoryTwoBlocks);
+		}
+
+		/* Free the retained blocks from this thread so they are uncounted on a different shard than they were counted on */
+		for (i = 0; i < MEM_CATEGORY_BENCHMARK_THREADS; i++) {
+			for (j = 0; j < MEM_CATEGORY_BENCHMARK_RETAINED; j++) {
+				omrmem_free_memory(mbs.retained[i][j]);
+			}
+		}
+
+		getCategoriesState(OMRPORTLIB, &categoriesState);
+		if ((categoriesState.dummyCategoryTwoBlocks != baseline.dummyCategoryTwoBlocks)
+			|| (categoriesState.dummyCategoryTwoBytes != baseline.dummyCategoryTwoBytes)
+		) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Counters for DUMMY_CATEGORY_TWO not restored. Expected %zu bytes / %zu blocks, got %zu bytes / %zu blocks\n",
+					baseline.dummyCategoryTwoBytes, baseline.dummyCategoryTwoBlocks, categoriesState.dummyCategoryTwoBytes, categoriesState.dummyCategoryTwoBlocks);
+		}
+	}
+
+	omrthread_monitor_destroy(mbs.monitor);
+
+exit:
+	/* Reset categories to NULL */
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/*
+ * Verifies the counter shards given to registered memory categories: each category gets its
+ * own cache line aligned block of a power of 2 shards, omrmem_walk_categories reports the
+ * category's own counters plus every shard, and unregistering the categories folds the shards
+ * back into the category's own counters.
+ */
+TEST(PortMemTest, mem_test11_category_shards)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test11_category_shards";
+	struct CategoriesState baseline;
+	struct CategoriesState categoriesState;
+	uintptr_t expectedBytes = 0;
+	uintptr_t expectedBlocks = 0;
+	uint32_t shardCount = 0;
+	uint32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, (uintptr_t) &dummyCategorySet);
+
+	for (i = 0; i < dummyCategorySet.numberOfCategories; i++) {
+		OMRMemCategory *category = dummyCategorySet.categories[i];
+		if (NULL == category->shards) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Category %s has no counter shards\n", category->name);
+			goto exit;
+		}
+		if (0 != ((uintptr_t)category->shards % OMRMEM_CATEGORY_SHARD_SIZE)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Counter shards of category %s at %p are not aligned to %d bytes\n",
+					category->name, category->shards, OMRMEM_CATEGORY_SHARD_SIZE);
+		}
+		if ((0 != (category->shardMask & (category->shardMask + 1))) || (category->shardMask >= OMRMEM_CATEGORY_MAX_SHARDS)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Category %s has an invalid shard mask 0x%x\n", category->name, category->shardMask);
+		}
+	}
+	if ((dummyCategoryOne.shards + dummyCategoryOne.shardMask) >= dummyCategoryTwo.shards) {
+		if ((dummyCategoryTwo.shards + dummyCategoryTwo.shardMask) >= dummyCategoryOne.shards) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Categories %s and %s share counter shards\n", dummyCategoryOne.name, dummyCategoryTwo.name);
+		}
+	}
+
+	/* Spread known counts over the category's own counters and each of its shards. */
+	getCategoriesState(OMRPORTLIB, &baseline);
+	shardCount = dummyCategoryThree.shardMask + 1;
+	dummyCategoryThree.liveBytes += 1000;
+	dummyCategoryThree.liveAllocations += 1;
+	expectedBytes = baseline.dummyCategoryThreeBytes + 1000;
+	expectedBlocks = baseline.dummyCategoryThreeBlocks + 1;
+	for (i = 0; i < shardCount; i++) {
+		dummyCategoryThree.shards[i].liveBytes += 16 * (i + 1);
+		dummyCategoryThree.shards[i].liveAllocations += i + 1;
+		expectedBytes += 16 * (i + 1);
+		expectedBlocks += i + 1;
+	}
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if ((categoriesState.dummyCategoryThreeBytes != expectedBytes) || (categoriesState.dummyCategoryThreeBlocks != expectedBlocks)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Walked totals for DUMMY_CATEGORY_THREE wrong. Expected %zu bytes / %zu blocks, got %zu bytes / %zu blocks\n",
+				expectedBytes, expectedBlocks, categoriesState.dummyCategoryThreeBytes, categoriesState.dummyCategoryThreeBlocks);
+	}
+
+	/* Unregistering detaches the shards and keeps the totals. */
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+	if ((NULL != dummyCategoryThree.shards) || (0 != dummyCategoryThree.shardMask)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Counter shards of DUMMY_CATEGORY_THREE not detached\n");
+	}
+	if ((dummyCategoryThree.liveBytes != expectedBytes) || (dummyCategoryThree.liveAllocations != expectedBlocks)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Counters for DUMMY_CATEGORY_THREE not folded back. Expected %zu bytes / %zu blocks, got %zu bytes / %zu blocks\n",
+				expectedBytes, expectedBlocks, dummyCategoryThree.liveBytes, dummyCategoryThree.liveAllocations);
+	}
+	dummyCategoryThree.liveBytes -= expectedBytes - baseline.dummyCategoryThreeBytes;
+	dummyCategoryThree.liveAllocations -= expectedBlocks - baseline.dummyCategoryThreeBlocks;
+
+exit:
+	/* Reset categories to NULL */
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
 freeMemPointers(struct OMRPortLibrary *portLibrary, void **memPtrs, uintptr_t length)
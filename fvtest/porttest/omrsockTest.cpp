@@ -157,6 +157,16 @@ TEST(PortSockTest, library_function_pointers_not_null)
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_int, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_linger, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_timeval, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_create, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_close, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_add, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_modify, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_remove, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_wait, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendv, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_recvv, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendmmsg, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_recvmmsg, (void *)NULL);
 }
 
 /**
@@ -1324,3 +1334,413 @@ TEST(PortSockTest, poll_functionality_many_sockets)
 		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &sockets[i]), 0);
 	}
 }
+
+/**
+ * Create a connected pair of non-blocking IPv4 stream sockets on the loopback interface.
+ *
+ * @param[in] portLibrary
+ * @param[in] serverSocket The listening server socket.
+ * @param[in] serverSockAddr The socket address of the server.
+ * @param[out] clientSocket The client end of the connection.
+ * @param[out] connectedServerSocket The server end of the connection.
+ *
+ * @return on success, report an error otherwise.
+ */
+void
+connect_nonblocking_pair(struct OMRPortLibrary *portLibrary, omrsock_socket_t serverSocket, omrsock_sockaddr_t serverSockAddr, omrsock_socket_t *clientSocket, omrsock_socket_t *connectedServerSocket)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage clientSockAddr;
+	OMRSockAddrStorage connectedServerSockAddr;
+
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, clientSocket, &clientSockAddr, serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, connectedServerSocket), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, *clientSocket, OMRSOCK_O_NONBLOCK), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, *connectedServerSocket, OMRSOCK_O_NONBLOCK), 0);
+}
+
+/**
+ * Start an IPv4 stream server listening on the loopback interface.
+ */
+void
+start_loopback_server(struct OMRPortLibrary *portLibrary, omrsock_socket_t *serverSocket, omrsock_sockaddr_t serverSockAddr)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	uint16_t port = 4930;
+	uint8_t serverAddr[4];
+
+	EXPECT_EQ(OMRPORTLIB->sock_inet_pton(OMRPORTLIB, OMRSOCK_AF_INET, "127.0.0.1", serverAddr), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, serverSocket, serverSockAddr);
+}
+
+/**
+ * Send a whole buffer on a non-blocking socket, retrying while the socket would block.
+ */
+void
+send_all_nonblocking(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint8_t *buf, int32_t nbyte)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	while (0 != nbyte) {
+		int32_t bytesSent = OMRPORTLIB->sock_send(OMRPORTLIB, sock, buf, nbyte, 0);
+		if (0 > bytesSent) {
+			ASSERT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+			bytesSent = 0;
+		}
+		nbyte -= bytesSent;
+		buf += bytesSent;
+	}
+}
+
+/**
+ * Test the event loop functions @ref omrsock_eventloop_create, @ref omrsock_eventloop_add,
+ * @ref omrsock_eventloop_modify, @ref omrsock_eventloop_remove, @ref omrsock_eventloop_wait
+ * and @ref omrsock_eventloop_close.
+ *
+ * A connected pair of non-blocking sockets is set up and the server end is added to
+ * an event loop. The test checks that the server end is reported with its user data
+ * once data arrives, and is no longer reported once removed. On Linux, where the event
+ * loop is edge-triggered, it also checks that readiness is not reported again until
+ * more data arrives.
+ */
+TEST(PortSockTest, eventloop_functionality)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	OMRSockEvent events[4];
+	const char *msg = "This is an omrsock event loop test.";
+	int32_t msgLength = strlen(msg) + 1;
+	char buf[100] = {0};
+
+	start_loopback_server(OMRPORTLIB, &serverSocket, &serverSockAddr);
+	connect_nonblocking_pair(OMRPORTLIB, serverSocket, &serverSockAddr, &clientSocket, &connectedServerSocket);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop), 0);
+	ASSERT_NE(loop, (void *)NULL);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, 0, 1), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, 42), 0);
+
+	/* Nothing has been sent yet. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	send_all_nonblocking(OMRPORTLIB, clientSocket, (uint8_t *)msg, msgLength);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+	EXPECT_EQ(events[0].userData, uintptr_t(42));
+	EXPECT_NE(events[0].revents & OMRSOCK_POLLIN, 0);
+
+#if defined(LINUX)
+	/* Edge-triggered: no new data has arrived, so the socket is not reported again. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+#endif /* defined(LINUX) */
+
+	/* Drain the socket until it would block. */
+	int32_t bytesRecv = 0;
+	int32_t bytesTotal = 0;
+	while (0 < (bytesRecv = OMRPORTLIB->sock_recv(OMRPORTLIB, connectedServerSocket, (uint8_t *)buf + bytesTotal, sizeof(buf) - bytesTotal, 0))) {
+		bytesTotal += bytesRecv;
+	}
+	EXPECT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+	EXPECT_EQ(bytesTotal, msgLength);
+	EXPECT_STREQ(msg, buf);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	/* Observe writability instead, with new user data. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_modify(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLOUT, 7), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 5000), 1);
+	EXPECT_EQ(events[0].userData, uintptr_t(7));
+	EXPECT_NE(events[0].revents & OMRSOCK_POLLOUT, 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 0), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_close(OMRPORTLIB, &loop), 0);
+	EXPECT_EQ(loop, (void *)NULL);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Test scatter/gather stream communication using @ref omrsock_sendv and @ref omrsock_recvv.
+ *
+ * A message is gathered from three buffers on the client side and scattered into two
+ * buffers of different sizes on the server side.
+ */
+TEST(PortSockTest, two_socket_stream_scatter_gather)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedServerSocket = NULL;
+
+	start_loopback_server(OMRPORTLIB, &serverSocket, &serverSockAddr);
+	connect_nonblocking_pair(OMRPORTLIB, serverSocket, &serverSockAddr, &clientSocket, &connectedServerSocket);
+
+	char part1[] = "This is ";
+	char part2[] = "an omrsock test ";
+	char part3[] = "for scatter/gather.";
+	OMRSockIOVec sendIov[3] = {
+		{part1, strlen(part1)},
+		{part2, strlen(part2)},
+		{part3, strlen(part3) + 1}
+	};
+	int32_t msgLength = (int32_t)(sendIov[0].length + sendIov[1].length + sendIov[2].length);
+
+	EXPECT_EQ(OMRPORTLIB->sock_sendv(OMRPORTLIB, clientSocket, sendIov, 0, 0), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	ASSERT_EQ(OMRPORTLIB->sock_sendv(OMRPORTLIB, clientSocket, sendIov, 3, 0), msgLength);
+
+	char head[10] = {0};
+	char tail[100] = {0};
+	OMRSockIOVec recvIov[2] = {
+		{head, sizeof(head)},
+		{tail, sizeof(tail)}
+	};
+	int32_t bytesTotal = 0;
+
+	/* The message may arrive in pieces; advance the buffers past what has been received. */
+	for (int32_t i = 0; (i < 100) && (bytesTotal < msgLength); i++) {
+		int32_t index = (bytesTotal < (int32_t)sizeof(head)) ? 0 : 1;
+		OMRSockIOVec iov[2] = {recvIov[0], recvIov[1]};
+		if (0 == index) {
+			iov[0].buffer = head + bytesTotal;
+			iov[0].length = sizeof(head) - bytesTotal;
+		} else {
+			iov[1].buffer = tail + (bytesTotal - sizeof(head));
+			iov[1].length = sizeof(tail) - (bytesTotal - sizeof(head));
+		}
+		int32_t bytesRecv = OMRPORTLIB->sock_recvv(OMRPORTLIB, connectedServerSocket, &iov[index], 2 - index, 0);
+		if (0 > bytesRecv) {
+			ASSERT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+			OMRPollFd pollFd;
+			ASSERT_EQ(OMRPORTLIB->sock_pollfd_init(OMRPORTLIB, &pollFd, connectedServerSocket, OMRSOCK_POLLIN), 0);
+			OMRPORTLIB->sock_poll(OMRPORTLIB, &pollFd, 1, 1000);
+		} else {
+			bytesTotal += bytesRecv;
+		}
+	}
+	ASSERT_EQ(bytesTotal, msgLength);
+
+	char expected[100] = {0};
+	char received[110] = {0};
+	strcat(expected, part1);
+	strcat(expected, part2);
+	strcat(expected, part3);
+	memcpy(received, head, sizeof(head));
+	memcpy(received + sizeof(head), tail, msgLength - sizeof(head));
+	EXPECT_STREQ(expected, received);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Test batched datagram communication using @ref omrsock_sendmmsg and @ref omrsock_recvmmsg.
+ *
+ * The client sends a batch of datagrams addressed to the server in one call, and the
+ * server receives them in as few calls as possible. The contents, lengths and source
+ * addresses of the received datagrams are checked.
+ */
+TEST(PortSockTest, two_socket_datagram_batched_communication)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	uint16_t port = 4930;
+	uint8_t serverAddr[4];
+	const uint32_t numMsgs = 20;
+
+	EXPECT_EQ(OMRPORTLIB->sock_inet_pton(OMRPORTLIB, OMRSOCK_AF_INET, "127.0.0.1", serverAddr), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_DGRAM, &serverSocket, &serverSockAddr);
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_DGRAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+
+	OMRTimeval timeRecv;
+	EXPECT_EQ(OMRPORTLIB->sock_timeval_init(OMRPORTLIB, &timeRecv, 3, 0), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_setsockopt_timeval(OMRPORTLIB, serverSocket, OMRSOCK_SOL_SOCKET, OMRSOCK_SO_RCVTIMEO, &timeRecv), 0);
+
+	/* Each datagram is a fixed header followed by its index. */
+	char header[] = "omrsock batched datagram ";
+	uint32_t index[numMsgs];
+	OMRSockIOVec sendIov[numMsgs][2];
+	OMRSockMsg sendMsgs[numMsgs];
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		index[i] = i;
+		sendIov[i][0].buffer = header;
+		sendIov[i][0].length = sizeof(header);
+		sendIov[i][1].buffer = &index[i];
+		sendIov[i][1].length = sizeof(index[i]);
+		sendMsgs[i].iov = sendIov[i];
+		sendMsgs[i].iovCount = 2;
+		sendMsgs[i].addr = &serverSockAddr;
+		sendMsgs[i].bytes = 0;
+	}
+
+	uint32_t numSent = 0;
+	for (int32_t i = 0; (i < 100) && (numSent < numMsgs); i++) {
+		int32_t rc = OMRPORTLIB->sock_sendmmsg(OMRPORTLIB, clientSocket, &sendMsgs[numSent], numMsgs - numSent, 0);
+		ASSERT_GT(rc, 0);
+		numSent += rc;
+	}
+	ASSERT_EQ(numSent, numMsgs);
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		EXPECT_EQ(sendMsgs[i].bytes, sizeof(header) + sizeof(uint32_t));
+	}
+
+	char recvBuf[numMsgs][64];
+	OMRSockIOVec recvIov[numMsgs];
+	OMRSockAddrStorage recvAddr[numMsgs];
+	OMRSockMsg recvMsgs[numMsgs];
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		memset(recvBuf[i], 0, sizeof(recvBuf[i]));
+		recvIov[i].buffer = recvBuf[i];
+		recvIov[i].length = sizeof(recvBuf[i]);
+		recvMsgs[i].iov = &recvIov[i];
+		recvMsgs[i].iovCount = 1;
+		recvMsgs[i].addr = &recvAddr[i];
+		recvMsgs[i].bytes = 0;
+	}
+
+	uint32_t numRecv = 0;
+	for (int32_t i = 0; (i < 100) && (numRecv < numMsgs); i++) {
+		int32_t rc = OMRPORTLIB->sock_recvmmsg(OMRPORTLIB, serverSocket, &recvMsgs[numRecv], numMsgs - numRecv, 0);
+		ASSERT_GT(rc, 0);
+		numRecv += rc;
+	}
+	ASSERT_EQ(numRecv, numMsgs);
+
+	/* Loopback datagrams from one sender arrive in order. */
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		uint32_t receivedIndex = 0;
+		ASSERT_EQ(recvMsgs[i].bytes, sizeof(header) + sizeof(uint32_t));
+		EXPECT_STREQ(header, recvBuf[i]);
+		memcpy(&receivedIndex, recvBuf[i] + sizeof(header), sizeof(receivedIndex));
+		EXPECT_EQ(receivedIndex, i);
+		EXPECT_EQ(((struct sockaddr_in *)&recvAddr[i].data)->sin_family, AF_INET);
+	}
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Loopback echo throughput benchmark for the event loop.
+ *
+ * A number of connected pairs of non-blocking sockets are driven by one event loop.
+ * Each client sends a message, the server end echoes it back, and once the whole echo
+ * has been received the client sends the next message. Since the event loop is
+ * edge-triggered on Linux, every socket is drained until it would block on each
+ * notification. Round trips per second and throughput are logged at info level
+ * (-logLevel=info).
+ */
+TEST(PortSockTest, eventloop_loopback_echo_benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "eventloop_loopback_echo_benchmark";
+	const uint32_t numPairs = 16;
+	const uint32_t numRounds = 200;
+	const int32_t msgSize = 4096;
+
+	struct EchoConnection {
+		omrsock_socket_t sock;
+		bool isClient;
+		int32_t filled;
+		uint32_t rounds;
+		uint8_t buf[4096];
+	};
+
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	EchoConnection *conns = (EchoConnection *)omrmem_allocate_memory(2 * numPairs * sizeof(EchoConnection), OMRMEM_CATEGORY_PORT_LIBRARY);
+	ASSERT_NE(conns, (void *)NULL);
+	memset(conns, 0, 2 * numPairs * sizeof(EchoConnection));
+
+	start_loopback_server(OMRPORTLIB, &serverSocket, &serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop), 0);
+
+	for (uint32_t i = 0; i < numPairs; i++) {
+		EchoConnection *client = &conns[2 * i];
+		EchoConnection *server = &conns[2 * i + 1];
+		connect_nonblocking_pair(OMRPORTLIB, serverSocket, &serverSockAddr, &client->sock, &server->sock);
+		client->isClient = true;
+		for (int32_t j = 0; j < msgSize; j++) {
+			client->buf[j] = (uint8_t)(i + j);
+		}
+		ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, client->sock, OMRSOCK_POLLIN, 2 * i), 0);
+		ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, server->sock, OMRSOCK_POLLIN, 2 * i + 1), 0);
+	}
+
+	uint64_t start = omrtime_nano_time();
+	for (uint32_t i = 0; i < numPairs; i++) {
+		send_all_nonblocking(OMRPORTLIB, conns[2 * i].sock, conns[2 * i].buf, msgSize);
+	}
+
+	OMRSockEvent events[2 * numPairs];
+	uint32_t clientsDone = 0;
+	uint32_t timeouts = 0;
+	while ((clientsDone < numPairs) && (timeouts < 10)) {
+		int32_t numEvents = OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 2 * numPairs, 1000);
+		ASSERT_GE(numEvents, 0);
+		if (0 == numEvents) {
+			timeouts += 1;
+			continue;
+		}
+		for (int32_t e = 0; e < numEvents; e++) {
+			EchoConnection *conn = &conns[events[e].userData];
+			int32_t bytesRecv = 0;
+
+			/* Drain the socket until it would block. */
+			while (0 < (bytesRecv = OMRPORTLIB->sock_recv(OMRPORTLIB, conn->sock, conn->buf + conn->filled, msgSize - conn->filled, 0))) {
+				conn->filled += bytesRecv;
+				if (msgSize == conn->filled) {
+					conn->filled = 0;
+					conn->rounds += 1;
+					if (!conn->isClient) {
+						send_all_nonblocking(OMRPORTLIB, conn->sock, conn->buf, msgSize);
+					} else if (numRounds == conn->rounds) {
+						clientsDone += 1;
+					} else {
+						send_all_nonblocking(OMRPORTLIB, conn->sock, conn->buf, msgSize);
+					}
+				}
+			}
+			ASSERT_EQ(bytesRecv, -1);
+			ASSERT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+		}
+	}
+	uint64_t elapsed = OMR_MAX(omrtime_nano_time() - start, 1);
+	ASSERT_EQ(clientsDone, numPairs);
+
+	for (uint32_t i = 0; i < numPairs; i++) {
+		EchoConnection *client = &conns[2 * i];
+		EXPECT_EQ(client->rounds, numRounds);
+		EXPECT_EQ(conns[2 * i + 1].rounds, numRounds);
+		for (int32_t j = 0; j < msgSize; j++) {
+			ASSERT_EQ(client->buf[j], (uint8_t)(i + j));
+		}
+	}
+
+	uint64_t roundTrips = (uint64_t)numPairs * numRounds;
+	portTestEnv->log("%s: %u connections x %u round trips of %d bytes in %llu us (%llu round trips/s, %llu MB/s)\n",
+		testName, numPairs, numRounds, msgSize, (unsigned long long)(elapsed / 1000),
+		(unsigned long long)(roundTrips * 1000000000 / elapsed),
+		(unsigned long long)(roundTrips * 2 * msgSize * 1000 / elapsed));
+
+	for (uint32_t i = 0; i < 2 * numPairs; i++) {
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, conns[i].sock), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &conns[i].sock), 0);
+	}
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_close(OMRPORTLIB, &loop), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	omrmem_free_memory(conns);
+}
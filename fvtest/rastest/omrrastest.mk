@@ -32,6 +32,7 @@ OBJECTS := \
   memoryCategoriesTest \
   methodDictionaryTest \
   rasTestHelpers \
+  traceBenchmark \
   traceLifecycleTest \
   traceLogTest \
   traceRecordHelpers \
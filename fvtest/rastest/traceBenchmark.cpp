@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Measures the cost of an enabled maximal tracepoint written to in-core
+ * trace buffers. Each tracepoint shape is timed separately: one int32, one
+ * pointer, and a string followed by a pointer and an int32, since strings
+ * make traceV size the record as it copies rather than up front. Timings
+ * are logged in ns per tracepoint at LEVEL_INFO.
+ */
+
+#include "omrport.h"
+#include "omr.h"
+#include "omrrasinit.h"
+#include "omrTest.h"
+#include "omrTestHelpers.h"
+#include "omrtrace.h"
+#include "omrvm.h"
+#include "ut_omr_test.h"
+
+#include "rasTestHelpers.hpp"
+
+#define NUM_TRACEPOINTS 1000000
+
+enum TracepointShape {
+	INT_ARGUMENT = 0,
+	POINTER_ARGUMENT,
+	MIXED_ARGUMENTS,
+	NUM_SHAPES
+};
+
+static const char * const shapeNames[] = { "int32", "pointer", "string+ptr+int" };
+
+static uint64_t
+timeTracepoints(OMR_VMThread *vmthread, TracepointShape shape)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	uint64_t start = omrtime_hires_clock();
+
+	for (uintptr_t i = 0; i < NUM_TRACEPOINTS; i++) {
+		switch (shape) {
+		case INT_ARGUMENT:
+			Trc_OMR_Test_Int(vmthread, (int32_t)i);
+			break;
+		case POINTER_ARGUMENT:
+			Trc_OMR_Test_Ptr(vmthread, (void *)i);
+			break;
+		default:
+			Trc_OMR_Test_ManyParms(vmthread, "traceBenchmark", (void *)i, (uint32_t)i);
+			break;
+		}
+	}
+
+	return omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+}
+
+TEST(TraceBenchmark, maximalTracepointCost)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "traceBenchmark"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	/* Warm up the trace buffers before timing anything */
+	timeTracepoints(vmthread, INT_ARGUMENT);
+
+	rasTestEnv->log(LEVEL_INFO, "%16s %10s\n", "arguments", "ns/tp");
+	for (uint32_t shape = 0; shape < NUM_SHAPES; shape++) {
+		uint64_t elapsed = timeTracepoints(vmthread, (TracepointShape)shape);
+		rasTestEnv->log(LEVEL_INFO, "%16s %10.1f\n", shapeNames[shape], (double)elapsed / NUM_TRACEPOINTS);
+	}
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+}
@@ -40,6 +40,7 @@
  * - Filling trace buffers
  * - Wrapping tracepoints across multiple trace buffers
  * - Verifies the contents of trace records sent to subscribers
+ * - Publishing trace buffers from dispatcher threads (-Xtrace:asyncpublish)
  */
 
 #define TRACE_BUFFER_BYTES 1024
@@ -64,6 +65,16 @@ typedef struct FailingSubscriberData {
 	uint32_t alarmCount;
 } FailingSubscriberData;
 
+typedef struct SlowSubscriberData {
+	volatile uint32_t callCount;
+} SlowSubscriberData;
+
+typedef struct BlockingSubscriberData {
+	volatile uint32_t callCount;
+	volatile uint32_t blocked;
+} BlockingSubscriberData;
+
+static void initChildThreadData(OMRTestVM *testVM, TestChildThreadData *childData);
 static void startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData);
 static omr_error_t waitForChildThread(OMRTestVM *testVM, omrthread_t childThread, TestChildThreadData *childData);
 static int J9THREAD_PROC childThreadMain(void *entryArg);
@@ -74,6 +85,8 @@ static omr_error_t countTracepointsIter(void *userData, const char *tpMod, const
 										int32_t isBigEndian);
 static omr_error_t failOnSecondCall(UtSubscription *subscriptionID);
 static void failOnSecondCallAlarm(UtSubscription *subscriptionID);
+static omr_error_t slowSubscriber(UtSubscription *subscriptionID);
+static omr_error_t blockingSubscriber(UtSubscription *subscriptionID);
 
 static const char *lowercaseAlpha = "abcdefghijklmnopqrstuvwxyz";
 static const char *uppercaseAlpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
@@ -155,20 +168,7 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	TestChildThreadData childData[NUM_CHILD_THREADS];
 	UtSubscription *subscriptionID[NUM_CHILD_THREADS];
 
-	memset(childData, 0, sizeof(TestChildThreadData) * NUM_CHILD_THREADS);
-	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
-		childData[i].testVM = &testVM;
-		childData[i].childRc = OMR_ERROR_NONE;
-		initWrapBuffer(&childData[i].wrapBuffer);
-	}
-	childData[0].traceDataCount = 1;
-	childData[0].traceData = &lowercaseAlpha;
-	childData[1].traceDataCount = 1;
-	childData[1].traceData = &uppercaseAlpha;
-	childData[2].traceDataCount = sizeof(ibmText1) / sizeof(ibmText1[0]);
-	childData[2].traceData = ibmText1;
-	childData[3].traceDataCount = sizeof(ibmText2) / sizeof(ibmText2[0]);
-	childData[3].traceData = ibmText2;
+	initChildThreadData(&testVM, childData);
 
 	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
 
@@ -244,6 +244,191 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	omrfile_unlink("traceLogTest.trc");
 }
 
+TEST(TraceLogTest, asyncPublishDeliversEveryBuffer)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	const OMR_TI *ti = omr_agent_getTI();
+
+	omrthread_t childThread[NUM_CHILD_THREADS];
+	TestChildThreadData childData[NUM_CHILD_THREADS];
+	UtSubscription *subscriptionID[NUM_CHILD_THREADS];
+	OMR_TracePublishStatistics stats;
+
+	initChildThreadData(&testVM, childData);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* asyncpublish=2,4: two dispatcher threads, and hold tracing threads back once 4 buffers are waiting */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:asyncpublish=2,4:maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "asyncPublish"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_NO_FATAL_FAILURE(startChildThread(&testVM, &childThread[i], childThreadMain, &childData[i]));
+		OMRTEST_ASSERT_ERROR_NONE(
+			ti->RegisterRecordSubscriber(vmthread, "child", countTracepoints, NULL, (void *)&childData[i], &subscriptionID[i]));
+	}
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_EQ(1, omrthread_resume(childThread[i]));
+	}
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		OMRTEST_ASSERT_ERROR_NONE(waitForChildThread(&testVM, childThread[i], &childData[i]));
+	}
+
+	/* The child threads' buffers were queued when they terminated; flushing delivers them */
+	OMRTEST_ASSERT_ERROR_NONE(ti->FlushTraceData(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(testVM.omrVM._trcEngine->omrTraceIntfS.GetPublishStatistics(&stats));
+	ASSERT_LE((uint64_t)(5 * NUM_CHILD_THREADS), stats.buffersQueued);
+	ASSERT_EQ(stats.buffersQueued, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)0, stats.buffersDropped);
+	ASSERT_EQ((uint64_t)0, stats.queueDepth);
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		OMRTEST_ASSERT_ERROR_NONE(ti->DeregisterRecordSubscriber(vmthread, subscriptionID[i]));
+	}
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_EQ(childData[i].expectedLoggedCount, childData[i].loggedCount);
+		ASSERT_EQ(0, childData[i].unloggedCount);
+		freeWrapBuffer(&childData[i].wrapBuffer);
+	}
+}
+
+TEST(TraceLogTest, asyncPublishDropsWhenQueueIsFull)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	const OMR_TI *ti = omr_agent_getTI();
+
+	omrthread_t childThread = NULL;
+	TestChildThreadData childData[NUM_CHILD_THREADS];
+	UtSubscription *subscriptionID = NULL;
+	SlowSubscriberData slowData = { 0 };
+	OMR_TracePublishStatistics stats;
+
+	initChildThreadData(&testVM, childData);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* A single buffer may wait for the dispatcher; further full buffers are discarded */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:asyncpublish=1,1,drop:maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "asyncPublishDrop"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	OMRTEST_ASSERT_ERROR_NONE(
+		ti->RegisterRecordSubscriber(vmthread, "slow", slowSubscriber, NULL, (void *)&slowData, &subscriptionID));
+	ASSERT_NO_FATAL_FAILURE(startChildThread(&testVM, &childThread, childThreadMain, &childData[2]));
+	ASSERT_EQ(1, omrthread_resume(childThread));
+	OMRTEST_ASSERT_ERROR_NONE(waitForChildThread(&testVM, childThread, &childData[2]));
+
+	OMRTEST_ASSERT_ERROR_NONE(ti->FlushTraceData(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(testVM.omrVM._trcEngine->omrTraceIntfS.GetPublishStatistics(&stats));
+	ASSERT_LT((uint64_t)0, stats.buffersDropped);
+	ASSERT_EQ(stats.buffersQueued, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)slowData.callCount, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)0, stats.backpressureWaits);
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	OMRTEST_ASSERT_ERROR_NONE(ti->DeregisterRecordSubscriber(vmthread, subscriptionID));
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		freeWrapBuffer(&childData[i].wrapBuffer);
+	}
+}
+
+TEST(TraceLogTest, asyncPublishBlockedSubscriberDoesNotStallOthers)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	const OMR_TI *ti = omr_agent_getTI();
+
+	omrthread_t childThread = NULL;
+	TestChildThreadData childData[NUM_CHILD_THREADS];
+	UtSubscription *blockedID = NULL;
+	UtSubscription *runningID = NULL;
+	BlockingSubscriberData blockedData = { 0, TRUE };
+	BlockingSubscriberData runningData = { 0, FALSE };
+	OMR_TracePublishStatistics stats;
+
+	initChildThreadData(&testVM, childData);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* Two dispatcher threads, one for each subscriber */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:asyncpublish=2,64:maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "asyncPublishBlocked"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	OMRTEST_ASSERT_ERROR_NONE(
+		ti->RegisterRecordSubscriber(vmthread, "blocked", blockingSubscriber, NULL, (void *)&blockedData, &blockedID));
+	OMRTEST_ASSERT_ERROR_NONE(
+		ti->RegisterRecordSubscriber(vmthread, "running", blockingSubscriber, NULL, (void *)&runningData, &runningID));
+	ASSERT_NO_FATAL_FAILURE(startChildThread(&testVM, &childThread, childThreadMain, &childData[2]));
+	ASSERT_EQ(1, omrthread_resume(childThread));
+
+	/* The running subscriber keeps receiving buffers while the other is stuck in its first one */
+	for (int i = 0; (i < 10000) && (runningData.callCount < 2); i += 1) {
+		omrthread_sleep(1);
+	}
+	const uint32_t runningCount = runningData.callCount;
+	const uint32_t blockedCount = blockedData.callCount;
+	blockedData.blocked = FALSE;
+	ASSERT_LE((uint32_t)2, runningCount);
+	ASSERT_GE((uint32_t)1, blockedCount);
+
+	OMRTEST_ASSERT_ERROR_NONE(waitForChildThread(&testVM, childThread, &childData[2]));
+	OMRTEST_ASSERT_ERROR_NONE(ti->FlushTraceData(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(testVM.omrVM._trcEngine->omrTraceIntfS.GetPublishStatistics(&stats));
+	ASSERT_EQ(stats.buffersQueued, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)runningData.callCount, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)blockedData.callCount, stats.buffersPublished);
+	ASSERT_EQ((uint64_t)0, stats.queueDepth);
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	OMRTEST_ASSERT_ERROR_NONE(ti->DeregisterRecordSubscriber(vmthread, blockedID));
+	OMRTEST_ASSERT_ERROR_NONE(ti->DeregisterRecordSubscriber(vmthread, runningID));
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		freeWrapBuffer(&childData[i].wrapBuffer);
+	}
+}
+
+static void
+initChildThreadData(OMRTestVM *testVM, TestChildThreadData *childData)
+{
+	memset(childData, 0, sizeof(TestChildThreadData) * NUM_CHILD_THREADS);
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		childData[i].testVM = testVM;
+		childData[i].childRc = OMR_ERROR_NONE;
+		initWrapBuffer(&childData[i].wrapBuffer);
+	}
+	childData[0].traceDataCount = 1;
+	childData[0].traceData = &lowercaseAlpha;
+	childData[1].traceDataCount = 1;
+	childData[1].traceData = &uppercaseAlpha;
+	childData[2].traceDataCount = sizeof(ibmText1) / sizeof(ibmText1[0]);
+	childData[2].traceData = ibmText1;
+	childData[3].traceDataCount = sizeof(ibmText2) / sizeof(ibmText2[0]);
+	childData[3].traceData = ibmText2;
+}
+
 static void
 startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData)
 {
@@ -384,3 +569,31 @@ failOnSecondCallAlarm(UtSubscription *subscriptionID)
 
 	VM_AtomicSupport::addU32(&failData->alarmCount, 1);
 }
+
+/*
+ * Take long enough over each buffer that the tracing thread fills the publish queue.
+ */
+static omr_error_t
+slowSubscriber(UtSubscription *subscriptionID)
+{
+	SlowSubscriberData *slowData = (SlowSubscriberData *)subscriptionID->userData;
+
+	VM_AtomicSupport::addU32(&slowData->callCount, 1);
+	omrthread_sleep(20);
+	return OMR_ERROR_NONE;
+}
+
+/*
+ * Hold on to the first buffer until the test lets go.
+ */
+static omr_error_t
+blockingSubscriber(UtSubscription *subscriptionID)
+{
+	BlockingSubscriberData *blockingData = (BlockingSubscriberData *)subscriptionID->userData;
+
+	VM_AtomicSupport::addU32(&blockingData->callCount, 1);
+	while (blockingData->blocked) {
+		omrthread_sleep(1);
+	}
+	return OMR_ERROR_NONE;
+}
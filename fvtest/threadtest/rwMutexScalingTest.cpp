@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define SCALING_ITERATIONS 20000
+#define SCALING_WRITE_PERIOD 1000
+
+typedef struct ScalingTestData {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	uintptr_t iterations;
+	uintptr_t writePeriod;
+	volatile BOOLEAN go;
+	volatile uintptr_t finished;
+	volatile uintptr_t sharedA;
+	volatile uintptr_t sharedB;
+	volatile uintptr_t inconsistentReads;
+} ScalingTestData;
+
+static intptr_t J9THREAD_PROC
+scalingWorker(ScalingTestData *data)
+{
+	uintptr_t i = 0;
+	uintptr_t inconsistentReads = 0;
+
+	omrthread_monitor_enter(data->synchronization);
+	while (!data->go) {
+		omrthread_monitor_wait(data->synchronization);
+	}
+	omrthread_monitor_exit(data->synchronization);
+
+	for (i = 1; i <= data->iterations; i++) {
+		if ((0 != data->writePeriod) && (0 == (i % data->writePeriod))) {
+			omrthread_rwmutex_enter_write(data->handle);
+			data->sharedA += 1;
+			data->sharedB += 1;
+			omrthread_rwmutex_exit_write(data->handle);
+		} else {
+			omrthread_rwmutex_enter_read(data->handle);
+			if (data->sharedA != data->sharedB) {
+				inconsistentReads += 1;
+			}
+			omrthread_rwmutex_exit_read(data->handle);
+		}
+	}
+
+	omrthread_monitor_enter(data->synchronization);
+	data->inconsistentReads += inconsistentReads;
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	omrthread_monitor_exit(data->synchronization);
+
+	return 0;
+}
+
+/**
+ * Run threadCount threads through the given mix of reads and writes and
+ * return the elapsed time in microseconds.
+ */
+static uint64_t
+runScaling(uintptr_t flags, uintptr_t threadCount, uintptr_t writePeriod, uintptr_t *inconsistentReads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	ScalingTestData data;
+	uintptr_t i = 0;
+	uint64_t start = 0;
+	uint64_t end = 0;
+	uintptr_t expectedWrites = 0;
+
+	memset(&data, 0, sizeof(data));
+	data.iterations = SCALING_ITERATIONS;
+	data.writePeriod = writePeriod;
+	EXPECT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&data.handle, flags, "scaling rwmutex"));
+	omrthread_monitor_init_with_name(&data.synchronization, 0, "scaling monitor");
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, (omrthread_entrypoint_t)scalingWorker, &data));
+	}
+
+	omrthread_monitor_enter(data.synchronization);
+	start = omrtime_hires_clock();
+	data.go = TRUE;
+	omrthread_monitor_notify_all(data.synchronization);
+	while (data.finished < threadCount) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	end = omrtime_hires_clock();
+	omrthread_monitor_exit(data.synchronization);
+
+	*inconsistentReads = data.inconsistentReads;
+	expectedWrites = (0 == writePeriod) ? 0 : threadCount * (SCALING_ITERATIONS / writePeriod);
+	EXPECT_EQ(expectedWrites, data.sharedA);
+
+	omrthread_monitor_destroy(data.synchronization);
+	omrthread_rwmutex_destroy(data.handle);
+
+	return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+/**
+ * Compare the throughput of the monitor-based and reader-biased rwmutex for a
+ * read-only and a read-mostly workload as the number of threads grows. Results
+ * are logged at info level (-logLevel=info); the test itself only checks that
+ * readers never observe a partially applied write.
+ */
+TEST(RWMutex, ReaderScalingBenchmark)
+{
+	const uintptr_t threadCounts[] = { 1, 2, 4, 8 };
+	const uintptr_t writePeriods[] = { 0, SCALING_WRITE_PERIOD };
+	const uintptr_t modes[] = { 0, J9THREAD_RWMUTEX_READER_BIASED };
+	uintptr_t t = 0;
+	uintptr_t w = 0;
+	uintptr_t m = 0;
+
+	omrTestEnv->log(LEVEL_INFO, "%8s %10s %14s %14s\n", "threads", "writes", "monitor ops/ms", "biased ops/ms");
+	for (w = 0; w < sizeof(writePeriods) / sizeof(writePeriods[0]); w++) {
+		for (t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+			uint64_t opsPerMilli[2] = { 0, 0 };
+			for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+				uintptr_t inconsistentReads = 0;
+				uint64_t micros = runScaling(modes[m], threadCounts[t], writePeriods[w], &inconsistentReads);
+				ASSERT_EQ((uintptr_t)0, inconsistentReads);
+				if (0 == micros) {
+					micros = 1;
+				}
+				opsPerMilli[m] = ((uint64_t)threadCounts[t] * SCALING_ITERATIONS * 1000) / micros;
+			}
+			omrTestEnv->log(LEVEL_INFO, "%8zu %9s%% %14llu %14llu\n",
+				threadCounts[t],
+				(0 == writePeriods[w]) ? "0" : "0.1",
+				(unsigned long long)opsPerMilli[0],
+				(unsigned long long)opsPerMilli[1]);
+		}
+	}
+}
@@ -91,10 +91,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags flags passed to omrthread_rwmutex_init
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags = 0)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,7 +104,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -1136,3 +1137,168 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * Validate the single threaded behaviour of a reader-biased RWMutex, including
+ * nested reads and reads nested inside a write
+ */
+TEST(RWMutex, ReaderBiasedEnterExitTest)
+{
+	intptr_t result;
+	omrthread_rwmutex_t handle;
+	uintptr_t flags = J9THREAD_RWMUTEX_READER_BIASED;
+	const char *mutexName = "test_mutex";
+
+	result = omrthread_rwmutex_init(&handle, flags, mutexName);
+	ASSERT_TRUE(0 == result);
+
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	/* a reader cannot upgrade */
+	result = omrthread_rwmutex_try_enter_write(handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == result);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+
+	result = omrthread_rwmutex_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(TRUE == omrthread_rwmutex_is_writelocked(handle));
+	result = omrthread_rwmutex_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	result = omrthread_rwmutex_try_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+
+	/* clean up */
+	result = omrthread_rwmutex_destroy(handle);
+	ASSERT_TRUE(0 == result);
+}
+
+/**
+ * validates the following for a reader-biased RWMutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, ReaderBiasedReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for write */
+	ASSERT_TRUE(0 == info->readCounter);
+	omrthread_rwmutex_enter_write(info->handle);
+
+	/* start the concurrent thread that will try to enter for read and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased RWMutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read
+ * once reader exits writer can enter
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for read */
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+
+	/* start the concurrent thread that will try to enter for write and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* the writer is still draining, so a nested read must not block */
+	omrthread_rwmutex_enter_read(info->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_rwmutex_exit_read(info->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased RWMutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read but
+ * does not block if try_enter_write was used instead of enter_write
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedNonBlockTest)
+{
+	intptr_t result = 0;
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* start the concurrent thread that will try to enter for read */
+	startConcurrentThread(info);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* now try to enter for write making sure we don't block */
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(1 == info->readCounter);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == result);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	freeSupportThreadInfo(info);
+}
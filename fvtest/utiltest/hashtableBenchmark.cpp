@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Compares lookup throughput of the J9HashTable flavours:
+ *
+ *   chained   - list nodes allocated from a J9Pool (the default)
+ *   spaceOpt  - J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION, linear probing over the
+ *               bucket array; only used while the table has at most 149 buckets
+ *   openAddr  - J9HASH_TABLE_OPEN_ADDRESSING, group-probed control bytes
+ *
+ * The chained and space optimized tables are created with a fixed prime size
+ * and filled to a target load factor of it. The open addressing table rounds
+ * its capacity up to a power of two, so it is sized for the number of
+ * entries instead; the load actually reached is reported for every flavour.
+ * Each table is then probed with an equal number of hits and misses, and
+ * the mean ns per lookup is logged at LEVEL_INFO as one row per table size,
+ * load factor and flavour. Flavours that do not apply to a size, such as
+ * spaceOpt on the large table, are left out of the table.
+ */
+
+#include "omrTest.h"
+#include "testEnvironment.hpp"
+#include "hashtable_api.h"
+
+extern PortEnvironment *omrTestEnv;
+
+#define NUM_LOOKUPS 1000000
+#define SMALL_TABLE_SIZE 149
+#define LARGE_TABLE_SIZE 300007
+
+enum HashtableFlavour {
+	CHAINED = 0,
+	SPACE_OPTIMIZED,
+	OPEN_ADDRESSING,
+	NUM_FLAVOURS
+};
+
+static const char * const flavourNames[] = { "chained", "spaceOpt", "openAddr" };
+static const uint32_t flavourFlags[] = { 0, J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION, J9HASH_TABLE_OPEN_ADDRESSING };
+static const double loadFactors[] = { 0.25, 0.5, 0.75, 0.9 };
+
+static uintptr_t
+identityHashFn(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry;
+}
+
+static uintptr_t
+equalFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(uintptr_t *)leftEntry == *(uintptr_t *)rightEntry;
+}
+
+/**
+ * Pointer-like keys: 8-byte aligned, so the low bits carry no information.
+ * Keys with bit 3 clear are inserted, keys with bit 3 set are used for misses.
+ */
+static uintptr_t
+makeKey(uint64_t *state, bool hit)
+{
+	uint64_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+	return (((uintptr_t)x & ~(uintptr_t)0xF) | (hit ? 0 : 0x8));
+}
+
+class HashtableBenchmark : public ::testing::TestWithParam<uint32_t>
+{
+protected:
+	/**
+	 * @return the number of nanoseconds per lookup, or 0 if the flavour does not apply
+	 */
+	uint64_t
+	measure(HashtableFlavour flavour, uint32_t tableSize, uint32_t count, uint32_t *buckets)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+		uintptr_t *hits = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * count, OMRMEM_CATEGORY_VM);
+		uintptr_t misses[1024];
+		uint64_t state = 0x2545F4914F6CDD1DULL;
+		uint64_t elapsed = 0;
+		uintptr_t found = 0;
+
+		EXPECT_TRUE(NULL != hits);
+		if (NULL == hits) {
+			return 0;
+		}
+
+		J9HashTable *table = hashTableNew(OMRPORTLIB, OMR_GET_CALLSITE(), (OPEN_ADDRESSING == flavour) ? count : tableSize, sizeof(uintptr_t), sizeof(uintptr_t),
+			flavourFlags[flavour], OMRMEM_CATEGORY_VM, identityHashFn, equalFn, NULL, NULL);
+		EXPECT_TRUE(NULL != table);
+		if (NULL == table) {
+			omrmem_free_memory(hits);
+			return 0;
+		}
+
+		if ((SPACE_OPTIMIZED == flavour) && !hashTableIsSpaceOptimized(table)) {
+			/* the size optimization is only applied to small tables */
+			hashTableFree(table);
+			omrmem_free_memory(hits);
+			return 0;
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			hits[i] = makeKey(&state, true);
+			EXPECT_TRUE(NULL != hashTableAdd(table, &hits[i]));
+		}
+		for (uint32_t i = 0; i < 1024; i++) {
+			misses[i] = makeKey(&state, false);
+		}
+		EXPECT_EQ(count, hashTableGetCount(table));
+		*buckets = table->tableSize;
+
+		uint64_t start = omrtime_hires_clock();
+		for (uint32_t i = 0; i < NUM_LOOKUPS; i++) {
+			uintptr_t *result = (uintptr_t *)hashTableFind(table, &hits[i % count]);
+			found += (NULL != result) ? 1 : 0;
+			found += (NULL != hashTableFind(table, &misses[i & 1023])) ? 1 : 0;
+		}
+		elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+		EXPECT_EQ((uintptr_t)NUM_LOOKUPS, found) << flavourNames[flavour] << ": every hit and no miss should be found";
+
+		hashTableFree(table);
+		omrmem_free_memory(hits);
+		return elapsed / (2 * NUM_LOOKUPS);
+	}
+};
+
+TEST_P(HashtableBenchmark, LookupByLoadFactor)
+{
+	uint32_t tableSize = GetParam();
+
+	omrTestEnv->log(LEVEL_INFO, "%10s %8s %10s %10s %10s %8s %10s\n", "tableSize", "target", "entries", "flavour", "buckets", "load", "ns/lookup");
+	for (uint32_t l = 0; l < sizeof(loadFactors) / sizeof(loadFactors[0]); l++) {
+		uint32_t count = (uint32_t)(tableSize * loadFactors[l]);
+		for (uint32_t f = 0; f < NUM_FLAVOURS; f++) {
+			uint32_t buckets = 0;
+			uint64_t nanos = measure((HashtableFlavour)f, tableSize, count, &buckets);
+			if (0 != buckets) {
+				omrTestEnv->log(LEVEL_INFO, "%10u %8.2f %10u %10s %10u %8.2f %10llu\n",
+					tableSize, loadFactors[l], count, flavourNames[f], buckets, (double)count / buckets, (unsigned long long)nanos);
+			}
+		}
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(UtilTest, HashtableBenchmark, ::testing::Values((uint32_t)SMALL_TABLE_SIZE, (uint32_t)LARGE_TABLE_SIZE));
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Compares the cost of dispatching an untagged hook event from several threads
+ * at once under each statistics mode of J9HookConfigureStatistics():
+ *
+ *   shared      - every listener call is counted and timed in the event's
+ *                 OMREventInfo4Dump (the default)
+ *   sharded     - J9HOOK_STATISTICS_SHARDED, counted and timed in per-thread
+ *                 shards which are aggregated after the run
+ *   sampledOnly - J9HOOK_STATISTICS_SAMPLED_EVENTS_ONLY, untagged events are
+ *                 dispatched without any statistics
+ *
+ * Each mode is timed from resuming the dispatching threads until the last one
+ * is joined, and that wall time divided by the dispatches per thread is logged
+ * at LEVEL_INFO. The listener counts are checked against the event's
+ * OMREventInfo4Dump so a mode that drops statistics is caught, not just timed.
+ */
+
+#include "omrTest.h"
+#include "testEnvironment.hpp"
+#include "hookable_api.h"
+#include "omrhookable.h"
+#include "omrthread.h"
+
+extern PortEnvironment *omrTestEnv;
+
+#define NUM_DISPATCHES 1000000
+#define NUM_THREADS 4
+#define BENCHMARK_EVENT 1
+
+/* laid out the way hookgen lays out a hook interface */
+typedef struct BenchmarkHookInterface {
+	struct J9CommonHookInterface common;
+	uint8_t flags[2];
+	struct OMREventInfo4Dump infos4Dump[2];
+	J9HookRecord *hooks[2];
+} BenchmarkHookInterface;
+
+typedef struct DispatchThreadData {
+	J9HookInterface **hookInterface;
+	uintptr_t calls;
+	uint8_t padding[64];
+} DispatchThreadData;
+
+enum StatisticsMode {
+	SHARED = 0,
+	SHARDED,
+	SAMPLED_ONLY,
+	NUM_MODES
+};
+
+static const char * const modeNames[] = { "shared", "sharded", "sampledOnly" };
+static const uintptr_t modeFlags[] = { 0, J9HOOK_STATISTICS_SHARDED, J9HOOK_STATISTICS_SAMPLED_EVENTS_ONLY };
+
+static BenchmarkHookInterface benchmarkHookInterface;
+
+static void
+countCall(J9HookInterface **hookInterface, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((DispatchThreadData *)eventData)->calls += 1;
+}
+
+static int J9THREAD_PROC
+dispatchThreadMain(void *entryArg)
+{
+	DispatchThreadData *data = (DispatchThreadData *)entryArg;
+	J9HookInterface **hookInterface = data->hookInterface;
+
+	for (uintptr_t i = 0; i < NUM_DISPATCHES; i++) {
+		(*hookInterface)->J9HookDispatch(hookInterface, BENCHMARK_EVENT, data);
+	}
+	return 0;
+}
+
+/**
+ * @return the number of nanoseconds each thread took per dispatch
+ */
+static uint64_t
+measure(StatisticsMode mode)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	J9HookInterface **hookInterface = J9_HOOK_INTERFACE(benchmarkHookInterface);
+	omrthread_t threads[NUM_THREADS];
+	DispatchThreadData data[NUM_THREADS];
+	uint64_t elapsed = 0;
+
+	EXPECT_EQ(0, J9HookInitializeInterface(hookInterface, OMRPORTLIB, sizeof(benchmarkHookInterface)));
+	EXPECT_EQ(0, J9HookConfigureStatistics(hookInterface, modeFlags[mode]));
+	EXPECT_EQ(0, (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, BENCHMARK_EVENT, countCall, OMR_GET_CALLSITE(), NULL));
+
+	for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i].hookInterface = hookInterface;
+		data[i].calls = 0;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, TRUE, dispatchThreadMain, &data[i]));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+		omrthread_resume(threads[i]);
+	}
+	for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+	elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	J9HookAggregateStatistics(hookInterface);
+	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(&benchmarkHookInterface.common, BENCHMARK_EVENT);
+	for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+		EXPECT_EQ((uintptr_t)NUM_DISPATCHES, data[i].calls);
+	}
+	if (SAMPLED_ONLY == mode) {
+		EXPECT_EQ((uintptr_t)0, eventDump->count) << modeNames[mode] << ": untagged events should not be counted";
+	} else {
+		EXPECT_EQ((uintptr_t)(NUM_THREADS * NUM_DISPATCHES), eventDump->count) << modeNames[mode] << ": every listener call should be counted";
+		EXPECT_TRUE(NULL != eventDump->longestHook.callsite);
+	}
+
+	(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	return elapsed / NUM_DISPATCHES;
+}
+
+TEST(UtilTest, HookDispatchBenchmark)
+{
+	omrTestEnv->log(LEVEL_INFO, "%8s %12s %12s\n", "threads", "statistics", "ns/dispatch");
+	for (uint32_t m = 0; m < NUM_MODES; m++) {
+		uint64_t nanos = measure((StatisticsMode)m);
+		omrTestEnv->log(LEVEL_INFO, "%8u %12s %12llu\n", NUM_THREADS, modeNames[m], (unsigned long long)nanos);
+	}
+}
@@ -165,6 +165,37 @@ public:
 		return result;
 	}
 
+#elif (defined(LINUX) || defined(OSX)) && defined(__GNUC__)
+	/**
+	 * Return the number of bits set to 0 before the first bit set to one starting at the lowest
+	 * significant bit.
+	 * @note If the input is 0, the result is undefined.
+	 * @return Number of non-zero bits starting at the lowest significant bit.
+	 */
+	MMINLINE static uintptr_t leadingZeroes(uintptr_t input)
+	{
+#if defined(OMR_ENV_DATA64)
+		return (uintptr_t)__builtin_ctzll((unsigned long long)input);
+#else /* defined(OMR_ENV_DATA64) */
+		return (uintptr_t)__builtin_ctzl((unsigned long)input);
+#endif /* defined(OMR_ENV_DATA64) */
+	}
+
+	/**
+	 * Return the number of bits set to 0 before the first bit set to one starting at the highest
+	 * significant bit.
+	 * @note If the input is 0, the result is undefined.
+	 * @return Number of non-zero bits starting at the highest significant bit.
+	 */
+	MMINLINE static uintptr_t trailingZeroes(uintptr_t input)
+	{
+#if defined(OMR_ENV_DATA64)
+		return (uintptr_t)__builtin_clzll((unsigned long long)input);
+#else /* defined(OMR_ENV_DATA64) */
+		return (uintptr_t)__builtin_clzl((unsigned long)input);
+#endif /* defined(OMR_ENV_DATA64) */
+	}
+
 #else /* defined(LINUX) && defined(J9HAMMER) */
 
 
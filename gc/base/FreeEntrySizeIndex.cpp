@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "FreeEntrySizeIndex.hpp"
+
+/**
+ * The smallest node table allocated, so that small lists do not reallocate as they grow
+ */
+#define FREE_ENTRY_SIZE_INDEX_MINIMUM_CAPACITY 256
+
+void
+MM_FreeEntrySizeIndex::initialize(OMR::GC::Forge *forge)
+{
+	_forge = forge;
+}
+
+void
+MM_FreeEntrySizeIndex::tearDown()
+{
+	if (NULL != _nodes) {
+		_forge->free(_nodes);
+		_nodes = NULL;
+	}
+	_capacity = 0;
+	_freeNodes = NULL;
+	_root = NULL;
+	_count = 0;
+	_valid = false;
+}
+
+MM_FreeEntrySizeIndex::Node *
+MM_FreeEntrySizeIndex::merge(Node *low, Node *high)
+{
+	if (NULL == low) {
+		return high;
+	}
+	if (NULL == high) {
+		return low;
+	}
+	if (low->priority >= high->priority) {
+		low->right = merge(low->right, high);
+		updateLargestSize(low);
+		return low;
+	}
+	high->left = merge(low, high->left);
+	updateLargestSize(high);
+	return high;
+}
+
+void
+MM_FreeEntrySizeIndex::split(Node *node, uintptr_t key, Node **low, Node **high)
+{
+	if (NULL == node) {
+		*low = NULL;
+		*high = NULL;
+	} else if (node->entry < key) {
+		split(node->right, key, &node->right, high);
+		updateLargestSize(node);
+		*low = node;
+	} else {
+		split(node->left, key, low, &node->left);
+		updateLargestSize(node);
+		*high = node;
+	}
+}
+
+bool
+MM_FreeEntrySizeIndex::update(Node *node, uintptr_t key, uintptr_t newKey, uintptr_t newSize)
+{
+	bool found = false;
+	if (NULL != node) {
+		if (key < node->entry) {
+			found = update(node->left, key, newKey, newSize);
+		} else if (key > node->entry) {
+			found = update(node->right, key, newKey, newSize);
+		} else {
+			node->entry = newKey;
+			node->size = newSize;
+			found = true;
+		}
+		if (found) {
+			updateLargestSize(node);
+		}
+	}
+	return found;
+}
+
+void
+MM_FreeEntrySizeIndex::release(Node *node)
+{
+	while (NULL != node) {
+		release(node->right);
+		Node *left = node->left;
+		node->left = _freeNodes;
+		_freeNodes = node;
+		_count -= 1;
+		node = left;
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::removeKeys(uintptr_t lowKey, uintptr_t highKey)
+{
+	Node *low = NULL;
+	Node *middle = NULL;
+	Node *high = NULL;
+	split(_root, lowKey, &low, &middle);
+	split(middle, highKey, &middle, &high);
+	release(middle);
+	_root = merge(low, high);
+}
+
+void
+MM_FreeEntrySizeIndex::clear()
+{
+	_root = NULL;
+	_count = 0;
+	_freeNodes = NULL;
+	for (uintptr_t i = _capacity; i > 0; i--) {
+		_nodes[i - 1].left = _freeNodes;
+		_freeNodes = &_nodes[i - 1];
+	}
+}
+
+bool
+MM_FreeEntrySizeIndex::rebuild(MM_HeapLinkedFreeHeader *freeListHead, bool compressed)
+{
+	uintptr_t entryCount = 0;
+	for (MM_HeapLinkedFreeHeader *freeEntry = freeListHead; NULL != freeEntry; freeEntry = freeEntry->getNext(compressed)) {
+		entryCount += 1;
+	}
+
+	if (entryCount > _capacity) {
+		/* leave room for the list to grow as entries are split and recycled */
+		uintptr_t capacity = OMR_MAX(entryCount * 2, FREE_ENTRY_SIZE_INDEX_MINIMUM_CAPACITY);
+		Node *nodes = (Node *)_forge->allocate(capacity * sizeof(Node), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == nodes) {
+			_valid = false;
+			return false;
+		}
+		if (NULL != _nodes) {
+			_forge->free(_nodes);
+		}
+		_nodes = nodes;
+		_capacity = capacity;
+	}
+
+	clear();
+	/* entries arrive in key order, so each is merged onto the right spine of the tree */
+	for (MM_HeapLinkedFreeHeader *freeEntry = freeListHead; NULL != freeEntry; freeEntry = freeEntry->getNext(compressed)) {
+		Node *node = _freeNodes;
+		_freeNodes = node->left;
+		node->entry = (uintptr_t)freeEntry;
+		node->size = freeEntry->getSize();
+		node->largestSize = node->size;
+		node->priority = nextPriority();
+		node->left = NULL;
+		node->right = NULL;
+		_root = merge(_root, node);
+		_count += 1;
+	}
+
+	_valid = true;
+	return true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::findFirstFit(uintptr_t size, MM_HeapLinkedFreeHeader **previousFreeEntry)
+{
+	*previousFreeEntry = NULL;
+	if ((NULL == _root) || (_root->largestSize < size)) {
+		return NULL;
+	}
+
+	Node *node = _root;
+	Node *previous = NULL;
+	for (;;) {
+		if ((NULL != node->left) && (node->left->largestSize >= size)) {
+			node = node->left;
+		} else if (node->size >= size) {
+			break;
+		} else {
+			/* the fit is to the right, so this node is the closest preceding entry seen so far */
+			previous = node;
+			node = node->right;
+		}
+	}
+
+	if (NULL != node->left) {
+		previous = node->left;
+		while (NULL != previous->right) {
+			previous = previous->right;
+		}
+	}
+	if (NULL != previous) {
+		*previousFreeEntry = (MM_HeapLinkedFreeHeader *)previous->entry;
+	}
+	return (MM_HeapLinkedFreeHeader *)node->entry;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::findPrevious(void *address)
+{
+	Node *node = _root;
+	Node *previous = NULL;
+	while (NULL != node) {
+		if (node->entry < (uintptr_t)address) {
+			previous = node;
+			node = node->right;
+		} else {
+			node = node->left;
+		}
+	}
+	return (NULL == previous) ? NULL : (MM_HeapLinkedFreeHeader *)previous->entry;
+}
+
+bool
+MM_FreeEntrySizeIndex::add(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t size)
+{
+	if (_valid) {
+		Node *node = _freeNodes;
+		if (NULL == node) {
+			_valid = false;
+			return false;
+		}
+		_freeNodes = node->left;
+		node->entry = (uintptr_t)freeEntry;
+		node->size = size;
+		node->largestSize = size;
+		node->priority = nextPriority();
+		node->left = NULL;
+		node->right = NULL;
+
+		Node *low = NULL;
+		Node *high = NULL;
+		split(_root, (uintptr_t)freeEntry, &low, &high);
+		_root = merge(merge(low, node), high);
+		_count += 1;
+	}
+	return _valid;
+}
+
+void
+MM_FreeEntrySizeIndex::remove(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	if (_valid) {
+		removeKeys((uintptr_t)freeEntry, (uintptr_t)freeEntry + 1);
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::update(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *newFreeEntry, uintptr_t newSize)
+{
+	if (_valid) {
+		if (!update(_root, (uintptr_t)freeEntry, (uintptr_t)newFreeEntry, newSize)) {
+			/* the entry should have been indexed -- stop trusting the index rather than hand out a stale entry */
+			_valid = false;
+		}
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::resync(void *lowAddress, void *highAddress, MM_HeapLinkedFreeHeader *firstFreeEntry, bool compressed)
+{
+	if (_valid) {
+		removeKeys((uintptr_t)lowAddress, (uintptr_t)highAddress + 1);
+		MM_HeapLinkedFreeHeader *freeEntry = firstFreeEntry;
+		while ((NULL != freeEntry) && ((void *)freeEntry <= highAddress)) {
+			if (!add(freeEntry, freeEntry->getSize())) {
+				break;
+			}
+			freeEntry = freeEntry->getNext(compressed);
+		}
+	}
+}
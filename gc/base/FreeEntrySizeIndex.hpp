@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYSIZEINDEX_HPP_)
+#define FREEENTRYSIZEINDEX_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "Forge.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+/**
+ * Search index over the entries of an address ordered free list.
+ *
+ * The index is a Cartesian tree (treap) keyed by free entry address, in which every node also records the size
+ * of the largest entry in its subtree. That turns first fit -- the lowest addressed entry of at least a given size,
+ * which is what an address ordered pool hands out -- into a single root to leaf descent, and also finds the entry
+ * preceding any address so that entries can be unlinked without walking the list. All operations are expected
+ * O(log n) in the number of entries.
+ *
+ * The index lives beside the free list rather than in it: nodes come from a table allocated from the forge, and
+ * the owning pool keeps the index in step as it changes the list. Paths that change the list in ways the pool
+ * does not track (sweep, compact) invalidate the index, and it is rebuilt from the list on demand. Operations on
+ * an invalid index are ignored. An index that runs out of nodes invalidates itself; the next rebuild sizes the
+ * table for the list it is built from.
+ */
+class MM_FreeEntrySizeIndex
+{
+	/* Data Members */
+private:
+	struct Node {
+		uintptr_t entry; /**< address of the free entry (the key) */
+		uintptr_t size; /**< size of the free entry in bytes */
+		uintptr_t largestSize; /**< size of the largest entry in the subtree rooted here */
+		uint32_t priority; /**< heap order priority -- every node has a priority no greater than its parent's */
+		Node *left; /**< entries at lower addresses (or the next free node, for nodes not in the tree) */
+		Node *right; /**< entries at higher addresses */
+	};
+
+	OMR::GC::Forge *_forge; /**< source of the node table */
+	Node *_nodes; /**< node table */
+	uintptr_t _capacity; /**< number of nodes in the node table */
+	Node *_freeNodes; /**< nodes not in the tree, linked through left */
+	Node *_root;
+	uintptr_t _count; /**< number of entries in the tree */
+	uint32_t _seed; /**< state of the generator for node priorities */
+	bool _valid; /**< true if the tree matches the free list */
+
+	/* Member Functions */
+private:
+	MMINLINE uint32_t
+	nextPriority()
+	{
+		/* xorshift32 -- priorities only need to be uncorrelated with the order entries are added in */
+		_seed ^= _seed << 13;
+		_seed ^= _seed >> 17;
+		_seed ^= _seed << 5;
+		return _seed;
+	}
+
+	static MMINLINE void
+	updateLargestSize(Node *node)
+	{
+		uintptr_t largestSize = node->size;
+		if ((NULL != node->left) && (node->left->largestSize > largestSize)) {
+			largestSize = node->left->largestSize;
+		}
+		if ((NULL != node->right) && (node->right->largestSize > largestSize)) {
+			largestSize = node->right->largestSize;
+		}
+		node->largestSize = largestSize;
+	}
+
+	/**
+	 * Join two trees, where every key in low is less than every key in high.
+	 */
+	static Node *merge(Node *low, Node *high);
+
+	/**
+	 * Split a tree into the nodes with keys less than key and the nodes with keys greater than or equal to key.
+	 */
+	static void split(Node *node, uintptr_t key, Node **low, Node **high);
+
+	/**
+	 * Find the node with the given key and change its key and size, updating the largest sizes on the path to it.
+	 * @return true if the node was found
+	 */
+	static bool update(Node *node, uintptr_t key, uintptr_t newKey, uintptr_t newSize);
+
+	/**
+	 * Return every node in a tree to the free nodes.
+	 */
+	void release(Node *node);
+
+	/**
+	 * Remove the nodes with keys in [lowKey, highKey) from the tree.
+	 */
+	void removeKeys(uintptr_t lowKey, uintptr_t highKey);
+
+	void clear();
+
+public:
+	/**
+	 * @param forge the forge to allocate the node table from
+	 */
+	void initialize(OMR::GC::Forge *forge);
+	void tearDown();
+
+	/**
+	 * Rebuild the index from an address ordered free list, growing the node table if needed.
+	 * @param freeListHead the first entry of the free list
+	 * @param compressed true if the free list holds compressed references
+	 * @return true if the index is valid, false if the node table could not be allocated
+	 */
+	bool rebuild(MM_HeapLinkedFreeHeader *freeListHead, bool compressed);
+
+	/**
+	 * Mark the index as not matching the free list. It is ignored until it is rebuilt.
+	 */
+	MMINLINE void invalidate() { _valid = false; }
+
+	MMINLINE bool isValid() { return _valid; }
+
+	/**
+	 * @return the number of entries in the index
+	 */
+	MMINLINE uintptr_t getCount() { return _count; }
+
+	/**
+	 * @return the size of the largest entry in the index
+	 */
+	MMINLINE uintptr_t getLargestSize() { return (NULL == _root) ? 0 : _root->largestSize; }
+
+	/**
+	 * Find the lowest addressed entry of at least the given size.
+	 * @param size[in] the minimum size of the entry
+	 * @param previousFreeEntry[out] the entry preceding the one found, or NULL if it is the first entry
+	 * @return the entry, or NULL if there is none large enough
+	 */
+	MM_HeapLinkedFreeHeader *findFirstFit(uintptr_t size, MM_HeapLinkedFreeHeader **previousFreeEntry);
+
+	/**
+	 * Find the highest addressed entry below an address.
+	 * @return the entry, or NULL if there is none
+	 */
+	MM_HeapLinkedFreeHeader *findPrevious(void *address);
+
+	/**
+	 * Add an entry that has been linked into the free list.
+	 * @return false if there was no free node, in which case the index is invalidated
+	 */
+	bool add(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t size);
+
+	/**
+	 * Remove an entry that has been unlinked from the free list.
+	 */
+	void remove(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Record that an entry has changed size and possibly address, without moving past either of its neighbours.
+	 * @param freeEntry the old address of the entry
+	 * @param newFreeEntry the new address of the entry
+	 * @param newSize the new size of the entry
+	 */
+	void update(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *newFreeEntry, uintptr_t newSize);
+
+	/**
+	 * Replace the entries of the index from lowAddress up to and including highAddress with the entries of the
+	 * free list in that range, after the pool has reworked that part of the list.
+	 * @param firstFreeEntry the first entry of the free list at or above lowAddress, or NULL if there is none
+	 * @param compressed true if the free list holds compressed references
+	 */
+	void resync(void *lowAddress, void *highAddress, MM_HeapLinkedFreeHeader *firstFreeEntry, bool compressed);
+
+	MM_FreeEntrySizeIndex()
+		: _forge(NULL)
+		, _nodes(NULL)
+		, _capacity(0)
+		, _freeNodes(NULL)
+		, _root(NULL)
+		, _count(0)
+		, _seed(0x9E3779B9)
+		, _valid(false)
+	{}
+};
+
+#endif /* FREEENTRYSIZEINDEX_HPP_ */
@@ -328,6 +328,10 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< Enabled by -Xgc:tlhAdaptiveSizing.  Size each thread's TLH refreshes from its observed allocation rate instead of growing them by tlhIncrementSize */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< microseconds between refreshes of a thread's TLH that adaptive TLH sizing aims for, set by -Xgc:tlhAdaptiveRefreshInterval= */
+	uintptr_t tlhAdaptiveReservedLimit; /**< bound in bytes on tlhReservedBytes when adaptive TLH sizing is enabled, set by -Xgc:tlhAdaptiveReservedLimit= */
+	volatile uintptr_t tlhReservedBytes; /**< total size of the current TLHs of all threads and of their cached TLH remainders, maintained only when adaptive TLH sizing is enabled */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -336,7 +340,10 @@ public:
 	const char* gcModeString;
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
+	bool splitFreeListStealing; /**< if true, allocating threads skip a locked split free list rather than wait for it, and refill their home list from its neighbours (set by -Xgc:splitFreeListStealing) */
+	uintptr_t splitFreeListRebalanceRatio; /**< a neighbouring split free list must hold this many times the free bytes of a thread's home list before entries are moved over; 0 disables rebalancing */
 	bool enableHybridMemoryPool;
+	bool freeListSizeIndex; /**< if true, address ordered list pools search their free lists through a size index once allocation walks get long (set by -Xgc:freeListSizeIndex) */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -383,6 +390,8 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketStealing; /**< if true, hand full output packets to per-thread work-stealing deques rather than the shared packet lists and _inputListMonitor during stop-the-world marking (set by -Xgc:workPacketStealing) */
+	uintptr_t workPacketStealingDequeSize; /**< capacity (power of two) of each GC thread's packet deque; pushes beyond it overflow to the shared packet lists */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -477,6 +486,9 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerWorkStealing; /**< if true, distribute scan caches through per-thread work-stealing deques rather than the shared scan lists and _scanCacheMonitor (set by -Xgc:scavengerWorkStealing) */
+	uintptr_t scavengerWorkStealingDequeSize; /**< capacity (power of two) of each GC thread's scan cache deque; pushes beyond it overflow to the shared scan lists */
+	uintptr_t scavengerPrefetchDistance; /**< number of scanned slots queued ahead of copyAndForward() so that their targets' headers can be prefetched; 0 disables the pipeline (set by -Xgc:scavengerPrefetchDistance=) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -557,6 +569,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool regionParallelCompact; /**< if true, compute forwarding addresses per fixed-size region and slide all regions in parallel instead of evacuating sub areas (set by -Xgc:regionParallelCompact) */
+	uintptr_t regionParallelCompactRegionSize; /**< desired size of a region in region parallel compaction; grown if the compact table cannot describe the heap at this size */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -570,6 +584,8 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentPacing; /**< if true, background helpers pace concurrent mark against a completion deadline and mutators are taxed only when it is at risk */
+	uintptr_t concurrentPacingCPUBudget; /**< percentage of wall clock time each paced background helper may spend marking */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -686,6 +702,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Copy logs (e.g. verbose:gc) into a ring buffer which a background thread writes to file */
+	uintptr_t asyncLoggingBufferSize; /**< size in bytes of the asyncLogging ring buffer, set by -Xgc:asyncLoggingBufferSize= */
+	bool asyncLoggingBlockOnOverflow; /**< set by -Xgc:asyncLoggingOverflow=block to make writers wait for space instead of dropping output when the ring buffer is full */
+	bool asyncLoggingSync; /**< Enabled by -Xgc:asyncLoggingSync.  Flush the log file to disk after every batch the background thread writes */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1453,13 +1473,20 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
+		, tlhAdaptiveReservedLimit(32 * 1024 * 1024)
+		, tlhReservedBytes(0)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
+		, splitFreeListStealing(false)
+		, splitFreeListRebalanceRatio(4)
 		, enableHybridMemoryPool(false)
+		, freeListSizeIndex(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1494,6 +1521,8 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketStealing(false)
+		, workPacketStealingDequeSize(64)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1572,6 +1601,9 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerWorkStealing(false)
+		, scavengerWorkStealingDequeSize(1024)
+		, scavengerPrefetchDistance(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1637,6 +1669,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, regionParallelCompact(false)
+		, regionParallelCompactRegionSize(512 * 1024)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1648,6 +1682,8 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentPacing(false)
+		, concurrentPacingCPUBudget(50)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1734,6 +1770,10 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(4 * 1024 * 1024)
+		, asyncLoggingBlockOnOverflow(false)
+		, asyncLoggingSync(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
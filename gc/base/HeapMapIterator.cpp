@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapSpan.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -130,7 +131,14 @@ MM_HeapMapIterator::nextObject()
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			/* Skip any run of empty map slots in spans rather than one slot per pass of the loop */
+			uintptr_t remainingMapSlots = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNext = MM_HeapMapSpan::findNonEmptySlot(_heapMapSlotCurrent, _heapMapSlotCurrent + remainingMapSlots);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNext;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
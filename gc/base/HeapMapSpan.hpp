@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSPAN_HPP_)
+#define HEAPMAPSPAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "Bits.hpp"
+
+/**
+ * @name Heap map span kernel selection
+ * Spans are only scanned with vector instructions on 64 bit platforms, where a span is exactly four heap map slots.
+ * The AVX2 kernel is only used when the compiler targets AVX2; SSE2 is always available on x86-64.
+ * @{
+ */
+#if defined(OMR_ENV_DATA64)
+#if defined(__AVX2__)
+#define J9MODRON_HMS_USE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define J9MODRON_HMS_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define J9MODRON_HMS_USE_NEON
+#include <arm_neon.h>
+#endif /* defined(__AVX2__) */
+#endif /* defined(OMR_ENV_DATA64) */
+/** @} */
+
+/**
+ * Find the boundaries of runs of empty and non-empty heap map slots, examining 256 bits of the heap map at a time.
+ *
+ * Sweep and marked object iteration spend most of their time stepping over heap map slots which are all zero
+ * (dead space) or all non-zero (densely marked live space).  The routines here skip whole spans of such slots
+ * at once, and only fall back to examining individual slots once the span containing the boundary is found.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapSpan
+{
+	/* Data Members */
+public:
+	enum {
+		BITS_PER_SPAN = 256,
+		SLOTS_PER_SPAN = BITS_PER_SPAN / J9BITS_BITS_IN_SLOT,
+		SPAN_ALL_EMPTY = ((uintptr_t)1 << SLOTS_PER_SPAN) - 1
+	};
+
+	/* Member Functions */
+private:
+	/**
+	 * Determine which slots of a span are empty.
+	 * @param span[in] the first of SLOTS_PER_SPAN heap map slots
+	 * @return a mask with bit i set if and only if span[i] is zero
+	 */
+	MMINLINE static uintptr_t emptySlotMask(const uintptr_t *span)
+	{
+#if defined(J9MODRON_HMS_USE_AVX2)
+		__m256i slots = _mm256_loadu_si256((const __m256i *)span);
+		__m256i empty = _mm256_cmpeq_epi64(slots, _mm256_setzero_si256());
+		return (uintptr_t)_mm256_movemask_pd(_mm256_castsi256_pd(empty));
+#elif defined(J9MODRON_HMS_USE_SSE2)
+		/* SSE2 has no 64 bit compare: a slot is empty when both of its 32 bit halves are */
+		__m128i zero = _mm_setzero_si128();
+		uintptr_t low = (uintptr_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)span), zero)));
+		uintptr_t high = (uintptr_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(span + 2)), zero)));
+		uintptr_t halves = low | (high << 4);
+		halves &= (halves >> 1);
+		return (halves & 0x1) | ((halves >> 1) & 0x2) | ((halves >> 2) & 0x4) | ((halves >> 3) & 0x8);
+#elif defined(J9MODRON_HMS_USE_NEON)
+		static const uint32_t laneBits[4] = { 0x1, 0x2, 0x4, 0x8 };
+		uint64x2_t low = vceqzq_u64(vld1q_u64((const uint64_t *)span));
+		uint64x2_t high = vceqzq_u64(vld1q_u64((const uint64_t *)(span + 2)));
+		uint32x4_t empty = vcombine_u32(vmovn_u64(low), vmovn_u64(high));
+		return (uintptr_t)vaddvq_u32(vandq_u32(empty, vld1q_u32(laneBits)));
+#else /* defined(J9MODRON_HMS_USE_AVX2) */
+		uintptr_t mask = 0;
+		for (uintptr_t i = 0; i < SLOTS_PER_SPAN; i++) {
+			if (0 == span[i]) {
+				mask |= ((uintptr_t)1 << i);
+			}
+		}
+		return mask;
+#endif /* defined(J9MODRON_HMS_USE_AVX2) */
+	}
+
+protected:
+public:
+	/**
+	 * Find the first non-empty heap map slot in [slotCurrent, slotTop).
+	 * @param slotCurrent[in] the first heap map slot to examine
+	 * @param slotTop[in] the heap map slot past the last one to examine
+	 * @return the first slot with at least one bit set, or slotTop if all slots are empty
+	 */
+	MMINLINE static uintptr_t *findNonEmptySlot(uintptr_t *slotCurrent, uintptr_t *slotTop)
+	{
+		while ((slotCurrent + SLOTS_PER_SPAN) <= slotTop) {
+			uintptr_t emptyMask = emptySlotMask(slotCurrent);
+			if (SPAN_ALL_EMPTY != emptyMask) {
+				return slotCurrent + MM_Bits::leadingZeroes(~emptyMask);
+			}
+			slotCurrent += SLOTS_PER_SPAN;
+		}
+
+		while ((slotCurrent < slotTop) && (0 == *slotCurrent)) {
+			slotCurrent += 1;
+		}
+		return slotCurrent;
+	}
+
+	/**
+	 * Find the first empty heap map slot in [slotCurrent, slotTop).
+	 * @param slotCurrent[in] the first heap map slot to examine
+	 * @param slotTop[in] the heap map slot past the last one to examine
+	 * @return the first slot with no bits set, or slotTop if no slot is empty
+	 */
+	MMINLINE static uintptr_t *findEmptySlot(uintptr_t *slotCurrent, uintptr_t *slotTop)
+	{
+		while ((slotCurrent + SLOTS_PER_SPAN) <= slotTop) {
+			uintptr_t emptyMask = emptySlotMask(slotCurrent);
+			if (0 != emptyMask) {
+				return slotCurrent + MM_Bits::leadingZeroes(emptyMask);
+			}
+			slotCurrent += SLOTS_PER_SPAN;
+		}
+
+		while ((slotCurrent < slotTop) && (0 != *slotCurrent)) {
+			slotCurrent += 1;
+		}
+		return slotCurrent;
+	}
+};
+
+#endif /* HEAPMAPSPAN_HPP_ */
@@ -139,6 +139,10 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	/* concurrent sweep links entries into the list behind the pool's back, so the index could not be kept valid */
+	_sizeIndex.initialize(env->getForge());
+	_sizeIndexEnabled = ext->freeListSizeIndex && !ext->isConcurrentSweepEnabled();
+
 	return true;
 }
 
@@ -183,6 +187,8 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase *env)
 	
 	_largeObjectCollectorAllocateStats = NULL;
 
+	_sizeIndex.tearDown();
+
 	_heapLock.tearDown();
 	_resetLock.tearDown();
 }
@@ -410,6 +416,24 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+/****************************************
+ * Size Index Functionality
+ ****************************************
+ */
+
+/**
+ * Build the size index from the free list. The index replaces hints while it is valid, so the hints are dropped.
+ * If the index cannot be allocated the pool stops trying and keeps using hints.
+ */
+void
+MM_MemoryPoolAddressOrderedList::rebuildSizeIndex()
+{
+	clearHints();
+	if (!_sizeIndex.rebuild(_heapFreeList, compressObjectReferences())) {
+		_sizeIndexEnabled = false;
+	}
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -440,11 +464,22 @@ retry:
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
 
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
+	if (_sizeIndex.isValid()) {
+		/* The index finds the same entry the walk would, without the walk */
+		currentFreeEntry = _sizeIndex.findFirstFit(sizeInBytesRequired, &previousFreeEntry);
+		if (NULL == currentFreeEntry) {
+			largestFreeEntry = _sizeIndex.getLargestSize();
+		} else {
+			Assert_MM_true(sizeInBytesRequired <= currentFreeEntry->getSize());
+			Assert_MM_true(currentFreeEntry == ((NULL == previousFreeEntry) ? _heapFreeList : previousFreeEntry->getNext(compressed)));
+		}
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 	}
 
 	while(currentFreeEntry) {
@@ -480,7 +515,7 @@ retry:
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
-	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
+	if(!_sizeIndex.isValid() && ((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed))) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
@@ -500,6 +535,7 @@ retry:
 
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed))) {
 		updateHint(currentFreeEntry, recycleEntry);
+		_sizeIndex.update(currentFreeEntry, recycleEntry, recycleEntrySize);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		/* Adjust the free memory size and count */
@@ -511,6 +547,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		_sizeIndex.remove(currentFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -518,6 +555,11 @@ retry:
 		largeObjectAllocateStats->allocateObject(sizeInBytesRequired);
 	}
 
+	/* A long walk means the list has grown past what hints handle well */
+	if (_sizeIndexEnabled && (walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK)) {
+		rebuildSizeIndex();
+	}
+
 	if(lockingRequired) {
 			_heapLock.release();
 		}
@@ -529,6 +571,9 @@ retry:
 fail_allocate:
 	/* Since we failed to allocate, update the largest free entry so that outside callers will be able to skip this pool, next time, in Tarok configurations */
 	setLargestFreeEntry(largestFreeEntry);
+	if (_sizeIndexEnabled && (walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK)) {
+		rebuildSizeIndex();
+	}
 	if (lockingRequired) {
 		_heapLock.release();
 	}
@@ -634,6 +679,7 @@ retry:
 		topOfRecycledChunk = ((uint8_t *)addrTop) + recycleEntrySize;
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
+			_sizeIndex.update(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop, recycleEntrySize);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			/* Adjust the free memory size and count */
@@ -641,12 +687,14 @@ retry:
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			_sizeIndex.remove(freeEntry);
 		}
 	} else {
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		_sizeIndex.remove(freeEntry);
 	}
 
 	if (lockingRequired) {
@@ -716,6 +764,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	_sizeIndex.invalidate();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 
 	_lastFreeEntry = NULL;
@@ -811,14 +860,19 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 	}
 
 	/* Find the free entries in the list the appear before/after the range being added */
-	previousFreeEntry = NULL;
-	nextFreeEntry = _heapFreeList;
-	while(nextFreeEntry) {
-		if(lowAddress < nextFreeEntry)  {
-			break;
+	if (_sizeIndex.isValid()) {
+		previousFreeEntry = _sizeIndex.findPrevious(lowAddress);
+		nextFreeEntry = (NULL == previousFreeEntry) ? _heapFreeList : previousFreeEntry->getNext(compressed);
+	} else {
+		previousFreeEntry = NULL;
+		nextFreeEntry = _heapFreeList;
+		while(nextFreeEntry) {
+			if(lowAddress < nextFreeEntry)  {
+				break;
+			}
+			previousFreeEntry = nextFreeEntry;
+			nextFreeEntry = nextFreeEntry->getNext(compressed);
 		}
-		previousFreeEntry = nextFreeEntry;
-		nextFreeEntry = nextFreeEntry->getNext(compressed);
 	}
 
 	/* Check if the range can be coalesced with either the surrounding free entries */
@@ -827,6 +881,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		if(previousFreeEntry && (lowAddress == (void *) (((uintptr_t)previousFreeEntry) + previousFreeEntry->getSize()))) {
 			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(previousFreeEntry->getSize());
 			previousFreeEntry->expandSize(expandSize);
+			_sizeIndex.update(previousFreeEntry, previousFreeEntry, previousFreeEntry->getSize());
 
 			/* Update the free list information */
 			_freeMemorySize += expandSize;
@@ -852,6 +907,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 			} else {
 				_heapFreeList = newFreeEntry;
 			}
+			_sizeIndex.update(nextFreeEntry, newFreeEntry, newFreeEntry->getSize());
 
 			/* Update the free list information */
 			_freeMemorySize += expandSize;
@@ -880,6 +936,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 	} else {
 		_heapFreeList = freeEntry;
 	}
+	_sizeIndex.add(freeEntry, expandSize);
 
 	/* Update the free list information */
 	_freeMemorySize += expandSize;
@@ -919,6 +976,11 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
+	if (_sizeIndex.isValid()) {
+		/* the encompassing entry is the last one at or below lowAddress */
+		currentFreeEntry = _sizeIndex.findPrevious((void *)((uintptr_t)lowAddress + 1));
+		previousFreeEntry = _sizeIndex.findPrevious(currentFreeEntry);
+	}
 	while(currentFreeEntry) {
 		if( (lowAddress >= currentFreeEntry) && (highAddress <= (void *) (((uintptr_t)currentFreeEntry) + currentFreeEntry->getSize())) ) {
 			break;
@@ -976,6 +1038,7 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 	} else {
 		_heapFreeList = nextFreeEntry;
 	}
+	_sizeIndex.resync(currentFreeEntry, highAddress, nextFreeEntry, compressed);
 
 	/* Adjust the free memory data */
 	_freeMemorySize -= totalContractSize;
@@ -1014,16 +1077,24 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 
 	assume0(isValidListOrdering());
 
-	while(NULL != currentFreeEntry) {
-		if(currentFreeEntry > freeListHead) {
-			/* we need to insert our chunks before currentfreeEntry */
-			break;
-		}
+	if (_sizeIndex.isValid()) {
+		previousFreeEntry = _sizeIndex.findPrevious(freeListHead);
+	} else {
+		while(NULL != currentFreeEntry) {
+			if(currentFreeEntry > freeListHead) {
+				/* we need to insert our chunks before currentfreeEntry */
+				break;
+			}
 
-		previousFreeEntry = currentFreeEntry;
-		currentFreeEntry = currentFreeEntry->getNext(compressed);
+			previousFreeEntry = currentFreeEntry;
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+		}
 	}
 
+	/* Everything the index may need to change lies between the previous entry and the end of the added entries */
+	void *indexLowAddress = (NULL == previousFreeEntry) ? (void *)freeListHead : (void *)previousFreeEntry;
+	void *indexHighAddress = (void *)freeListTail->afterEnd();
+
 	/* Appending at start of list ? */
 	if (previousFreeEntry == NULL) {
 		assume0(_heapFreeList == NULL || freeListTail < _heapFreeList);
@@ -1060,6 +1131,7 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 			previousFreeEntry->setNext(freeListHead, compressed);
 		}
 	}
+	_sizeIndex.resync(indexLowAddress, indexHighAddress, (NULL == previousFreeEntry) ? _heapFreeList : previousFreeEntry, compressed);
 
 	/* Adjust the free memory data */
 	_freeMemorySize += freeListMemorySize;
@@ -1104,6 +1176,14 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
+	if (_sizeIndex.isValid()) {
+		/* start the walk at the one entry below lowAddress that may straddle it */
+		MM_HeapLinkedFreeHeader *straddlingFreeEntry = _sizeIndex.findPrevious(lowAddress);
+		if (NULL != straddlingFreeEntry) {
+			currentFreeEntry = straddlingFreeEntry;
+			previousFreeEntry = _sizeIndex.findPrevious(straddlingFreeEntry);
+		}
+	}
 
 	while(currentFreeEntry) {
 		currentFreeEntryTop = (void *)currentFreeEntry->afterEnd();
@@ -1123,6 +1203,10 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 		return false;
 	}
 
+	/* Entries below the first one consumed are left alone */
+	MM_HeapLinkedFreeHeader *firstAffectedFreeEntry = currentFreeEntry;
+	MM_HeapLinkedFreeHeader *lastUnaffectedFreeEntry = previousFreeEntry;
+
 	/* Remember the next free entry after the current one which we are going to consume at least part of */
 	nextFreeEntry = currentFreeEntry->getNext(compressed);
 
@@ -1240,6 +1324,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	} else {
 		_heapFreeList = tailFreeEntry;
 	}
+	_sizeIndex.resync(firstAffectedFreeEntry, highAddress,
+		(NULL == lastUnaffectedFreeEntry) ? _heapFreeList : lastUnaffectedFreeEntry->getNext(compressed), compressed);
 
 	/* Adjust the free memory data */
 	_freeMemorySize -= removeSize;
@@ -1461,6 +1547,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	_sizeIndex.invalidate();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1514,6 +1602,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
+	} else if (_sizeIndex.isValid()) {
+		MM_HeapLinkedFreeHeader *previousFreeEntry = _sizeIndex.findPrevious(chunkBase);
+		recycled = recycleHeapChunk(chunkBase, chunkTop, previousFreeEntry, previousFreeEntry->getNext(compressed));
 	} else {
 		MM_HeapLinkedFreeHeader  *currentFreeEntry = _heapFreeList;
 		MM_HeapLinkedFreeHeader  *next;
@@ -1544,6 +1635,7 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 		_freeMemorySize += chunkSize;
 		_freeEntryCount += 1;
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(chunkSize);
+		_sizeIndex.add((MM_HeapLinkedFreeHeader *)chunkBase, chunkSize);
 	}
 
 	_heapLock.release();
@@ -27,6 +27,7 @@
 #include "omrcomp.h"
 #include "modronopt.h"
 
+#include "FreeEntrySizeIndex.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -57,6 +58,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size index support */
+	MM_FreeEntrySizeIndex _sizeIndex; /**< first fit search index over _heapFreeList, used in place of hints while valid */
+	bool _sizeIndexEnabled; /**< true if the size index may be built for this pool (-Xgc:freeListSizeIndex, not with concurrent sweep) */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -73,6 +78,7 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void rebuildSizeIndex();
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
@@ -152,6 +158,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -160,6 +167,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -142,6 +142,133 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 }
  
  
+MMINLINE void
+MM_MemoryPoolSplitAddressOrderedList::recordFreeListContention(uintptr_t curFreeList, uintptr_t contendedCount, bool stolen)
+{
+	MM_LargeObjectAllocateStats* stats = &_largeObjectAllocateStatsForFreeList[curFreeList];
+
+	if (0 != contendedCount) {
+		stats->addFreeListContended(contendedCount);
+	}
+	if (stolen) {
+		stats->incrementFreeListSteal();
+	}
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::rebalanceFreeList(MM_EnvironmentBase* env, uintptr_t homeFreeList)
+{
+	bool const compressed = compressObjectReferences();
+	J9ModronFreeList* home = &_heapFreeLists[homeFreeList];
+	uintptr_t donorFreeList = _heapFreeListCount;
+
+	if ((0 == _extensions->splitFreeListRebalanceRatio) || (homeFreeList == _reservedFreeListIndex)) {
+		return;
+	}
+
+	/* Pick a donor from an unlocked look at the neighbours; the choice is checked again once both locks are held */
+	if ((0 < homeFreeList) && shouldRebalanceFreeList(homeFreeList, homeFreeList - 1)) {
+		donorFreeList = homeFreeList - 1;
+	} else if ((NULL == home->_freeList) && ((homeFreeList + 1) < _heapFreeListCount) && shouldRebalanceFreeList(homeFreeList, homeFreeList + 1)) {
+		donorFreeList = homeFreeList + 1;
+	}
+	if (_heapFreeListCount == donorFreeList) {
+		return;
+	}
+
+	J9ModronFreeList* donor = &_heapFreeLists[donorFreeList];
+	J9ModronFreeList* firstLocked = (donorFreeList < homeFreeList) ? donor : home;
+	J9ModronFreeList* secondLocked = (donorFreeList < homeFreeList) ? home : donor;
+	if (!firstLocked->_lock.tryAcquire()) {
+		return;
+	}
+	if (!secondLocked->_lock.tryAcquire()) {
+		firstLocked->_lock.release();
+		return;
+	}
+
+	if ((homeFreeList != _reservedFreeListIndex)
+		&& shouldRebalanceFreeList(homeFreeList, donorFreeList)
+		&& (NULL != donor->_freeList->getNext(compressed))
+		&& ((donorFreeList < homeFreeList) || (NULL == home->_freeList))
+	) {
+		MM_LargeObjectAllocateStats* donorStats = &_largeObjectAllocateStatsForFreeList[donorFreeList];
+		MM_LargeObjectAllocateStats* homeStats = &_largeObjectAllocateStatsForFreeList[homeFreeList];
+		/* Moving half of the difference evens the two lists out */
+		uintptr_t moveSize = (donor->_freeSize - home->_freeSize) / 2;
+		MM_HeapLinkedFreeHeader* keepTail = NULL;
+		MM_HeapLinkedFreeHeader* movedHead = NULL;
+		MM_HeapLinkedFreeHeader* movedTail = NULL;
+		uintptr_t movedSize = 0;
+		uintptr_t movedCount = 0;
+
+		/* Both walks leave at least one entry on either side of the split */
+		if (donorFreeList < homeFreeList) {
+			/* The lower neighbour keeps the head of its list and gives up the tail */
+			uintptr_t keepSize = donor->_freeSize - moveSize;
+			keepTail = donor->_freeList;
+			uintptr_t keptSize = keepTail->getSize();
+			while ((keptSize < keepSize) && (NULL != keepTail->getNext(compressed)->getNext(compressed))) {
+				keepTail = keepTail->getNext(compressed);
+				keptSize += keepTail->getSize();
+			}
+			movedHead = keepTail->getNext(compressed);
+			movedTail = movedHead;
+			while (NULL != movedTail->getNext(compressed)) {
+				movedTail = movedTail->getNext(compressed);
+			}
+		} else {
+			/* The higher neighbour gives up the head of its list */
+			movedHead = donor->_freeList;
+			movedTail = movedHead;
+			uintptr_t headSize = movedTail->getSize();
+			while ((headSize < moveSize) && (NULL != movedTail->getNext(compressed)->getNext(compressed))) {
+				movedTail = movedTail->getNext(compressed);
+				headSize += movedTail->getSize();
+			}
+		}
+
+		MM_HeapLinkedFreeHeader* movedEntry = movedHead;
+		for (;;) {
+			uintptr_t entrySize = movedEntry->getSize();
+			movedSize += entrySize;
+			movedCount += 1;
+			donorStats->decrementFreeEntrySizeClassStats(entrySize);
+			homeStats->incrementFreeEntrySizeClassStats(entrySize);
+			if (movedTail == movedEntry) {
+				break;
+			}
+			movedEntry = movedEntry->getNext(compressed);
+		}
+
+		if (donorFreeList < homeFreeList) {
+			Assert_MM_true((NULL == home->_freeList) || (movedTail < home->_freeList));
+			keepTail->setNext(NULL, compressed);
+			movedTail->setNext(home->_freeList, compressed);
+		} else {
+			donor->_freeList = movedTail->getNext(compressed);
+			movedTail->setNext(NULL, compressed);
+		}
+		home->_freeList = movedHead;
+
+		Assert_MM_true(donor->_freeSize >= movedSize);
+		Assert_MM_true(donor->_freeCount > movedCount);
+		donor->_freeSize -= movedSize;
+		donor->_freeCount -= movedCount;
+		home->_freeSize += movedSize;
+		home->_freeCount += movedCount;
+
+		/* A hint vouches for the entries below it, which have changed in both lists */
+		donor->clearHints();
+		home->clearHints();
+
+		homeStats->addFreeListRebalance(movedSize);
+	}
+
+	secondLocked->_lock.release();
+	firstLocked->_lock.release();
+}
+
 void*
 MM_MemoryPoolSplitAddressOrderedList::internalAllocate(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats* largeObjectAllocateStatsForFreeList)
 {
@@ -154,6 +281,10 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocate(MM_EnvironmentBase* env,
 	MM_HeapLinkedFreeHeader* recycleEntry = NULL;
 	uintptr_t recycleEntrySize = 0;
 	void* addrBase = NULL;
+	uintptr_t homeFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+	uintptr_t contendedCount = 0;
+	/* with stealing, the first lap over the free lists skips any list that is locked */
+	bool blockOnContention = !_extensions->splitFreeListStealing;
 
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
@@ -161,8 +292,12 @@ retry:
 
 	bool firstIteration = true;
 	bool jumpedToSuggested = false;
+	bool skippedContended = false;
 	if (skipReserved) {
 		curFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+		if (!blockOnContention && lockingRequired) {
+			rebalanceFreeList(env, curFreeList);
+		}
 	} else {
 		/* tried all lists and the only thing to try is reserved free entry */
 		curFreeList = _reservedFreeListIndex;
@@ -174,31 +309,32 @@ retry:
 
 	do {
 		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
-			if (skipReserved) {
-				/* first pass will skip reserved free entry */
-				currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
-				if (NULL != currentFreeEntry) {
-					/* found a freeEntry; will release lock only after we handle the remainder */
-					break;
-				}
+			if (lockingRequired && !lockFreeListForAllocate(curFreeList, blockOnContention || !skipReserved)) {
+				/* the list is busy; only come back and wait for it if no other list can satisfy the request */
+				contendedCount += 1;
+				skippedContended = true;
 			} else {
-				/* second pass will directly use reserved free entry */
-				if (sizeInBytesRequired <= _reservedFreeEntrySize) {
-					Assert_MM_true(_reservedFreeEntryAvaliable);
-					currentFreeEntry = getReservedFreeEntry();
-					previousFreeEntry = _previousReservedFreeEntry;
-					break;
+				if (skipReserved) {
+					/* first pass will skip reserved free entry */
+					currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
+					if (NULL != currentFreeEntry) {
+						/* found a freeEntry; will release lock only after we handle the remainder */
+						break;
+					}
+				} else {
+					/* second pass will directly use reserved free entry */
+					if (sizeInBytesRequired <= _reservedFreeEntrySize) {
+						Assert_MM_true(_reservedFreeEntryAvaliable);
+						currentFreeEntry = getReservedFreeEntry();
+						previousFreeEntry = _previousReservedFreeEntry;
+						break;
+					}
 				}
-			}
-			Assert_MM_true(NULL == currentFreeEntry);
+				Assert_MM_true(NULL == currentFreeEntry);
 
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.release();
+				if (lockingRequired) {
+					_heapFreeLists[curFreeList]._lock.release();
+				}
 			}
 		}
 
@@ -216,6 +352,11 @@ retry:
 skipSearch:
 	/* Check if an entry was found */
 	if (NULL == currentFreeEntry) {
+		if (skippedContended) {
+			/* lists were skipped while locked - go around again, this time waiting for them */
+			blockOnContention = true;
+			goto retry;
+		}
 		if (skipReserved && (sizeInBytesRequired <= _reservedFreeEntrySize)) {
 			skipReserved = false;
 			goto retry;
@@ -280,10 +421,15 @@ skipSearch:
 	}
 
 	/* Was our initial or suggested freelist empty? If not, go back and use it more. */
-	if (NULL != _heapFreeLists[suggestedFreeList]._freeList) {
+	if (0 != contendedCount) {
+		/* a thread that ran into a locked list makes the list it got the entry from its new home */
+		_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = curFreeList;
+	} else if (NULL != _heapFreeLists[suggestedFreeList]._freeList) {
 		_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = suggestedFreeList;
 	}
 
+	recordFreeListContention(curFreeList, contendedCount, skipReserved && (curFreeList != homeFreeList));
+
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStatsForFreeList is null for Survivor) */
 	if (NULL != largeObjectAllocateStatsForFreeList) {
 		largeObjectAllocateStatsForFreeList[curFreeList].allocateObject(sizeInBytesRequired);
@@ -311,6 +457,10 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* en
 	uintptr_t recycleEntrySize = 0;
 	uintptr_t suggestedFreeList;
 	uintptr_t curFreeList;
+	uintptr_t homeFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+	uintptr_t contendedCount = 0;
+	/* with stealing, the first lap over the free lists skips any list that is locked */
+	bool blockOnContention = !_extensions->splitFreeListStealing;
 
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
@@ -318,10 +468,14 @@ retry:
 
 	bool firstIteration = true;
 	bool jumpedToSuggested = false;
+	bool skippedContended = false;
 
 
 	if (skipReserved) {
 		curFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+		if (!blockOnContention && lockingRequired) {
+			rebalanceFreeList(env, curFreeList);
+		}
 	} else {
 		/* tried all lists and the only thing to try is reserved free entry */
 		curFreeList = _reservedFreeListIndex;
@@ -333,39 +487,40 @@ retry:
 
 	do {
 		if (NULL != _heapFreeLists[curFreeList]._freeList) {
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.acquire();
-				_heapFreeLists[curFreeList]._timesLocked += 1;
-			}
-
-			if (!skipReserved) {
-				/* second pass will directly use reserved free entry */
-				freeEntry = getReservedFreeEntry();
-				if (NULL != freeEntry) {
-					previousFreeEntry = _previousReservedFreeEntry;
-				}
+			if (lockingRequired && !lockFreeListForAllocate(curFreeList, blockOnContention || !skipReserved)) {
+				/* the list is busy; only come back and wait for it if no other list has an entry */
+				contendedCount += 1;
+				skippedContended = true;
 			} else {
-				freeEntry = _heapFreeLists[curFreeList]._freeList;
-			}
-			
-			if (NULL != freeEntry) {
-				freeEntrySize = freeEntry->getSize();
-
-				if (skipReserved && isPreviousReservedFreeEntry(previousFreeEntry, curFreeList)) {
-					previousFreeEntry = freeEntry;
-					freeEntry = freeEntry->getNext(compressed);
+				if (!skipReserved) {
+					/* second pass will directly use reserved free entry */
+					freeEntry = getReservedFreeEntry();
 					if (NULL != freeEntry) {
-						freeEntrySize = freeEntry->getSize();
-						break;
+						previousFreeEntry = _previousReservedFreeEntry;
 					}
-					previousFreeEntry = NULL;
 				} else {
-					break;
+					freeEntry = _heapFreeLists[curFreeList]._freeList;
 				}
-			}
 
-			if (lockingRequired) {
-				_heapFreeLists[curFreeList]._lock.release();
+				if (NULL != freeEntry) {
+					freeEntrySize = freeEntry->getSize();
+
+					if (skipReserved && isPreviousReservedFreeEntry(previousFreeEntry, curFreeList)) {
+						previousFreeEntry = freeEntry;
+						freeEntry = freeEntry->getNext(compressed);
+						if (NULL != freeEntry) {
+							freeEntrySize = freeEntry->getSize();
+							break;
+						}
+						previousFreeEntry = NULL;
+					} else {
+						break;
+					}
+				}
+
+				if (lockingRequired) {
+					_heapFreeLists[curFreeList]._lock.release();
+				}
 			}
 		}
 
@@ -383,6 +538,11 @@ retry:
 skipSearch:
 	/* Check if an entry was found */
 	if (NULL == freeEntry) {
+		if (skippedContended) {
+			/* lists were skipped while locked - go around again, this time waiting for them */
+			blockOnContention = true;
+			goto retry;
+		}
 		if (skipReserved && (0 != _reservedFreeEntrySize)) {
 			skipReserved = false;
 			goto retry;
@@ -403,6 +563,7 @@ skipSearch:
 
 	/* Update our current free list */
 	_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = curFreeList;
+	recordFreeListContention(curFreeList, contendedCount, skipReserved && (curFreeList != homeFreeList));
 
 	/* Consume the bytes and set the return pointer values */
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
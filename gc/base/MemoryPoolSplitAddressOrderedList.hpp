@@ -71,6 +71,38 @@ private:
 	 */
 	MM_HeapLinkedFreeHeader* internalAllocateFromList(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry);
 
+	/**
+	 * Record lock contention and stealing against the free list an allocate was satisfied from
+	 *
+	 * @param[in] curFreeList the index of the free list the allocate was satisfied from (locked, if locking is required)
+	 * @param[in] contendedCount number of times the allocating thread found a free list locked and moved on
+	 * @param[in] stolen true if curFreeList is not the allocating thread's home free list
+	 */
+	MMINLINE void recordFreeListContention(uintptr_t curFreeList, uintptr_t contendedCount, bool stolen);
+
+	/**
+	 * Move free entries into a thread's home free list from a neighbouring free list that holds
+	 * splitFreeListRebalanceRatio times more free memory. The lower neighbour gives up the tail of its list,
+	 * the higher neighbour the head of its list (only into an empty home list), so the lists stay address ordered.
+	 * Called with no free list locks held; the locks are only tried, and the move is skipped if either is busy.
+	 *
+	 * @param[in] env
+	 * @param[in] homeFreeList the index of the allocating thread's home free list
+	 */
+	void rebalanceFreeList(MM_EnvironmentBase* env, uintptr_t homeFreeList);
+
+	/**
+	 * check if donorFreeList holds enough free memory, relative to homeFreeList, to give some of it up
+	 */
+	MMINLINE bool shouldRebalanceFreeList(uintptr_t homeFreeList, uintptr_t donorFreeList)
+	{
+		J9ModronFreeList* donor = &_heapFreeLists[donorFreeList];
+		return ((donorFreeList != _reservedFreeListIndex)
+				&& (1 < donor->_freeCount)
+				&& (NULL != donor->_freeList)
+				&& ((donor->_freeSize / _extensions->splitFreeListRebalanceRatio) > _heapFreeLists[homeFreeList]._freeSize));
+	}
+
 	/* helpers for maintaining reserved free entry - start */
 	/**
 	 * check if previousFreeEntry is the same as previousReservedFreeEntry
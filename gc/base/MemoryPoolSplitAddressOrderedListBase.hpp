@@ -292,6 +292,29 @@ protected:
 		return index;
 	}
 
+	/**
+	 * Lock a free list for allocation.
+	 * When contention is not to be waited out the lock is only tried, so the caller can move on to another free list.
+	 *
+	 * @param[in] freeListIndex index of the free list to lock
+	 * @param[in] blockOnContention wait for the lock if it is held by another thread
+	 * @return true if the lock was acquired
+	 */
+	MMINLINE bool lockFreeListForAllocate(uintptr_t freeListIndex, bool blockOnContention)
+	{
+		J9ModronFreeList* freeList = &_heapFreeLists[freeListIndex];
+		bool locked = true;
+		if (blockOnContention) {
+			freeList->_lock.acquire();
+		} else {
+			locked = freeList->_lock.tryAcquire();
+		}
+		if (locked) {
+			freeList->_timesLocked += 1;
+		}
+		return locked;
+	}
+
 	/**
 	 * set Next of the freeEntry with new freeEntry pointer
 	 *
@@ -37,17 +37,53 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCREGION_PARALLEL_COMPACT "-Xgc:regionParallelCompact"
+#define OMR_XGCREGION_PARALLEL_COMPACT_LENGTH 26
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGER_WORK_STEALING "-Xgc:scavengerWorkStealing"
+#define OMR_XGCSCAVENGER_WORK_STEALING_LENGTH 26
+#define OMR_XGCSCAVENGER_PREFETCH_DISTANCE "-Xgc:scavengerPrefetchDistance="
+#define OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH 31
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING_OVERFLOW "-Xgc:asyncLoggingOverflow="
+#define OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH 26
+#define OMR_XGCASYNC_LOGGING_SYNC "-Xgc:asyncLoggingSync"
+#define OMR_XGCASYNC_LOGGING_SYNC_LENGTH 21
+#define OMR_XGCFREE_LIST_SIZE_INDEX "-Xgc:freeListSizeIndex"
+#define OMR_XGCFREE_LIST_SIZE_INDEX_LENGTH 22
+#define OMR_XGCSPLIT_FREE_LIST_STEALING "-Xgc:splitFreeListStealing"
+#define OMR_XGCSPLIT_FREE_LIST_STEALING_LENGTH 26
+#define OMR_XGCSPLIT_FREE_LIST_REBALANCE_RATIO "-Xgc:splitFreeListRebalanceRatio="
+#define OMR_XGCSPLIT_FREE_LIST_REBALANCE_RATIO_LENGTH 33
+#define OMR_XGCWORK_PACKET_STEALING "-Xgc:workPacketStealing"
+#define OMR_XGCWORK_PACKET_STEALING_LENGTH 23
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCONCURRENT_PACING_CPU_BUDGET "-Xgc:concurrentPacingCPUBudget="
+#define OMR_XGCCONCURRENT_PACING_CPU_BUDGET_LENGTH 31
+#define OMR_XGCCONCURRENT_PACING "-Xgc:concurrentPacing"
+#define OMR_XGCCONCURRENT_PACING_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#define OMR_XGCTLH_ADAPTIVE_SIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH 22
+#define OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL "-Xgc:tlhAdaptiveRefreshInterval="
+#define OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH 32
+#define OMR_XGCTLH_ADAPTIVE_RESERVED_LIMIT "-Xgc:tlhAdaptiveReservedLimit="
+#define OMR_XGCTLH_ADAPTIVE_RESERVED_LIMIT_LENGTH 30
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -264,6 +300,9 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCREGION_PARALLEL_COMPACT, OMR_XGCREGION_PARALLEL_COMPACT_LENGTH)) {
+		extensions->regionParallelCompact = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +315,30 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_OVERFLOW, OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH)) {
+		char *policy = option + OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH;
+		if (0 == strcmp(policy, "block")) {
+			extensions->asyncLoggingBlockOnOverflow = true;
+		} else if (0 == strcmp(policy, "drop")) {
+			extensions->asyncLoggingBlockOnOverflow = false;
+		} else {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_SYNC, OMR_XGCASYNC_LOGGING_SYNC_LENGTH)) {
+		extensions->asyncLoggingSync = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +350,70 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_WORK_STEALING, OMR_XGCSCAVENGER_WORK_STEALING_LENGTH)) {
+		extensions->scavengerWorkStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PREFETCH_DISTANCE, OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH)) {
+		uintptr_t value = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->scavengerPrefetchDistance = value;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	else if (0 == strncmp(option, OMR_XGCFREE_LIST_SIZE_INDEX, OMR_XGCFREE_LIST_SIZE_INDEX_LENGTH)) {
+		extensions->freeListSizeIndex = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSPLIT_FREE_LIST_STEALING, OMR_XGCSPLIT_FREE_LIST_STEALING_LENGTH)) {
+		extensions->splitFreeListStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSPLIT_FREE_LIST_REBALANCE_RATIO, OMR_XGCSPLIT_FREE_LIST_REBALANCE_RATIO_LENGTH)) {
+		uintptr_t value = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSPLIT_FREE_LIST_REBALANCE_RATIO_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->splitFreeListRebalanceRatio = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCWORK_PACKET_STEALING, OMR_XGCWORK_PACKET_STEALING_LENGTH)) {
+		extensions->workPacketStealing = true;
+	}
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_PACING_CPU_BUDGET, OMR_XGCCONCURRENT_PACING_CPU_BUDGET_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENT_PACING_CPU_BUDGET_LENGTH, &value)) || (0 == value) || (100 < value)) {
+			result = false;
+		} else {
+			extensions->concurrentPacingCPUBudget = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_PACING, OMR_XGCCONCURRENT_PACING_LENGTH)) {
+		extensions->concurrentPacing = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_SIZING, OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL, OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH)) {
+		uintptr_t value = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveRefreshInterval = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_RESERVED_LIMIT, OMR_XGCTLH_ADAPTIVE_RESERVED_LIMIT_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCTLH_ADAPTIVE_RESERVED_LIMIT_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveReservedLimit = value;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -293,15 +293,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
+	/* flush the TLHs first so that what they waste is counted in the stats being merged */
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
@@ -38,6 +38,7 @@
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
 #include "AllocationStats.hpp"
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -54,6 +55,12 @@
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+/**
+ * Weight of the history in a thread's smoothed allocation rate when adaptive TLH sizing folds in a new sample.
+ */
+#define TLH_ALLOCATION_RATE_HISTORY_WEIGHT 0.5f
+
 /**
  * Report clearing of a full allocation cache
  */
@@ -113,8 +120,10 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	if(shouldFlush) {
 		_abandonedList = NULL;
 		_abandonedListSize = 0;
+		releaseAbandonedReservedBytes(env);
 		clear(env);
 	} else {
+		releaseReservedBytes(env);
 		/* Clear current information accumulated */
 		setAllZeroes();
 	}
@@ -142,7 +151,12 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* the refresh size was already set from the allocation rate sampled when the TLH was flushed */
+		_tlh->refreshSize = refreshSize;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 }
 
 /**
@@ -163,8 +177,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		/* increase thread hungriness if we did not refresh (adaptive sizing follows the allocation rate instead) */
+		if (!extensions->tlhAdaptiveSizing && getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -193,12 +207,25 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (_abandonedListSize > stats->_tlhMaxAbandonedListSize) {
 			stats->_tlhMaxAbandonedListSize = _abandonedListSize;
 		}
+		if (extensions->tlhAdaptiveSizing) {
+			/* the cached remainder stays reserved until it is reused or flushed; only the consumed part is released */
+			uintptr_t remainingBytes = OMR_MIN(getRemainingSize(), _reservedBytes);
+			_reservedBytes -= remainingBytes;
+			_abandonedReservedBytes += remainingBytes;
+		}
 		wipeTLH(env);
 	} else {
+		stats->_tlhWastedBytes += getRemainingSize();
 		clear(env);
 	}
 
+	if (extensions->tlhAdaptiveSizing) {
+		sampleAllocationRate(env);
+		setRefreshSize(adaptiveRefreshSize(env, stats, sizeInBytesRequired));
+	}
+
 	bool didRefresh = false;
+	bool didReuse = false;
 	/* Try allocating a TLH */
 	if ((NULL != _abandonedList) && (sizeInBytesRequired <= tlhMinimumSize)) {
 		/* Try to get a cached TLH */
@@ -224,6 +251,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhDiscardedBytes -= getSize();
 
 		didRefresh = true;
+		didReuse = true;
 	} else {
 		/* Try allocating a fresh TLH */
 		MM_AllocationContext *ac = env->getAllocationContext();
@@ -281,12 +309,26 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (0 < getSize()) {
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
-			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
-			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+			if (extensions->tlhAdaptiveSizing) {
+				/* a reused remainder is already counted from when it was cached */
+				uintptr_t countedBytes = didReuse ? OMR_MIN(getSize(), _abandonedReservedBytes) : 0;
+				_abandonedReservedBytes -= countedBytes;
+				_reservedBytes = getSize();
+				uintptr_t reservedBytes = extensions->tlhReservedBytes;
+				if (countedBytes < _reservedBytes) {
+					reservedBytes = MM_AtomicOperations::add(&extensions->tlhReservedBytes, _reservedBytes - countedBytes);
+				}
+				if (reservedBytes > stats->_tlhMaxReservedBytes) {
+					stats->_tlhMaxReservedBytes = reservedBytes;
+				}
+			} else {
+				/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
+				 * may not give you the size requested */
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
+				if (getRefreshSize() < tlhMaximumSize) {
+					setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				}
 			}
 		}
 	}
@@ -354,10 +396,107 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	bool const compressed = extensions->compressObjectReferences();
+
+	/* Whatever is left in the TLH and in the cached remainders goes back to the heap unused */
+	uintptr_t wastedBytes = getRemainingSize();
+	for (MM_HeapLinkedFreeHeaderTLH *cached = _abandonedList; NULL != cached; cached = (MM_HeapLinkedFreeHeaderTLH *)cached->getNext(compressed)) {
+		wastedBytes += cached->getSize();
+	}
+	stats->_tlhWastedBytes += wastedBytes;
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
+	releaseAbandonedReservedBytes(env);
 	clear(env);
+
+	if (extensions->tlhAdaptiveSizing) {
+		/* Threads that have stopped allocating never refresh, so the flush for each GC is
+		 * where their rate decays and their next TLH shrinks back towards the minimum.
+		 */
+		sampleAllocationRate(env);
+		setRefreshSize(adaptiveRefreshSize(env, NULL, 0));
+	}
+}
+
+void
+MM_TLHAllocationSupport::sampleAllocationRate(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRateSampleTime) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_lastRateSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == elapsedMicros) {
+			/* keep accumulating until the clock has moved */
+			return;
+		}
+		float rate = (float)_bytesSinceRateSample / (float)elapsedMicros;
+		_allocationRate = MM_Math::weightedAverage(_allocationRate, rate, TLH_ALLOCATION_RATE_HISTORY_WEIGHT);
+	}
+
+	_lastRateSampleTime = now;
+	_bytesSinceRateSample = 0;
+}
+
+uintptr_t
+MM_TLHAllocationSupport::adaptiveRefreshSize(MM_EnvironmentBase *env, MM_AllocationStats *stats, uintptr_t minimumSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t tlhMinimumSize = OMR_MAX(extensions->tlhMinimumSize, minimumSize);
+	uintptr_t tlhMaximumSize = OMR_MAX(extensions->tlhMaximumSize, tlhMinimumSize);
+	uintptr_t granularity = extensions->tlhIncrementSize;
+
+	/* enough for the thread to allocate for one refresh interval at its current rate */
+	float target = _allocationRate * (float)extensions->tlhAdaptiveRefreshInterval;
+	uintptr_t refreshSize = tlhMaximumSize;
+	if (target < (float)tlhMaximumSize) {
+		refreshSize = MM_Math::roundToCeiling(granularity, (uintptr_t)target);
+		refreshSize = OMR_MIN(OMR_MAX(refreshSize, tlhMinimumSize), tlhMaximumSize);
+	}
+
+	/* hand out no more than is left under the reserved limit, but never less than the minimum */
+	uintptr_t reservedBytes = extensions->tlhReservedBytes;
+	uintptr_t reservedLimit = extensions->tlhAdaptiveReservedLimit;
+	if ((reservedBytes + refreshSize) > reservedLimit) {
+		uintptr_t available = (reservedLimit > reservedBytes) ? MM_Math::roundToFloor(granularity, reservedLimit - reservedBytes) : 0;
+		if (available < refreshSize) {
+			refreshSize = OMR_MAX(available, tlhMinimumSize);
+			if (NULL != stats) {
+				stats->_tlhRefreshCountLimited += 1;
+			}
+		}
+	}
+
+	return refreshSize;
+}
+
+void
+MM_TLHAllocationSupport::retireAdaptiveTLH(MM_EnvironmentBase *env)
+{
+	_bytesSinceRateSample += getUsedSize();
+	releaseReservedBytes(env);
+}
+
+void
+MM_TLHAllocationSupport::releaseReservedBytes(MM_EnvironmentBase *env)
+{
+	if (0 != _reservedBytes) {
+		MM_AtomicOperations::subtract(&env->getExtensions()->tlhReservedBytes, _reservedBytes);
+		_reservedBytes = 0;
+	}
+}
+
+void
+MM_TLHAllocationSupport::releaseAbandonedReservedBytes(MM_EnvironmentBase *env)
+{
+	if (0 != _abandonedReservedBytes) {
+		MM_AtomicOperations::subtract(&env->getExtensions()->tlhReservedBytes, _abandonedReservedBytes);
+		_abandonedReservedBytes = 0;
+	}
 }
 
 void
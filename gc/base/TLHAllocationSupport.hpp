@@ -43,6 +43,7 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 class MM_AllocateDescription;
+class MM_AllocationStats;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ObjectAllocationInterface;
@@ -83,6 +84,13 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	/* Adaptive TLH sizing (see MM_GCExtensionsBase::tlhAdaptiveSizing) */
+	uint64_t _lastRateSampleTime; /**< hires clock time of the last allocation rate sample, 0 before the first one */
+	uintptr_t _bytesSinceRateSample; /**< bytes allocated from retired TLHs since the last allocation rate sample */
+	float _allocationRate; /**< smoothed allocation rate of the thread, in bytes per microsecond */
+	uintptr_t _reservedBytes; /**< size of the current TLH as counted in MM_GCExtensionsBase::tlhReservedBytes */
+	uintptr_t _abandonedReservedBytes; /**< size of the remainders on _abandonedList as counted in MM_GCExtensionsBase::tlhReservedBytes */
+
 public:
 protected:
 private:
@@ -148,8 +156,42 @@ private:
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
+	/**
+	 * Fold the bytes allocated since the last sample into the thread's smoothed allocation rate.
+	 */
+	void sampleAllocationRate(MM_EnvironmentBase *env);
+
+	/**
+	 * Pick the size of the next TLH so that, at the thread's current allocation rate, it lasts
+	 * tlhAdaptiveRefreshInterval, without letting all threads together hold more than tlhAdaptiveReservedLimit.
+	 * @param stats the statistics to count a limited refresh in, or NULL
+	 * @param minimumSize the size of the allocation the refresh is for, if any
+	 * @return the new refresh size in bytes
+	 */
+	uintptr_t adaptiveRefreshSize(MM_EnvironmentBase *env, MM_AllocationStats *stats, uintptr_t minimumSize);
+
+	/**
+	 * Account for the current TLH being retired: count what was allocated from it towards the next
+	 * allocation rate sample and drop it from the total of reserved TLH bytes.
+	 */
+	void retireAdaptiveTLH(MM_EnvironmentBase *env);
+
+	/**
+	 * Drop the current TLH from the total of reserved TLH bytes.
+	 */
+	void releaseReservedBytes(MM_EnvironmentBase *env);
+
+	/**
+	 * Drop the remainders on the abandoned list from the total of reserved TLH bytes,
+	 * once the list itself has been discarded.
+	 */
+	void releaseAbandonedReservedBytes(MM_EnvironmentBase *env);
+
 	MMINLINE void wipeTLH(MM_EnvironmentBase *env)
 	{
+		if (env->getExtensions()->tlhAdaptiveSizing) {
+			retireAdaptiveTLH(env);
+		}
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
 		objectAllocationNotify(env, _tlh->heapBase, getAlloc());
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
@@ -191,7 +233,12 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_lastRateSampleTime(0),
+		_bytesSinceRateSample(0),
+		_allocationRate(0.0f),
+		_reservedBytes(0),
+		_abandonedReservedBytes(0)
 	{};
 
 	/*
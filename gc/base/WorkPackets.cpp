@@ -37,6 +37,23 @@
 #include "WorkPackets.hpp"
 #include "WorkPacketOverflow.hpp"
 
+class MM_WorkPackets::InputPacketCheck
+{
+private:
+	MM_WorkPackets *_workPackets;
+	MM_EnvironmentBase *_env;
+	bool _mustSyncThreadsAndExit;
+
+public:
+	bool operator()() { return !_mustSyncThreadsAndExit && _workPackets->inputPacketAvailable(_env); }
+
+	InputPacketCheck(MM_WorkPackets *workPackets, MM_EnvironmentBase *env, bool mustSyncThreadsAndExit)
+		: _workPackets(workPackets)
+		, _env(env)
+		, _mustSyncThreadsAndExit(mustSyncThreadsAndExit)
+	{}
+};
+
 /**
  * Instantiate a MM_WorkPackets
  * @param mode type of packets (used for getting the right overflow handler)
@@ -120,6 +137,25 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Concurrent marking hands packets between mutators, background threads and GC threads (and inspects the shared
+	 * list counts while doing so), so work stealing is limited to stop-the-world marking.
+	 */
+	if (_extensions->workPacketStealing && !_extensions->isConcurrentMarkEnabled()) {
+		uintptr_t dequeCount = _extensions->gcThreadCount;
+		_packetDeques = (MM_WorkStealingDeque<MM_Packet> *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque<MM_Packet>) * dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new (&_packetDeques[i]) MM_WorkStealingDeque<MM_Packet>();
+			/* _packetDequeCount tracks how many deques tearDown() has to release */
+			_packetDequeCount = i + 1;
+			if (!_packetDeques[i].initialize(env->getForge(), _extensions->workPacketStealingDequeSize, (uint32_t)(i + 1) * 2654435761U, OMR::GC::AllocationCategory::WORK_PACKETS)) {
+				return false;
+			}
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -224,6 +260,15 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _packetDeques) {
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			_packetDeques[i].tearDown(env->getForge());
+		}
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -262,6 +307,8 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	flushPacketDeques(env);
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -328,6 +375,22 @@ MM_WorkPackets::reuseDeferredPackets(MM_EnvironmentBase *env)
  */
 bool
 MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	if (sharedInputPacketAvailable(env)) {
+		return true;
+	}
+
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		if (!_packetDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+MM_WorkPackets::sharedInputPacketAvailable(MM_EnvironmentBase *env)
 {
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
@@ -384,35 +447,46 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = NULL;
+	MM_WorkStealingDeque<MM_Packet> *ownDeque = getPacketDeque(env);
 
-	if (!inputPacketAvailable(env)) {
-		return NULL;
+	/* the most recently published packets of this thread are the most likely to still be in its cache */
+	if (NULL != ownDeque) {
+		packet = ownDeque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+		}
 	}
 
-	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
-		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
-				packet = getPacket(env, &_fullPacketList);
+	if ((NULL == packet) && sharedInputPacketAvailable(env)) {
+		if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
+			if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
+					packet = getPacket(env, &_fullPacketList);
+				}
 			}
-		}
-	} else {
-		if(NULL == (packet = getPacket(env, &_fullPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
-				packet = getPacket(env, &_nonEmptyPacketList);
+		} else {
+			if(NULL == (packet = getPacket(env, &_fullPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
+					packet = getPacket(env, &_nonEmptyPacketList);
+				}
 			}
 		}
+
+		if(NULL == packet) {
+			packet = getInputPacketFromOverflow(env);
+		}
 	}
 
-	if(NULL == packet) {
-		packet = getInputPacketFromOverflow(env);
+	if ((NULL == packet) && (NULL != _packetDeques)) {
+		packet = stealPacket(env);
 	}
 
 	if(NULL != packet) {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		env->_workPacketStats.workPacketsAcquired += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-		if((_inputListWaitCount > 0) && inputPacketAvailable(env)) {
+		if((NULL == _packetDeques) && (_inputListWaitCount > 0) && inputPacketAvailable(env)) {
 			notifyWaitingThreads(env);
 		}
 	}
@@ -420,6 +494,38 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 	return packet;
 }
 
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env)
+{
+	uintptr_t stealAttempts = 0;
+	MM_Packet *packet = MM_WorkStealingDeque<MM_Packet>::stealFromOthers(_packetDeques, _packetDequeCount, getPacketDeque(env), &stealAttempts);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats._stealAttemptCount += stealAttempts;
+	if (NULL != packet) {
+		env->_workPacketStats._stealCount += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	if (NULL != packet) {
+		packet->setOwner(env);
+	}
+	return packet;
+}
+
+void
+MM_WorkPackets::flushPacketDeques(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		MM_Packet *packet = NULL;
+		bool contended = false;
+		while (NULL != (packet = _packetDeques[i].steal(&contended))) {
+			packet->setOwner(env);
+			putPacket(env, packet);
+		}
+		Assert_MM_false(contended);
+		Assert_MM_true(_packetDeques[i].isEmpty());
+	}
+}
+
 /**
  * Get an input packet
  * 
@@ -432,6 +538,10 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	bool doneFlag = false;
 	volatile uintptr_t doneIndex = _inputListDoneIndex;
 	bool mustSyncThreadsAndExit = (NULL != env->_currentTask) && env->_currentTask->shouldYieldFromTask(env);
+
+	if (NULL != _packetDeques) {
+		return getInputPacketWorkStealing(env, doneIndex, mustSyncThreadsAndExit);
+	}
 	
 	while(!doneFlag) {
 		if (!mustSyncThreadsAndExit) {
@@ -497,6 +607,49 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	return packet;
 }
 
+MM_Packet *
+MM_WorkPackets::getInputPacketWorkStealing(MM_EnvironmentBase *env, uintptr_t doneIndex, bool mustSyncThreadsAndExit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t threadCount = (NULL == env->_currentTask) ? 1 : env->_currentTask->getThreadCount();
+
+	while (true) {
+		if (!mustSyncThreadsAndExit) {
+			MM_Packet *packet = getInputPacketNoWait(env);
+			if (NULL != packet) {
+				return packet;
+			}
+		}
+
+		/* Offer termination. Only output packets are published to the deques, and a thread only gets here once it
+		 * has nothing left to push, so once every thread has offered there can be no work left anywhere.
+		 */
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		InputPacketCheck inputPacketCheck(this, env, mustSyncThreadsAndExit);
+		uintptr_t idleYields = 0;
+		MM_WorkStealingTermination::Result result = MM_WorkStealingTermination::offer(
+			&_inputListWaitCount, &_inputListDoneIndex, doneIndex, threadCount, inputPacketCheck, &idleYields);
+		if (MM_WorkStealingTermination::LAST_THREAD == result) {
+			MM_AtomicOperations::add(&_inputListDoneIndex, 1);
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats._idleYieldCount += idleYields;
+		if (MM_WorkStealingTermination::WORK_AVAILABLE == result) {
+			env->_workPacketStats.addToWorkStallTime(waitStartTime, omrtime_hires_clock());
+		} else {
+			env->_workPacketStats.addToCompleteStallTime(waitStartTime, omrtime_hires_clock());
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		if (MM_WorkStealingTermination::WORK_AVAILABLE != result) {
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+
 /**
  * Get an output packet
  * 
@@ -578,18 +731,29 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if (NULL == packet) {
+		/* in work stealing mode full output packets are published to the deques rather than _fullPacketList */
+		MM_WorkStealingDeque<MM_Packet> *ownDeque = getPacketDeque(env);
+		if ((NULL != ownDeque) && (NULL != (packet = ownDeque->pop()))) {
+			packet->setOwner(env);
+		}
+	}
+
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
 		
-		omrthread_monitor_enter(_inputListMonitor);
+		/* idle threads in work stealing mode poll for overflow rather than waiting on _inputListMonitor */
+		if (NULL == _packetDeques) {
+			omrthread_monitor_enter(_inputListMonitor);
 
-		/* Overflow was created - alert other threads that are waiting */
-		if(_inputListWaitCount > 0) {
-			omrthread_monitor_notify(_inputListMonitor);
-		}
+			/* Overflow was created - alert other threads that are waiting */
+			if(_inputListWaitCount > 0) {
+				omrthread_monitor_notify(_inputListMonitor);
+			}
 		
-		omrthread_monitor_exit(_inputListMonitor);
+			omrthread_monitor_exit(_inputListMonitor);
+		}
 	} else {
 		packet = getPacket(env, &_emptyPacketList);
 		if(NULL == packet) {
@@ -742,6 +906,11 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 void
 MM_WorkPackets::notifyWaitingThreads(MM_EnvironmentBase *env)
 {
+	if (NULL != _packetDeques) {
+		/* idle threads spin looking for work rather than waiting on _inputListMonitor */
+		return;
+	}
+
 	/* Added an entry to a null list - notify any other threads that a new entry has appeared on the list */
 	if (0 == omrthread_monitor_try_enter(_inputListMonitor)) {
 		if (_inputListWaitCount > 0) {
@@ -762,6 +931,14 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	MM_WorkStealingDeque<MM_Packet> *deque = getPacketDeque(env);
+	if ((NULL != deque) && !packet->isEmpty()) {
+		/* publish the packet for this thread (or a thief) without touching the shared lists; overflow to them when full */
+		packet->resetOwner();
+		if (deque->push(packet)) {
+			return;
+		}
+	}
 	putPacket(env, packet);
 }
 
@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -86,6 +87,9 @@ protected:
 	volatile uintptr_t _inputListWaitCount;
 	volatile uintptr_t _inputListDoneIndex;
 
+	MM_WorkStealingDeque<MM_Packet> *_packetDeques; /**< per GC thread work-stealing deques of full output packets, indexed by worker ID (NULL unless work stealing is enabled) */
+	uintptr_t _packetDequeCount; /**< number of entries in _packetDeques */
+
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
@@ -101,6 +105,45 @@ protected:
 	
 	virtual MM_WorkPacketOverflow *createOverflowHandler(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 
+	/**
+	 * Return the work-stealing deque owned by the given GC thread, or NULL if work stealing
+	 * is disabled or the thread is not running a task with a deque of its own.
+	 */
+	MMINLINE MM_WorkStealingDeque<MM_Packet> *
+	getPacketDeque(MM_EnvironmentBase *env)
+	{
+		uintptr_t workerID = env->getWorkerID();
+		return ((NULL != env->_currentTask) && (workerID < _packetDequeCount)) ? &_packetDeques[workerID] : NULL;
+	}
+
+	/**
+	 * Determine whether an input packet is available on the shared packet lists or from overflow.
+	 */
+	bool sharedInputPacketAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * Try to steal a packet from the deque of another GC thread, starting at a random victim.
+	 * @return the stolen packet, or NULL if no victim had work
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Work-stealing equivalent of the _inputListMonitor protocol in getInputPacket().
+	 * Takes work from the thread's own deque, the shared lists, overflow or other threads' deques, and
+	 * otherwise spins in a lock-free termination protocol (over _inputListWaitCount and _inputListDoneIndex)
+	 * until either new work appears or all threads agree that there is no work left.
+	 * @param doneIndex[in] snapshot of _inputListDoneIndex taken on entry to getInputPacket()
+	 * @param mustSyncThreadsAndExit[in] true if the task is yielding and the thread must not take more work
+	 * @return the next input packet, or NULL if all work is done
+	 */
+	MM_Packet *getInputPacketWorkStealing(MM_EnvironmentBase *env, uintptr_t doneIndex, bool mustSyncThreadsAndExit);
+	class InputPacketCheck; /**< tells getInputPacketWorkStealing() to stop waiting for termination */
+
+	/**
+	 * Move every packet remaining in the work-stealing deques back to the shared lists.
+	 */
+	void flushPacketDeques(MM_EnvironmentBase *env);
+
 private:
 	
 /* Methods */
@@ -235,6 +278,8 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
+		_packetDeques(NULL),
+		_packetDequeCount(0),
 		_overflowHandler(NULL)
 	{
 		_typeId = __FUNCTION__;
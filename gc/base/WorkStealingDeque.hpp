@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+
+#include "AllocationCategory.hpp"
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "Forge.hpp"
+
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define WORK_STEALING_DEQUE_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define WORK_STEALING_DEQUE_CACHE_LINE_SIZE 256
+#else
+#define WORK_STEALING_DEQUE_CACHE_LINE_SIZE 64
+#endif
+
+/* Idle threads yield the CPU every this many spins while waiting for work or termination */
+#define WORK_STEALING_YIELD_SPINS 64
+
+/**
+ * Bounded Chase-Lev work-stealing deque of T pointers, one per GC thread.
+ *
+ * The owning GC thread pushes and pops at the bottom without any atomic read-modify-write
+ * (except when racing thieves for the last entry), while other GC threads steal from the top
+ * with a single compare-and-swap. The deque has a fixed capacity; callers are expected to fall
+ * back to their shared lists when push() fails.
+ *
+ * @ingroup GC_Base
+ */
+template <typename T>
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves (and by the owner when taking the last entry) */
+	uint8_t _topPadding[WORK_STEALING_DEQUE_CACHE_LINE_SIZE - sizeof(uintptr_t)]; /**< keep _top and _bottom on separate cache lines */
+	volatile uintptr_t _bottom; /**< index one past the newest entry, only written by the owner */
+	T * volatile *_entries; /**< circular buffer of _capacity entries */
+	uintptr_t _capacity; /**< number of entries in _entries (a power of two) */
+	uintptr_t _mask; /**< _capacity - 1 */
+	uint32_t _victimSeed; /**< owner-private pseudo random state used to pick steal victims */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	bool
+	initialize(OMR::GC::Forge *forge, uintptr_t capacity, uint32_t seed, OMR::GC::AllocationCategory::Enum category)
+	{
+		/* capacity must be a power of two so indices can be masked rather than divided */
+		Assert_MM_true((0 != capacity) && (0 == (capacity & (capacity - 1))));
+
+		_entries = (T * volatile *)forge->allocate(sizeof(T *) * capacity, category, OMR_GET_CALLSITE());
+		if (NULL == _entries) {
+			return false;
+		}
+
+		_capacity = capacity;
+		_mask = capacity - 1;
+		_top = 0;
+		_bottom = 0;
+		/* xorshift state must never be zero */
+		_victimSeed = (0 == seed) ? 1 : seed;
+
+		return true;
+	}
+
+	void
+	tearDown(OMR::GC::Forge *forge)
+	{
+		if (NULL != _entries) {
+			forge->free((void *)_entries);
+			_entries = NULL;
+		}
+	}
+
+	/**
+	 * Push an entry onto the bottom of the deque. Must only be called by the owning thread.
+	 * @param entry[in] the entry to push
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(T *entry)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((intptr_t)(bottom - top) >= (intptr_t)_capacity) {
+			return false;
+		}
+		_entries[bottom & _mask] = entry;
+		/* publish the entry before the new bottom becomes visible to thieves */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed entry. Must only be called by the owning thread.
+	 * @return the entry, or NULL if the deque is empty (or the last entry was lost to a thief)
+	 */
+	MMINLINE T *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the store to _bottom must be visible before we read _top */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		T *entry = NULL;
+		if ((intptr_t)(bottom - top) >= 0) {
+			entry = _entries[bottom & _mask];
+			if (bottom == top) {
+				/* last entry - race thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					entry = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			_bottom = bottom + 1;
+		}
+		return entry;
+	}
+
+	/**
+	 * Take the oldest entry from the deque. May be called by any thread.
+	 * @param[out] contended set to true if the steal failed because of a race with another thread
+	 * @return the entry, or NULL if the deque was empty or the race was lost
+	 */
+	MMINLINE T *
+	steal(bool *contended)
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+		T *entry = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			entry = _entries[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				*contended = true;
+				entry = NULL;
+			}
+		}
+		return entry;
+	}
+
+	/**
+	 * Racy emptiness check, suitable for deciding whether it is worth trying to steal.
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Pick the next steal victim index in [0, count), never returning ownIndex when count > 1.
+	 * Must only be called by the owning thread.
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t ownIndex, uintptr_t count)
+	{
+		/* xorshift32 */
+		uint32_t seed = _victimSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		_victimSeed = seed;
+		if (count <= 1) {
+			return 0;
+		}
+		uintptr_t victim = seed % (count - 1);
+		return (victim >= ownIndex) ? (victim + 1) : victim;
+	}
+
+	/**
+	 * Steal an entry from any deque but the caller's own, starting at a random victim and visiting every
+	 * other deque once. The visit is repeated while a steal lost a race, so failing means every other deque
+	 * was seen empty.
+	 * @param deques[in] the deques of all GC threads
+	 * @param count[in] the number of deques
+	 * @param ownDeque[in] the caller's deque, or NULL if it has none
+	 * @param[out] stealAttempts incremented for every deque a steal was tried on
+	 * @return the stolen entry, or NULL if no victim had work
+	 */
+	static T *
+	stealFromOthers(MM_WorkStealingDeque *deques, uintptr_t count, MM_WorkStealingDeque *ownDeque, uintptr_t *stealAttempts)
+	{
+		uintptr_t victim = 0;
+		if (NULL != ownDeque) {
+			victim = ownDeque->nextVictim((uintptr_t)(ownDeque - deques), count);
+		}
+
+		bool contended = true;
+		while (contended) {
+			contended = false;
+			for (uintptr_t i = 0; i < count; i++) {
+				MM_WorkStealingDeque *deque = &deques[(victim + i) % count];
+				if ((deque != ownDeque) && !deque->isEmpty()) {
+					*stealAttempts += 1;
+					T *entry = deque->steal(&contended);
+					if (NULL != entry) {
+						return entry;
+					}
+				}
+			}
+		}
+
+		return NULL;
+	}
+
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _entries(NULL)
+		, _capacity(0)
+		, _mask(0)
+		, _victimSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Lock-free termination protocol for GC threads that work steal.
+ *
+ * A thread that ran out of work offers to terminate by counting itself in a waiting count, and
+ * withdraws the offer if work shows up again. The thread that sees every thread waiting resets the
+ * count and ends the round of work by advancing a done index, which releases the others.
+ *
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingTermination
+{
+public:
+	enum Result {
+		WORK_AVAILABLE = 0, /**< the offer was withdrawn because work showed up */
+		TERMINATED, /**< another thread ended the round of work */
+		LAST_THREAD /**< every thread is idle; the caller must end the round by advancing the done index */
+	};
+
+	/**
+	 * Offer termination and spin until the round of work ends or work shows up.
+	 * @param waitingCount[in] the number of threads that have offered termination
+	 * @param currentDoneIndex[in] the done index, advanced once per round of work
+	 * @param doneIndex[in] the done index when the caller started looking for work
+	 * @param threadCount[in] the number of threads taking part
+	 * @param workAvailable[in] functor returning true if the caller should stop waiting and look for work
+	 * @param[out] idleYields incremented whenever the thread yields its CPU
+	 */
+	template <typename WorkCheck>
+	static Result
+	offer(volatile uintptr_t *waitingCount, volatile uintptr_t *currentDoneIndex, uintptr_t doneIndex, uintptr_t threadCount, WorkCheck &workAvailable, uintptr_t *idleYields)
+	{
+		MM_AtomicOperations::add(waitingCount, 1);
+
+		uintptr_t spinCount = 0;
+		while (true) {
+			if (doneIndex != *currentDoneIndex) {
+				/* another thread detected termination and has already reset the waiting count */
+				return TERMINATED;
+			}
+
+			uintptr_t waiting = *waitingCount;
+			if (threadCount == waiting) {
+				/* everybody is idle - exactly one thread wins the right to end this round of work */
+				if (threadCount == MM_AtomicOperations::lockCompareExchange(waitingCount, threadCount, 0)) {
+					return LAST_THREAD;
+				}
+				continue;
+			}
+
+			if (workAvailable()) {
+				/* Withdraw the offer. The count may only be decremented while termination has not been detected (non-zero),
+				 * otherwise we just wait for the winning thread to advance the done index.
+				 */
+				if ((0 != waiting) && (waiting == MM_AtomicOperations::lockCompareExchange(waitingCount, waiting, waiting - 1))) {
+					return WORK_AVAILABLE;
+				}
+				continue;
+			}
+
+			spinCount += 1;
+			if (0 == (spinCount % WORK_STEALING_YIELD_SPINS)) {
+				*idleYields += 1;
+				omrthread_yield();
+			} else {
+				MM_AtomicOperations::yieldCPU();
+			}
+		}
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -125,6 +125,32 @@ done:
 	return result;
 }
 
+/**
+ * Try to acquire a spinlock without spinning or waiting.
+ * @param[in] s spinlock to be acquired
+ * @param[in] lockTracing lock statistics
+ * @return  0 if the lock was acquired, -1 if it is currently held
+ */
+intptr_t
+omrgc_spinlock_try_acquire(J9GCSpinlock *spinlock, J9ThreadMonitorTracing*  lockTracing)
+{
+	volatile intptr_t *target = (volatile intptr_t*) &spinlock->target;
+	intptr_t result = -1;
+
+	/* -1 indicates free; a single attempt to put 0 into the target field */
+	if ((-1 == *target) && (-1 == (intptr_t) MM_AtomicOperations::lockCompareExchange((volatile uintptr_t*) target, (uintptr_t)-1, 0))) {
+		result = 0;
+#if defined(OMR_THR_JLM)
+		if (lockTracing != NULL) {
+			UPDATE_JLM_MON_ENTER(lockTracing);
+		}
+#endif /* OMR_THR_JLM */
+		/* On out-of-order memory models (e.g. Power4), ensure that all reads and writes have been completed at this point */
+		MM_AtomicOperations::readWriteBarrier();
+	}
+	return result;
+}
+
 /**
  * Destroy a spinlock.
  * @param[in] s spinlock to be destroyed
@@ -46,6 +46,7 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -71,6 +72,9 @@
 #define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
 #endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 
+/* Number of spins between omrthread_yield() calls while a region waits for the regions it slides into to be evacuated */
+#define COMPACT_REGION_WAIT_YIELD_SPINS 64
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -369,6 +373,13 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_compactRegionTable = (CompactRegionEntry*)_subAreaTable;
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* Objects may grow when they move, so the size of a region's live data is not known before it is slid */
+	_regionParallel = false;
+#else /* OMR_GC_DEFERRED_HASHCODE_INSERTION */
+	_regionParallel = _extensions->regionParallelCompact;
+#endif /* OMR_GC_DEFERRED_HASHCODE_INSERTION */
 	_delegate.mainSetupForGC(env);
 }
 
@@ -566,42 +577,49 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no worker GC threads
-	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())) {
-		singleThreaded = true;
-	}
-
-	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
-	env->_compactStats._setupEndTime = omrtime_hires_clock();
+	if (_regionParallel) {
+		/* Regions are always slid completely, so there is no need to fall back to a single
+		 * sub area per segment for aggressive compactions.
+		 */
+		compactByRegion(env, objectCount, byteCount, fixupObjectsCount);
+	} else {
+		/* We force a single sub area compaction if:
+		 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+		 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+		 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+		 *  o no worker GC threads
+		 */
+		if (aggressive || (1 == env->_currentTask->getThreadCount())) {
+			singleThreaded = true;
+		}
 
-	/* If a single threaded compaction force compact to run on main thread. Required
-	 * to ensure all events issued on main thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
-		env->_compactStats._moveEndTime = omrtime_hires_clock();
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		workerSetupForGC(env, singleThreaded);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+		/* If a single threaded compaction force compact to run on main thread. Required
+		 * to ensure all events issued on main thread.
+		 */
+		if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
-		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+			fixupObjects(env, fixupObjectsCount);
 
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
 
-		if (singleThreaded) {
-			env->_currentTask->releaseSynchronizedGCThreads(env);
+			if (singleThreaded) {
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
 		}
 	}
 
@@ -612,8 +630,13 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 
 	MM_AtomicOperations::sync();
 
+	env->_compactStats._rebuildStartTime = omrtime_hires_clock();
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_regionParallel) {
+			rebuildFreelistByRegion(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -627,9 +650,14 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_regionParallel) {
+			rebuildMarkbitsByRegion(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
+	env->_compactStats._rebuildEndTime = omrtime_hires_clock();
 
 	_delegate.workerCleanupAfterGC(env);
 
@@ -1470,6 +1498,13 @@ MM_CompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 {
+	if (_regionParallel) {
+		/* Every region was slid completely and the space above the compacted objects
+		 * of each heap region was rebuilt as free list entries, so the heap is walkable.
+		 */
+		return;
+	}
+
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
 	MM_HeapRegionDescriptorStandard *region = NULL;
@@ -1508,11 +1543,17 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 
 bool
 MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction)
+{
+	return changeAction(&entry->currentAction, newAction);
+}
+
+bool
+MM_CompactScheme::changeAction(volatile uintptr_t *currentAction, uintptr_t newAction)
 {
 	bool successful = false;
-	uintptr_t previousAction = entry->currentAction;
+	uintptr_t previousAction = *currentAction;
 	if (previousAction != newAction ) {
-		uintptr_t action = MM_AtomicOperations::lockCompareExchange(&entry->currentAction, previousAction, newAction);
+		uintptr_t action = MM_AtomicOperations::lockCompareExchange(currentAction, previousAction, newAction);
 		if (action == previousAction) {
 			successful = true;
 		} else {
@@ -1524,4 +1565,333 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+
+void
+MM_CompactScheme::compactByRegion(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	env->_compactStats._setupStartTime = omrtime_hires_clock();
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		createCompactRegionTable(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+	env->_compactStats._setupEndTime = omrtime_hires_clock();
+
+	CompactRegionEntry *regionTable = _compactRegionTable;
+
+	/* Forwarding: summarize every region in parallel, then a single thread turns the live bytes into destinations */
+	env->_compactStats._forwardStartTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if ((CompactRegionEntry::end_segment != regionTable[i].state) && changeAction(&regionTable[i].currentAction, CompactRegionEntry::summarizing)) {
+			summarizeRegion(env, &regionTable[i]);
+		}
+	}
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		computeRegionDestinations();
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+	env->_compactStats._forwardEndTime = omrtime_hires_clock();
+
+	/* Regions must be claimed in address order, see waitForRegionDestination() */
+	env->_compactStats._moveStartTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if ((CompactRegionEntry::end_segment != regionTable[i].state) && changeAction(&regionTable[i].currentAction, CompactRegionEntry::sliding)) {
+			slideRegion(env, i, objectCount, byteCount);
+		}
+	}
+	env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	MM_AtomicOperations::sync();
+
+	/* The live objects of a region now lie, contiguous, at its destination */
+	env->_compactStats._fixupStartTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if ((CompactRegionEntry::end_segment != regionTable[i].state) && changeAction(&regionTable[i].currentAction, CompactRegionEntry::fixing_up)) {
+			if (0 != regionTable[i].liveBytes) {
+				omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)regionTable[i].destination + regionTable[i].liveBytes);
+				fixupSubArea(env, regionTable[i].destination, destinationTop, false, fixupObjectCount);
+			}
+		}
+	}
+	env->_compactStats._fixupEndTime = omrtime_hires_clock();
+}
+
+void
+MM_CompactScheme::createCompactRegionTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t maxEntries = _subAreaTableSize / sizeof(_compactRegionTable[0]);
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	MM_HeapRegionDescriptorStandard *heapRegion = NULL;
+	uintptr_t heapRegionCount = 0;
+	while (NULL != (heapRegion = regionCounter.nextRegion())) {
+		if (heapRegion->isCommitted() && (0 != heapRegion->getSize())) {
+			heapRegionCount += 1;
+		}
+	}
+
+	/* Every heap region needs an end_segment entry and may end with a partial region, plus one end_heap entry.
+	 * Grow the regions if the backing store cannot describe the heap at the desired size.
+	 */
+	uintptr_t reservedEntries = (2 * heapRegionCount) + 1;
+	Assert_MM_true(maxEntries >= reservedEntries);
+	uintptr_t regionSize = _heap->getMaximumPhysicalRange();
+	if (maxEntries > reservedEntries) {
+		uintptr_t minRegionSize = (regionSize / (maxEntries - reservedEntries)) + 1;
+		regionSize = OMR_MAX(_extensions->regionParallelCompactRegionSize, minRegionSize);
+	}
+	regionSize = MM_Math::roundToCeiling(sizeof_page, regionSize);
+
+	CompactRegionEntry *regionTable = _compactRegionTable;
+	uintptr_t i = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (heapRegion = regionIterator.nextRegion())) {
+		if (!heapRegion->isCommitted() || (0 == heapRegion->getSize())) {
+			continue;
+		}
+		uintptr_t lowAddress = (uintptr_t)heapRegion->getLowAddress();
+		uintptr_t highAddress = (uintptr_t)heapRegion->getHighAddress();
+		/* Regions must not share compact table entries */
+		Assert_MM_true(0 == pageOffset((omrobjectptr_t)lowAddress));
+
+		for (uintptr_t regionLow = lowAddress; regionLow < highAddress; regionLow += regionSize) {
+			regionTable[i].low = (omrobjectptr_t)regionLow;
+			regionTable[i].high = (omrobjectptr_t)(((highAddress - regionLow) > regionSize) ? (regionLow + regionSize) : highAddress);
+			regionTable[i].firstObject = NULL;
+			regionTable[i].sourceTop = NULL;
+			regionTable[i].destination = NULL;
+			regionTable[i].liveBytes = 0;
+			regionTable[i].state = CompactRegionEntry::pending;
+			regionTable[i++].currentAction = CompactRegionEntry::none;
+		}
+		regionTable[i].low = (omrobjectptr_t)highAddress;
+		regionTable[i].high = (omrobjectptr_t)highAddress;
+		regionTable[i].firstObject = NULL;
+		regionTable[i].sourceTop = NULL;
+		regionTable[i].destination = NULL;
+		regionTable[i].liveBytes = 0;
+		regionTable[i].state = CompactRegionEntry::end_segment;
+		regionTable[i++].currentAction = CompactRegionEntry::none;
+
+		/* Reset the memory pools in preparation for the rebuild of the free list at the end of compaction */
+		heapRegion->getSubSpace()->getMemoryPool()->reset(MM_MemoryPool::forCompact);
+	}
+	regionTable[i].state = CompactRegionEntry::end_heap;
+	Assert_MM_true(i < maxEntries);
+
+	_compactFrom = (omrobjectptr_t)_heap->getHeapBase();
+	_compactTo = (omrobjectptr_t)_heap->getHeapTop();
+}
+
+void
+MM_CompactScheme::summarizeRegion(MM_EnvironmentStandard *env, CompactRegionEntry *region)
+{
+	/* The mark map only records object starts, so the population count of the region's
+	 * mark map slots is the number of live objects in it.
+	 */
+	uintptr_t *slot = _markMap->getSlotPtrForAddress(region->low);
+	uintptr_t *slotTop = _markMap->getSlotPtrForAddress(region->high);
+	uintptr_t liveObjects = 0;
+	while (slot < slotTop) {
+		liveObjects += MM_Bits::populationCount(*slot);
+		slot += 1;
+	}
+
+	if (0 != liveObjects) {
+		uintptr_t liveBytes = 0;
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)region->low, (uintptr_t *)region->high);
+		omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
+		region->firstObject = objectPtr;
+		while (NULL != objectPtr) {
+			uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+			liveBytes += objectSize;
+			region->sourceTop = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+			objectPtr = markedObjectIterator.nextObject();
+		}
+		region->liveBytes = liveBytes;
+	}
+}
+
+void
+MM_CompactScheme::computeRegionDestinations()
+{
+	CompactRegionEntry *regionTable = _compactRegionTable;
+	omrobjectptr_t compactTop = NULL;
+
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if (NULL == compactTop) {
+			/* first region of a heap region, objects never slide across heap regions */
+			compactTop = regionTable[i].low;
+		}
+		regionTable[i].destination = compactTop;
+		if (CompactRegionEntry::end_segment == regionTable[i].state) {
+			compactTop = NULL;
+		} else {
+			compactTop = (omrobjectptr_t)((uintptr_t)compactTop + regionTable[i].liveBytes);
+		}
+	}
+}
+
+void
+MM_CompactScheme::slideRegion(MM_EnvironmentStandard *env, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	CompactRegionEntry *region = &_compactRegionTable[i];
+
+	if (NULL != region->firstObject) {
+		waitForRegionDestination(env, i);
+
+		/* Objects only slide down, and the objects of the region are visited in address order, so an
+		 * object is never overwritten before it is moved. The compact table entry of a page is only
+		 * stored once the iterator has moved past the page's mark bits.
+		 */
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)region->firstObject, (uintptr_t *)region->high);
+		omrobjectptr_t deadObject = region->destination;
+		omrobjectptr_t objectPtr = NULL;
+		intptr_t page = -1; /* invalid value */
+		intptr_t counter = 0; /* obj on page, first is zero */
+		CompactTableEntry entry;
+		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+			uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+			/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+			saveForwardingPtr(entry, objectPtr, deadObject, page, counter);
+
+			if (deadObject != objectPtr) {
+				preObjectMove(env, objectPtr);
+				memmove(deadObject, objectPtr, objectSize);
+				postObjectMove(env, deadObject);
+				objectCount += 1;
+				byteCount += objectSize;
+			}
+			deadObject = (omrobjectptr_t)((uintptr_t)deadObject + objectSize);
+		}
+
+		if (page != -1) {
+			_compactTable[page] = entry;
+		}
+		Assert_MM_true(deadObject == (omrobjectptr_t)((uintptr_t)region->destination + region->liveBytes));
+	}
+
+	/* publish the moved objects before the regions waiting on this one overwrite its source */
+	MM_AtomicOperations::storeSync();
+	region->state = CompactRegionEntry::evacuated;
+}
+
+void
+MM_CompactScheme::waitForRegionDestination(MM_EnvironmentStandard *env, intptr_t i)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	CompactRegionEntry *regionTable = _compactRegionTable;
+	omrobjectptr_t destination = regionTable[i].destination;
+	omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)destination + regionTable[i].liveBytes);
+	uint64_t stallStartTime = 0;
+
+	for (intptr_t j = i - 1; j >= 0; j--) {
+		CompactRegionEntry *region = &regionTable[j];
+		if (CompactRegionEntry::end_segment == region->state) {
+			/* the destination lies within the same heap region */
+			break;
+		}
+		if (NULL == region->firstObject) {
+			continue;
+		}
+		if (region->sourceTop <= destination) {
+			/* live objects of lower regions end below this one */
+			break;
+		}
+		if (region->firstObject >= destinationTop) {
+			continue;
+		}
+
+		uintptr_t spinCount = 0;
+		while (CompactRegionEntry::evacuated != region->state) {
+			if (0 == stallStartTime) {
+				stallStartTime = omrtime_hires_clock();
+			}
+			spinCount += 1;
+			if (0 == (spinCount % COMPACT_REGION_WAIT_YIELD_SPINS)) {
+				omrthread_yield();
+			} else {
+				MM_AtomicOperations::yieldCPU();
+			}
+		}
+	}
+	MM_AtomicOperations::loadSync();
+
+	if (0 != stallStartTime) {
+		env->_compactStats._moveStallTime += omrtime_hires_clock() - stallStartTime;
+	}
+}
+
+void
+MM_CompactScheme::rebuildFreelistByRegion(MM_EnvironmentStandard *env)
+{
+	CompactRegionEntry *regionTable = _compactRegionTable;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t i = 0;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		/* The end_segment entry of a heap region records where its compacted objects end */
+		while (CompactRegionEntry::end_segment != regionTable[i].state) {
+			i += 1;
+		}
+		Assert_MM_true(region->getHighAddress() == (void *)regionTable[i].high);
+		void *currentFreeBase = (void *)regionTable[i].destination;
+		uintptr_t currentFreeSize = (uintptr_t)region->getHighAddress() - (uintptr_t)currentFreeBase;
+		i += 1;
+
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		MM_CompactMemoryPoolState poolStateObj;
+		MM_CompactMemoryPoolState *poolState = &poolStateObj;
+		poolState->_memoryPool = memorySubSpace->getMemoryPool(region->getLowAddress());
+
+		if (0 != currentFreeSize) {
+#if defined(DEBUG_PAINT_FREE)
+			memset(currentFreeBase, 0xBB, currentFreeSize);
+#endif /* DEBUG_PAINT_FREE */
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+		}
+
+		if (NULL != poolState->_freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+													(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+		}
+		flushPool(env, poolState);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsByRegion(MM_EnvironmentStandard *env)
+{
+	CompactRegionEntry *regionTable = _compactRegionTable;
+
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if ((CompactRegionEntry::end_segment != regionTable[i].state) && changeAction(&regionTable[i].currentAction, CompactRegionEntry::clearing_mark_bits)) {
+			_markMap->setBitsInRange(env, regionTable[i].low, regionTable[i].high, true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* The destinations of neighbouring regions may share a mark map slot */
+	for (uintptr_t i = 0; CompactRegionEntry::end_heap != regionTable[i].state; i++) {
+		if ((CompactRegionEntry::end_segment != regionTable[i].state) && changeAction(&regionTable[i].currentAction, CompactRegionEntry::rebuilding_mark_bits)) {
+			if (0 != regionTable[i].liveBytes) {
+				omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)regionTable[i].destination + regionTable[i].liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, regionTable[i].destination, destinationTop, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
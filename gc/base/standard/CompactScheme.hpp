@@ -122,6 +122,43 @@ private:
 		};
 	};
 
+	/* A fixed-size slice of a heap region, used by region parallel compaction.
+	 * As usual, region addresses are up to, but not including, high.
+	 */
+	struct CompactRegionEntry {
+		omrobjectptr_t low;
+		omrobjectptr_t high;
+		omrobjectptr_t firstObject; /**< the first live object starting in the region, or NULL if there is none */
+		omrobjectptr_t sourceTop; /**< end of the last live object starting in the region, which may lie beyond high */
+		omrobjectptr_t destination; /**< new address of firstObject, or the compacted top of the heap region for an end_segment entry */
+		uintptr_t liveBytes;
+		volatile uintptr_t state;
+		volatile uintptr_t currentAction; /**< record the status of the region for parallelization */
+
+		/* legal values for currentAction */
+		enum {
+			none = 0,
+			summarizing,
+			sliding,
+			fixing_up,
+			clearing_mark_bits,
+			rebuilding_mark_bits
+		};
+
+		/* legal values for state
+		 * A region is pending until all of its live objects have been slid to
+		 * their destination, and evacuated afterwards. The end_segment entry at the
+		 * end of each heap region and the end_heap entry are set once by
+		 * createCompactRegionTable.
+		 */
+		enum State {
+			pending = 0,
+			evacuated,
+			end_segment,
+			end_heap
+		};
+	};
+
 protected:
 	OMR_VM                 *_omrVM;
 	MM_GCExtensionsBase    *_extensions;
@@ -138,6 +175,8 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	bool                   _regionParallel; /**< true if the current compaction slides fixed-size regions rather than evacuating sub areas */
+	CompactRegionEntry     *_compactRegionTable; /**< region parallel compaction's view of the shared SweepHeapSectioning backing store */
 
 public:
 
@@ -302,6 +341,73 @@ protected:
 	 * @return true if the action was changed, or false if another thread already changed it to newAction
 	 */
 	bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+	/**
+	 * Atomically change the currentAction value of a sub area or region to the specified action.
+	 * @see changeSubAreaAction
+	 */
+	bool changeAction(volatile uintptr_t *currentAction, uintptr_t newAction);
+
+	/**
+	 * Region parallel compaction, Compressor/LISP2 style: summarize the live data of every
+	 * region, compute each region's destination with a prefix sum of the live bytes of the
+	 * regions below it, then slide all regions in parallel, each one waiting only for the
+	 * regions it slides into to be vacated, and finally fix up the moved objects.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 * @param[in/out] fixupObjectCount the number of objects fixed up (accumulated)
+	 */
+	void compactByRegion(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount);
+
+	/**
+	 * Divide every committed heap region into fixed-size regions, terminating the regions of each
+	 * heap region with an end_segment entry and the table with an end_heap entry.
+	 * Must be called by a single thread.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void createCompactRegionTable(MM_EnvironmentStandard *env);
+
+	/**
+	 * Count the objects in a region with a population count over its mark map slots, and for
+	 * regions which have any, record the live bytes and the extent of the live objects.
+	 *
+	 * @param env[in] the current thread
+	 * @param region[in] the region to summarize
+	 */
+	void summarizeRegion(MM_EnvironmentStandard *env, CompactRegionEntry *region);
+
+	/**
+	 * Assign every region its destination, the exclusive prefix sum of the live bytes
+	 * of the regions below it in the same heap region. Must be called by a single thread.
+	 */
+	void computeRegionDestinations();
+
+	/**
+	 * Slide the live objects of a region down to its destination, recording their forwarding
+	 * addresses in the compact table, once the regions overlapping the destination are evacuated.
+	 *
+	 * @param env[in] the current thread
+	 * @param i[in] the index of the region in the compact region table
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideRegion(MM_EnvironmentStandard *env, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Wait until every region whose live objects overlap the destination range of the specified
+	 * region has been evacuated. Regions are claimed in address order and only ever slide down,
+	 * so the regions waited for have always been claimed by a running thread already.
+	 *
+	 * @param env[in] the current thread
+	 * @param i[in] the index of the region in the compact region table
+	 */
+	void waitForRegionDestination(MM_EnvironmentStandard *env, intptr_t i);
+
+	void rebuildFreelistByRegion(MM_EnvironmentStandard *env);
+	void rebuildMarkbitsByRegion(MM_EnvironmentStandard *env);
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
@@ -336,6 +442,8 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _regionParallel(false)
+		, _compactRegionTable(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
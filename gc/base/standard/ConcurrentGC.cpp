@@ -1045,7 +1045,9 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 	uintptr_t sizeTraced = 0;
 	uintptr_t totalScanned = 0;
 	uintptr_t sizeToTrace = 0;
+	uint64_t idleDebt = 0;
 	MM_SpinLimiter spinLimiter(env);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	/* Thread not a mutator so identify its type */
 	env->initializeGCThread();
@@ -1083,12 +1085,14 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 		while ((CONCURRENT_HELPER_MARK == request)
 				&& _markingScheme->getWorkPackets()->inputPacketAvailable(env)
 				&& spinLimiter.spin()) {
+			uint64_t sliceStartTime = omrtime_hires_clock();
 			sizeTraced = localMark(env, sizeToTrace);
 			if (sizeTraced > 0 ) {
 				_stats.incConHelperTraceSizeCount(sizeTraced);
 				totalScanned += sizeTraced;
 				spinLimiter.reset();
 			}
+			paceConHelper(env, sliceStartTime, &idleDebt);
 			request = getConHelperRequest(env);
 		}
 
@@ -1100,6 +1104,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 				&& _cardTable->isCardCleaningStarted()
 				&& !_cardTable->isCardCleaningComplete()
 				&& spinLimiter.spin()) {
+			uint64_t sliceStartTime = omrtime_hires_clock();
 			if (cleanCards(env, false, _conHelperCleanSize, &sizeTraced, false)) {
 				if (sizeTraced > 0 ) {
 					_stats.incConHelperCardCleanCount(sizeTraced);
@@ -1107,6 +1112,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 					spinLimiter.reset();
 				}
 			}
+			paceConHelper(env, sliceStartTime, &idleDebt);
 			request = getConHelperRequest(env);
 		}
 
@@ -1131,6 +1137,46 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 	shutdownAndExitConHelperThread(omrThread);
 }
 
+/**
+ * Account for a slice of concurrent helper work.
+ * The time spent on the slice is added to the background mark time. If pacing, the
+ * idle time owed to honour the helper CPU budget is accumulated in idleDebt and once at
+ * least a millisecond is owed the helper releases VM access and waits it out. The wait is
+ * cut short if the completion deadline becomes at risk or the helpers are asked to stop.
+ *
+ * @param sliceStartTime the time, in hi-res ticks, the slice of work started
+ * @param idleDebt[in/out] idle time, in hi-res ticks, owed by this helper
+ */
+void
+MM_ConcurrentGC::paceConHelper(MM_EnvironmentBase *env, uint64_t sliceStartTime, uint64_t *idleDebt)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t sliceTime = omrtime_hires_clock() - sliceStartTime;
+
+	_stats.incBackgroundMarkTime(sliceTime);
+
+	if (_extensions->concurrentPacing) {
+		if (_pacingDeadlineAtRisk) {
+			/* Mark flat out until the helpers are back on schedule */
+			*idleDebt = 0;
+		} else {
+			uint64_t budget = (uint64_t)_extensions->concurrentPacingCPUBudget;
+			*idleDebt += (sliceTime * (100 - budget)) / budget;
+			uint64_t idleMillis = omrtime_hires_delta(0, *idleDebt, OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+			if (idleMillis > 0) {
+				*idleDebt = 0;
+				env->releaseVMAccess();
+				omrthread_monitor_enter(_conHelpersActivationMonitor);
+				if ((CONCURRENT_HELPER_MARK == _conHelpersRequest) && !_pacingDeadlineAtRisk) {
+					omrthread_monitor_wait_timed(_conHelpersActivationMonitor, (int64_t)idleMillis, 0);
+				}
+				omrthread_monitor_exit(_conHelpersActivationMonitor);
+				env->acquireVMAccess();
+			}
+		}
+	}
+}
+
 /**
  * Shutdown and exit a concurrent helper
  * Detach a concurrent helper. Notify _conHelpersActivationMonitor if this is
@@ -1197,9 +1243,10 @@ MM_ConcurrentGC::initializeConcurrentHelpers(MM_GCExtensionsBase *extensions)
 		conHelperThreadInfo.threadID = conHelperThreadCount;
 		conHelperThreadInfo.collector = this;
 
+		/* Paced helpers are held to their CPU budget explicitly so need not defer to application threads */
 		threadForkResult = createThreadWithCategory(&(_conHelpersTable[conHelperThreadCount]),
 							OMR_OS_STACK_SIZE,
-							J9THREAD_PRIORITY_MIN,
+							extensions->concurrentPacing ? J9THREAD_PRIORITY_NORMAL : J9THREAD_PRIORITY_MIN,
 							0,
 							con_helper_thread_proc,
 							(void *)&conHelperThreadInfo,
@@ -1483,6 +1530,7 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 
 	_alloc2ConHelperTraceRate = 0;
 	_lastConHelperTraceSizeCount = 0;
+	_pacingDeadlineAtRisk = true;
 	_lastAverageAlloc2TraceRate = 0;
 	_maxAverageAlloc2TraceRate = 0;
     _lastFreeSize = LAST_FREE_SIZE_NEEDS_INITIALIZING;
@@ -1630,8 +1678,22 @@ MM_ConcurrentGC::updateTuningStatistics(MM_EnvironmentBase *env)
 			break;
 		}
 
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+		/* Learn how quickly a single helper marks so the next cycle can predict when paced helpers will complete */
+		if (_extensions->concurrentPacing) {
+			uint64_t backgroundMarkMillis = omrtime_hires_delta(0, _stats.getBackgroundMarkTime(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+			if (backgroundMarkMillis > 0) {
+				float newConHelperMarkRate = (float)_stats.getConHelperTraced() / (float)backgroundMarkMillis;
+				if (0 == _pacingConHelperMarkRate) {
+					_pacingConHelperMarkRate = newConHelperMarkRate;
+				} else {
+					_pacingConHelperMarkRate = MM_Math::weightedAverage(_pacingConHelperMarkRate, newConHelperMarkRate, CONCURRENT_PACING_HISTORY_WEIGHT);
+				}
+			}
+		}
+
 		if (_extensions->debugConcurrentMark) {
-			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 			char pass1Factor[10];
 			char pass2Factor[10];
@@ -1656,6 +1718,13 @@ MM_ConcurrentGC::updateTuningStatistics(MM_EnvironmentBase *env)
 							pass1Factor, pass2Factor);
 			omrtty_printf("                          Bytes traced in Pass 1 Factor=\"%.3f\"\n",
 							_bytesTracedInPass1Factor);
+			omrtty_printf("                          Mutator tax time=\"%llu\"us Background mark time=\"%llu\"us\n",
+							omrtime_hires_delta(0, _stats.getMutatorTaxTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+							omrtime_hires_delta(0, _stats.getBackgroundMarkTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+			if (_extensions->concurrentPacing) {
+				omrtty_printf("                          Pacing: Helper mark rate=\"%.1f\" Allocation rate=\"%.1f\" (bytes/ms)\n",
+								_pacingConHelperMarkRate, _pacingAllocationRate);
+			}
 		}
 	}
 }
@@ -1759,9 +1828,11 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 			}
 		} 
 		
-		/* Provided background thread is not already doing enough tracing ....*/
-		if (thisTraceRate > _alloc2ConHelperTraceRate) {
-			/* ..calculate tax for mutator taking into account any tracing being done by concurrent helpers */
+		if (_extensions->concurrentPacing && !_pacingDeadlineAtRisk) {
+			/* Paced background helpers are predicted to complete in time so mutator pays no tax */
+			sizeToTrace = 0;
+		} else if (thisTraceRate > _alloc2ConHelperTraceRate) {
+			/* Background thread is not doing enough tracing so calculate tax for mutator taking into account any tracing being done by concurrent helpers */
 			sizeToTrace = (uintptr_t)(allocationSize * (thisTraceRate - _alloc2ConHelperTraceRate));
 		} else {
 			/* Background thread is doing enough tracing on its own so mutator gets away without paying any tax */
@@ -1921,6 +1992,7 @@ MM_ConcurrentGC::potentialFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescript
 void
 MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	float newConHelperRate;
 
 	/* Single thread this code; ensure update for earlier interval completes
@@ -1940,6 +2012,10 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
             _tuningUpdateInterval = _minTraceSize;
         }
 
+		if (_extensions->concurrentPacing) {
+			_pacingLastTuningTime = omrtime_hires_clock();
+			updatePacingDeadline(env, freeSize);
+		}
     } else if ( (_lastFreeSize > freeSize) && (_lastFreeSize - freeSize) >= _tuningUpdateInterval) {
         /* This thread first to update for this interval so calculate
          * total traced so far
@@ -1966,6 +2042,20 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 			_maxAverageAlloc2TraceRate =  _lastAverageAlloc2TraceRate;
 		}
 
+		if (_extensions->concurrentPacing) {
+			/* Allocation rate is kept across cycles; it seeds the deadline prediction at the start of the next one */
+			uint64_t now = omrtime_hires_clock();
+			uint64_t intervalMicros = OMR_MAX(omrtime_hires_delta(_pacingLastTuningTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+			float newAllocationRate = ((float)freeSpaceUsed * 1000) / (float)intervalMicros;
+			if (0 == _pacingAllocationRate) {
+				_pacingAllocationRate = newAllocationRate;
+			} else {
+				_pacingAllocationRate = MM_Math::weightedAverage(_pacingAllocationRate, newAllocationRate, CONCURRENT_PACING_HISTORY_WEIGHT);
+			}
+			_pacingLastTuningTime = now;
+			updatePacingDeadline(env, freeSize);
+		}
+
 		/* Set for next interval */
 		_lastFreeSize = freeSize;
 	}
@@ -1973,6 +2063,42 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 	omrthread_monitor_exit(_concurrentTuningMonitor);
 }
 
+/**
+ * Decide whether paced concurrent helpers are at risk of missing the completion deadline.
+ * The deadline is the point at which the remaining taxable free space is consumed at the
+ * current allocation rate. Helpers are predicted to complete the remaining trace target at
+ * their historical mark rate scaled by the CPU budget. If there is no history yet, or the
+ * prediction does not beat the deadline by a safety margin, mutators are taxed as normal.
+ * Called with _concurrentTuningMonitor held.
+ *
+ * @param freeSize The current amount of free space in the old area
+ */
+void
+MM_ConcurrentGC::updatePacingDeadline(MM_EnvironmentBase *env, uintptr_t freeSize)
+{
+	bool atRisk = true;
+	uintptr_t remainingFree = MM_Math::saturatingSubtract(freeSize, _kickoffThresholdBuffer);
+	uintptr_t workCompleteSoFar = _stats.getTotalTraced();
+	uintptr_t traceTarget = _pass2Started ? _traceTargetPass1 + _traceTargetPass2 : _traceTargetPass1;
+	float helpersMarkRate = _pacingConHelperMarkRate * (float)_conHelpersStarted * ((float)_extensions->concurrentPacingCPUBudget / 100);
+
+	if ((remainingFree > 0) && (workCompleteSoFar < traceTarget) && (helpersMarkRate > 0) && (_pacingAllocationRate > 0)) {
+		float millisToDeadline = (float)remainingFree / _pacingAllocationRate;
+		float millisToComplete = (float)(traceTarget - workCompleteSoFar) / helpersMarkRate;
+		atRisk = ((millisToComplete * CONCURRENT_PACING_DEADLINE_MARGIN) > millisToDeadline);
+	}
+
+	if (atRisk && !_pacingDeadlineAtRisk) {
+		/* Wake any helpers idling to honour their CPU budget */
+		omrthread_monitor_enter(_conHelpersActivationMonitor);
+		_pacingDeadlineAtRisk = true;
+		omrthread_monitor_notify_all(_conHelpersActivationMonitor);
+		omrthread_monitor_exit(_conHelpersActivationMonitor);
+	} else {
+		_pacingDeadlineAtRisk = atRisk;
+	}
+}
+
 /**
  * Start card cleaning.
  * Either free space has reached the card cleaning kickoff level or we have run out
@@ -2058,6 +2184,7 @@ MM_ConcurrentGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 void
 MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_AllocateDescription *allocDescription)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_MARK_TRACE);
 
 	/* Get required information from Alloc description */
@@ -2104,8 +2231,11 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 		case CONCURRENT_TRACE_ONLY:
 		case CONCURRENT_CLEAN_TRACE:
 			sizeToTrace = calculateTraceSize(env, allocDescription);
-			if (sizeToTrace > 0) {
+			/* When pacing an untaxed mutator must still drive periodical tuning and mode transitions */
+			if ((sizeToTrace > 0) || _extensions->concurrentPacing) {
+				uint64_t taxStartTime = omrtime_hires_clock();
 				sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
+				_stats.incMutatorTaxTime(omrtime_hires_clock() - taxStartTime);
 			}
 
 			taxPaid = true;
@@ -121,6 +121,9 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define LAST_FREE_SIZE_NEEDS_INITIALIZING ((uintptr_t)-1)
 #define ALL_BYTES_TRACED_IN_PASS_1 ((float)1.0)
 
+#define CONCURRENT_PACING_HISTORY_WEIGHT ((float)0.6)
+#define CONCURRENT_PACING_DEADLINE_MARGIN ((float)1.25)
+
 /**
  * @}
  */
@@ -241,6 +244,12 @@ private:
 	uintptr_t _lastConHelperTraceSizeCount;
 	float _alloc2ConHelperTraceRate;
 
+	/* Pacing statistics; only maintained if concurrentPacing is enabled */
+	float _pacingConHelperMarkRate; /**< bytes traced per millisecond of background mark time by a single helper */
+	float _pacingAllocationRate; /**< bytes of free space consumed per millisecond whilst concurrent is active */
+	uint64_t _pacingLastTuningTime; /**< time of the last periodical tuning, in hi-res ticks */
+	volatile bool _pacingDeadlineAtRisk; /**< set if paced helpers alone are predicted to miss the completion deadline */
+
 	/* Concurrent card cleaning statistics */
 	float _cardCleaningFactorPass1;
 	float _cardCleaningFactorPass2;
@@ -300,6 +309,8 @@ private:
 	bool periodicalTuningNeeded(MM_EnvironmentBase *env, uintptr_t freeSize);
 	void periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize);
 	void kickoffCardCleaning(MM_EnvironmentBase *env, ConcurrentCardCleaningReason reason);
+	void updatePacingDeadline(MM_EnvironmentBase *env, uintptr_t freeSize);
+	void paceConHelper(MM_EnvironmentBase *env, uint64_t sliceStartTime, uint64_t *idleDebt);
 	
 	void adjustTraceTarget();
 	void updateTuningStatistics(MM_EnvironmentBase *env);
@@ -508,6 +519,10 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_pacingConHelperMarkRate(0)
+		,_pacingAllocationRate(0)
+		,_pacingLastTuningTime(0)
+		,_pacingDeadlineAtRisk(true)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
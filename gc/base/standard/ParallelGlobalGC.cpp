@@ -439,11 +439,23 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	uintptr_t regionSize = _extensions->regionSize;
 	Assert_MM_true((0 != regionSize) && (0 == (heapBase % regionSize)));
 
+	/* Split free list contention was merged into the tenure allocation profile before this GC, and the pool
+	 * reset below clears it; carry it over into the sweep stats for reporting */
+	MM_SweepStats freeListContention;
+	if (_extensions->processLargeAllocateStats) {
+		MM_LargeObjectAllocateStats *allocateStats = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool()->getLargeObjectAllocateStats();
+		freeListContention.freeListContendedCount = allocateStats->getFreeListContendedCount();
+		freeListContention.freeListStealCount = allocateStats->getFreeListStealCount();
+		freeListContention.freeListRebalanceCount = allocateStats->getFreeListRebalanceCount();
+		freeListContention.freeListRebalanceBytes = allocateStats->getFreeListRebalanceBytes();
+	}
+
 	/* Reset memory pools of associated memory spaces */
 	_extensions->heap->resetSpacesForGarbageCollect(env);
 	
 	/* Clear the gc stats structure */
 	_extensions->globalGCStats.clear();
+	_extensions->globalGCStats.sweepStats.merge(&freeListContention);
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	_compactThisCycle = false;
@@ -722,7 +734,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -47,6 +47,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapSpan.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapSpan::findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -518,11 +512,25 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
+			/* The map slot starts a run of slots holding live objects - step over the whole run at once,
+			 * sampling the slots which the dark matter sample rate falls on.
+			 */
+			uintptr_t liveSlotCount = MM_HeapMapSpan::findEmptySlot(markMapCurrent + 1, markMapChunkTop) - markMapCurrent;
+			uintptr_t sampleIndex = darkMatterSampleRate - (darkMatterCandidates % darkMatterSampleRate);
+			while (sampleIndex <= liveSlotCount) {
+				uintptr_t sampleOffset = sampleIndex - 1;
+				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleOffset, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleOffset));
 				darkMatterSamples += 1;
+				if ((liveSlotCount - sampleIndex) < darkMatterSampleRate) {
+					break;
+				}
+				sampleIndex += darkMatterSampleRate;
 			}
+			darkMatterCandidates += liveSlotCount;
+
+			/* Leave the cursors on the last slot of the run */
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * (liveSlotCount - 1);
+			markMapCurrent += liveSlotCount - 1;
 		} else {
 			/* There is at least a single free slot in the mark map - check the head and tail */
 			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
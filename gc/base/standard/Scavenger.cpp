@@ -105,6 +105,22 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+class MM_Scavenger::ScanCacheWorkCheck
+{
+private:
+	MM_Scavenger *_scavenger;
+	MM_EnvironmentStandard *_env;
+
+public:
+	/* an aborting thread must stop waiting too, so that it can back out */
+	bool operator()() { return _scavenger->shouldAbortScanLoop(_env) || _scavenger->isScanCacheWorkAvailable(); }
+
+	ScanCacheWorkCheck(MM_Scavenger *scavenger, MM_EnvironmentStandard *env)
+		: _scavenger(scavenger)
+		, _env(env)
+	{}
+};
+
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
@@ -224,6 +240,11 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	/* initialize the global scavenger gcCount */
 	_extensions->scavengerStats._gcCount = 0;
 
+	/* the prefetch pipeline's ring of pending slots is a fixed size stack array */
+	if (SCAVENGER_PREFETCH_DISTANCE_MAX < _extensions->scavengerPrefetchDistance) {
+		_extensions->scavengerPrefetchDistance = SCAVENGER_PREFETCH_DISTANCE_MAX;
+	}
+
 	if (!_scavengeCacheFreeList.initialize(env, NULL)) {
 		return false;
 	}
@@ -284,6 +305,25 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	/* Work stealing relies on every scan cache being pushed by the GC thread that owns the deque, which does not hold
+	 * for Concurrent Scavenger (mutators and background threads flush each other's caches), so it is limited to STW Scavenger.
+	 */
+	if (_extensions->scavengerWorkStealing && !_extensions->isConcurrentScavengerEnabled()) {
+		uintptr_t dequeCount = _extensions->gcThreadCount;
+		_scanCacheDeques = (MM_WorkStealingDeque<MM_CopyScanCacheStandard> *)_extensions->getForge()->allocate(sizeof(MM_WorkStealingDeque<MM_CopyScanCacheStandard>) * dequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new (&_scanCacheDeques[i]) MM_WorkStealingDeque<MM_CopyScanCacheStandard>();
+			/* _scanCacheDequeCount tracks how many deques tearDown() has to release */
+			_scanCacheDequeCount = i + 1;
+			if (!_scanCacheDeques[i].initialize(_extensions->getForge(), _extensions->scavengerWorkStealingDequeSize, (uint32_t)(i + 1) * 2654435761U, OMR::GC::AllocationCategory::FIXED)) {
+				return false;
+			}
+		}
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
 		if (!_mainGCThread.initialize(this, true, true, true)) {
@@ -307,6 +347,15 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].tearDown(_extensions->getForge());
+		}
+		_extensions->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -781,6 +830,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
+	finalGCStats->_stealAttemptCount += scavStats->_stealAttemptCount;
+	finalGCStats->_stealCount += scavStats->_stealCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
 	finalGCStats->_totalDeepStructures += scavStats->_totalDeepStructures;
@@ -822,6 +873,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_slotsPipelined += scavStats->_slotsPipelined;
+	finalGCStats->_slotsPrefetched += scavStats->_slotsPrefetched;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -1989,13 +2042,62 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t prefetchDistance = _extensions->scavengerPrefetchDistance;
+	if (0 == prefetchDistance) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
+	} else {
+		/* Slots are queued in a ring of prefetchDistance entries and copied in scan order once the ring is full.
+		 * The header of each target in evacuate space is prefetched as its slot is queued, so it has had the time
+		 * taken to copy the prefetchDistance slots ahead of it to arrive in cache. The scanner reuses its slot
+		 * object, so the ring holds slot addresses. */
+		OMR_VM *omrVM = env->getOmrVM();
+		volatile fomrobject_t *pendingSlots[SCAVENGER_PREFETCH_DISTANCE_MAX];
+		uintptr_t pendingHead = 0;
+		uintptr_t pendingCount = 0;
+		uint64_t slotsPrefetched = 0;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			omrobjectptr_t targetPtr = slotObject->readReferenceFromSlot();
+			if ((NULL != targetPtr) && isObjectInEvacuateMemory(targetPtr)) {
+				prefetchObjectHeader(targetPtr);
+				slotsPrefetched += 1;
+			}
+			if (prefetchDistance == pendingCount) {
+				/* ring is full -- copy the oldest slot and reuse its entry as the tail */
+				GC_SlotObject pendingSlot(omrVM, pendingSlots[pendingHead]);
+				bool isSlotObjectInNewSpace = copyAndForward(env, &pendingSlot);
+				shouldRemember |= isSlotObjectInNewSpace;
+				if (NULL != *copyCache) {
+					slotsCopied += 1;
+				}
+				slotsScanned += 1;
+				pendingSlots[pendingHead] = slotObject->readAddressFromSlot();
+				pendingHead = (pendingHead + 1) % prefetchDistance;
+			} else {
+				pendingSlots[(pendingHead + pendingCount) % prefetchDistance] = slotObject->readAddressFromSlot();
+				pendingCount += 1;
+			}
+		}
+		/* drain the slots still queued when the scanner ran out */
+		while (0 < pendingCount) {
+			GC_SlotObject pendingSlot(omrVM, pendingSlots[pendingHead]);
+			bool isSlotObjectInNewSpace = copyAndForward(env, &pendingSlot);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
+			pendingHead = (pendingHead + 1) % prefetchDistance;
+			pendingCount -= 1;
+		}
+		env->_scavengerStats._slotsPipelined += slotsScanned;
+		env->_scavengerStats._slotsPrefetched += slotsPrefetched;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2293,6 +2395,10 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	if (NULL != _scanCacheDeques) {
+		return getNextScanCacheWorkStealing(env, doneIndex);
+	}
+
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
  		while (_cachedEntryCount > 0) {
  			cache = getNextScanCacheFromList(env);
@@ -2362,6 +2468,113 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	return cache;
 }
 
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	uintptr_t stealAttempts = 0;
+	MM_CopyScanCacheStandard *cache = MM_WorkStealingDeque<MM_CopyScanCacheStandard>::stealFromOthers(_scanCacheDeques, _scanCacheDequeCount, getScanCacheDeque(env), &stealAttempts);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_scavengerStats._stealAttemptCount += stealAttempts;
+	if (NULL != cache) {
+		env->_scavengerStats._stealCount += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	return cache;
+}
+
+bool
+MM_Scavenger::isScanCacheWorkAvailable()
+{
+	if (0 != _cachedEntryCount) {
+		return true;
+	}
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		if (!_scanCacheDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::getNextScanCacheWorkStealing(MM_EnvironmentStandard *env, uintptr_t doneIndex)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_WorkStealingDeque<MM_CopyScanCacheStandard> *ownDeque = getScanCacheDeque(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	while (!shouldAbortScanLoop(env)) {
+		if (NULL != ownDeque) {
+			cache = ownDeque->pop();
+			if (NULL != cache) {
+				return cache;
+			}
+		}
+
+		/* deque overflow (and threads without a deque) still go through the shared scan lists */
+		if (0 != _cachedEntryCount) {
+			cache = getNextScanCacheFromList(env);
+			if (NULL != cache) {
+				return cache;
+			}
+		}
+
+		cache = stealScanCache(env);
+		if (NULL != cache) {
+			return cache;
+		}
+
+		/* Offer termination. A thread only offers once its own deque is empty, and nothing but an active thread
+		 * ever pushes work, so once every thread has offered there can be no work left anywhere.
+		 */
+		flushBuffersForGetNextScanCache(env);
+		uintptr_t threadCount = env->_currentTask->getThreadCount();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		ScanCacheWorkCheck scanCacheWorkCheck(this, env);
+		uintptr_t idleYields = 0;
+		MM_WorkStealingTermination::Result result = MM_WorkStealingTermination::offer(
+			&_waitingCount, &_doneIndex, doneIndex, threadCount, scanCacheWorkCheck, &idleYields);
+		if (MM_WorkStealingTermination::LAST_THREAD == result) {
+			flushCopyScanCounts(env, true);
+			uint64_t notifyStartTime = omrtime_hires_clock();
+			MM_AtomicOperations::add(&_doneIndex, 1);
+			env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_scavengerStats.addToCompleteStallTime(waitStartTime, notifyStartTime);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return NULL;
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (MM_WorkStealingTermination::WORK_AVAILABLE == result) {
+			env->_scavengerStats.addToWorkStallTime(waitStartTime, omrtime_hires_clock());
+		} else {
+			env->_scavengerStats.addToCompleteStallTime(waitStartTime, omrtime_hires_clock());
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		if ((MM_WorkStealingTermination::WORK_AVAILABLE != result) || shouldAbortScanLoop(env)) {
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+
+void
+MM_Scavenger::flushScanCacheDeques(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		MM_CopyScanCacheStandard *cache = NULL;
+		bool contended = false;
+		while (NULL != (cache = _scanCacheDeques[i].steal(&contended))) {
+			flushCache(env, cache);
+		}
+		Assert_MM_false(contended);
+		Assert_MM_true(_scanCacheDeques[i].isEmpty());
+	}
+}
+
 /**
  * Scans all the objects to scan in the scanCache, remembering objects as required,
  * and flushing the cache at the end.
@@ -3551,6 +3764,14 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
+	MM_WorkStealingDeque<MM_CopyScanCacheStandard> *deque = getScanCacheDeque(env);
+	if (NULL != deque) {
+		/* idle threads spin looking for work rather than waiting on _scanCacheMonitor, so no notify is required */
+		if (deque->push(newCacheEntry)) {
+			return;
+		}
+	}
+
 	_scavengeCacheScanList.pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
@@ -4050,6 +4271,7 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			flushScanCacheDeques(env);
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
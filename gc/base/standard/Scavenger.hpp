@@ -42,6 +42,12 @@
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "WorkStealingDeque.hpp"
+
+/**
+ * Upper bound for -Xgc:scavengerPrefetchDistance=, the size of the per-call ring of pending slots in scavengeObjectSlots()
+ */
+#define SCAVENGER_PREFETCH_DISTANCE_MAX 16
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -113,6 +119,8 @@ private:
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
+	MM_WorkStealingDeque<MM_CopyScanCacheStandard> *_scanCacheDeques; /**< per GC thread work-stealing deques, indexed by worker ID (NULL unless work stealing is enabled) */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
@@ -260,6 +268,20 @@ public:
 
 	MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_t *objectPtrIndirect);
 
+	/**
+	 * Hint the processor to start loading the header of an object that is about to be copied, so that
+	 * the forwarding check in copyAndForward() is less likely to stall on a cache miss.
+	 * @param objectPtr object in evacuate space that will be passed to copyAndForward() shortly
+	 */
+	MMINLINE void
+	prefetchObjectHeader(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__)
+		/* the header will be written when the object is forwarded */
+		__builtin_prefetch((const void *)objectPtr, 1);
+#endif /* defined(__GNUC__) */
+	}
+
 	/**
 	 * Handle the path after a failed attempt to forward an object:
 	 * try to reuse or abandon reserved memory for this threads destination object candidate.
@@ -415,6 +437,45 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Return the work-stealing deque owned by the given GC thread, or NULL if work stealing
+	 * is disabled or the thread has no deque of its own.
+	 */
+	MMINLINE MM_WorkStealingDeque<MM_CopyScanCacheStandard> *
+	getScanCacheDeque(MM_EnvironmentStandard *env)
+	{
+		uintptr_t workerID = env->getWorkerID();
+		return (workerID < _scanCacheDequeCount) ? &_scanCacheDeques[workerID] : NULL;
+	}
+
+	/**
+	 * Try to steal a scan cache from the deque of another GC thread, starting at a random victim.
+	 * @return the stolen cache, or NULL if no victim had work
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * Racy check for scan work visible to a thread that has offered to terminate
+	 * (any non-empty deque or scan list).
+	 */
+	bool isScanCacheWorkAvailable();
+
+	/**
+	 * Work-stealing equivalent of the scan list/_scanCacheMonitor protocol in getNextScanCache().
+	 * Takes work from the thread's own deque, the shared scan lists, or other threads' deques, and
+	 * otherwise spins in a lock-free termination protocol (over _waitingCount and _doneIndex) until
+	 * either new work appears or all threads agree that the scan is complete.
+	 * @param doneIndex[in] snapshot of _doneIndex taken on entry to getNextScanCache()
+	 * @return the next cache to scan, or NULL if the scan loop is complete (or aborted)
+	 */
+	MM_CopyScanCacheStandard *getNextScanCacheWorkStealing(MM_EnvironmentStandard *env, uintptr_t doneIndex);
+	class ScanCacheWorkCheck; /**< tells getNextScanCacheWorkStealing() to stop waiting for termination */
+
+	/**
+	 * Flush every cache remaining in the work-stealing deques (used when backing out).
+	 */
+	void flushScanCacheDeques(MM_EnvironmentStandard *env);
 	/**
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
@@ -933,6 +994,8 @@ public:
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
 		, _waitingCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
 		, _cacheLineAlignment(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
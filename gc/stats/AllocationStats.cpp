@@ -35,6 +35,9 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhWastedBytes = 0;
+	_tlhRefreshCountLimited = 0;
+	_tlhMaxReservedBytes = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -67,6 +70,15 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_tlhMaxAbandonedListSize, prevMax, stats->_tlhMaxAbandonedListSize);
 	}
+	MM_AtomicOperations::add(&_tlhWastedBytes, stats->_tlhWastedBytes);
+	MM_AtomicOperations::add(&_tlhRefreshCountLimited, stats->_tlhRefreshCountLimited);
+	for (
+			uintptr_t prevMax = _tlhMaxReservedBytes;
+			prevMax < stats->_tlhMaxReservedBytes;
+			prevMax = _tlhMaxReservedBytes) {
+		MM_AtomicOperations::lockCompareExchange(
+			&_tlhMaxReservedBytes, prevMax, stats->_tlhMaxReservedBytes);
+	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	MM_AtomicOperations::add(&_arrayletLeafAllocationCount, stats->_arrayletLeafAllocationCount);
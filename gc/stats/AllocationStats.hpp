@@ -42,6 +42,9 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhWastedBytes; /**< The amount of TLH memory never allocated into: remainders too small to cache at a refresh, and everything left in TLHs when they were flushed. */
+	uintptr_t _tlhRefreshCountLimited; /**< Number of adaptively sized refreshes that were cut down to respect tlhAdaptiveReservedLimit. */
+	uintptr_t _tlhMaxReservedBytes; /**< The largest total size of all threads' TLHs seen at a refresh (adaptive TLH sizing only). */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -94,6 +97,9 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhWastedBytes(0),
+		_tlhRefreshCountLimited(0),
+		_tlhMaxReservedBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
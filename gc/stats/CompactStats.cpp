@@ -42,12 +42,17 @@ MM_CompactStats::clear()
 	_fixupObjects = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
+	_forwardStartTime = 0;
+	_forwardEndTime = 0;
 	_moveStartTime = 0;
 	_moveEndTime = 0;
 	_fixupStartTime = 0;
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+	_rebuildStartTime = 0;
+	_rebuildEndTime = 0;
+	_moveStallTime = 0;
 };
 
 void
@@ -59,12 +64,17 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
+	_forwardStartTime = (0 == _forwardStartTime) ? statsToMerge->_forwardStartTime : OMR_MIN(_forwardStartTime, statsToMerge->_forwardStartTime);
+	_forwardEndTime = OMR_MAX(_forwardEndTime, statsToMerge->_forwardEndTime);
 	_moveStartTime = (0 == _moveStartTime) ? statsToMerge->_moveStartTime : OMR_MIN(_moveStartTime, statsToMerge->_moveStartTime);
 	_moveEndTime = OMR_MAX(_moveEndTime, statsToMerge->_moveEndTime);
 	_fixupStartTime = (0 == _fixupStartTime) ? statsToMerge->_fixupStartTime : OMR_MIN(_fixupStartTime, statsToMerge->_fixupStartTime);
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+	_rebuildStartTime = (0 == _rebuildStartTime) ? statsToMerge->_rebuildStartTime : OMR_MIN(_rebuildStartTime, statsToMerge->_rebuildStartTime);
+	_rebuildEndTime = OMR_MAX(_rebuildEndTime, statsToMerge->_rebuildEndTime);
+	_moveStallTime += statsToMerge->_moveStallTime;
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -52,12 +52,17 @@ public:
 	uintptr_t _fixupObjects;
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _forwardStartTime; /**< start of forwarding address computation (region parallel compaction only) */
+	uint64_t _forwardEndTime;
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+	uint64_t _rebuildStartTime; /**< start of free list and mark map rebuild */
+	uint64_t _rebuildEndTime;
+	uint64_t _moveStallTime; /**< hi-res ticks spent waiting for the regions a region slides into to be vacated */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
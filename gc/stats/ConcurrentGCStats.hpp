@@ -67,6 +67,8 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uint64_t _mutatorTaxTime; /**< hi-res ticks mutators spent tracing and cleaning cards to pay allocation tax */
+	volatile uint64_t _backgroundMarkTime; /**< hi-res ticks concurrent helpers spent tracing and cleaning cards */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -171,6 +173,9 @@ public:
 	MMINLINE uintptr_t getMutatorsTraced() { return _traceSizeCount + _cardCleanCount; };
 	MMINLINE uintptr_t getConHelperTraced() { return _conHelperTraceSizeCount + _conHelperCardCleanCount; };
 	
+	MMINLINE uint64_t getMutatorTaxTime() { return MM_AtomicOperations::getU64(&_mutatorTaxTime); };
+	MMINLINE uint64_t getBackgroundMarkTime() { return MM_AtomicOperations::getU64(&_backgroundMarkTime); };
+	
 	MMINLINE bool getConcurrentWorkStackOverflowOcurred() { return _concurrentWorkStackOverflowOcurred; };
 	MMINLINE void setConcurrentWorkStackOverflowOcurred(bool overflow){ _concurrentWorkStackOverflowOcurred = overflow; };
 	MMINLINE uintptr_t getConcurrentWorkStackOverflowCount() { return _concurrentWorkStackOverflowCount; };
@@ -197,6 +202,9 @@ public:
 	MMINLINE void incRSObjectsFound(uintptr_t increment) { incrementCount((uintptr_t *)&_RSObjectsFound, increment); };
 	MMINLINE void incConcurrentWorkStackOverflowCount() { incrementCount((uintptr_t *)&_concurrentWorkStackOverflowCount, 1); }; 
 	
+	MMINLINE void incMutatorTaxTime(uint64_t increment) { MM_AtomicOperations::addU64(&_mutatorTaxTime, increment); };
+	MMINLINE void incBackgroundMarkTime(uint64_t increment) { MM_AtomicOperations::addU64(&_backgroundMarkTime, increment); };
+	
 	MMINLINE void setThreadsToScanCount(uintptr_t count) { _threadsToScanCount = count; };
 	MMINLINE uintptr_t getThreadsToScanCount() { return _threadsToScanCount; };
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
@@ -227,6 +235,8 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		MM_AtomicOperations::setU64(&_mutatorTaxTime, 0);
+		MM_AtomicOperations::setU64(&_backgroundMarkTime, 0);
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,6 +270,8 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_mutatorTaxTime(0),
+		_backgroundMarkTime(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
@@ -192,6 +192,11 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+
+	_freeListContendedCount = 0;
+	_freeListStealCount = 0;
+	_freeListRebalanceCount = 0;
+	_freeListRebalanceBytes = 0;
 }
 
 void
@@ -239,6 +244,12 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	/* merge split free list contention - current */
+	_freeListContendedCount += statsToMerge->_freeListContendedCount;
+	_freeListStealCount += statsToMerge->_freeListStealCount;
+	_freeListRebalanceCount += statsToMerge->_freeListRebalanceCount;
+	_freeListRebalanceBytes += statsToMerge->_freeListRebalanceBytes;
 }
 
 void
@@ -75,6 +75,11 @@ private:
 	uintptr_t _TLHSizeClassIndex; /**< preserved next value of sizeClassIndex on last invocation of simulateAllocateTLHs */
 	uintptr_t _TLHFrequentAllocationSize;/**< preserved next value of FrequentAllocationSize on last invocation of simulateAllocateTLHs */
 
+	uintptr_t _freeListContendedCount; /**< number of times an allocating thread found a split free list locked and moved on to another list */
+	uintptr_t _freeListStealCount; /**< number of allocates satisfied from a split free list other than the thread's home list */
+	uintptr_t _freeListRebalanceCount; /**< number of times free entries were moved into a thread's home list from a neighbouring split free list */
+	uintptr_t _freeListRebalanceBytes; /**< total size of the free entries moved by those rebalances */
+
 	MMINLINE uintptr_t getNextSizeClass(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 	MMINLINE bool isFirstIterationCompleteForCurrentStride(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 
@@ -217,6 +222,15 @@ public:
 	void resetRemainingFreeMemoryAfterEstimate() { _remainingFreeMemoryAfterEstimate= 0; }
 	uintptr_t getFreeMemoryBeforeEstimate() { return _freeMemoryBeforeEstimate; }
 	uintptr_t getMaxHeapSize() {return _maxHeapSize; }
+
+	/* split free list lock contention; current stats, reset and merged together with the allocation profile */
+	uintptr_t getFreeListContendedCount() { return _freeListContendedCount; }
+	uintptr_t getFreeListStealCount() { return _freeListStealCount; }
+	uintptr_t getFreeListRebalanceCount() { return _freeListRebalanceCount; }
+	uintptr_t getFreeListRebalanceBytes() { return _freeListRebalanceBytes; }
+	void addFreeListContended(uintptr_t count) { _freeListContendedCount += count; }
+	void incrementFreeListSteal() { _freeListStealCount += 1; }
+	void addFreeListRebalance(uintptr_t bytes) { _freeListRebalanceCount += 1; _freeListRebalanceBytes += bytes; }
 	uintptr_t getFreeMemory(){return _freeEntrySizeClassStats.getFreeMemory(_sizeClassSizes);}
 	uintptr_t getPageAlignedFreeMemory(uintptr_t pageSize) {return _freeEntrySizeClassStats.getPageAlignedFreeMemory(_sizeClassSizes, pageSize);}
 
@@ -245,7 +259,11 @@ public:
 		_freeMemoryBeforeEstimate(0),
 		_maxHeapSize(0),
 		_TLHSizeClassIndex(0),
-		_TLHFrequentAllocationSize(0)
+		_TLHFrequentAllocationSize(0),
+		_freeListContendedCount(0),
+		_freeListStealCount(0),
+		_freeListRebalanceCount(0),
+		_freeListRebalanceBytes(0)
 	{
 	}
 
@@ -53,6 +53,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
 	,_aliasToCopyCacheCount(0)
+	,_stealAttemptCount(0)
+	,_stealCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
 	,_workStallCount(0)
@@ -95,6 +97,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_slotsPipelined(0)
+	,_slotsPrefetched(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
@@ -165,6 +169,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
+	_stealAttemptCount = 0;
+	_stealCount = 0;
 	_arraySplitCount = 0;
 	_arraySplitAmount = 0;
 	_workStallCount = 0;
@@ -198,6 +204,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_slotsCopied = 0;
 	_slotsScanned = 0;
+	_slotsPipelined = 0;
+	_slotsPrefetched = 0;
 
 	_adjustedSyncStallTime = 0;
 	_notifyStallTime = 0;
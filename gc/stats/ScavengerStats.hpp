@@ -85,6 +85,8 @@ public:
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
 	uintptr_t _aliasToCopyCacheCount;
+	uintptr_t _stealAttemptCount; /**< The number of times the thread tried to steal a scan cache from another thread's deque (work stealing mode only) */
+	uintptr_t _stealCount; /**< The number of scan caches the thread successfully stole from another thread's deque (work stealing mode only) */
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
@@ -151,6 +153,8 @@ public:
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
+	uint64_t _slotsPipelined; /**< The number of slots scanned through the prefetch pipeline (-Xgc:scavengerPrefetchDistance=) */
+	uint64_t _slotsPrefetched; /**< The number of pipelined slots whose target was in evacuate space and had its header prefetched */
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
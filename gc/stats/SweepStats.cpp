@@ -44,6 +44,11 @@ MM_SweepStats::clear()
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */			
+
+	freeListContendedCount = 0;
+	freeListStealCount = 0;
+	freeListRebalanceCount = 0;
+	freeListRebalanceBytes = 0;
 }
 	
 void
@@ -59,6 +64,11 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	mergeTime += statsToMerge->mergeTime;
 	sweepChunksProcessed += statsToMerge->sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	freeListContendedCount += statsToMerge->freeListContendedCount;
+	freeListStealCount += statsToMerge->freeListStealCount;
+	freeListRebalanceCount += statsToMerge->freeListRebalanceCount;
+	freeListRebalanceBytes += statsToMerge->freeListRebalanceBytes;
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -52,6 +52,11 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	uintptr_t freeListContendedCount;	/**< Split free list allocates that found a list locked and moved on, since the previous collection */
+	uintptr_t freeListStealCount;	/**< Split free list allocates satisfied away from the thread's home list */
+	uintptr_t freeListRebalanceCount;	/**< Times entries were moved between neighbouring split free lists during allocation */
+	uintptr_t freeListRebalanceBytes;	/**< Bytes moved by those rebalances */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -51,6 +51,9 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t _stealAttemptCount; /**< The number of times the thread tried to steal a packet from another thread's deque (work stealing mode only) */
+	uintptr_t _stealCount; /**< The number of packets the thread successfully stole from another thread's deque (work stealing mode only) */
+	uintptr_t _idleYieldCount; /**< The number of times the thread gave up its processor while idle, waiting for work or termination (work stealing mode only) */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +76,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		_stealAttemptCount = 0;
+		_stealCount = 0;
+		_idleYieldCount = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +97,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		_stealAttemptCount += statsToMerge->_stealAttemptCount;
+		_stealCount += statsToMerge->_stealCount;
+		_idleYieldCount += statsToMerge->_idleYieldCount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -151,6 +160,9 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,_stealAttemptCount(0)
+		,_stealCount(0)
+		,_idleYieldCount(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
@@ -830,6 +830,13 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (_extensions->tlhAdaptiveSizing) {
+			writer->formatAndOutput(env, 1, "<tlh-refreshes fresh=\"%zu\" reused=\"%zu\" limited=\"%zu\" wastedBytes=\"%zu\" maxReservedBytes=\"%zu\" />",
+					systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhRefreshCountLimited,
+					systemStats->_tlhWastedBytes, systemStats->_tlhMaxReservedBytes);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -29,11 +29,6 @@
 
 #include <string.h>
 
-enum {
-	single_file = 0,
-	rotating_files
-};
-
 MM_VerboseWriterFileLogging::MM_VerboseWriterFileLogging(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type)
 	:MM_VerboseWriter(type)
 	,_filename(NULL)
@@ -39,6 +39,11 @@ class MM_VerboseWriterFileLogging : public MM_VerboseWriter
 	 */
 public:
 protected:
+	enum {
+		single_file = 0,
+		rotating_files
+	};
+
 	char *_filename; /**< the filename template supplied from the command line */
 	uintptr_t _numFiles; /**< number of files to rotate through */
 	uintptr_t _numCycles; /**< number of cycles in each file */
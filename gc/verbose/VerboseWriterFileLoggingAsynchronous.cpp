@@ -0,0 +1,632 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+/* The ring is never smaller than this, whatever -Xgc:asyncLoggingBufferSize= asks for */
+#define ASYNC_LOGGING_MINIMUM_RING_SIZE ((uintptr_t)64 * 1024)
+/* Upper bound on the size of a single write issued by the consumer thread */
+#define ASYNC_LOGGING_MAXIMUM_DRAIN_SIZE ((uintptr_t)1024 * 1024)
+/* How long the consumer thread sleeps before looking for records nobody woke it up for */
+#define ASYNC_LOGGING_DRAIN_INTERVAL_MILLIS 100
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_reserveCursor(0)
+	,_releaseCursor(0)
+	,_drainBuffer(NULL)
+	,_drainBufferSize(0)
+	,_drainBufferUsed(0)
+	,_consumerMonitor(NULL)
+	,_consumerState(consumer_stopped)
+	,_waitingProducers(0)
+	,_activeProducers(0)
+	,_droppedRecords(0)
+	,_droppedRecordsReported(0)
+	,_nextFile(0)
+	,_blockOnOverflow(false)
+	,_syncAfterWrite(false)
+	,_omrVM(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * Allocates the ring buffer, opens the first file and starts the consumer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	_omrVM = env->getOmrVM();
+	_blockOnOverflow = extensions->asyncLoggingBlockOnOverflow;
+	_syncAfterWrite = extensions->asyncLoggingSync;
+
+	if (NULL == _consumerMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_consumerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_consumerMonitor")) {
+			_consumerMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (NULL == _ring) {
+		/* ring offsets are masked rather than divided, so the size has to be a power of two */
+		_ringSize = ASYNC_LOGGING_MINIMUM_RING_SIZE;
+		while (((_ringSize << 1) > _ringSize) && ((_ringSize << 1) <= extensions->asyncLoggingBufferSize)) {
+			_ringSize <<= 1;
+		}
+		_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		memset(_ring, 0, _ringSize);
+		_reserveCursor = 0;
+		_releaseCursor = 0;
+	}
+
+	if (NULL == _drainBuffer) {
+		_drainBufferSize = OMR_MIN(_ringSize / 4, ASYNC_LOGGING_MAXIMUM_DRAIN_SIZE);
+		_drainBuffer = (char *)extensions->getForge()->allocate(_drainBufferSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _drainBuffer) {
+			return false;
+		}
+		_drainBufferUsed = 0;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+	_nextFile = _currentFile;
+
+	return startConsumer(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the consumer thread, after it has written out everything in the ring buffer.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL != _consumerMonitor) {
+		stopConsumer(env);
+		closeLogFile(env);
+		omrthread_monitor_destroy(_consumerMonitor);
+		_consumerMonitor = NULL;
+	}
+
+	extensions->getForge()->free(_drainBuffer);
+	_drainBuffer = NULL;
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * The initialized stanza is written straight to the new file, since the records
+ * still in the ring belong after it.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeToFile(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Writes out everything still in the ring buffer, then prints the footer and closes the file being logged to.
+ * The consumer thread is stopped; it is started again if the writer is reconfigured.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	stopConsumer(env);
+	closeLogFile(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		if (_syncAfterWrite) {
+			omrfile_sync(_logFileDescriptor);
+		}
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeToFile(MM_EnvironmentBase *env, const char *data, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during rotation.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, data, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, data, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+
+	if (0 != length) {
+		if (enterProducer()) {
+			publish(env, record_output, string, length, true);
+			exitProducer();
+		} else {
+			/* no consumer (the writer is being closed or reconfigured) - fall back to writing synchronously */
+			writeToFile(env, string, length);
+		}
+	}
+}
+
+/**
+ * Cycles the output files if necessary.  The rotation itself is queued behind the
+ * output of the cycle and done by the consumer thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	bool consumerRunning = enterProducer();
+
+	if(rotating_files == _mode) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if(0 == _currentCycle) {
+			_nextFile = (_nextFile + 1) % _numFiles;
+			if (consumerRunning) {
+				publish(env, record_rotate, &_nextFile, sizeof(_nextFile), false);
+			} else {
+				closeLogFile(env);
+				_currentFile = _nextFile;
+				openFile(env, true);
+			}
+		}
+	}
+
+	if (consumerRunning) {
+		/* the cycle is complete - have the consumer write it out now rather than at its next periodic check */
+		omrthread_monitor_enter(_consumerMonitor);
+		omrthread_monitor_notify_all(_consumerMonitor);
+		omrthread_monitor_exit(_consumerMonitor);
+		exitProducer();
+	}
+}
+
+/**
+ * Announce a producer that is about to publish a record.
+ * The producer is counted before the consumer state is checked, so that stopConsumer() either sees it
+ * and waits for its record, or it sees the consumer stopping and does not publish.
+ * @return true if the consumer is running and the record may be published, in which case exitProducer()
+ * must be called once it has been; false if the caller has to write synchronously
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enterProducer()
+{
+	MM_AtomicOperations::add(&_activeProducers, 1);
+	if (consumer_running == _consumerState) {
+		return true;
+	}
+	MM_AtomicOperations::subtract(&_activeProducers, 1);
+	return false;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::exitProducer()
+{
+	MM_AtomicOperations::subtract(&_activeProducers, 1);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::publish(MM_EnvironmentBase *env, uintptr_t type, const void *payload, uintptr_t length, bool mayDrop)
+{
+	uintptr_t recordSize = sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+	uintptr_t reserved = 0;
+
+	if (recordSize > _ringSize) {
+		/* would never fit, whatever the overflow policy */
+		MM_AtomicOperations::add(&_droppedRecords, 1);
+		return false;
+	}
+
+	while (true) {
+		reserved = _reserveCursor;
+		uintptr_t used = reserved - _releaseCursor;
+		if (used > _ringSize) {
+			/* read a stale reserve cursor that the consumer has already released past */
+			continue;
+		}
+		if (recordSize <= (_ringSize - used)) {
+			if (reserved == MM_AtomicOperations::lockCompareExchange(&_reserveCursor, reserved, reserved + recordSize)) {
+				break;
+			}
+		} else if (mayDrop && !_blockOnOverflow) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		} else if (!waitForSpace(recordSize)) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		}
+	}
+
+	copyToRing(reserved + sizeof(uintptr_t), payload, length);
+
+	/* the payload must be visible before the header which publishes it */
+	MM_AtomicOperations::storeSync();
+	*(volatile uintptr_t *)(_ring + (reserved & (_ringSize - 1))) = (length << 1) | type;
+
+	uintptr_t half = _ringSize / 2;
+	uintptr_t usedBefore = reserved - _releaseCursor;
+	if ((usedBefore <= half) && ((usedBefore + recordSize) > half)) {
+		/* passing half full - wake the consumer rather than leave it to its periodic check */
+		omrthread_monitor_enter(_consumerMonitor);
+		omrthread_monitor_notify_all(_consumerMonitor);
+		omrthread_monitor_exit(_consumerMonitor);
+	}
+
+	return true;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::waitForSpace(uintptr_t recordSize)
+{
+	bool result = true;
+
+	omrthread_monitor_enter(_consumerMonitor);
+	_waitingProducers += 1;
+	while (recordSize > (_ringSize - (_reserveCursor - _releaseCursor))) {
+		if (consumer_running != _consumerState) {
+			result = false;
+			break;
+		}
+		omrthread_monitor_notify_all(_consumerMonitor);
+		omrthread_monitor_wait(_consumerMonitor);
+	}
+	_waitingProducers -= 1;
+	omrthread_monitor_exit(_consumerMonitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::copyToRing(uintptr_t cursor, const void *data, uintptr_t length)
+{
+	uintptr_t offset = cursor & (_ringSize - 1);
+	uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+
+	memcpy(_ring + offset, data, firstPart);
+	memcpy(_ring, (const uint8_t *)data + firstPart, length - firstPart);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::copyFromRing(uintptr_t cursor, void *data, uintptr_t length)
+{
+	uintptr_t offset = cursor & (_ringSize - 1);
+	uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+
+	memcpy(data, _ring + offset, firstPart);
+	memcpy((uint8_t *)data + firstPart, _ring, length - firstPart);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::releaseTo(uintptr_t cursor)
+{
+	uintptr_t releaseCursor = _releaseCursor;
+
+	if (cursor != releaseCursor) {
+		/* clear the consumed records so that stale data is never mistaken for a published header */
+		uintptr_t length = cursor - releaseCursor;
+		uintptr_t offset = releaseCursor & (_ringSize - 1);
+		uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+		memset(_ring + offset, 0, firstPart);
+		memset(_ring, 0, length - firstPart);
+
+		MM_AtomicOperations::storeSync();
+		_releaseCursor = cursor;
+
+		omrthread_monitor_enter(_consumerMonitor);
+		if (0 != _waitingProducers) {
+			omrthread_monitor_notify_all(_consumerMonitor);
+		}
+		omrthread_monitor_exit(_consumerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flushDrainBuffer(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (0 != _drainBufferUsed) {
+		writeToFile(env, _drainBuffer, _drainBufferUsed);
+		_drainBufferUsed = 0;
+	}
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _droppedRecordsReported) {
+		char notice[128];
+		uintptr_t noticeLength = omrstr_printf(notice, sizeof(notice), "<!-- asynchronous logging buffer full: %zu records dropped -->\n", droppedRecords - _droppedRecordsReported);
+		writeToFile(env, notice, noticeLength);
+		_droppedRecordsReported = droppedRecords;
+	}
+
+	if (_syncAfterWrite && (-1 != _logFileDescriptor)) {
+		omrfile_sync(_logFileDescriptor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	uintptr_t readCursor = _releaseCursor;
+	bool wroteOutput = false;
+
+	while (true) {
+		uintptr_t header = *(volatile uintptr_t *)(_ring + (readCursor & (_ringSize - 1)));
+		if (0 == header) {
+			break;
+		}
+		/* the payload was stored before the header */
+		MM_AtomicOperations::loadSync();
+
+		uintptr_t length = header >> 1;
+		uintptr_t payloadCursor = readCursor + sizeof(uintptr_t);
+		uintptr_t recordSize = sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+
+		if (record_rotate == (header & 1)) {
+			uintptr_t nextFile = 0;
+			copyFromRing(payloadCursor, &nextFile, sizeof(nextFile));
+			readCursor += recordSize;
+			releaseTo(readCursor);
+
+			flushDrainBuffer(env);
+			closeLogFile(env);
+			_currentFile = nextFile;
+			openFile(env, true);
+			wroteOutput = false;
+		} else {
+			if (length > (_drainBufferSize - _drainBufferUsed)) {
+				releaseTo(readCursor);
+				flushDrainBuffer(env);
+			}
+
+			if (length > _drainBufferSize) {
+				/* too large to gather - write it straight out of the ring, which wraps at most once */
+				uintptr_t offset = payloadCursor & (_ringSize - 1);
+				uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+				writeToFile(env, (const char *)(_ring + offset), firstPart);
+				if (length > firstPart) {
+					writeToFile(env, (const char *)_ring, length - firstPart);
+				}
+				readCursor += recordSize;
+				releaseTo(readCursor);
+			} else {
+				copyFromRing(payloadCursor, _drainBuffer + _drainBufferUsed, length);
+				_drainBufferUsed += length;
+				readCursor += recordSize;
+			}
+			wroteOutput = true;
+		}
+	}
+
+	releaseTo(readCursor);
+	if (wroteOutput || (_droppedRecords != _droppedRecordsReported)) {
+		flushDrainBuffer(env);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startConsumer(MM_EnvironmentBase *env)
+{
+	bool result = true;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us before we wait */
+	omrthread_monitor_enter(_consumerMonitor);
+	_consumerState = consumer_starting;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		consumer_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (consumer_starting == _consumerState) {
+			omrthread_monitor_wait(_consumerMonitor);
+		}
+	} else {
+		_consumerState = consumer_stopped;
+		result = false;
+	}
+	omrthread_monitor_exit(_consumerMonitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopConsumer(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_consumerMonitor);
+	if (consumer_stopped != _consumerState) {
+		_consumerState = consumer_stop_requested;
+		omrthread_monitor_notify_all(_consumerMonitor);
+		while (consumer_stopped != _consumerState) {
+			omrthread_monitor_wait(_consumerMonitor);
+		}
+	}
+	omrthread_monitor_exit(_consumerMonitor);
+
+	/* Producers that saw the consumer running may have published after its last drain (a producer
+	 * blocked on a full ring gives up once the consumer stops), so wait for them and write out
+	 * whatever they left in the ring in their place.
+	 */
+	MM_AtomicOperations::sync();
+	while (0 != _activeProducers) {
+		omrthread_yield();
+	}
+	MM_AtomicOperations::loadSync();
+	if (NULL != _ring) {
+		drain(env);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::consumer_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	/* this method will NOT return */
+	writer->consumerEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::consumerEntryPoint()
+{
+	{
+		MM_EnvironmentBase env(_omrVM);
+
+		omrthread_monitor_enter(_consumerMonitor);
+		_consumerState = consumer_running;
+		omrthread_monitor_notify_all(_consumerMonitor);
+		while (consumer_running == _consumerState) {
+			if (!hasPublishedRecord()) {
+				omrthread_monitor_wait_timed(_consumerMonitor, ASYNC_LOGGING_DRAIN_INTERVAL_MILLIS, 0);
+			}
+			omrthread_monitor_exit(_consumerMonitor);
+			drain(&env);
+			omrthread_monitor_enter(_consumerMonitor);
+		}
+		omrthread_monitor_exit(_consumerMonitor);
+
+		/* write out everything published before the stop request */
+		drain(&env);
+	}
+
+	omrthread_monitor_enter(_consumerMonitor);
+	_consumerState = consumer_stopped;
+	omrthread_monitor_notify_all(_consumerMonitor);
+	omrthread_exit(_consumerMonitor);
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread.
+ *
+ * Writers copy each flushed stanza into a lock-free multi-producer ring buffer and return
+ * without doing any I/O.  A dedicated thread drains the ring in large batches, and also owns
+ * the file so that log rotation happens off the GC thread.
+ *
+ * Each record in the ring is a uintptr_t header followed by the payload padded to a uintptr_t
+ * boundary.  A producer reserves space by advancing _reserveCursor, copies in the payload and
+ * then publishes the record by storing its (non-zero) header.  The consumer clears the ring
+ * behind it, so a zero header always means the next record has not been published yet.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum ConsumerState {
+		consumer_stopped = 0,
+		consumer_starting,
+		consumer_running,
+		consumer_stop_requested
+	};
+
+	enum RecordType {
+		record_output = 0, /**< the payload is verbose output */
+		record_rotate = 1 /**< the payload is the index of the next file to rotate to */
+	};
+
+	intptr_t _logFileDescriptor; /**< the file being written to, owned by the consumer thread while it is running */
+
+	uint8_t *_ring; /**< the ring buffer records are passed through */
+	uintptr_t _ringSize; /**< size of the ring buffer in bytes, a power of two */
+	volatile uintptr_t _reserveCursor; /**< unwrapped ring offset of the next byte to hand out to a producer */
+	volatile uintptr_t _releaseCursor; /**< unwrapped ring offset up to which the consumer has cleared the ring */
+
+	char *_drainBuffer; /**< buffer the consumer gathers payloads in so they can be written with a single call */
+	uintptr_t _drainBufferSize; /**< size of the drain buffer in bytes */
+	uintptr_t _drainBufferUsed; /**< bytes of the drain buffer waiting to be written */
+
+	omrthread_monitor_t _consumerMonitor; /**< protects the consumer state and is used to wake the consumer and blocked producers */
+	volatile uintptr_t _consumerState; /**< one of ConsumerState */
+	volatile uintptr_t _waitingProducers; /**< number of producers blocked waiting for space in the ring */
+	volatile uintptr_t _activeProducers; /**< number of producers that saw the consumer running and may still be publishing */
+
+	volatile uintptr_t _droppedRecords; /**< number of records dropped because the ring was full */
+	uintptr_t _droppedRecordsReported; /**< number of dropped records already reported in the log */
+
+	uintptr_t _nextFile; /**< index of the file the producers last asked the consumer to rotate to */
+	bool _blockOnOverflow; /**< true if producers wait for space rather than drop records when the ring is full */
+	bool _syncAfterWrite; /**< true if the file is flushed to disk after every batch */
+
+	OMR_VM *_omrVM; /**< the VM the consumer thread runs on behalf of */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of records dropped because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Write the footer and close the current file.  Only called when the consumer thread owns the file,
+	 * or when the consumer thread is not running.
+	 */
+	void closeLogFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Write directly to the current file, or to stderr if it could not be opened.
+	 */
+	void writeToFile(MM_EnvironmentBase *env, const char *data, uintptr_t length);
+
+	/**
+	 * Copy a record into the ring and publish it.
+	 * @param type one of RecordType
+	 * @param payload the record payload
+	 * @param length the size of the payload in bytes, which must not be zero
+	 * @param mayDrop true if the record may be dropped when the ring is full and the overflow policy is to drop
+	 * @return true if the record was published, false if it was dropped
+	 */
+	bool publish(MM_EnvironmentBase *env, uintptr_t type, const void *payload, uintptr_t length, bool mayDrop);
+
+	/**
+	 * Block the calling producer until the ring has room for a record, or the consumer stops.
+	 * @return true if there is room, false if the consumer is no longer running
+	 */
+	bool waitForSpace(uintptr_t recordSize);
+
+	void copyToRing(uintptr_t cursor, const void *data, uintptr_t length);
+	void copyFromRing(uintptr_t cursor, void *data, uintptr_t length);
+
+	/**
+	 * Clear the ring up to the given cursor, making the space available to producers again.
+	 */
+	void releaseTo(uintptr_t cursor);
+
+	/**
+	 * Write out and release every record published so far.
+	 */
+	void drain(MM_EnvironmentBase *env);
+	void flushDrainBuffer(MM_EnvironmentBase *env);
+
+	MMINLINE bool hasPublishedRecord()
+	{
+		return 0 != *(volatile uintptr_t *)(_ring + (_releaseCursor & (_ringSize - 1)));
+	}
+
+	bool enterProducer();
+	void exitProducer();
+	bool startConsumer(MM_EnvironmentBase *env);
+	void stopConsumer(MM_EnvironmentBase *env);
+
+	static int J9THREAD_PROC consumer_thread_proc(void *info);
+	void consumerEntryPoint();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
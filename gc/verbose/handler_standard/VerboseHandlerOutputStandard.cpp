@@ -302,9 +302,23 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	if ((0 == sweepStats->freeListContendedCount) && (0 == sweepStats->freeListStealCount) && (0 == sweepStats->freeListRebalanceCount)) {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	handleSweepEndInternal(env, eventData);
+		handleSweepEndInternal(env, eventData);
+	} else {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+
+		writer->formatAndOutput(env, 1, "<freelist-contention contended=\"%zu\" stolen=\"%zu\" rebalanced=\"%zu\" rebalancedbytes=\"%zu\" />",
+				sweepStats->freeListContendedCount, sweepStats->freeListStealCount, sweepStats->freeListRebalanceCount, sweepStats->freeListRebalanceBytes);
+
+		handleSweepEndInternal(env, eventData);
+
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -410,6 +424,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_slotsPipelined) {
+		writer->formatAndOutput(env, 1, "<slot-prefetch slots=\"%llu\" prefetched=\"%llu\" />",
+				scavengerStats->_slotsPipelined, scavengerStats->_slotsPrefetched);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -576,6 +576,10 @@ public:
 	VMINLINE static uintptr_t
 	add(volatile uintptr_t *address, uintptr_t addend)
 	{
+#if !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390)
+		/* A single fetch-and-add (e.g. lock xadd) rather than a compare-and-swap retry loop */
+		return (uintptr_t)__sync_add_and_fetch(address, addend);
+#else /* !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390) */
 		/* Stop compiler optimizing away load of oldValue */
 		volatile uintptr_t *localAddr = address;
 		uintptr_t oldValue;
@@ -585,6 +589,7 @@ public:
 			oldValue = (uintptr_t)*localAddr;
 		}
 		return oldValue + addend;
+#endif /* !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390) */
 	}
 
 	/**
@@ -782,6 +787,10 @@ public:
 	VMINLINE static uintptr_t
 	subtract(volatile uintptr_t *address, uintptr_t value)
 	{
+#if !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390)
+		/* A single fetch-and-subtract (e.g. lock xadd) rather than a compare-and-swap retry loop */
+		return (uintptr_t)__sync_sub_and_fetch(address, value);
+#else /* !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390) */
 		/* Stop compiler optimizing away load of oldValue */
 		volatile uintptr_t *localAddr = address;
 		uintptr_t oldValue;
@@ -791,6 +800,7 @@ public:
 			oldValue = (uintptr_t)*localAddr;
 		}
 		return oldValue - value;
+#endif /* !defined(ATOMIC_SUPPORT_STUB) && defined(__GNUC__) && !defined(J9ZOS390) */
 	}
 
 	/**
@@ -52,6 +52,24 @@ struct J9HookInterface;
 intptr_t
 J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary *portLib, size_t interfaceSize);
 
+/**
+* @brief Select how listener statistics are gathered for a hook interface.
+* Must be called before any event is dispatched on the interface.
+* @param hookInterface
+* @param flags J9HOOK_STATISTICS_* flags
+* @return 0 on success, J9HOOK_ERR_NOMEM if the shards could not be allocated
+*/
+intptr_t
+J9HookConfigureStatistics(struct J9HookInterface **hookInterface, uintptr_t flags);
+
+/**
+* @brief Fold sharded statistics into the OMREventInfo4Dump of every event.
+* Call before reading J9HOOK_DUMPINFO() of an interface using J9HOOK_STATISTICS_SHARDED.
+* @param hookInterface
+*/
+void
+J9HookAggregateStatistics(struct J9HookInterface **hookInterface);
+
 #ifdef __cplusplus
 }
 #endif
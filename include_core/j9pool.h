@@ -79,6 +79,7 @@ typedef struct J9Pool {
 	uint16_t alignment;
 	uint16_t flags;
 	uint32_t memoryCategory;
+	struct J9PoolDepot *depot;
 } J9Pool;
 
 #define POOL_NO_ZERO  8
@@ -89,6 +90,30 @@ typedef struct J9Pool {
 #define POOL_ALWAYS_KEEP_SORTED  4
 #define POOL_ALLOC_TYPE_PUDDLE_LIST  2
 #define POOL_ALLOC_TYPE_POOL  0
+#define POOL_CONCURRENT  64
+#define POOL_ALLOC_TYPE_MAGAZINE  3
+
+#define J9POOL_MAGAZINE_SIZE  16
+
+/*
+ * A magazine holds up to J9POOL_MAGAZINE_SIZE free elements ("rounds") of a
+ * POOL_CONCURRENT pool. Magazines move between per-thread caches and the
+ * pool's depot as a unit.
+ */
+typedef struct J9PoolMagazine {
+	struct J9PoolMagazine *next;
+	uintptr_t rounds;
+	void *elements[J9POOL_MAGAZINE_SIZE];
+} J9PoolMagazine;
+
+/*
+ * Per-thread cache for a POOL_CONCURRENT pool. Must be zero initialized and
+ * only ever used by one thread at a time.
+ */
+typedef struct J9PoolThreadCache {
+	struct J9PoolMagazine *loaded;
+	struct J9PoolMagazine *previous;
+} J9PoolThreadCache;
 
 /*
  * @ddr_namespace: map_to_type=J9PoolState
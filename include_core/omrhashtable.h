@@ -51,6 +51,7 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000020	/*!< Store entries inline using open addressing with group-probed control bytes */
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -86,7 +87,8 @@ extern "C" {
 /**
 * Hash table state queries
 */
-#define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsOpenAddressing(table) (J9HASH_TABLE_OPEN_ADDRESSING == ((table)->flags & J9HASH_TABLE_OPEN_ADDRESSING))
+#define hashTableIsSpaceOptimized(table) ((NULL == table->listNodePool) && !hashTableIsOpenAddressing(table))
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -120,6 +122,10 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	uint8_t *controlBytes;
+	uint8_t *slots;
+	uint32_t slotSize;
+	uint32_t numberOfDeletedNodes;
 } J9HashTable;
 
 typedef struct J9HashTableState {
@@ -75,6 +75,12 @@ typedef struct J9HookInterface {
 #define J9HOOK_AGENTID_DEFAULT  ((uintptr_t)1)
 #define J9HOOK_AGENTID_LAST  ((uintptr_t)-1)
 
+/* flags for J9HookConfigureStatistics() */
+/* count and time listeners in per-thread shards, folded into infos4Dump by J9HookAggregateStatistics() */
+#define J9HOOK_STATISTICS_SHARDED  1
+/* neither count nor time listeners of events dispatched without a J9HOOK_TAG_SAMPLING_MASK interval */
+#define J9HOOK_STATISTICS_SAMPLED_EVENTS_ONLY  2
+
 /* time threshold (=100 milliseconds) for triggering the tracepoint  */
 #define OMRHOOK_DEFAULT_THRESHOLD_IN_MICROSECONDS_WARNING_CALLBACK_ELAPSED_TIME	(100 * 1000)
 
@@ -108,6 +114,11 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	uintptr_t statisticsFlags;			/* J9HOOK_STATISTICS_* flags */
+	struct OMREventInfo4Dump *shards;	/* eventSize statistics per shard, NULL unless J9HOOK_STATISTICS_SHARDED */
+	uintptr_t shardMask;				/* number of shards - 1 */
+	uintptr_t shardStride;				/* bytes between shards, a multiple of the cache line size */
+	void *shardMemory;					/* allocation holding the shards */
 } J9CommonHookInterface;
 
 
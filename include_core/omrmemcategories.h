@@ -31,6 +31,32 @@
 
 #include "omrcfg.h"
 
+/* Each counter shard is padded out to a cache line so that CPUs updating different shards do not contend */
+#define OMRMEM_CATEGORY_SHARD_SIZE 64
+/* Upper bound on the number of counter shards per category */
+#define OMRMEM_CATEGORY_MAX_SHARDS 64
+
+/*
+ * Counters updated by the port library are spread across per-CPU shards so that
+ * hot categories do not bounce a single cache line between all allocating threads.
+ * The shards are only summed by omrmem_walk_categories.
+ */
+typedef struct OMRMemCategoryShard {
+	uintptr_t liveBytes;
+	uintptr_t liveAllocations;
+	uint8_t padding[OMRMEM_CATEGORY_SHARD_SIZE - (2 * sizeof(uintptr_t))];
+} OMRMemCategoryShard;
+
+/*
+ * liveBytes and liveAllocations hold updates made directly to the category (e.g. by the
+ * thread library) and port library updates made before the category has shards. The live
+ * totals for a category are these plus the sum of its shards, which is what
+ * omrmem_walk_categories reports.
+ *
+ * shards and shardMask are owned by the port library, which points shards at a cache line
+ * aligned block of (shardMask + 1) shards when the category set is registered through
+ * OMRPORT_CTLDATA_MEM_CATEGORIES_SET. Initializers should leave both zero.
+ */
 typedef struct OMRMemCategory {
 	const char *const name;
 	const uint32_t categoryCode;
@@ -38,6 +64,8 @@ typedef struct OMRMemCategory {
 	uintptr_t liveAllocations;
 	const uint32_t numberOfChildren;
 	const uint32_t *const children;
+	OMRMemCategoryShard *volatile shards;
+	uint32_t shardMask;
 } OMRMemCategory;
 
 typedef struct OMRMemCategorySet {
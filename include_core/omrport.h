@@ -463,6 +463,45 @@ typedef struct J9FileStatFilesystem {
  */
 typedef FILE OMRFileStream;
 
+/**
+ * A handle to an asynchronous file I/O submission/completion queue.
+ * Private, platform specific implementation.
+ * @see omrfile_async_queue_create
+ */
+typedef struct OMRFileAsyncQueue OMRFileAsyncQueue;
+
+/**
+ * Describes one contiguous buffer of a vectored asynchronous file operation.
+ * Layout compatible with struct iovec on platforms that provide it.
+ */
+typedef struct OMRFileIOVec {
+	void *buffer;
+	uintptr_t length;
+} OMRFileIOVec;
+
+/**
+ * Describes one asynchronous read or write submitted with @ref omrfile_async_submit.
+ * The iov array and the buffers it describes must remain valid until the matching
+ * completion has been returned by @ref omrfile_async_poll.
+ */
+typedef struct OMRFileAsyncRequest {
+	intptr_t fd; /**< file descriptor returned by omrfile_open */
+	int32_t opcode; /**< OMRPORT_FILE_ASYNC_OP_READ or OMRPORT_FILE_ASYNC_OP_WRITE */
+	int32_t bufferIndex; /**< index of a registered buffer containing iov[0], or OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX */
+	int64_t offset; /**< absolute file offset of the first byte transferred */
+	OMRFileIOVec *iov;
+	uint32_t iovCount;
+	uintptr_t userData; /**< returned unchanged in the matching OMRFileAsyncCompletion */
+} OMRFileAsyncRequest;
+
+/**
+ * Describes the outcome of one asynchronous request reaped with @ref omrfile_async_poll.
+ */
+typedef struct OMRFileAsyncCompletion {
+	uintptr_t userData;
+	intptr_t result; /**< bytes transferred, or a negative portable error code */
+} OMRFileAsyncCompletion;
+
 /* It is the responsibility of the user to create the storage for J9PortVMemParams.
  * The structure is only needed for the lifetime of the call to omrvmem_reserve_memory_ex
  * This structure must be initialized using @ref omrvmem_vmem_params_init
@@ -878,6 +917,13 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_FILE_WAIT_FOR_LOCK  4
 #define OMRPORT_FILE_NOWAIT_FOR_LOCK  8
 
+#define OMRPORT_FILE_ASYNC_OP_READ  1
+#define OMRPORT_FILE_ASYNC_OP_WRITE  2
+#define OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX  -1
+#define OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL  1
+#define OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL  1
+#define OMRPORT_FILE_ASYNC_BACKEND_IO_URING  2
+
 #define OMRPORT_MMAP_CAPABILITY_COPYONWRITE  1
 #define OMRPORT_MMAP_CAPABILITY_READ  2
 #define OMRPORT_MMAP_CAPABILITY_WRITE  4
@@ -2431,6 +2477,38 @@ typedef struct OMRPortLibrary {
 	int32_t (*sock_getsockopt_linger)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval) ;
 	/** see @ref omrsock.c::omrsock_getsockopt_timeval "omrsock_getsockopt_timeval"*/
 	int32_t (*sock_getsockopt_timeval)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval) ;
+	/** see @ref omrfileasync.c::omrfile_async_queue_create "omrfile_async_queue_create"*/
+	int32_t (*file_async_queue_create)(struct OMRPortLibrary *portLibrary, uint32_t depth, uint32_t flags, OMRFileAsyncQueue **queue) ;
+	/** see @ref omrfileasync.c::omrfile_async_queue_destroy "omrfile_async_queue_destroy"*/
+	void (*file_async_queue_destroy)(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue) ;
+	/** see @ref omrfileasync.c::omrfile_async_queue_backend "omrfile_async_queue_backend"*/
+	int32_t (*file_async_queue_backend)(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue) ;
+	/** see @ref omrfileasync.c::omrfile_async_register_buffers "omrfile_async_register_buffers"*/
+	int32_t (*file_async_register_buffers)(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileIOVec *buffers, uint32_t count) ;
+	/** see @ref omrfileasync.c::omrfile_async_submit "omrfile_async_submit"*/
+	int32_t (*file_async_submit)(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count) ;
+	/** see @ref omrfileasync.c::omrfile_async_poll "omrfile_async_poll"*/
+	int32_t (*file_async_poll)(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions) ;
+	/** see @ref omrsock.c::omrsock_eventloop_create "omrsock_eventloop_create"*/
+	int32_t (*sock_eventloop_create)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_close "omrsock_eventloop_close"*/
+	int32_t (*sock_eventloop_close)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_add "omrsock_eventloop_add"*/
+	int32_t (*sock_eventloop_add)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_modify "omrsock_eventloop_modify"*/
+	int32_t (*sock_eventloop_modify)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_remove "omrsock_eventloop_remove"*/
+	int32_t (*sock_eventloop_remove)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock) ;
+	/** see @ref omrsock.c::omrsock_eventloop_wait "omrsock_eventloop_wait"*/
+	int32_t (*sock_eventloop_wait)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs) ;
+	/** see @ref omrsock.c::omrsock_sendv "omrsock_sendv"*/
+	int32_t (*sock_sendv)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_recvv "omrsock_recvv"*/
+	int32_t (*sock_recvv)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_sendmmsg "omrsock_sendmmsg"*/
+	int32_t (*sock_sendmmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_recvmmsg "omrsock_recvmmsg"*/
+	int32_t (*sock_recvmmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags) ;
 #if defined(OMR_OPT_CUDA)
 	/** CUDA configuration data */
 	J9CudaConfig *cuda_configData;
@@ -3003,6 +3081,22 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsock_getsockopt_int(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_int(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_linger(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_linger(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_timeval(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_timeval(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_async_queue_create(param1,param2,param3) privateOmrPortLibrary->file_async_queue_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_queue_destroy(param1) privateOmrPortLibrary->file_async_queue_destroy(privateOmrPortLibrary, (param1))
+#define omrfile_async_queue_backend(param1) privateOmrPortLibrary->file_async_queue_backend(privateOmrPortLibrary, (param1))
+#define omrfile_async_register_buffers(param1,param2,param3) privateOmrPortLibrary->file_async_register_buffers(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_submit(param1,param2,param3) privateOmrPortLibrary->file_async_submit(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_poll(param1,param2,param3,param4) privateOmrPortLibrary->file_async_poll(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_create(param1) privateOmrPortLibrary->sock_eventloop_create(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_close(param1) privateOmrPortLibrary->sock_eventloop_close(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_add(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_add(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_modify(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_modify(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_remove(param1,param2) privateOmrPortLibrary->sock_eventloop_remove(privateOmrPortLibrary, (param1), (param2))
+#define omrsock_eventloop_wait(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_wait(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_sendv(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendv(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_recvv(param1,param2,param3,param4) privateOmrPortLibrary->sock_recvv(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_sendmmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendmmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_recvmmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_recvmmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 
 #if defined(OMR_OPT_CUDA)
 #define omrcuda_startup() \
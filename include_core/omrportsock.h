@@ -46,6 +46,20 @@ typedef struct OMRTimeval *omrsock_timeval_t;
 /* Pointer to OMRLinger, a struct that contains struct linger.*/
 typedef struct OMRLinger *omrsock_linger_t;
 
+/* Pointer to OMREventLoop, a struct that contains an epoll instance, or the poll set used in its place.
+ * Private, platform specific implementation.
+ */
+typedef struct OMREventLoop *omrsock_eventloop_t;
+
+/* Pointer to OMRSockEvent, a struct that contains a readiness notification. */
+typedef struct OMRSockEvent *omrsock_event_t;
+
+/* Pointer to OMRSockIOVec, a struct that describes one buffer of a scatter/gather transfer. */
+typedef struct OMRSockIOVec *omrsock_iovec_t;
+
+/* Pointer to OMRSockMsg, a struct that describes one message of a batched transfer. */
+typedef struct OMRSockMsg *omrsock_msg_t;
+
 /* Bind to all available interfaces */
 #define OMRSOCK_INADDR_ANY ((uint32_t)0)
 
@@ -151,4 +151,45 @@ typedef struct OMRLinger {
 /* Additional constants: Set maximum backlog for listen */
 #define OMRSOCK_MAXCONN SOMAXCONN
 
+/**
+ * A readiness notification returned by @ref omrsock_eventloop_wait.
+ */
+typedef struct OMRSockEvent {
+	/**
+	 * The value registered with the socket in @ref omrsock_eventloop_add or @ref omrsock_eventloop_modify.
+	 */
+	uintptr_t userData;
+
+	/**
+	 * ORed OMRSOCK_POLL* constants the socket became ready for.
+	 */
+	int16_t revents;
+} OMRSockEvent;
+
+/**
+ * One buffer of a scatter/gather transfer. Layout compatible with struct iovec.
+ */
+typedef struct OMRSockIOVec {
+	void *buffer;
+	uintptr_t length;
+} OMRSockIOVec;
+
+/**
+ * One message of a batched transfer, @ref omrsock_sendmmsg and @ref omrsock_recvmmsg.
+ */
+typedef struct OMRSockMsg {
+	OMRSockIOVec *iov;
+	uint32_t iovCount;
+
+	/**
+	 * Destination address when sending, filled in with the source address when receiving. May be NULL.
+	 */
+	OMRSockAddrStorage *addr;
+
+	/**
+	 * Number of bytes transferred, set when the message has been sent or received.
+	 */
+	uint32_t bytes;
+} OMRSockMsg;
+
 #endif /* !defined(OMRPORTSOCKTYPES_H_) */
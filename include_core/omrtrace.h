@@ -63,6 +63,7 @@ extern "C" {
 #define UT_BACKTRACE                  "BACKTRACE"
 #define UT_FATAL_ASSERT_KEYWORD       "FATALASSERT"
 #define UT_NO_FATAL_ASSERT_KEYWORD    "NOFATALASSERT"
+#define UT_ASYNC_PUBLISH_KEYWORD      "ASYNCPUBLISH"
 
 /*
  * =============================================================================
@@ -76,6 +77,7 @@ typedef struct OMR_TraceBuffer {
 	volatile uint32_t flags;			/* Flags                            */
 	int32_t bufferType;					/* Buffer type                      */
 	struct OMR_TraceThread *thr;		/* The thread that last owned this  */
+	volatile uintptr_t publishRefs;		/* Subscribers yet to consume it (asyncpublish only) */
 	/* This section written to disk     */
 	UtTraceRecord record;				/* Disk record                      */
 } OMR_TraceBuffer;
@@ -94,6 +96,18 @@ typedef struct OMR_TraceThread {
 	int indent;						/* Iprint indentation count        */
 } OMR_TraceThread;
 
+/*
+ * Counters describing how full trace buffers have been published to subscribers.
+ * Returned by OMR_TraceInterface.GetPublishStatistics().
+ */
+typedef struct OMR_TracePublishStatistics {
+	uint64_t buffersPublished;		/* Buffers delivered to the subscribers */
+	uint64_t buffersQueued;			/* Buffers handed to the dispatcher threads (asyncpublish only) */
+	uint64_t buffersDropped;		/* Buffers discarded because the publish queue was full (asyncpublish=...,drop only) */
+	uint64_t backpressureWaits;		/* Times a tracing thread waited for the publish queue to drain (asyncpublish only) */
+	uint64_t queueDepth;			/* Buffers currently queued or being dispatched (asyncpublish only) */
+} OMR_TracePublishStatistics;
+
 typedef struct OMR_TraceInterface {
 	omr_error_t (*RegisterRecordSubscriber)(struct OMR_TraceThread *thr, const char *description,
 		utsSubscriberCallback func, utsSubscriberAlarmCallback alarm,
@@ -102,6 +116,7 @@ typedef struct OMR_TraceInterface {
 	omr_error_t (*FlushTraceData)(struct OMR_TraceThread *thr);
 	omr_error_t (*GetTraceMetadata)(void **data, int32_t *length);
 	omr_error_t (*SetOptions)(struct OMR_TraceThread *thr, const char *opts[]);
+	omr_error_t (*GetPublishStatistics)(OMR_TracePublishStatistics *stats);
 } OMR_TraceInterface;
 
 /*
@@ -114,6 +114,26 @@ void *
 pool_newElement(J9Pool *aPool);
 
 
+/**
+* @brief
+* @param aPool
+* @param cache
+* @return void *
+*/
+void *
+pool_newElementCached(J9Pool *aPool, J9PoolThreadCache *cache);
+
+
+/**
+* @brief
+* @param aPool
+* @param cache
+* @return void
+*/
+void
+pool_flushThreadCache(J9Pool *aPool, J9PoolThreadCache *cache);
+
+
 /**
 * @brief
 * @param *lastHandle
@@ -142,6 +162,17 @@ void
 pool_removeElement(J9Pool *aPool, void *anElement);
 
 
+/**
+* @brief
+* @param *aPool
+* @param *cache
+* @param *anElement
+* @return void
+*/
+void
+pool_removeElementCached(J9Pool *aPool, J9PoolThreadCache *cache, void *anElement);
+
+
 /**
 * @brief
 * @param *aPool
@@ -105,6 +105,8 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    codeCacheConfig._emitExecutableELF = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool) 
                                     ||  TR::Options::getCmdLineOptions()->getOption(TR_EmitExecutableELFFile);
    codeCacheConfig._emitRelocatableELF = TR::Options::getCmdLineOptions()->getOption(TR_EmitRelocatableELFFile);
+   codeCacheConfig._emitPerfMap = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool);
+   codeCacheConfig._emitPerfJitDump = TR::Options::getCmdLineOptions()->getOption(TR_PerfJitDump);
 
    TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
    }
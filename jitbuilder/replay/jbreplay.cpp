@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * jbreplay compiles JitBuilder recordings without the program that made them,
+ * so compile time can be measured (and compared across compiler changes) on a
+ * fixed set of methods. Recordings are made by running any JitBuilder program
+ * with TR_JitBuilderRecordDirectory set to a directory, which gets one
+ * <method name>.jbil file per compiled method. Text recordings made with
+ * JitBuilderRecorderTextFile are accepted too.
+ *
+ *    jbreplay [-n iterations] <recording or directory of recordings>...
+ *
+ * The compiled code is never run: constant addresses and the entry points of
+ * called functions are replayed verbatim and are only valid in the process
+ * that made the recording.
+ */
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "env/TRMemory.hpp"    // must precede MethodBuilder.hpp to get TR_ALLOC
+#include "ilgen/JitBuilderReplay.hpp"
+#include "ilgen/JitBuilderReplayBinaryFile.hpp"
+#include "ilgen/JitBuilderReplayTextFile.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+extern bool internal_initializeJit();
+extern int32_t internal_compileMethodBuilder(TR::MethodBuilder *methodBuilder, void **entryPoint);
+extern void internal_shutdownJit();
+
+static uint64_t
+nanoTime()
+   {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+   }
+
+static bool
+isTextRecording(const char *fileName)
+   {
+   // text recordings start with the quoted signature string, binary ones with its length
+   FILE *file = fopen(fileName, "rb");
+   if (NULL == file)
+      return false;
+   int first = fgetc(file);
+   fclose(file);
+   return first == '"';
+   }
+
+static void
+addRecordings(const char *path, std::vector<std::string> &recordings)
+   {
+   struct stat info;
+   if (0 != stat(path, &info))
+      {
+      fprintf(stderr, "jbreplay: cannot access %s\n", path);
+      return;
+      }
+
+   if (!S_ISDIR(info.st_mode))
+      {
+      recordings.push_back(path);
+      return;
+      }
+
+   DIR *dir = opendir(path);
+   if (NULL == dir)
+      {
+      fprintf(stderr, "jbreplay: cannot read directory %s\n", path);
+      return;
+      }
+
+   std::vector<std::string> found;
+   struct dirent *entry;
+   while (NULL != (entry = readdir(dir)))
+      {
+      size_t len = strlen(entry->d_name);
+      if (len > 5 && 0 == strcmp(entry->d_name + len - 5, ".jbil"))
+         found.push_back(std::string(path) + "/" + entry->d_name);
+      }
+   closedir(dir);
+
+   // report in a stable order so runs can be compared
+   std::sort(found.begin(), found.end());
+   recordings.insert(recordings.end(), found.begin(), found.end());
+   }
+
+/**
+ * @brief compiles one recording
+ * @return true if the recording compiled, with the compile time in nanoseconds in elapsed
+ */
+static bool
+compileRecording(const char *fileName, std::string &methodName, std::string &failure, uint64_t &elapsed)
+   {
+   TR::JitBuilderReplay *replay = NULL;
+   if (isTextRecording(fileName))
+      replay = new TR::JitBuilderReplayTextFile(fileName);
+   else
+      replay = new TR::JitBuilderReplayBinaryFile(fileName);
+
+   int32_t rc = 0;
+      {
+      TR::TypeDictionary types;
+      TR::MethodBuilderReplay method(&types, replay);
+      void *entry = NULL;
+
+      uint64_t start = nanoTime();
+      rc = internal_compileMethodBuilder(&method, &entry);
+      elapsed = nanoTime() - start;
+
+      methodName = method.GetMethodName();
+      }
+
+   if (0 != rc)
+      failure = (NULL != replay->failureReason()) ? replay->failureReason() : "compilation failed";
+
+   delete replay;
+   return 0 == rc;
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   int32_t iterations = 1;
+   std::vector<std::string> recordings;
+
+   for (int a = 1; a < argc; a++)
+      {
+      if (0 == strcmp(argv[a], "-n") && a + 1 < argc)
+         iterations = atoi(argv[++a]);
+      else
+         addRecordings(argv[a], recordings);
+      }
+
+   if (recordings.empty() || iterations < 1)
+      {
+      fprintf(stderr, "usage: %s [-n iterations] <recording or directory of recordings>...\n", argv[0]);
+      return 1;
+      }
+
+   if (!internal_initializeJit())
+      {
+      fprintf(stderr, "jbreplay: failed to initialize the JIT\n");
+      return 1;
+      }
+
+   int32_t failures = 0;
+   uint64_t total = 0;
+   printf("%-40s %12s %12s\n", "method", "best ms", "mean ms");
+   for (size_t r = 0; r < recordings.size(); r++)
+      {
+      const char *fileName = recordings[r].c_str();
+      std::string methodName;
+      std::string failure;
+      uint64_t best = 0;
+      uint64_t sum = 0;
+      bool compiled = true;
+
+      for (int32_t i = 0; i < iterations && compiled; i++)
+         {
+         uint64_t elapsed = 0;
+         compiled = compileRecording(fileName, methodName, failure, elapsed);
+         if (0 == i || elapsed < best)
+            best = elapsed;
+         sum += elapsed;
+         }
+
+      if (!compiled)
+         {
+         printf("%-40s %s: %s\n", methodName.c_str(), fileName, failure.c_str());
+         failures++;
+         continue;
+         }
+
+      total += sum;
+      printf("%-40s %12.3f %12.3f\n", methodName.c_str(), best / 1e6, (sum / iterations) / 1e6);
+      }
+
+   printf("%-40s %12s %12.3f\n", "total", "", (total / iterations) / 1e6);
+
+   internal_shutdownJit();
+   return (0 == failures) ? 0 : 2;
+   }
@@ -203,6 +203,31 @@ typedef enum OMR_TraceEngineInitState {
 	OMR_TRACE_ENGINE_SHUTDOWN_STARTED
 } OMR_TraceEngineInitState;
 
+typedef enum OMR_TracePublishState {
+	OMR_TRACE_PUBLISH_SYNCHRONOUS = 0, /* subscribers are called on the thread that filled the buffer */
+	OMR_TRACE_PUBLISH_ASYNCHRONOUS, /* full buffers are queued for the dispatcher threads */
+	OMR_TRACE_PUBLISH_STOPPING /* the dispatcher threads are draining the queue and exiting */
+} OMR_TracePublishState;
+
+#define UT_DEFAULT_PUBLISH_THREADS    1
+#define UT_DEFAULT_PUBLISH_QUEUE      64
+
+/*
+ * Buffers waiting to be delivered to one subscriber when publishing asynchronously,
+ * hung off UtSubscription.queueSubscription. The ring has publishQueueLimit entries,
+ * which is as many buffers as can be queued at once.
+ *
+ * Guarded by OMR_TRACEGLOBAL(subscribersLock). Only the thread recorded in dispatcher
+ * calls the subscriber, so each subscriber sees its buffers one at a time and in order.
+ */
+struct subscription {
+	OMR_TraceBuffer **ring;
+	uintptr_t head;			/* Next buffer to deliver */
+	uintptr_t tail;			/* Where the next buffer is queued */
+	omrthread_t dispatcher;	/* Thread delivering from the ring, NULL if none */
+};
+typedef struct subscription OMR_TraceSubscriberQueue;
+
 #define OMR_TRACE_ENGINE_IS_ENABLED(initState)	\
 	(((initState) >= OMR_TRACE_ENGINE_ENABLED) && ((initState) <= OMR_TRACE_ENGINE_SHUTDOWN_STARTED))
 
@@ -251,6 +276,18 @@ struct OMR_TraceGlobal {
 	omrthread_monitor_t bufferPoolLock;	/* Lock for buffer pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
 	J9Pool *threadPool;				/* Pool for allocating all UtThreadData */
 	omrthread_monitor_t threadPoolLock;	/* Lock for thread pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
+	uint32_t publishThreads;		/* Number of dispatcher threads requested by -Xtrace:asyncpublish, 0 to publish synchronously */
+	uint32_t publishQueueLimit;		/* Buffers that may wait for dispatch before tracing threads are held back */
+	int32_t publishDropOnOverflow;	/* Discard full buffers rather than wait when the publish queue is full */
+	volatile uint32_t publishState;	/* OMR_TracePublishState */
+	volatile uint32_t publishDispatchers;	/* Number of dispatcher threads running */
+	OMR_TraceBuffer *volatile publishQueue;	/* Buffers waiting to be passed to the subscriber queues, most recently queued first */
+	volatile uintptr_t publishQueueDepth;	/* Buffers queued and not yet consumed by every subscriber */
+	omrthread_monitor_t publishLock;	/* Guards publishState and publishDispatchers, and wakes tracing threads held back by a full queue */
+	volatile uint64_t buffersPublished;	/* Publish statistics, see OMR_TracePublishStatistics */
+	volatile uint64_t buffersQueued;
+	volatile uint64_t buffersDropped;
+	volatile uint64_t backpressureWaits;
 };
 
 /*
@@ -544,6 +581,58 @@ omr_error_t releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf
  */
 OMR_TraceBuffer *recycleTraceBuffer(OMR_TraceThread *currentThr);
 
+/**
+ * @brief Start the threads that dispatch published buffers to subscribers.
+ *
+ * Does nothing unless asynchronous publishing was requested by -Xtrace:asyncpublish.
+ *
+ * @pre attached to omrthread
+ * @return an OMR error code
+ */
+omr_error_t startPublishDispatchers(void);
+
+/**
+ * @brief Deliver every queued buffer and stop the dispatcher threads.
+ *
+ * Buffers published after this are delivered synchronously.
+ *
+ * @param[in] currentThr The current thread. May be NULL.
+ */
+void stopPublishDispatchers(OMR_TraceThread *currentThr);
+
+/**
+ * @brief Deliver every buffer queued so far to the subscribers, and recycle the buffers.
+ *
+ * @param[in] currentThr The current thread. May be NULL.
+ */
+void drainPublishQueue(OMR_TraceThread *currentThr);
+
+/**
+ * @brief Give a new subscription its own publish queue, if publishing asynchronously.
+ *
+ * @param[in] subscription The subscription.
+ * @return an OMR error code
+ */
+omr_error_t allocateSubscriberQueue(UtSubscription *subscription);
+
+/**
+ * @brief Wait until no other thread is calling a subscriber with buffers from its publish queue.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock), which is released while waiting
+ * @param[in] subscription The subscription.
+ * @return TRUE if the subscription still exists, FALSE if it was destroyed while waiting
+ */
+BOOLEAN waitForSubscriberDispatch(UtSubscription *subscription);
+
+/**
+ * @brief Release the buffers still queued for a subscription that is being destroyed.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock)
+ * @param[in] currentThr The current thread. May be NULL.
+ * @param[in] subscription The subscription.
+ */
+void detachSubscriberQueue(OMR_TraceThread *currentThr, UtSubscription *subscription);
+
 /*
  * =============================================================================
  *  Externs
@@ -91,6 +91,12 @@ omr_trc_startup(OMR_VM *omrVM, const OMR_TraceLanguageInterface *languageIntf, c
 		}
 	}
 
+	rc = startPublishDispatchers();
+	if (OMR_ERROR_NONE != rc) {
+		omrtty_printf("omr_trc_startup: failed to start trace publish dispatcher threads, rc=%d\n", rc);
+		goto done;
+	}
+
 	omrVM->_trcEngine = newTrcEngine;
 done:
 	return rc;
@@ -196,6 +202,10 @@ omr_trc_preForkHandler(void)
 		omrthread_monitor_enter(OMR_TRACEGLOBAL(threadPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global thread pool lock.\n"));
 
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global publish queue lock.\n"));
+		omrthread_monitor_enter(OMR_TRACEGLOBAL(publishLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global publish queue lock.\n"));
+
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global buffer pool lock.\n"));
 		omrthread_monitor_enter(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global buffer pool lock.\n"));
@@ -209,6 +219,9 @@ omr_trc_postForkParentHandler(void)
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global buffer pool lock.\n"));
 
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(publishLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global publish queue lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(threadPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global thread pool lock.\n"));
 
@@ -235,6 +248,9 @@ omr_trc_postForkChildHandler(void)
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global buffer pool lock.\n"));
 
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(publishLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global publish queue lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(threadPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global thread pool lock.\n"));
 
@@ -269,6 +285,9 @@ postForkCleanupGlobals(OMR_TraceThread *thr)
 	}
 	OMR_TRACEGLOBAL(lastPrint) = NULL;
 	OMR_TRACEGLOBAL(lostRecords) = 0;
+	/* The dispatcher threads do not exist in the child, so tracing threads deliver their own buffers. */
+	OMR_TRACEGLOBAL(publishState) = OMR_TRACE_PUBLISH_SYNCHRONOUS;
+	OMR_TRACEGLOBAL(publishDispatchers) = 0;
 #if OMR_ENABLE_EXCEPTION_OUTPUT
 	OMR_TRACEGLOBAL(exceptionTrcBuf) = NULL;
 	OMR_TRACEGLOBAL(exceptionContext) = NULL;
@@ -280,6 +299,16 @@ postForkCleanupBuffers(OMR_TraceThread *thr)
 {
 	/* Clear all buffers in the pool and in freeQueue. */
 	OMR_TRACEGLOBAL(freeQueue) = NULL;
+	OMR_TRACEGLOBAL(publishQueue) = NULL;
+	OMR_TRACEGLOBAL(publishQueueDepth) = 0;
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); NULL != subscription; subscription = subscription->next) {
+		OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+		if (NULL != queue) {
+			queue->head = 0;
+			queue->tail = 0;
+			queue->dispatcher = NULL;
+		}
+	}
 	if (NULL != thr) {
 		thr->trcBuf = NULL;
 	}
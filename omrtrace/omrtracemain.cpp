@@ -46,6 +46,7 @@ omrthread_tls_key_t j9uteTLSKey;
 
 static omr_error_t trcFlushTraceData(OMR_TraceThread *thr);
 static omr_error_t trcGetTraceMetadata(void **data, int32_t *length);
+static omr_error_t trcGetPublishStatistics(OMR_TracePublishStatistics *stats);
 static omr_error_t trcSetOptions(OMR_TraceThread *thr, const char *opts[]);
 static omr_error_t moduleLoaded(OMR_TraceThread *thr, UtModuleInfo *modInfo);
 static omr_error_t moduleUnLoading(OMR_TraceThread *thr, UtModuleInfo *modInfo);
@@ -310,6 +311,11 @@ utTerminateTrace(void)
 		listCounters();
 	}
 
+	/* Deliver the buffers still queued for the subscribers. Buffers published from now on,
+	 * including those of the threads that have yet to stop, are delivered synchronously.
+	 */
+	stopPublishDispatchers(twThreadSelf());
+
 	if (OMR_TRACEGLOBAL(lostRecords) != 0) {
 		UT_DBGOUT(1, ("<UT> Discarded %d trace buffers\n", OMR_TRACEGLOBAL(lostRecords)));
 	}
@@ -406,6 +412,9 @@ freeTrace(void)
 	omrthread_monitor_destroy(global->freeQueueLock);
 	global->freeQueueLock = NULL;
 
+	omrthread_monitor_destroy(global->publishLock);
+	global->publishLock = NULL;
+
 	omrthread_monitor_destroy(global->traceLock);
 	global->traceLock = NULL;
 
@@ -499,6 +508,7 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 
 	tempGbl.dynamicBuffers = TRUE;
 	tempGbl.bufferSize = UT_DEFAULT_BUFFERSIZE;
+	tempGbl.publishQueueLimit = UT_DEFAULT_PUBLISH_QUEUE;
 
 	/* Make the trace functions available to the rest of OMR */
 	/* OMRTODO Remove this. GC uses it to register the module.
@@ -553,6 +563,11 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
+	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(publishLock), 0, "Global Trace Publish Queue")) {
+		UT_DBGOUT(1, ("<UT> Initialization of publishLock failed\n"));
+		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+		goto fail;
+	}
 	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(bufferPoolLock), 0, "Global Trace Buffer Pool")) {
 		UT_DBGOUT(1, ("<UT> Initialization of bufferPoolLock failed\n"));
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
@@ -677,6 +692,7 @@ trcRegisterRecordSubscriber(OMR_TraceThread *thr, const char *description, utsSu
 	subscription->alarm = alarm;
 	subscription->next = NULL;
 	subscription->prev = NULL;
+	subscription->queueSubscription = NULL;
 	if (description == NULL) {
 		description = "Trace Subscriber [unnamed]";
 	}
@@ -689,6 +705,12 @@ trcRegisterRecordSubscriber(OMR_TraceThread *thr, const char *description, utsSu
 	}
 	strcpy(subscription->description, description);
 
+	result = allocateSubscriberQueue(subscription);
+	if (OMR_ERROR_NONE != result) {
+		UT_DBGOUT(1, ("<UT thr=" UT_POINTER_SPEC "> Out of memory allocating publish queue\n", thr));
+		goto out;
+	}
+
 	enlistRecordSubscriber(subscription);
 
 out:
@@ -734,7 +756,8 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 	omrthread_monitor_enter(OMR_TRACEGLOBAL(subscribersLock));
 	UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> Lock acquired for deregistration\n", thr));
 
-	if (findRecordSubscriber(subscriptionID)) {
+	/* A dispatcher thread may be calling the subscriber; it must not be destroyed under it. */
+	if (findRecordSubscriber(subscriptionID) && waitForSubscriberDispatch(subscriptionID)) {
 		getTraceLock(thr);
 		destroyRecordSubscriber(thr, subscriptionID, TRUE);
 		freeTraceLock(thr);
@@ -760,6 +783,9 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 static omr_error_t
 trcFlushTraceData(OMR_TraceThread *thr)
 {
+	if (OMR_TRACE_PUBLISH_ASYNCHRONOUS == OMR_TRACEGLOBAL(publishState)) {
+		drainPublishQueue(thr);
+	}
 	return OMR_ERROR_NONE;
 }
 
@@ -791,6 +817,28 @@ trcGetTraceMetadata(void **data, int32_t *length)
 	return OMR_ERROR_NONE;
 }
 
+/*******************************************************************************
+ * name        - trcGetPublishStatistics
+ * description - Retrieves the counters describing how buffers were published
+ * parameters  - stats
+ * returns     - Success or error code
+ ******************************************************************************/
+static omr_error_t
+trcGetPublishStatistics(OMR_TracePublishStatistics *stats)
+{
+	if (NULL == stats) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	stats->buffersPublished = VM_AtomicSupport::getU64(&OMR_TRACEGLOBAL(buffersPublished));
+	stats->buffersQueued = VM_AtomicSupport::getU64(&OMR_TRACEGLOBAL(buffersQueued));
+	stats->buffersDropped = VM_AtomicSupport::getU64(&OMR_TRACEGLOBAL(buffersDropped));
+	stats->backpressureWaits = VM_AtomicSupport::getU64(&OMR_TRACEGLOBAL(backpressureWaits));
+	stats->queueDepth = OMR_TRACEGLOBAL(publishQueueDepth);
+
+	return OMR_ERROR_NONE;
+}
+
 static omr_error_t
 trcSetOptions(OMR_TraceThread *thr, const char *opts[])
 {
@@ -841,6 +889,7 @@ fillInUTInterfaces(UtInterface **utIntf, OMR_TraceInterface *omrTraceIntf, UtMod
 		omrTraceIntf->FlushTraceData				= trcFlushTraceData;
 		omrTraceIntf->GetTraceMetadata				= trcGetTraceMetadata;
 		omrTraceIntf->SetOptions					= trcSetOptions;
+		omrTraceIntf->GetPublishStatistics			= trcGetPublishStatistics;
 
 		/*
 		 * Initialize the direct module interface, these are
@@ -912,6 +961,7 @@ deleteRecordSubscriber(OMR_TraceGlobal *global, UtSubscription *subscription)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(global->portLibrary);
 	omrmem_free_memory(subscription->description);
+	omrmem_free_memory(subscription->queueSubscription);
 	omrmem_free_memory(subscription);
 }
 
@@ -965,6 +1015,7 @@ destroyRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription, BOOL
 	 * if it was not enlisted.
 	 */
 	delistRecordSubscriber(subscription);
+	detachSubscriberQueue(thr, subscription);
 
 	if (NULL == OMR_TRACEGLOBAL(subscribers)) {
 		OMR_TRACEGLOBAL(traceInCore) = TRUE;
@@ -61,6 +61,7 @@ static omr_error_t setException(OMR_TraceThread *thr, const char *value, BOOLEAN
 static omr_error_t setOutput(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 #endif /* OMR_ALLOW_OUTPUT_OPTION */
 static omr_error_t setBuffers(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
+static omr_error_t setAsyncPublish(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t setSuspendResumeCount(OMR_TraceThread *thr, const char *value, int32_t resume, BOOLEAN atRuntime);
 static omr_error_t processSuspendOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t processResumeOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
@@ -94,6 +95,7 @@ const OMR_TraceOption UTE_OPTIONS[] = {
 	{UT_OUTPUT_KEYWORD, FALSE, setOutput},
 #endif /* OMR_ALLOW_OUTPUT_OPTION */
 	{UT_BUFFERS_KEYWORD, TRUE, setBuffers}, /* Not all buffers functions are exposed - but are controlled in the set function*/
+	{UT_ASYNC_PUBLISH_KEYWORD, FALSE, setAsyncPublish},
 	{UT_SUSPEND_KEYWORD, TRUE, processSuspendOption},
 	{UT_RESUME_KEYWORD, TRUE, processResumeOption},
 	{UT_RESUME_COUNT_KEYWORD, TRUE, processResumeOption},
@@ -271,6 +273,68 @@ end:
 	return rc;
 }
 
+/*******************************************************************************
+ * name        - setAsyncPublish
+ * description - Publish full buffers to subscribers from dispatcher threads
+ * parameters  - thr, string value of the property ([threads[,queue]][,drop|,block]), atRuntime
+ * returns     - UTE return code
+ ******************************************************************************/
+static omr_error_t
+setAsyncPublish(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	uint32_t publishThreads = UT_DEFAULT_PUBLISH_THREADS;
+	uint32_t publishQueueLimit = OMR_TRACEGLOBAL(publishQueueLimit);
+	int32_t dropOnOverflow = FALSE;
+	int numbersSeen = 0;
+
+	if ((NULL != value) && ('\0' != *value)) {
+		const int numberOfArgs = getParmNumber(value);
+
+		for (int i = 0; i < numberOfArgs; i++) {
+			int argSize = 0;
+			const char *startOfThisArg = getPositionalParm(i + 1, value, &argSize);
+
+			if (0 == argSize) {
+				reportCommandLineError(atRuntime, "Empty option passed to -Xtrace:asyncpublish");
+				return OMR_ERROR_ILLEGAL_ARGUMENT;
+			}
+
+			if ((4 == argSize) && (0 == j9_cmdla_strnicmp(startOfThisArg, "DROP", argSize))) {
+				dropOnOverflow = TRUE;
+			} else if ((5 == argSize) && (0 == j9_cmdla_strnicmp(startOfThisArg, "BLOCK", argSize))) {
+				dropOnOverflow = FALSE;
+			} else if (numbersSeen < 2) {
+				int number = decimalString2Int(startOfThisArg, FALSE, &rc, atRuntime);
+				if (OMR_ERROR_NONE != rc) {
+					return OMR_ERROR_ILLEGAL_ARGUMENT;
+				}
+				if (number < 1) {
+					reportCommandLineError(atRuntime, "-Xtrace:asyncpublish thread and queue counts must be at least 1");
+					return OMR_ERROR_ILLEGAL_ARGUMENT;
+				}
+				if (0 == numbersSeen) {
+					publishThreads = (uint32_t)number;
+				} else {
+					publishQueueLimit = (uint32_t)number;
+				}
+				numbersSeen += 1;
+			} else {
+				reportCommandLineError(atRuntime, "Invalid option for -Xtrace:asyncpublish - \"%s\"", value);
+				return OMR_ERROR_ILLEGAL_ARGUMENT;
+			}
+		}
+	}
+
+	OMR_TRACEGLOBAL(publishThreads) = publishThreads;
+	OMR_TRACEGLOBAL(publishQueueLimit) = publishQueueLimit;
+	OMR_TRACEGLOBAL(publishDropOnOverflow) = dropOnOverflow;
+
+	UT_DBGOUT(1, ("<UT> Asynchronous publishing: %u threads, %u queued buffers, %s when full\n",
+		publishThreads, publishQueueLimit, dropOnOverflow ? "drop" : "block"));
+	return rc;
+}
+
 /*******************************************************************************
  * name        - setMinimal
  * description - Set the minimal trace options
@@ -20,11 +20,22 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
 #include "AtomicSupport.hpp"
 
 #include "omrtrace_internal.h"
 #include "thread_api.h"
 
+static void deliverTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static void queueTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static BOOLEAN reservePublishQueueSpace(OMR_TraceThread *currentThr);
+static void fanOutPublishedBuffers(OMR_TraceThread *currentThr);
+static UtSubscription *claimSubscriberQueue(BOOLEAN *othersDispatching);
+static void dispatchToSubscriber(OMR_TraceThread *currentThr, UtSubscription *subscription);
+static void releasePublishReference(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static int J9THREAD_PROC publishDispatcherMain(void *entryArg);
+
 omr_error_t
 publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
@@ -49,39 +60,482 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		/* CAS is not needed because flags is modified only by the thread that owns the buffer */
 		buf->flags = newFlags;
 
-		omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
-		omrthread_monitor_enter(subscribersLock);
+		if (0 != OMR_TRACEGLOBAL(publishThreads)) {
+			/* The buffer is released once every subscriber has seen it. Once the dispatcher
+			 * threads have stopped, this thread delivers it from the queue itself.
+			 */
+			queueTraceBuffer(currentThr, buf);
+			buf = NULL;
+		} else {
+			omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+			omrthread_monitor_enter(subscribersLock);
+			deliverTraceBuffer(currentThr, buf);
+			omrthread_monitor_exit(subscribersLock);
+		}
+	}
+	if (NULL != buf) {
+		releaseTraceBuffer(currentThr, buf);
+	}
+
+	decrementRecursionCounter(currentThr);
+	return rc;
+}
+
+/**
+ * Pass a full buffer to every subscriber.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock)
+ */
+static void
+deliverTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
+		subscription->data = &(buf->record);
+
+		omr_error_t subscriberRc = subscription->subscriber(subscription);
+		if (OMR_ERROR_NONE != subscriberRc) {
+			/* If the subscriber callback fails, call the alarm callback and
+			 * remove the subscription.
+			 */
+			UtSubscription *subscriptionToDestroy = subscription;
+
+			/* adjust the loop iterator */
+			subscription = subscriptionToDestroy->prev;
+
+			getTraceLock(currentThr);
+			destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
+			freeTraceLock(currentThr);
+
+			if (NULL == subscription) {
+				break;
+			}
+		}
+	}
+	VM_AtomicSupport::addU64(&OMR_TRACEGLOBAL(buffersPublished), 1);
+}
+
+/**
+ * Hand a full buffer to the dispatcher threads.
+ *
+ * The buffer is pushed onto a lock-free list, so a tracing thread never waits for
+ * the subscribers unless publishQueueLimit buffers are still waiting for one of them.
+ */
+static void
+queueTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	/* The owning thread may be gone by the time the buffer is dispatched. */
+	buf->thr = NULL;
+
+	if (!reservePublishQueueSpace(currentThr)) {
+		VM_AtomicSupport::addU64(&OMR_TRACEGLOBAL(buffersDropped), 1);
+		VM_AtomicSupport::addU32((volatile uint32_t *)&OMR_TRACEGLOBAL(lostRecords), 1);
+		releaseTraceBuffer(currentThr, buf);
+		return;
+	}
+
+	OMR_TraceBuffer *head = NULL;
+	do {
+		head = OMR_TRACEGLOBAL(publishQueue);
+		buf->next = head;
+	} while ((uintptr_t)head != VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueue), (uintptr_t)head, (uintptr_t)buf));
+	VM_AtomicSupport::addU64(&OMR_TRACEGLOBAL(buffersQueued), 1);
+
+	if (NULL == head) {
+		/* The dispatchers only wait when the list is empty, and check it while holding subscribersLock. */
+		omrthread_monitor_enter(OMR_TRACEGLOBAL(subscribersLock));
+		omrthread_monitor_notify_all(OMR_TRACEGLOBAL(subscribersLock));
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(subscribersLock));
+	}
+
+	/* If the dispatchers were stopped while the buffer was being queued they may
+	 * have missed it, so deliver it from here.
+	 */
+	VM_AtomicSupport::readWriteBarrier();
+	if (OMR_TRACE_PUBLISH_ASYNCHRONOUS != OMR_TRACEGLOBAL(publishState)) {
+		drainPublishQueue(currentThr);
+	}
+}
+
+/**
+ * Count a buffer against publishQueueLimit, holding the current thread back until
+ * there is room unless full buffers are to be dropped.
+ *
+ * The limit is never exceeded, so that the subscriber queues cannot overflow.
+ *
+ * @return TRUE if the buffer may be queued, FALSE if it must be dropped
+ */
+static BOOLEAN
+reservePublishQueueSpace(OMR_TraceThread *currentThr)
+{
+	omrthread_monitor_t const publishLock = OMR_TRACEGLOBAL(publishLock);
+	const uintptr_t limit = OMR_TRACEGLOBAL(publishQueueLimit);
+	BOOLEAN waited = FALSE;
+
+	for (;;) {
+		uintptr_t depth = OMR_TRACEGLOBAL(publishQueueDepth);
+		if (depth < limit) {
+			if (depth == VM_AtomicSupport::lockCompareExchange(&OMR_TRACEGLOBAL(publishQueueDepth), depth, depth + 1)) {
+				return TRUE;
+			}
+		} else if (OMR_TRACE_PUBLISH_ASYNCHRONOUS != OMR_TRACEGLOBAL(publishState)) {
+			/* Nothing else will make room */
+			drainPublishQueue(currentThr);
+		} else if (OMR_TRACEGLOBAL(publishDropOnOverflow)) {
+			return FALSE;
+		} else {
+			if (!waited) {
+				VM_AtomicSupport::addU64(&OMR_TRACEGLOBAL(backpressureWaits), 1);
+				waited = TRUE;
+			}
+			omrthread_monitor_enter(publishLock);
+			if ((OMR_TRACEGLOBAL(publishQueueDepth) >= limit)
+				&& (OMR_TRACE_PUBLISH_ASYNCHRONOUS == OMR_TRACEGLOBAL(publishState))
+			) {
+				omrthread_monitor_wait(publishLock);
+			}
+			omrthread_monitor_exit(publishLock);
+		}
+	}
+}
+
+/**
+ * Move the buffers on the lock-free list to the queue of every subscriber, in the
+ * order they were published.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock)
+ */
+static void
+fanOutPublishedBuffers(OMR_TraceThread *currentThr)
+{
+	OMR_TraceBuffer *buf = (OMR_TraceBuffer *)VM_AtomicSupport::lockExchange((volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueue), 0);
+	if (NULL == buf) {
+		return;
+	}
+
+	/* The list holds the most recently published buffer first. */
+	OMR_TraceBuffer *batch = NULL;
+	while (NULL != buf) {
+		OMR_TraceBuffer *next = buf->next;
+		buf->next = batch;
+		batch = buf;
+		buf = next;
+	}
+
+	uintptr_t subscriberCount = 0;
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		subscriberCount += 1;
+	}
+
+	const uintptr_t limit = OMR_TRACEGLOBAL(publishQueueLimit);
+	while (NULL != batch) {
+		buf = batch;
+		batch = buf->next;
+		buf->next = NULL;
+		buf->publishRefs = subscriberCount;
 		for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
-			subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
-			subscription->data = &(buf->record);
-
-			omr_error_t subscriberRc = subscription->subscriber(subscription);
-			if (OMR_ERROR_NONE != subscriberRc) {
-				/* If the subscriber callback fails, call the alarm callback and
-				 * remove the subscription.
-				 */
-				UtSubscription *subscriptionToDestroy = subscription;
-
-				/* adjust the loop iterator */
-				subscription = subscriptionToDestroy->prev;
-
-				getTraceLock(currentThr);
-				destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
-				freeTraceLock(currentThr);
-
-				if (NULL == subscription) {
-					break;
-				}
+			OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+			queue->ring[queue->tail % limit] = buf;
+			queue->tail += 1;
+		}
+		if (0 == subscriberCount) {
+			buf->publishRefs = 1;
+			releasePublishReference(currentThr, buf);
+		}
+	}
+
+	/* other dispatchers can now serve the other subscribers */
+	omrthread_monitor_notify_all(OMR_TRACEGLOBAL(subscribersLock));
+}
+
+/**
+ * Find a subscriber with buffers to deliver that no other thread is delivering to,
+ * and make the current thread its dispatcher.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock)
+ * @param[out] othersDispatching set to TRUE if another thread is delivering buffers to a subscriber
+ * @return the subscription, or NULL if there is nothing to deliver
+ */
+static UtSubscription *
+claimSubscriberQueue(BOOLEAN *othersDispatching)
+{
+	omrthread_t const self = omrthread_self();
+
+	*othersDispatching = FALSE;
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+		if (NULL == queue->dispatcher) {
+			if (queue->head != queue->tail) {
+				queue->dispatcher = self;
+				return subscription;
 			}
+		} else if (self != queue->dispatcher) {
+			*othersDispatching = TRUE;
 		}
-		omrthread_monitor_exit(subscribersLock);
 	}
-	releaseTraceBuffer(currentThr, buf);
+	return NULL;
+}
+
+/**
+ * Deliver the buffers queued for a subscriber.
+ *
+ * subscribersLock is released while the subscriber is called, so that the other
+ * subscribers can be served at the same time.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock), and the current thread is the subscriber's dispatcher
+ */
+static void
+dispatchToSubscriber(OMR_TraceThread *currentThr, UtSubscription *subscription)
+{
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+	const uintptr_t limit = OMR_TRACEGLOBAL(publishQueueLimit);
+	const uintptr_t end = queue->tail;
+	uintptr_t next = queue->head;
+	omr_error_t subscriberRc = OMR_ERROR_NONE;
+
+	omrthread_monitor_exit(subscribersLock);
+
+	/* Entries up to end are not touched by anyone else until head moves past them. */
+	while ((next != end) && (OMR_ERROR_NONE == subscriberRc)) {
+		OMR_TraceBuffer *buf = queue->ring[next % limit];
+		next += 1;
+
+		subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
+		subscription->data = &(buf->record);
+		subscriberRc = subscription->subscriber(subscription);
+
+		releasePublishReference(currentThr, buf);
+	}
+
+	omrthread_monitor_enter(subscribersLock);
+	queue->head = next;
+	queue->dispatcher = NULL;
+	if (OMR_ERROR_NONE != subscriberRc) {
+		/* If the subscriber callback fails, call the alarm callback and
+		 * remove the subscription.
+		 */
+		getTraceLock(currentThr);
+		destroyRecordSubscriber(currentThr, subscription, 1);
+		freeTraceLock(currentThr);
+	}
+	/* wake threads waiting for this subscriber to be idle */
+	omrthread_monitor_notify_all(subscribersLock);
+}
+
+/**
+ * Drop a subscriber's reference to a queued buffer. The last subscriber to consume
+ * the buffer recycles it and makes room for another.
+ */
+static void
+releasePublishReference(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	if (0 == VM_AtomicSupport::subtract(&buf->publishRefs, 1)) {
+		VM_AtomicSupport::addU64(&OMR_TRACEGLOBAL(buffersPublished), 1);
+		releaseTraceBuffer(currentThr, buf);
+
+		VM_AtomicSupport::subtract(&OMR_TRACEGLOBAL(publishQueueDepth), 1);
+
+		/* wake any tracing threads held back by a full queue */
+		omrthread_monitor_enter(OMR_TRACEGLOBAL(publishLock));
+		omrthread_monitor_notify_all(OMR_TRACEGLOBAL(publishLock));
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(publishLock));
+	}
+}
+
+void
+drainPublishQueue(OMR_TraceThread *currentThr)
+{
+	OMR_TraceThread dispatcherThr;
+
+	if (NULL == currentThr) {
+		/* Only used to count recursion, so tracepoints taken by subscribers are not logged against another thread. */
+		memset(&dispatcherThr, 0, sizeof(dispatcherThr));
+		currentThr = &dispatcherThr;
+	}
+	incrementRecursionCounter(currentThr);
+
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	omrthread_monitor_enter(subscribersLock);
+	for (;;) {
+		BOOLEAN othersDispatching = FALSE;
+		fanOutPublishedBuffers(currentThr);
+		UtSubscription *subscription = claimSubscriberQueue(&othersDispatching);
+		if (NULL != subscription) {
+			dispatchToSubscriber(currentThr, subscription);
+		} else if (othersDispatching) {
+			/* the buffers being delivered by other threads are not drained yet */
+			omrthread_monitor_wait(subscribersLock);
+		} else {
+			break;
+		}
+	}
+	omrthread_monitor_exit(subscribersLock);
 
 	decrementRecursionCounter(currentThr);
+}
+
+static int J9THREAD_PROC
+publishDispatcherMain(void *entryArg)
+{
+	omrthread_monitor_t const publishLock = OMR_TRACEGLOBAL(publishLock);
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	OMR_TraceThread dispatcherThr;
+
+	/* Only used to count recursion, so tracepoints taken by subscribers are not logged against another thread. */
+	memset(&dispatcherThr, 0, sizeof(dispatcherThr));
+
+	omrthread_monitor_enter(publishLock);
+	OMR_TRACEGLOBAL(publishDispatchers) += 1;
+	omrthread_monitor_notify_all(publishLock);
+	omrthread_monitor_exit(publishLock);
+
+	incrementRecursionCounter(&dispatcherThr);
+	omrthread_monitor_enter(subscribersLock);
+	while (OMR_TRACE_PUBLISH_ASYNCHRONOUS == OMR_TRACEGLOBAL(publishState)) {
+		BOOLEAN othersDispatching = FALSE;
+		fanOutPublishedBuffers(&dispatcherThr);
+		UtSubscription *subscription = claimSubscriberQueue(&othersDispatching);
+		if (NULL != subscription) {
+			dispatchToSubscriber(&dispatcherThr, subscription);
+		} else {
+			omrthread_monitor_wait(subscribersLock);
+		}
+	}
+	omrthread_monitor_exit(subscribersLock);
+	decrementRecursionCounter(&dispatcherThr);
+
+	/* deliver everything queued before the stop request */
+	drainPublishQueue(NULL);
+
+	omrthread_monitor_enter(publishLock);
+	OMR_TRACEGLOBAL(publishDispatchers) -= 1;
+	omrthread_monitor_notify_all(publishLock);
+	omrthread_exit(publishLock);
+	return 0;
+}
+
+omr_error_t
+startPublishDispatchers(void)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	const uint32_t publishThreads = OMR_TRACEGLOBAL(publishThreads);
+
+	if (0 != publishThreads) {
+		omrthread_monitor_t const publishLock = OMR_TRACEGLOBAL(publishLock);
+		uint32_t started = 0;
+
+		omrthread_monitor_enter(publishLock);
+		OMR_TRACEGLOBAL(publishState) = OMR_TRACE_PUBLISH_ASYNCHRONOUS;
+		for (uint32_t i = 0; i < publishThreads; i++) {
+			if (J9THREAD_SUCCESS == omrthread_create_ex(NULL, J9THREAD_ATTR_DEFAULT, FALSE, publishDispatcherMain, NULL)) {
+				started += 1;
+			} else {
+				UT_DBGOUT(1, ("<UT> Unable to start trace publish dispatcher thread %u\n", i));
+			}
+		}
+		if (0 == started) {
+			OMR_TRACEGLOBAL(publishState) = OMR_TRACE_PUBLISH_SYNCHRONOUS;
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			while (OMR_TRACEGLOBAL(publishDispatchers) < started) {
+				omrthread_monitor_wait(publishLock);
+			}
+			UT_DBGOUT(1, ("<UT> Started %u trace publish dispatcher threads\n", started));
+		}
+		omrthread_monitor_exit(publishLock);
+	}
+	return rc;
+}
+
+void
+stopPublishDispatchers(OMR_TraceThread *currentThr)
+{
+	omrthread_monitor_t const publishLock = OMR_TRACEGLOBAL(publishLock);
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+
+	omrthread_monitor_enter(publishLock);
+	if (OMR_TRACE_PUBLISH_ASYNCHRONOUS == OMR_TRACEGLOBAL(publishState)) {
+		OMR_TRACEGLOBAL(publishState) = OMR_TRACE_PUBLISH_STOPPING;
+		/* tracing threads held back by a full queue drain it themselves from now on */
+		omrthread_monitor_notify_all(publishLock);
+		omrthread_monitor_exit(publishLock);
+
+		/* The dispatchers wait on subscribersLock; never take it while holding publishLock. */
+		omrthread_monitor_enter(subscribersLock);
+		omrthread_monitor_notify_all(subscribersLock);
+		omrthread_monitor_exit(subscribersLock);
+
+		omrthread_monitor_enter(publishLock);
+		while (0 != OMR_TRACEGLOBAL(publishDispatchers)) {
+			omrthread_monitor_wait(publishLock);
+		}
+		OMR_TRACEGLOBAL(publishState) = OMR_TRACE_PUBLISH_SYNCHRONOUS;
+		UT_DBGOUT(1, ("<UT> Trace publish dispatcher threads stopped, %llu buffers queued, %llu dropped, %llu waits for queue space\n",
+			(unsigned long long)OMR_TRACEGLOBAL(buffersQueued), (unsigned long long)OMR_TRACEGLOBAL(buffersDropped),
+			(unsigned long long)OMR_TRACEGLOBAL(backpressureWaits)));
+	}
+	omrthread_monitor_exit(publishLock);
+
+	/* pick up anything queued by a thread that raced with the stop request */
+	if (0 != OMR_TRACEGLOBAL(publishThreads)) {
+		drainPublishQueue(currentThr);
+	}
+}
+
+omr_error_t
+allocateSubscriberQueue(UtSubscription *subscription)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if (0 != OMR_TRACEGLOBAL(publishThreads)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+		const uintptr_t ringSize = sizeof(OMR_TraceBuffer *) * OMR_TRACEGLOBAL(publishQueueLimit);
+		OMR_TraceSubscriberQueue *queue = (OMR_TraceSubscriberQueue *)omrmem_allocate_memory(sizeof(OMR_TraceSubscriberQueue) + ringSize, OMRMEM_CATEGORY_TRACE);
+		if (NULL == queue) {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			queue->ring = (OMR_TraceBuffer **)(queue + 1);
+			queue->head = 0;
+			queue->tail = 0;
+			queue->dispatcher = NULL;
+			subscription->queueSubscription = queue;
+		}
+	}
 	return rc;
 }
 
+BOOLEAN
+waitForSubscriberDispatch(UtSubscription *subscription)
+{
+	omrthread_t const self = omrthread_self();
+
+	for (;;) {
+		/* the dispatcher destroys the subscription if the subscriber fails */
+		if (!findRecordSubscriber(subscription)) {
+			return FALSE;
+		}
+		OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+		if ((NULL == queue) || (NULL == queue->dispatcher) || (self == queue->dispatcher)) {
+			return TRUE;
+		}
+		omrthread_monitor_wait(OMR_TRACEGLOBAL(subscribersLock));
+	}
+}
+
+void
+detachSubscriberQueue(OMR_TraceThread *currentThr, UtSubscription *subscription)
+{
+	OMR_TraceSubscriberQueue *queue = subscription->queueSubscription;
+
+	if (NULL != queue) {
+		const uintptr_t limit = OMR_TRACEGLOBAL(publishQueueLimit);
+		for (; queue->head != queue->tail; queue->head += 1) {
+			releasePublishReference(currentThr, queue->ring[queue->head % limit]);
+		}
+	}
+}
+
 omr_error_t
 releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
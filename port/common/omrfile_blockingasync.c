@@ -24,6 +24,10 @@
  * @file
  * @ingroup Port
  * @brief file
+ *
+ * Blocking file operations on descriptors that may also be used with the
+ * asynchronous queues in @ref omrfileasync.c. Where the platform has no
+ * separate asynchronous descriptor type these defer to the omrfile operations.
  */
 
 #include "omrport.h"
@@ -43,7 +47,7 @@
 int32_t
 omrfile_blockingasync_close(struct OMRPortLibrary *portLibrary, intptr_t fd)
 {
-	return -1;
+	return portLibrary->file_close(portLibrary, fd);
 }
 
 /**
@@ -60,7 +64,7 @@ omrfile_blockingasync_close(struct OMRPortLibrary *portLibrary, intptr_t fd)
 intptr_t
 omrfile_blockingasync_open(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags, int32_t mode)
 {
-	return -1;
+	return portLibrary->file_open(portLibrary, path, flags, mode);
 }
 
 /**
@@ -82,7 +86,7 @@ omrfile_blockingasync_open(struct OMRPortLibrary *portLibrary, const char *path,
 int32_t
 omrfile_blockingasync_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length)
 {
-	return -1;
+	return portLibrary->file_lock_bytes(portLibrary, fd, lockFlags, offset, length);
 }
 
 
@@ -100,7 +104,7 @@ omrfile_blockingasync_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd
 int32_t
 omrfile_blockingasync_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t offset, uint64_t length)
 {
-	return -1;
+	return portLibrary->file_unlock_bytes(portLibrary, fd, offset, length);
 }
 /**
  * Read bytes from a file descriptor into a user provided buffer.
@@ -115,7 +119,7 @@ omrfile_blockingasync_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t
 intptr_t
 omrfile_blockingasync_read(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes)
 {
-	return -1;
+	return portLibrary->file_read(portLibrary, fd, buf, nbytes);
 }
 
 
@@ -134,7 +138,7 @@ omrfile_blockingasync_read(struct OMRPortLibrary *portLibrary, intptr_t fd, void
 intptr_t
 omrfile_blockingasync_write(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes)
 {
-	return -1;
+	return portLibrary->file_write(portLibrary, fd, buf, nbytes);
 }
 
 /**
@@ -149,7 +153,7 @@ omrfile_blockingasync_write(struct OMRPortLibrary *portLibrary, intptr_t fd, con
 int32_t
 omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t newLength)
 {
-	return -1;
+	return portLibrary->file_set_length(portLibrary, fd, newLength);
 }
 
 /**
@@ -163,7 +167,7 @@ omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd
 int64_t
 omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd)
 {
-	return -1;
+	return portLibrary->file_flength(portLibrary, fd);
 }
 
 /**
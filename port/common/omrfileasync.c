@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file I/O submission/completion queues
+ */
+
+#include "omrport.h"
+#include "omrporterror.h"
+
+/**
+ * Create an asynchronous file I/O queue.
+ *
+ * Requests are submitted with @ref omrfile_async_submit and their results are
+ * reaped with @ref omrfile_async_poll. At most depth requests may be outstanding
+ * (submitted but not yet reaped) at any time. A queue must not be used by more
+ * than one thread at a time.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] depth Maximum number of outstanding requests, must be non-zero.
+ * @param[in] flags Creation flags:
+ * @args OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL never use a kernel submission interface.
+ * @param[out] queue The newly created queue.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_queue_create(struct OMRPortLibrary *portLibrary, uint32_t depth, uint32_t flags, OMRFileAsyncQueue **queue)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Destroy an asynchronous file I/O queue.
+ *
+ * Requests which are still outstanding are completed before the queue is
+ * freed; their completions are discarded.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue to destroy, may be NULL.
+ */
+void
+omrfile_async_queue_destroy(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+}
+
+/**
+ * Answer the backend servicing an asynchronous file I/O queue.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ *
+ * @return OMRPORT_FILE_ASYNC_BACKEND_IO_URING or OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL,
+ * negative portable error code on failure.
+ */
+int32_t
+omrfile_async_queue_backend(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Register a set of buffers with an asynchronous file I/O queue.
+ *
+ * Requests whose bufferIndex names a registered buffer must have exactly one
+ * iov entry lying entirely within that buffer. Where the backend supports it
+ * the buffers are pinned once here rather than on every request. Buffers may
+ * only be registered once per queue, while no requests are outstanding.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[in] buffers The buffers to register.
+ * @param[in] count Number of entries in buffers.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileIOVec *buffers, uint32_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Submit a batch of reads and writes to an asynchronous file I/O queue.
+ *
+ * Requests are queued in order until the queue is full. Requests are independent
+ * and may complete in any order.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[in] requests The requests to submit.
+ * @param[in] count Number of entries in requests.
+ *
+ * @return The number of requests queued (possibly fewer than count, or 0 when the
+ * queue is full), negative portable error code on failure.
+ */
+int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Reap completed requests from an asynchronous file I/O queue.
+ *
+ * Blocks until at least minCompletions requests have completed; minCompletions is
+ * limited to the number of outstanding requests, so a minCompletions of 0 never blocks.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[out] completions Receives the completed requests.
+ * @param[in] maxCompletions Capacity of completions.
+ * @param[in] minCompletions Number of completions to wait for.
+ *
+ * @return The number of completions stored, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_poll(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
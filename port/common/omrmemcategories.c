@@ -33,20 +33,24 @@
  * Memory categories are used to break down native memory usage under
  * areas a language programmer would understand.
  */
+#if defined(LINUX) && !defined(OMRZTPF)
+/* _GNU_SOURCE exposes sched_getcpu() in sched.h */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
 #include <stdlib.h>
 #include <string.h>
 
 #include "omrport.h"
 #include "omrportpriv.h"
 #include "omrportpg.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
 #include "ut_omrport.h"
 
-/* J9VMAtomicFunctions*/
-#ifndef _J9VMATOMICFUNCTIONS_
-#define _J9VMATOMICFUNCTIONS_
-extern uintptr_t compareAndSwapUDATA(uintptr_t *location, uintptr_t oldValue, uintptr_t newValue);
-#endif /* _J9VMATOMICFUNCTIONS_ */
-
 
 /* Templates for categories that are copied into malloc'd memory in omrmem_startup_categories */
 OMRMEM_CATEGORY_NO_CHILDREN("Unknown", OMRMEM_CATEGORY_UNKNOWN);
@@ -59,80 +63,255 @@ OMRMEM_CATEGORY_1_CHILD("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY, OMRMEM_CAT
 OMRMEM_CATEGORY_NO_CHILDREN("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY);
 #endif /* OMR_ENV_DATA64 */
 
+/**
+ * Answers a small number identifying where the calling thread is running: the current
+ * CPU where the OS can report it cheaply, otherwise a hash of the current omrthread.
+ */
+static uint32_t
+omrmem_categories_shard_hint(void)
+{
+#if defined(LINUX) && !defined(OMRZTPF)
+	int cpu = sched_getcpu();
+
+	if (0 <= cpu) {
+		return (uint32_t)cpu;
+	}
+#elif defined(OMR_OS_WINDOWS)
+	return (uint32_t)GetCurrentProcessorNumber();
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	{
+		uintptr_t self = (uintptr_t)omrthread_self();
+		/* omrthread_t structures are heap allocated; discard the alignment bits and mix the rest */
+		return ((uint32_t)(self >> 4) * (uint32_t)0x9E3779B9) >> 16;
+	}
+}
+
+/**
+ * Selects the counter shard the calling thread updates, or NULL if the category has none.
+ *
+ * shardMask is published before shards and starts out as zero, so a racing reader can
+ * only ever pick a shard inside the block.
+ */
+static OMRMemCategoryShard *
+omrmem_categories_get_shard(OMRMemCategory *category)
+{
+	OMRMemCategoryShard *shards = category->shards;
+
+	if (NULL == shards) {
+		return NULL;
+	}
+	return &shards[omrmem_categories_shard_hint() & category->shardMask];
+}
+
+/**
+ * Adds a (possibly negative, as a two's complement) delta to a category's live counts.
+ *
+ * Frees need not land on the shard that counted the allocation, so an individual shard
+ * may wrap; only the sum across the category and all of its shards is meaningful.
+ */
+static void
+omrmem_categories_update(OMRMemCategory *category, uintptr_t allocationsDelta, uintptr_t bytesDelta)
+{
+	OMRMemCategoryShard *shard = omrmem_categories_get_shard(category);
+	volatile uintptr_t *liveAllocations = &category->liveAllocations;
+	volatile uintptr_t *liveBytes = &category->liveBytes;
+
+	if (NULL != shard) {
+		liveAllocations = &shard->liveAllocations;
+		liveBytes = &shard->liveBytes;
+	}
+	if (0 != allocationsDelta) {
+		addAtomic(liveAllocations, allocationsDelta);
+	}
+	addAtomic(liveBytes, bytesDelta);
+}
+
 /**
  * Increments the counters for a memory category.
  *
- * Called by port library code when a memory allocation is made.
+ * Increments the block count and byte count.
  */
 void
 omrmem_categories_increment_counters(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
-
 	Trc_Assert_PTR_mem_categories_increment_counters_NULL_category(NULL != category);
 
-	/* Increment block count */
-	do {
-		oldValue = category->liveAllocations;
-	} while (compareAndSwapUDATA(&category->liveAllocations, oldValue, oldValue + 1) != oldValue);
-
-	omrmem_categories_increment_bytes(category, size);
+	omrmem_categories_update(category, 1, size);
 }
 
 /**
- * Increments just the byte counter for a memory category
+ * Increments just the bytes counter for a memory category.
  *
- * Used in omrmem32helpers to manage <32 bit slab regions
+ * Does not increment the block counter.
  */
 void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
-
 	Trc_Assert_PTR_mem_categories_increment_bytes_NULL_category(NULL != category);
 
-	/* Increment bytes */
-	do {
-		oldValue = category->liveBytes;
-	} while (compareAndSwapUDATA(&category->liveBytes, oldValue, oldValue + size) != oldValue);
+	omrmem_categories_update(category, 0, size);
 }
 
 /**
  * Decrements the counters for a memory category.
  *
- * Called by port library code when a memory block is freed.
+ * Decrements the block count and byte count.
  */
 void
 omrmem_categories_decrement_counters(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
-
 	Trc_Assert_PTR_mem_categories_decrement_counters_NULL_category(NULL != category);
 
-	/* Decrement block count */
-	do {
-		oldValue = category->liveAllocations;
-	} while (compareAndSwapUDATA(&category->liveAllocations, oldValue, oldValue - 1) != oldValue);
-
-	omrmem_categories_decrement_bytes(category, size);
+	omrmem_categories_update(category, (uintptr_t)-1, (uintptr_t)0 - size);
 }
 
 /**
- * Decrements the byte counter for a memory category.
+ * Decrements just the bytes counter for a memory category.
  *
- * Used in omrmem32helpers to manage <32 bit slab regions
+ * Does not decrement the block counter.
  */
 void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
-
 	Trc_Assert_PTR_mem_categories_decrement_bytes_NULL_category(NULL != category);
 
-	/* Decrement size */
-	do {
-		oldValue = category->liveBytes;
-	} while (compareAndSwapUDATA(&category->liveBytes, oldValue, oldValue - size) != oldValue);
+	omrmem_categories_update(category, 0, (uintptr_t)0 - size);
+}
+
+/**
+ * Sums the counters of a memory category across all of its shards.
+ *
+ * No update is lost to sharding, so the totals are exact whenever no allocation or
+ * free for the category is in flight.
+ */
+static void
+omrmem_categories_sum_counters(OMRMemCategory *category, uintptr_t *liveBytes, uintptr_t *liveAllocations)
+{
+	OMRMemCategoryShard *shards = category->shards;
+	uintptr_t bytes = category->liveBytes;
+	uintptr_t allocations = category->liveAllocations;
+
+	if (NULL != shards) {
+		uint32_t i = 0;
+
+		for (i = 0; i <= category->shardMask; i++) {
+			bytes += shards[i].liveBytes;
+			allocations += shards[i].liveAllocations;
+		}
+	}
+
+	*liveBytes = bytes;
+	*liveAllocations = allocations;
+}
+
+/**
+ * Calls back for every category registered with the port library.
+ */
+static void
+omrmem_categories_for_each_registered(struct OMRPortLibrary *portLibrary, void (*function)(OMRMemCategory *category, void *userData), void *userData)
+{
+	J9PortControlData *portControl = &portLibrary->portGlobals->control;
+	uint32_t i = 0;
+
+	for (i = 0; i < portControl->language_memory_categories.numberOfCategories; i++) {
+		if (NULL != portControl->language_memory_categories.categories[i]) {
+			function(portControl->language_memory_categories.categories[i], userData);
+		}
+	}
+	for (i = 0; i < portControl->omr_memory_categories.numberOfCategories; i++) {
+		if (NULL != portControl->omr_memory_categories.categories[i]) {
+			function(portControl->omr_memory_categories.categories[i], userData);
+		}
+	}
+}
+
+static void
+omrmem_categories_count_unsharded(OMRMemCategory *category, void *userData)
+{
+	if (NULL == category->shards) {
+		*(uint32_t *)userData += 1;
+	}
+}
+
+typedef struct OMRMemCategoryShardAllocation {
+	OMRMemCategoryShard *next;
+	uint32_t shardCount;
+} OMRMemCategoryShardAllocation;
+
+static void
+omrmem_categories_give_shards(OMRMemCategory *category, void *userData)
+{
+	OMRMemCategoryShardAllocation *allocation = (OMRMemCategoryShardAllocation *)userData;
+
+	/* A category shared with another port library keeps the shards it already has. */
+	if (NULL == category->shards) {
+		category->shardMask = allocation->shardCount - 1;
+		issueWriteBarrier();
+		category->shards = allocation->next;
+		allocation->next += allocation->shardCount;
+	}
+}
+
+/**
+ * Gives every registered category without shards a cache line aligned block of counter
+ * shards, one per CPU rounded up to a power of 2 (at most OMRMEM_CATEGORY_MAX_SHARDS).
+ * Called once the category tables are populated. If the allocation fails the categories
+ * simply keep counting on their own counters.
+ *
+ * @param[in] portLibrary The port library.
+ */
+void
+omrmem_categories_attach_shards(struct OMRPortLibrary *portLibrary)
+{
+	J9PortControlData *portControl = &portLibrary->portGlobals->control;
+	uintptr_t cpus = portLibrary->sysinfo_get_number_CPUs_by_type(portLibrary, OMRPORT_CPU_PHYSICAL);
+	uint32_t categoryCount = 0;
+	OMRMemCategoryShardAllocation allocation;
+	uintptr_t blockSize = 0;
+	void *block = NULL;
+
+	allocation.shardCount = 1;
+	while ((allocation.shardCount < cpus) && (allocation.shardCount < OMRMEM_CATEGORY_MAX_SHARDS)) {
+		allocation.shardCount <<= 1;
+	}
+
+	omrmem_categories_for_each_registered(portLibrary, omrmem_categories_count_unsharded, &categoryCount);
+	if (0 == categoryCount) {
+		return;
+	}
+
+	/* One extra shard leaves room to align the block to a cache line. */
+	blockSize = ((categoryCount * allocation.shardCount) + 1) * sizeof(OMRMemCategoryShard);
+	block = portLibrary->mem_allocate_memory(portLibrary, blockSize, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == block) {
+		return;
+	}
+	memset(block, 0, blockSize);
+	allocation.next = (OMRMemCategoryShard *)(((uintptr_t)block + OMRMEM_CATEGORY_SHARD_SIZE - 1) & ~(uintptr_t)(OMRMEM_CATEGORY_SHARD_SIZE - 1));
+
+	omrmem_categories_for_each_registered(portLibrary, omrmem_categories_give_shards, &allocation);
+	portControl->memory_category_shards = block;
+	portControl->memory_category_shards_size = blockSize;
+}
+
+static void
+omrmem_categories_take_shards(OMRMemCategory *category, void *userData)
+{
+	OMRMemCategoryShard *blockStart = ((OMRMemCategoryShard **)userData)[0];
+	OMRMemCategoryShard *blockEnd = ((OMRMemCategoryShard **)userData)[1];
+	OMRMemCategoryShard *shards = category->shards;
+
+	if ((shards >= blockStart) && (shards < blockEnd)) {
+		uintptr_t liveBytes = 0;
+		uintptr_t liveAllocations = 0;
+
+		/* Fold the shards back into the category's own counters so its totals survive. */
+		omrmem_categories_sum_counters(category, &liveBytes, &liveAllocations);
+		category->shards = NULL;
+		category->shardMask = 0;
+		category->liveBytes = liveBytes;
+		category->liveAllocations = liveAllocations;
+	}
 }
 
 /**
@@ -190,7 +369,11 @@ _recursive_category_walk_children(struct OMRPortLibrary *portLibrary, OMRMemCate
 	for (i = 0; i < parent->numberOfChildren; i++) {
 		uint32_t childCode = parent->children[i];
 		OMRMemCategory *child = omrmem_get_category(portLibrary, childCode);
-		result = state->walkFunction(child->categoryCode, child->name, child->liveBytes, child->liveAllocations, FALSE, parent->categoryCode, state);
+		uintptr_t liveBytes = 0;
+		uintptr_t liveAllocations = 0;
+
+		omrmem_categories_sum_counters(child, &liveBytes, &liveAllocations);
+		result = state->walkFunction(child->categoryCode, child->name, liveBytes, liveAllocations, FALSE, parent->categoryCode, state);
 
 		if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 			result = _recursive_category_walk_children(portLibrary, state, child);
@@ -210,8 +393,11 @@ static uintptr_t
 _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state, OMRMemCategory *walkPoint)
 {
 	uintptr_t result;
+	uintptr_t liveBytes = 0;
+	uintptr_t liveAllocations = 0;
 
-	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, walkPoint->liveBytes, walkPoint->liveAllocations, TRUE, 0, state);
+	omrmem_categories_sum_counters(walkPoint, &liveBytes, &liveAllocations);
+	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, liveBytes, liveAllocations, TRUE, 0, state);
 
 	if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 		return _recursive_category_walk_children(portLibrary, state, walkPoint);
@@ -279,6 +465,8 @@ omrmem_startup_categories(struct OMRPortLibrary *portLibrary)
 	portLibrary->portGlobals->control.language_memory_categories.categories = NULL;
 	portLibrary->portGlobals->control.omr_memory_categories.numberOfCategories = 0;
 	portLibrary->portGlobals->control.omr_memory_categories.categories = NULL;
+	portLibrary->portGlobals->control.memory_category_shards = NULL;
+	portLibrary->portGlobals->control.memory_category_shards_size = 0;
 	return 0;
 }
 
@@ -294,6 +482,20 @@ void
 omrmem_shutdown_categories(struct OMRPortLibrary *portLibrary)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	void *shardBlock = portLibrary->portGlobals->control.memory_category_shards;
+
+	/* Detach the counter shards this port library gave out before the tables go away. */
+	if (NULL != shardBlock) {
+		OMRMemCategoryShard *bounds[2];
+
+		bounds[0] = (OMRMemCategoryShard *)shardBlock;
+		bounds[1] = (OMRMemCategoryShard *)((uintptr_t)shardBlock + portLibrary->portGlobals->control.memory_category_shards_size);
+		omrmem_categories_for_each_registered(portLibrary, omrmem_categories_take_shards, bounds);
+		portLibrary->portGlobals->control.memory_category_shards = NULL;
+		portLibrary->portGlobals->control.memory_category_shards_size = 0;
+		portLibrary->mem_free_memory(OMRPORTLIB, shardBlock);
+	}
+
 	/* Free any allocated memory categories data. */
 	if (NULL != portLibrary->portGlobals->control.language_memory_categories.categories) {
 		portLibrary->mem_free_memory(OMRPORTLIB, portLibrary->portGlobals->control.language_memory_categories.categories);
@@ -396,6 +396,22 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsock_getsockopt_int, /* sock_getsockopt_int */
 	omrsock_getsockopt_linger, /* sock_getsockopt_linger */
 	omrsock_getsockopt_timeval, /* sock_getsockopt_timeval */
+	omrfile_async_queue_create, /* file_async_queue_create */
+	omrfile_async_queue_destroy, /* file_async_queue_destroy */
+	omrfile_async_queue_backend, /* file_async_queue_backend */
+	omrfile_async_register_buffers, /* file_async_register_buffers */
+	omrfile_async_submit, /* file_async_submit */
+	omrfile_async_poll, /* file_async_poll */
+	omrsock_eventloop_create, /* sock_eventloop_create */
+	omrsock_eventloop_close, /* sock_eventloop_close */
+	omrsock_eventloop_add, /* sock_eventloop_add */
+	omrsock_eventloop_modify, /* sock_eventloop_modify */
+	omrsock_eventloop_remove, /* sock_eventloop_remove */
+	omrsock_eventloop_wait, /* sock_eventloop_wait */
+	omrsock_sendv, /* sock_sendv */
+	omrsock_recvv, /* sock_recvv */
+	omrsock_sendmmsg, /* sock_sendmmsg */
+	omrsock_recvmmsg, /* sock_recvmmsg */
 #if defined(OMR_OPT_CUDA)
 	NULL, /* cuda_configData */
 	omrcuda_startup, /* cuda_startup */
@@ -258,6 +258,7 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 #endif
 			portControl->language_memory_categories.numberOfCategories = languageCategoryCount;
 			portControl->omr_memory_categories.numberOfCategories = omrCategoryCount;
+			omrmem_categories_attach_shards(portLibrary);
 			return 0;
 		} else {
 			Trc_Assert_PRT_mem_categories_already_set(NULL != portControl->language_memory_categories.categories);
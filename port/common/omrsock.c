@@ -847,3 +847,184 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+/**
+ * Create an event loop for readiness notification on many sockets.
+ *
+ * On Linux the event loop is backed by epoll and notifications are edge-triggered:
+ * a socket is reported once each time it becomes ready, so the caller must read or
+ * write until OMRPORT_ERROR_SOCKET_WOULDBLOCK before waiting again. Elsewhere the
+ * event loop is backed by poll and notifications are level-triggered, which callers
+ * written for edge-triggered notification also handle correctly. Sockets added to an
+ * event loop should be non-blocking, see @ref omrsock_fcntl.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] loop Pointer to the newly created event loop.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Close an event loop created by @ref omrsock_eventloop_create. Sockets in the
+ * event loop are not closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in,out] loop Pointer to the event loop, set to NULL once closed.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_close(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Add a socket to an event loop.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket to observe. A socket may only be added to an event loop once.
+ * @param[in] events All events to be observed, which is ORed before passing in.
+ * \arg OMRSOCK_POLLIN
+ * \arg OMRSOCK_POLLOUT
+ * @param[in] userData Value returned in @ref OMRSockEvent when the socket is ready.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Change the events observed for, and the user data of, a socket already in an event loop.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket.
+ * @param[in] events All events to be observed, which is ORed before passing in.
+ * \arg OMRSOCK_POLLIN
+ * \arg OMRSOCK_POLLOUT
+ * @param[in] userData Value returned in @ref OMRSockEvent when the socket is ready.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Remove a socket from an event loop. A socket should be removed before it is closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Wait for sockets in an event loop to become ready.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[out] events Array receiving one notification per ready socket. Besides the
+ * observed events, revents may report OMRSOCK_POLLERR and OMRSOCK_POLLHUP (Not available on AIX).
+ * @param[in] maxEvents The number of entries in events.
+ * @param[in] timeoutMs Maximum time in milliseconds to wait, 0 to return immediately
+ * or -1 to wait indefinitely.
+ *
+ * @return the number of notifications stored in events (0 on timeout), otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Send the contents of several buffers as one gathered write.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The connected socket to send on.
+ * @param[in] iov The buffers to send, in order.
+ * @param[in] iovCount The number of entries in iov.
+ * @param[in] flags The flags to modify the send behavior.
+ *
+ * @return the total number of bytes sent, which may be less than requested, otherwise return an error.
+ */
+int32_t
+omrsock_sendv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Receive into several buffers as one scattered read.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The connected socket to receive on.
+ * @param[out] iov The buffers to fill, in order.
+ * @param[in] iovCount The number of entries in iov.
+ * @param[in] flags The flags to modify the receive behavior.
+ *
+ * @return the total number of bytes received, 0 if the peer closed the connection, otherwise return an error.
+ */
+int32_t
+omrsock_recvv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Send a batch of messages. On Linux the batch is passed to the kernel with sendmmsg,
+ * elsewhere each message is sent in turn. The bytes field of each sent message is set.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket to send on.
+ * @param[in,out] msgs The messages to send. The addr field of a message may name the
+ * destination of a datagram, or be NULL for a connected socket.
+ * @param[in] count The number of entries in msgs.
+ * @param[in] flags The flags to modify the send behavior.
+ *
+ * @return the number of messages sent, which may be less than count, otherwise return an error.
+ */
+int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Receive a batch of messages. Waits (subject to the socket's blocking mode) for the
+ * first message only, then receives whatever further messages are already queued,
+ * up to count. On Linux this is done with recvmmsg. The bytes field, and the addr
+ * field if not NULL, of each received message are set.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket to receive on.
+ * @param[in,out] msgs The messages to fill.
+ * @param[in] count The number of entries in msgs.
+ * @param[in] flags The flags to modify the receive behavior.
+ *
+ * @return the number of messages received, otherwise return an error.
+ */
+int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
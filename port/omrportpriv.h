@@ -53,6 +53,8 @@ typedef struct J9PortControlData {
 	uintptr_t sig_flags;
 	OMRMemCategorySet language_memory_categories;
 	OMRMemCategorySet omr_memory_categories;
+	void *memory_category_shards; /* backing allocation for the counter shards of the registered categories */
+	uintptr_t memory_category_shards_size;
 #if defined(AIXPPC)
 	uintptr_t aix_proc_attr;
 #endif
@@ -264,6 +266,20 @@ omrfile_blockingasync_startup(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC void
 omrfile_blockingasync_shutdown(struct OMRPortLibrary *portLibrary);
 
+/* J9SourceJ9FileAsync */
+extern J9_CFUNC int32_t
+omrfile_async_queue_create(struct OMRPortLibrary *portLibrary, uint32_t depth, uint32_t flags, OMRFileAsyncQueue **queue);
+extern J9_CFUNC void
+omrfile_async_queue_destroy(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+extern J9_CFUNC int32_t
+omrfile_async_queue_backend(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+extern J9_CFUNC int32_t
+omrfile_async_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileIOVec *buffers, uint32_t count);
+extern J9_CFUNC int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count);
+extern J9_CFUNC int32_t
+omrfile_async_poll(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions);
+
 /* J9SourceJ9FileStream */
 extern J9_CFUNC int32_t
 omrfilestream_startup(struct OMRPortLibrary *portLibrary);
@@ -372,6 +388,8 @@ extern J9_CFUNC void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size);
 extern J9_CFUNC void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_attach_shards(struct OMRPortLibrary *portLibrary);
 
 /* J9SourceJ9MemoryMap*/
 extern J9_CFUNC void
@@ -797,6 +815,26 @@ extern J9_CFUNC int32_t
 omrsock_getsockopt_linger(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval);
 extern J9_CFUNC int32_t
 omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval);
+extern J9_CFUNC int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_close(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock);
+extern J9_CFUNC int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs);
+extern J9_CFUNC int32_t
+omrsock_sendv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags);
+extern J9_CFUNC int32_t
+omrsock_recvv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags);
+extern J9_CFUNC int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags);
+extern J9_CFUNC int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags);
 
 /* J9SourceJ9Str*/
 extern J9_CFUNC uintptr_t
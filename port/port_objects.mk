@@ -119,6 +119,7 @@ ifneq (win,$(OMR_HOST_OS))
 endif
 
 OBJECTS += omrfile_blockingasync
+OBJECTS += omrfileasync
 
 ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrfilehelpers
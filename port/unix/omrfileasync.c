@@ -0,0 +1,790 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file I/O submission/completion queues
+ *
+ * On Linux requests are handed to the kernel through an io_uring instance. Where
+ * io_uring is unavailable (older kernels, seccomp filters, other Unix platforms)
+ * requests are serviced by a small pool of omrthreads issuing positioned reads
+ * and writes.
+ */
+
+#include "omrcfg.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#if defined(LINUX) && !defined(OMRZTPF)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define OMR_FILE_ASYNC_IO_URING
+#endif /* __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup) */
+#endif /* defined(__has_include) */
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrporterror.h"
+#include "omrthread.h"
+#include "omrutil.h"
+
+/* Number of worker threads servicing a thread pool queue (bounded by the queue depth). */
+#define OMRFILE_ASYNC_THREAD_POOL_WORKERS 4
+#define OMRFILE_ASYNC_WORKER_STACK_SIZE (256 * 1024)
+
+typedef struct OMRFileAsyncTask {
+	intptr_t fd;
+	int32_t opcode;
+	int64_t offset;
+	OMRFileIOVec *iov;
+	uint32_t iovCount;
+	uintptr_t userData;
+} OMRFileAsyncTask;
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+typedef struct OMRFileAsyncRing {
+	int ringFd;
+	void *sqRing;
+	size_t sqRingSize;
+	void *cqRing;
+	size_t cqRingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	uint32_t *sqTail;
+	uint32_t sqMask;
+	uint32_t *sqArray;
+	uint32_t *cqHead;
+	uint32_t *cqTail;
+	uint32_t cqMask;
+	struct io_uring_cqe *cqes;
+	uint32_t unsubmitted; /**< entries published in the ring but not yet consumed by the kernel */
+	BOOLEAN buffersRegistered;
+} OMRFileAsyncRing;
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+struct OMRFileAsyncQueue {
+	struct OMRPortLibrary *portLibrary;
+	int32_t backend;
+	uint32_t depth;
+	uint32_t outstanding; /**< submitted and not yet reaped; only touched by the owning thread */
+	OMRFileIOVec *registeredBuffers;
+	uint32_t registeredCount;
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	OMRFileAsyncRing ring;
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+	/* Thread pool backend, all fields below are protected by monitor */
+	omrthread_monitor_t monitor;
+	OMRFileAsyncTask *tasks;
+	uint32_t taskHead;
+	uint32_t taskCount;
+	OMRFileAsyncCompletion *completions;
+	uint32_t completionHead;
+	uint32_t completionCount;
+	uint32_t liveWorkers;
+	BOOLEAN shutdown;
+};
+
+static int32_t findError(int32_t errorCode);
+static intptr_t transfer(OMRFileAsyncTask *task);
+static BOOLEAN validateRequest(OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *request);
+static int32_t threadPoolStartup(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+static void threadPoolShutdown(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+static int32_t J9THREAD_PROC threadPoolWorker(void *arg);
+#if defined(OMR_FILE_ASYNC_IO_URING)
+static int32_t ringStartup(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+static void ringShutdown(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue);
+static int32_t ringSubmit(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count);
+static int32_t ringPoll(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions);
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+/**
+ * @internal
+ * Determines the proper portable error code to return given a native error code
+ *
+ * @param[in] errorCode The error code reported by the OS
+ *
+ * @return	the (negative) portable error code
+ */
+static int32_t
+findError(int32_t errorCode)
+{
+	switch (errorCode) {
+	case EACCES:
+		/* FALLTHROUGH */
+	case EPERM:
+		return OMRPORT_ERROR_FILE_NOPERMISSION;
+	case EBADF:
+		return OMRPORT_ERROR_FILE_BADF;
+	case ENOSPC:
+		/* FALLTHROUGH */
+	case EFBIG:
+		return OMRPORT_ERROR_FILE_DISKFULL;
+	case EINVAL:
+		return OMRPORT_ERROR_FILE_INVAL;
+	case EISDIR:
+		return OMRPORT_ERROR_FILE_ISDIR;
+	case EAGAIN:
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	case EFAULT:
+		return OMRPORT_ERROR_FILE_EFAULT;
+	case EINTR:
+		return OMRPORT_ERROR_FILE_EINTR;
+	case EIO:
+		return OMRPORT_ERROR_FILE_IO;
+	case EOVERFLOW:
+		return OMRPORT_ERROR_FILE_OVERFLOW;
+	case ESPIPE:
+		return OMRPORT_ERROR_FILE_SPIPE;
+	default:
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+}
+
+/**
+ * @internal
+ * Perform a vectored positioned transfer synchronously. Stops early at end of file.
+ *
+ * @return bytes transferred, or a negative portable error code if nothing was transferred.
+ */
+static intptr_t
+transfer(OMRFileAsyncTask *task)
+{
+	int fd = (int)(task->fd - FD_BIAS);
+	off_t offset = (off_t)task->offset;
+	intptr_t total = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < task->iovCount; i++) {
+		uint8_t *cursor = (uint8_t *)task->iov[i].buffer;
+		uintptr_t remaining = task->iov[i].length;
+
+		while (remaining > 0) {
+			ssize_t rc = 0;
+			if (OMRPORT_FILE_ASYNC_OP_READ == task->opcode) {
+				rc = pread(fd, cursor, remaining, offset);
+			} else {
+				rc = pwrite(fd, cursor, remaining, offset);
+			}
+			if (rc < 0) {
+				if (EINTR == errno) {
+					continue;
+				}
+				return (0 == total) ? findError(errno) : total;
+			}
+			if (0 == rc) {
+				/* end of file */
+				return total;
+			}
+			cursor += rc;
+			remaining -= rc;
+			offset += rc;
+			total += rc;
+		}
+	}
+	return total;
+}
+
+/**
+ * @internal
+ * Check a request against the queue's registered buffers.
+ */
+static BOOLEAN
+validateRequest(OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *request)
+{
+	if ((OMRPORT_FILE_ASYNC_OP_READ != request->opcode) && (OMRPORT_FILE_ASYNC_OP_WRITE != request->opcode)) {
+		return FALSE;
+	}
+	if ((0 == request->iovCount) || (NULL == request->iov) || (request->offset < 0)) {
+		return FALSE;
+	}
+	if (OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX != request->bufferIndex) {
+		const OMRFileIOVec *registered = NULL;
+		uintptr_t start = 0;
+		uintptr_t end = 0;
+
+		if ((request->bufferIndex < 0) || ((uint32_t)request->bufferIndex >= queue->registeredCount) || (1 != request->iovCount)) {
+			return FALSE;
+		}
+		registered = &queue->registeredBuffers[request->bufferIndex];
+		start = (uintptr_t)request->iov[0].buffer;
+		end = start + request->iov[0].length;
+		if ((start < (uintptr_t)registered->buffer) || (end > ((uintptr_t)registered->buffer + registered->length))) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+ * @internal
+ * Worker thread of the thread pool backend. Drains queued tasks until the queue shuts down.
+ */
+static int32_t J9THREAD_PROC
+threadPoolWorker(void *arg)
+{
+	OMRFileAsyncQueue *queue = (OMRFileAsyncQueue *)arg;
+
+	omrthread_monitor_enter(queue->monitor);
+	for (;;) {
+		OMRFileAsyncTask task;
+		OMRFileAsyncCompletion *completion = NULL;
+
+		while ((0 == queue->taskCount) && !queue->shutdown) {
+			omrthread_monitor_wait(queue->monitor);
+		}
+		if (0 == queue->taskCount) {
+			break;
+		}
+		task = queue->tasks[queue->taskHead];
+		queue->taskHead = (queue->taskHead + 1) % queue->depth;
+		queue->taskCount -= 1;
+		omrthread_monitor_exit(queue->monitor);
+
+		{
+			intptr_t result = transfer(&task);
+			omrthread_monitor_enter(queue->monitor);
+			/* outstanding requests never exceed depth, so the completion ring cannot overflow */
+			completion = &queue->completions[(queue->completionHead + queue->completionCount) % queue->depth];
+			completion->userData = task.userData;
+			completion->result = result;
+			queue->completionCount += 1;
+			omrthread_monitor_notify_all(queue->monitor);
+		}
+	}
+	queue->liveWorkers -= 1;
+	omrthread_monitor_notify_all(queue->monitor);
+	omrthread_exit(queue->monitor);
+
+	/* unreachable */
+	return 0;
+}
+
+/**
+ * @internal
+ * Start the worker threads of a thread pool queue.
+ */
+static int32_t
+threadPoolStartup(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	uint32_t workers = OMR_MIN(queue->depth, OMRFILE_ASYNC_THREAD_POOL_WORKERS);
+	uint32_t i = 0;
+
+	queue->tasks = (OMRFileAsyncTask *)portLibrary->mem_allocate_memory(portLibrary, queue->depth * sizeof(OMRFileAsyncTask), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	queue->completions = (OMRFileAsyncCompletion *)portLibrary->mem_allocate_memory(portLibrary, queue->depth * sizeof(OMRFileAsyncCompletion), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == queue->tasks) || (NULL == queue->completions)) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	if (0 != omrthread_monitor_init_with_name(&queue->monitor, 0, "portLibrary_omrfile_async_queue_monitor")) {
+		queue->monitor = NULL;
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+
+	omrthread_monitor_enter(queue->monitor);
+	for (i = 0; i < workers; i++) {
+		omrthread_t worker = NULL;
+		if (J9THREAD_SUCCESS != createThreadWithCategory(
+				&worker,
+				OMRFILE_ASYNC_WORKER_STACK_SIZE,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				threadPoolWorker,
+				queue,
+				J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			break;
+		}
+		queue->liveWorkers += 1;
+	}
+	omrthread_monitor_exit(queue->monitor);
+
+	return (0 == queue->liveWorkers) ? OMRPORT_ERROR_FILE_OPFAILED : 0;
+}
+
+/**
+ * @internal
+ * Stop the worker threads of a thread pool queue, once all queued tasks have run.
+ */
+static void
+threadPoolShutdown(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	if (NULL != queue->monitor) {
+		omrthread_monitor_enter(queue->monitor);
+		queue->shutdown = TRUE;
+		omrthread_monitor_notify_all(queue->monitor);
+		while (0 != queue->liveWorkers) {
+			omrthread_monitor_wait(queue->monitor);
+		}
+		omrthread_monitor_exit(queue->monitor);
+		omrthread_monitor_destroy(queue->monitor);
+		queue->monitor = NULL;
+	}
+	portLibrary->mem_free_memory(portLibrary, queue->tasks);
+	portLibrary->mem_free_memory(portLibrary, queue->completions);
+	queue->tasks = NULL;
+	queue->completions = NULL;
+}
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+
+#define OMRFILE_ASYNC_RING_LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define OMRFILE_ASYNC_RING_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/**
+ * @internal
+ * Create an io_uring instance with at least queue->depth submission entries and map its rings.
+ */
+static int32_t
+ringStartup(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	OMRFileAsyncRing *ring = &queue->ring;
+	struct io_uring_params params;
+	int fd = -1;
+
+	memset(&params, 0, sizeof(params));
+	fd = (int)syscall(__NR_io_uring_setup, queue->depth, &params);
+	if (fd < 0) {
+		return findError(errno);
+	}
+	ring->ringFd = fd;
+
+	ring->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+	ring->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		ring->sqRingSize = OMR_MAX(ring->sqRingSize, ring->cqRingSize);
+		ring->cqRingSize = ring->sqRingSize;
+	}
+	ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == ring->sqRing) {
+		ring->sqRing = NULL;
+		return findError(errno);
+	}
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		ring->cqRing = ring->sqRing;
+	} else {
+		ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		if (MAP_FAILED == ring->cqRing) {
+			ring->cqRing = NULL;
+			return findError(errno);
+		}
+	}
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (MAP_FAILED == ring->sqes) {
+		ring->sqes = NULL;
+		return findError(errno);
+	}
+
+	ring->sqTail = (uint32_t *)((uint8_t *)ring->sqRing + params.sq_off.tail);
+	ring->sqMask = *(uint32_t *)((uint8_t *)ring->sqRing + params.sq_off.ring_mask);
+	ring->sqArray = (uint32_t *)((uint8_t *)ring->sqRing + params.sq_off.array);
+	ring->cqHead = (uint32_t *)((uint8_t *)ring->cqRing + params.cq_off.head);
+	ring->cqTail = (uint32_t *)((uint8_t *)ring->cqRing + params.cq_off.tail);
+	ring->cqMask = *(uint32_t *)((uint8_t *)ring->cqRing + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)((uint8_t *)ring->cqRing + params.cq_off.cqes);
+
+	return 0;
+}
+
+/**
+ * @internal
+ * Wait for outstanding requests, then unmap the rings and close the io_uring instance.
+ */
+static void
+ringShutdown(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	OMRFileAsyncRing *ring = &queue->ring;
+
+	if ((NULL != ring->cqes) && (NULL != ring->sqes)) {
+		OMRFileAsyncCompletion discard[16];
+		while (0 != queue->outstanding) {
+			if (ringPoll(portLibrary, queue, discard, 16, 1) < 0) {
+				break;
+			}
+		}
+	}
+	if (NULL != ring->sqes) {
+		munmap(ring->sqes, ring->sqesSize);
+	}
+	if ((NULL != ring->cqRing) && (ring->cqRing != ring->sqRing)) {
+		munmap(ring->cqRing, ring->cqRingSize);
+	}
+	if (NULL != ring->sqRing) {
+		munmap(ring->sqRing, ring->sqRingSize);
+	}
+	if (-1 != ring->ringFd) {
+		close(ring->ringFd);
+	}
+	memset(ring, 0, sizeof(OMRFileAsyncRing));
+	ring->ringFd = -1;
+}
+
+/**
+ * @internal
+ * Fill one submission queue entry per request and hand them to the kernel with a single io_uring_enter.
+ */
+static int32_t
+ringSubmit(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count)
+{
+	OMRFileAsyncRing *ring = &queue->ring;
+	/* the kernel is the only other party updating the submission tail, and it never does */
+	uint32_t tail = *ring->sqTail;
+	uint32_t queued = 0;
+
+	for (queued = 0; queued < count; queued++) {
+		const OMRFileAsyncRequest *request = &requests[queued];
+		uint32_t index = tail & ring->sqMask;
+		struct io_uring_sqe *sqe = &ring->sqes[index];
+		BOOLEAN isRead = (OMRPORT_FILE_ASYNC_OP_READ == request->opcode);
+
+		memset(sqe, 0, sizeof(struct io_uring_sqe));
+		sqe->fd = (int32_t)(request->fd - FD_BIAS);
+		sqe->off = (uint64_t)request->offset;
+		sqe->user_data = (uint64_t)request->userData;
+		if ((OMRPORT_FILE_ASYNC_NO_BUFFER_INDEX != request->bufferIndex) && ring->buffersRegistered) {
+			sqe->opcode = isRead ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+			sqe->addr = (uint64_t)(uintptr_t)request->iov[0].buffer;
+			sqe->len = (uint32_t)request->iov[0].length;
+			sqe->buf_index = (uint16_t)request->bufferIndex;
+		} else {
+			/* OMRFileIOVec is layout compatible with struct iovec */
+			sqe->opcode = isRead ? IORING_OP_READV : IORING_OP_WRITEV;
+			sqe->addr = (uint64_t)(uintptr_t)request->iov;
+			sqe->len = request->iovCount;
+		}
+		ring->sqArray[index] = index;
+		tail += 1;
+	}
+	OMRFILE_ASYNC_RING_STORE_RELEASE(ring->sqTail, tail);
+
+	ring->unsubmitted += queued;
+	queue->outstanding += queued;
+
+	while (0 != ring->unsubmitted) {
+		int rc = (int)syscall(__NR_io_uring_enter, ring->ringFd, ring->unsubmitted, 0, 0, NULL, 0);
+		if (rc < 0) {
+			if (EINTR == errno) {
+				continue;
+			}
+			/* Entries the kernel could not take yet stay in the ring and are handed over by the next enter. */
+			break;
+		}
+		ring->unsubmitted -= (uint32_t)rc;
+	}
+	return (int32_t)queued;
+}
+
+/**
+ * @internal
+ * Reap completion queue entries, entering the kernel only when fewer than minCompletions are ready.
+ */
+static int32_t
+ringPoll(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions)
+{
+	OMRFileAsyncRing *ring = &queue->ring;
+	uint32_t reaped = 0;
+
+	for (;;) {
+		uint32_t head = *ring->cqHead;
+		uint32_t tail = OMRFILE_ASYNC_RING_LOAD_ACQUIRE(ring->cqTail);
+
+		while ((head != tail) && (reaped < maxCompletions)) {
+			struct io_uring_cqe *cqe = &ring->cqes[head & ring->cqMask];
+			completions[reaped].userData = (uintptr_t)cqe->user_data;
+			completions[reaped].result = (cqe->res < 0) ? (intptr_t)findError(-cqe->res) : (intptr_t)cqe->res;
+			reaped += 1;
+			head += 1;
+		}
+		OMRFILE_ASYNC_RING_STORE_RELEASE(ring->cqHead, head);
+
+		if (reaped >= minCompletions) {
+			break;
+		}
+		{
+			int rc = (int)syscall(__NR_io_uring_enter, ring->ringFd, ring->unsubmitted, minCompletions - reaped, IORING_ENTER_GETEVENTS, NULL, 0);
+			if (rc >= 0) {
+				ring->unsubmitted -= (uint32_t)rc;
+			} else if (EINTR != errno) {
+				queue->outstanding -= reaped;
+				return (0 == reaped) ? findError(errno) : (int32_t)reaped;
+			}
+		}
+	}
+	queue->outstanding -= reaped;
+	return (int32_t)reaped;
+}
+
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+/**
+ * Create an asynchronous file I/O queue.
+ *
+ * Requests are submitted with @ref omrfile_async_submit and their results are
+ * reaped with @ref omrfile_async_poll. At most depth requests may be outstanding
+ * (submitted but not yet reaped) at any time. A queue must not be used by more
+ * than one thread at a time.
+ *
+ * On Linux the queue is backed by io_uring; if io_uring is unavailable, or
+ * OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL is set, a pool of worker threads
+ * issuing positioned reads and writes is used instead.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] depth Maximum number of outstanding requests, must be non-zero.
+ * @param[in] flags Creation flags:
+ * @args OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL never use a kernel submission interface.
+ * @param[out] queue The newly created queue.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_queue_create(struct OMRPortLibrary *portLibrary, uint32_t depth, uint32_t flags, OMRFileAsyncQueue **queue)
+{
+	OMRFileAsyncQueue *newQueue = NULL;
+	int32_t rc = 0;
+
+	if ((NULL == queue) || (0 == depth)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*queue = NULL;
+
+	newQueue = (OMRFileAsyncQueue *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRFileAsyncQueue), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newQueue) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memset(newQueue, 0, sizeof(OMRFileAsyncQueue));
+	newQueue->portLibrary = portLibrary;
+	newQueue->depth = depth;
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	newQueue->ring.ringFd = -1;
+	if (OMR_ARE_NO_BITS_SET(flags, OMRPORT_FILE_ASYNC_QUEUE_FORCE_THREAD_POOL)) {
+		if (0 == ringStartup(portLibrary, newQueue)) {
+			newQueue->backend = OMRPORT_FILE_ASYNC_BACKEND_IO_URING;
+		} else {
+			ringShutdown(portLibrary, newQueue);
+		}
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+	if (0 == newQueue->backend) {
+		newQueue->backend = OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL;
+		rc = threadPoolStartup(portLibrary, newQueue);
+		if (0 != rc) {
+			omrfile_async_queue_destroy(portLibrary, newQueue);
+			return rc;
+		}
+	}
+
+	*queue = newQueue;
+	return 0;
+}
+
+/**
+ * Destroy an asynchronous file I/O queue.
+ *
+ * Requests which are still outstanding are completed before the queue is
+ * freed; their completions are discarded.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue to destroy, may be NULL.
+ */
+void
+omrfile_async_queue_destroy(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	if (NULL != queue) {
+#if defined(OMR_FILE_ASYNC_IO_URING)
+		if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+			ringShutdown(portLibrary, queue);
+		}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+		if (OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL == queue->backend) {
+			threadPoolShutdown(portLibrary, queue);
+		}
+		portLibrary->mem_free_memory(portLibrary, queue->registeredBuffers);
+		portLibrary->mem_free_memory(portLibrary, queue);
+	}
+}
+
+/**
+ * Answer the backend servicing an asynchronous file I/O queue.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ *
+ * @return OMRPORT_FILE_ASYNC_BACKEND_IO_URING or OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL,
+ * negative portable error code on failure.
+ */
+int32_t
+omrfile_async_queue_backend(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue)
+{
+	if (NULL == queue) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	return queue->backend;
+}
+
+/**
+ * Register a set of buffers with an asynchronous file I/O queue.
+ *
+ * Requests whose bufferIndex names a registered buffer must have exactly one
+ * iov entry lying entirely within that buffer. With io_uring the buffers are
+ * pinned once here rather than on every request; if the kernel refuses to pin
+ * them (e.g. RLIMIT_MEMLOCK) such requests silently use the vectored path.
+ * Buffers may only be registered once per queue, while no requests are outstanding.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[in] buffers The buffers to register.
+ * @param[in] count Number of entries in buffers.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileIOVec *buffers, uint32_t count)
+{
+	if ((NULL == queue) || (NULL == buffers) || (0 == count) || (0 != queue->registeredCount) || (0 != queue->outstanding)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	queue->registeredBuffers = (OMRFileIOVec *)portLibrary->mem_allocate_memory(portLibrary, count * sizeof(OMRFileIOVec), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == queue->registeredBuffers) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memcpy(queue->registeredBuffers, buffers, count * sizeof(OMRFileIOVec));
+	queue->registeredCount = count;
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+		if (0 == syscall(__NR_io_uring_register, queue->ring.ringFd, IORING_REGISTER_BUFFERS, queue->registeredBuffers, count)) {
+			queue->ring.buffersRegistered = TRUE;
+		}
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+	return 0;
+}
+
+/**
+ * Submit a batch of reads and writes to an asynchronous file I/O queue.
+ *
+ * Requests are queued in order until the queue is full. Requests are independent
+ * and may complete in any order. With io_uring the whole batch is handed to the
+ * kernel by a single system call.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[in] requests The requests to submit.
+ * @param[in] count Number of entries in requests.
+ *
+ * @return The number of requests queued (possibly fewer than count, or 0 when the
+ * queue is full), negative portable error code on failure.
+ */
+int32_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, const OMRFileAsyncRequest *requests, uint32_t count)
+{
+	uint32_t i = 0;
+
+	if ((NULL == queue) || ((NULL == requests) && (0 != count))) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	for (i = 0; i < count; i++) {
+		if (!validateRequest(queue, &requests[i])) {
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		}
+	}
+	count = OMR_MIN(count, queue->depth - queue->outstanding);
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+		return ringSubmit(portLibrary, queue, requests, count);
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+	if (0 != count) {
+		omrthread_monitor_enter(queue->monitor);
+		for (i = 0; i < count; i++) {
+			OMRFileAsyncTask *task = &queue->tasks[(queue->taskHead + queue->taskCount) % queue->depth];
+			task->fd = requests[i].fd;
+			task->opcode = requests[i].opcode;
+			task->offset = requests[i].offset;
+			task->iov = requests[i].iov;
+			task->iovCount = requests[i].iovCount;
+			task->userData = requests[i].userData;
+			queue->taskCount += 1;
+		}
+		omrthread_monitor_notify_all(queue->monitor);
+		omrthread_monitor_exit(queue->monitor);
+		queue->outstanding += count;
+	}
+	return (int32_t)count;
+}
+
+/**
+ * Reap completed requests from an asynchronous file I/O queue.
+ *
+ * Blocks until at least minCompletions requests have completed; minCompletions is
+ * limited to the number of outstanding requests, so a minCompletions of 0 never blocks.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] queue The queue.
+ * @param[out] completions Receives the completed requests.
+ * @param[in] maxCompletions Capacity of completions.
+ * @param[in] minCompletions Number of completions to wait for.
+ *
+ * @return The number of completions stored, negative portable error code on failure.
+ */
+int32_t
+omrfile_async_poll(struct OMRPortLibrary *portLibrary, OMRFileAsyncQueue *queue, OMRFileAsyncCompletion *completions, uint32_t maxCompletions, uint32_t minCompletions)
+{
+	uint32_t reaped = 0;
+
+	if ((NULL == queue) || ((NULL == completions) && (0 != maxCompletions))) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	minCompletions = OMR_MIN(minCompletions, OMR_MIN(maxCompletions, queue->outstanding));
+
+#if defined(OMR_FILE_ASYNC_IO_URING)
+	if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+		return ringPoll(portLibrary, queue, completions, maxCompletions, minCompletions);
+	}
+#endif /* defined(OMR_FILE_ASYNC_IO_URING) */
+
+	omrthread_monitor_enter(queue->monitor);
+	while (queue->completionCount < minCompletions) {
+		omrthread_monitor_wait(queue->monitor);
+	}
+	while ((reaped < maxCompletions) && (0 != queue->completionCount)) {
+		completions[reaped] = queue->completions[queue->completionHead];
+		queue->completionHead = (queue->completionHead + 1) % queue->depth;
+		queue->completionCount -= 1;
+		reaped += 1;
+	}
+	omrthread_monitor_exit(queue->monitor);
+	queue->outstanding -= reaped;
+
+	return (int32_t)reaped;
+}
@@ -26,6 +26,15 @@
  * @brief Sockets
  */
 
+#if defined(LINUX) && !defined(OMRZTPF)
+/* _GNU_SOURCE exposes sendmmsg() and recvmmsg() in sys/socket.h */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#define OMRSOCK_USE_EPOLL
+#define OMRSOCK_USE_MMSG
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
 #include "omrcfg.h"
 #include "omrsock.h"
 
@@ -35,6 +44,10 @@
 #include <string.h> 
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/uio.h>
+#if defined(OMRSOCK_USE_EPOLL)
+#include <sys/epoll.h>
+#endif /* defined(OMRSOCK_USE_EPOLL) */
 
 #include "omrport.h"
 #include "omrporterror.h"
@@ -44,6 +57,27 @@
 #include "atoe.h"
 #endif /* defined(J9ZOS390) && !defined(OMR_EBCDIC) */
 
+/* Number of ready sockets collected by one call to epoll_wait(). */
+#define OMRSOCK_EVENTLOOP_BATCH 64
+/* Number of messages passed to one call to sendmmsg() or recvmmsg(). */
+#define OMRSOCK_MMSG_BATCH 16
+
+/**
+ * An event loop, see @ref omrsock_eventloop_create. Backed by epoll where available,
+ * otherwise by a poll set which grows as sockets are added.
+ */
+typedef struct OMREventLoop {
+#if defined(OMRSOCK_USE_EPOLL)
+	int epollFd;
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	struct pollfd *fds;
+	uintptr_t *userData;
+	uint32_t count;
+	uint32_t capacity;
+	uint32_t next; /* index at which to start reporting, so busy sockets do not starve others */
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+} OMREventLoop;
+
 /* Internal: OMRSOCK user interface constants TO OS dependent constants mapping. */
 
 /**
@@ -1269,3 +1303,456 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return get_opt(portLibrary, handle->data, optlevel, optname, (void*)&optval->data, sizeof(struct timeval));
 }
+
+#if defined(OMRSOCK_USE_EPOLL)
+/**
+ * @internal Map OMRSOCK poll constants to edge-triggered epoll events. Peer shutdown
+ * is observed along with OMRSOCK_POLLIN so that it is not missed once the socket is drained.
+ *
+ * @param omrEvents The OMR poll constants to be converted.
+ *
+ * @return epoll events.
+ */
+static uint32_t
+get_os_epoll_events(int16_t omrEvents)
+{
+	uint32_t osEvents = EPOLLET;
+
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLIN)) {
+		osEvents |= EPOLLIN | EPOLLRDHUP;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLOUT)) {
+		osEvents |= EPOLLOUT;
+	}
+
+	return osEvents;
+}
+
+/**
+ * @internal Map epoll events to OMRSOCK poll constants.
+ *
+ * @param osEvents The epoll events to be converted.
+ *
+ * @return OMR poll constants.
+ */
+static int16_t
+get_omr_epoll_events(uint32_t osEvents)
+{
+	int16_t omrEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLIN)) {
+		omrEvents |= OMRSOCK_POLLIN;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLOUT)) {
+		omrEvents |= OMRSOCK_POLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLERR)) {
+		omrEvents |= OMRSOCK_POLLERR;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLHUP | EPOLLRDHUP)) {
+		omrEvents |= OMRSOCK_POLLHUP;
+	}
+
+	return omrEvents;
+}
+
+/**
+ * @internal Add, modify or remove a socket in an epoll event loop.
+ *
+ * @return 0 on success, otherwise the error.
+ */
+static int32_t
+eventloop_ctl(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, int op, omrsock_socket_t sock, int16_t events, uintptr_t userData)
+{
+	struct epoll_event event;
+
+	memset(&event, 0, sizeof(event));
+	event.events = get_os_epoll_events(events);
+	event.data.u64 = (uint64_t)userData;
+
+	if (0 != epoll_ctl(loop->epollFd, op, sock->data, &event)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return 0;
+}
+#else /* defined(OMRSOCK_USE_EPOLL) */
+/**
+ * @internal Find a socket in a poll based event loop.
+ *
+ * @return index of the socket, or -1 if it is not in the event loop.
+ */
+static intptr_t
+eventloop_find(omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	uint32_t i = 0;
+
+	for (i = 0; loop->count > i; i++) {
+		if (loop->fds[i].fd == sock->data) {
+			return (intptr_t)i;
+		}
+	}
+	return -1;
+}
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	omrsock_eventloop_t newLoop = NULL;
+
+	if (NULL == loop) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	newLoop = (omrsock_eventloop_t)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMREventLoop), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newLoop) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	memset(newLoop, 0, sizeof(OMREventLoop));
+
+#if defined(OMRSOCK_USE_EPOLL)
+	newLoop->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (-1 == newLoop->epollFd) {
+		int32_t rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		portLibrary->mem_free_memory(portLibrary, newLoop);
+		return rc;
+	}
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+
+	*loop = newLoop;
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_close(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	if (NULL == loop || NULL == *loop) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_USE_EPOLL)
+	close((*loop)->epollFd);
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	portLibrary->mem_free_memory(portLibrary, (*loop)->fds);
+	portLibrary->mem_free_memory(portLibrary, (*loop)->userData);
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+	portLibrary->mem_free_memory(portLibrary, *loop);
+	*loop = NULL;
+
+	return 0;
+}
+
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData)
+{
+	if (NULL == loop || NULL == sock || 0 == events) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_USE_EPOLL)
+	return eventloop_ctl(portLibrary, loop, EPOLL_CTL_ADD, sock, events, userData);
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	if (-1 != eventloop_find(loop, sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	if (loop->count == loop->capacity) {
+		uint32_t newCapacity = (0 == loop->capacity) ? 8 : loop->capacity * 2;
+		struct pollfd *newFds = NULL;
+		uintptr_t *newUserData = NULL;
+
+		newFds = portLibrary->mem_reallocate_memory(portLibrary, loop->fds, newCapacity * sizeof(struct pollfd), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newFds) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		loop->fds = newFds;
+		newUserData = portLibrary->mem_reallocate_memory(portLibrary, loop->userData, newCapacity * sizeof(uintptr_t), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newUserData) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		loop->userData = newUserData;
+		loop->capacity = newCapacity;
+	}
+	loop->fds[loop->count].fd = sock->data;
+	loop->fds[loop->count].events = get_os_poll_constant(events);
+	loop->fds[loop->count].revents = 0;
+	loop->userData[loop->count] = userData;
+	loop->count += 1;
+	return 0;
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, int16_t events, uintptr_t userData)
+{
+	if (NULL == loop || NULL == sock || 0 == events) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_USE_EPOLL)
+	return eventloop_ctl(portLibrary, loop, EPOLL_CTL_MOD, sock, events, userData);
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	{
+		intptr_t index = eventloop_find(loop, sock);
+
+		if (-1 == index) {
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		}
+		loop->fds[index].events = get_os_poll_constant(events);
+		loop->userData[index] = userData;
+	}
+	return 0;
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	if (NULL == loop || NULL == sock) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_USE_EPOLL)
+	return eventloop_ctl(portLibrary, loop, EPOLL_CTL_DEL, sock, 0, 0);
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	{
+		intptr_t index = eventloop_find(loop, sock);
+
+		if (-1 == index) {
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		}
+		/* Order is not significant, so fill the hole with the last entry. */
+		loop->count -= 1;
+		loop->fds[index] = loop->fds[loop->count];
+		loop->userData[index] = loop->userData[loop->count];
+	}
+	return 0;
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	int32_t numEvents = 0;
+
+	if (NULL == loop || NULL == events || 0 == maxEvents) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(OMRSOCK_USE_EPOLL)
+	{
+		/* Ready sockets which do not fit stay on the epoll ready list for the next wait. */
+		struct epoll_event ready[OMRSOCK_EVENTLOOP_BATCH];
+		int32_t i = 0;
+
+		numEvents = epoll_wait(loop->epollFd, ready, OMR_MIN(maxEvents, OMRSOCK_EVENTLOOP_BATCH), timeoutMs);
+		if (-1 == numEvents) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		for (i = 0; numEvents > i; i++) {
+			events[i].userData = (uintptr_t)ready[i].data.u64;
+			events[i].revents = get_omr_epoll_events(ready[i].events);
+		}
+	}
+#else /* defined(OMRSOCK_USE_EPOLL) */
+	{
+		uint32_t seen = 0;
+		uint32_t i = 0;
+
+		if (0 == loop->count) {
+			/* Nothing to observe; behave as a timed wait. */
+			numEvents = poll(NULL, 0, timeoutMs);
+		} else {
+			numEvents = poll(loop->fds, loop->count, timeoutMs);
+		}
+		if (0 > numEvents) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+
+		numEvents = 0;
+		if (loop->next >= loop->count) {
+			loop->next = 0;
+		}
+		for (seen = 0, i = loop->next; (loop->count > seen) && (maxEvents > (uint32_t)numEvents); seen++) {
+			if (0 != loop->fds[i].revents) {
+				events[numEvents].userData = loop->userData[i];
+				events[numEvents].revents = get_omr_poll_constant(loop->fds[i].revents);
+				numEvents += 1;
+			}
+			i = (i + 1 == loop->count) ? 0 : i + 1;
+		}
+		loop->next = i;
+	}
+#endif /* defined(OMRSOCK_USE_EPOLL) */
+
+	return numEvents;
+}
+
+/**
+ * @internal Fill in a msghdr describing the buffers and address of a message.
+ * OMRSockIOVec is laid out as struct iovec so it is passed to the OS as is.
+ */
+static void
+fill_msghdr(struct msghdr *hdr, OMRSockIOVec *iov, uint32_t iovCount, OMRSockAddrStorage *addr)
+{
+	memset(hdr, 0, sizeof(struct msghdr));
+	hdr->msg_iov = (struct iovec *)iov;
+	hdr->msg_iovlen = iovCount;
+	if (NULL != addr) {
+		hdr->msg_name = (void *)&addr->data;
+		hdr->msg_namelen = sizeof(omr_os_sockaddr_storage);
+	}
+}
+
+int32_t
+omrsock_sendv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags)
+{
+	struct msghdr hdr;
+	int32_t bytesSent = 0;
+
+	if (NULL == sock || NULL == iov || 0 == iovCount) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	fill_msghdr(&hdr, iov, iovCount, NULL);
+	bytesSent = sendmsg(sock->data, &hdr, flags);
+
+	if (-1 == bytesSent) {
+		portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return bytesSent;
+}
+
+int32_t
+omrsock_recvv(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_iovec_t iov, uint32_t iovCount, int32_t flags)
+{
+	struct msghdr hdr;
+	int32_t bytesRecv = 0;
+
+	if (NULL == sock || NULL == iov || 0 == iovCount) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	fill_msghdr(&hdr, iov, iovCount, NULL);
+	bytesRecv = recvmsg(sock->data, &hdr, flags);
+
+	if (-1 == bytesRecv) {
+		portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return bytesRecv;
+}
+
+int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	uint32_t numSent = 0;
+
+	if (NULL == sock || NULL == msgs || 0 == count) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	while (count > numSent) {
+#if defined(OMRSOCK_USE_MMSG)
+		struct mmsghdr hdrs[OMRSOCK_MMSG_BATCH];
+		uint32_t batch = OMR_MIN(count - numSent, OMRSOCK_MMSG_BATCH);
+		int rc = 0;
+		uint32_t i = 0;
+
+		for (i = 0; batch > i; i++) {
+			OMRSockMsg *msg = &msgs[numSent + i];
+			fill_msghdr(&hdrs[i].msg_hdr, msg->iov, msg->iovCount, msg->addr);
+			hdrs[i].msg_len = 0;
+		}
+		rc = sendmmsg(sock->data, hdrs, batch, flags);
+		if (-1 == rc) {
+			break;
+		}
+		for (i = 0; (uint32_t)rc > i; i++) {
+			msgs[numSent + i].bytes = hdrs[i].msg_len;
+		}
+		numSent += rc;
+		if ((uint32_t)rc < batch) {
+			break;
+		}
+#else /* defined(OMRSOCK_USE_MMSG) */
+		struct msghdr hdr;
+		ssize_t bytesSent = 0;
+
+		fill_msghdr(&hdr, msgs[numSent].iov, msgs[numSent].iovCount, msgs[numSent].addr);
+		bytesSent = sendmsg(sock->data, &hdr, flags);
+		if (-1 == bytesSent) {
+			break;
+		}
+		msgs[numSent].bytes = (uint32_t)bytesSent;
+		numSent += 1;
+#endif /* defined(OMRSOCK_USE_MMSG) */
+	}
+
+	if (0 == numSent) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return (int32_t)numSent;
+}
+
+int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	uint32_t numRecv = 0;
+
+	if (NULL == sock || NULL == msgs || 0 == count) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	while (count > numRecv) {
+#if defined(OMRSOCK_USE_MMSG)
+		struct mmsghdr hdrs[OMRSOCK_MMSG_BATCH];
+		uint32_t batch = OMR_MIN(count - numRecv, OMRSOCK_MMSG_BATCH);
+		/* Only the first message may wait, the rest are taken only if already queued. */
+		int batchFlags = flags | ((0 == numRecv) ? MSG_WAITFORONE : MSG_DONTWAIT);
+		int rc = 0;
+		uint32_t i = 0;
+
+		for (i = 0; batch > i; i++) {
+			OMRSockMsg *msg = &msgs[numRecv + i];
+			fill_msghdr(&hdrs[i].msg_hdr, msg->iov, msg->iovCount, msg->addr);
+			hdrs[i].msg_len = 0;
+		}
+		rc = recvmmsg(sock->data, hdrs, batch, batchFlags, NULL);
+		if (-1 == rc) {
+			break;
+		}
+		for (i = 0; (uint32_t)rc > i; i++) {
+			msgs[numRecv + i].bytes = hdrs[i].msg_len;
+		}
+		numRecv += rc;
+		if ((uint32_t)rc < batch) {
+			break;
+		}
+#else /* defined(OMRSOCK_USE_MMSG) */
+		struct msghdr hdr;
+		ssize_t bytesRecv = 0;
+
+		if (0 != numRecv) {
+			/* Only the first message may wait, the rest are taken only if already queued. */
+			struct pollfd pfd;
+			pfd.fd = sock->data;
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+			if (1 != poll(&pfd, 1, 0)) {
+				break;
+			}
+		}
+		fill_msghdr(&hdr, msgs[numRecv].iov, msgs[numRecv].iovCount, msgs[numRecv].addr);
+		bytesRecv = recvmsg(sock->data, &hdr, flags);
+		if (-1 == bytesRecv) {
+			break;
+		}
+		msgs[numRecv].bytes = (uint32_t)bytesRecv;
+		numRecv += 1;
+#endif /* defined(OMRSOCK_USE_MMSG) */
+	}
+
+	if (0 == numRecv) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return (int32_t)numRecv;
+}
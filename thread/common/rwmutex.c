@@ -22,16 +22,42 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+#define RWMUTEX_CACHE_LINE_SIZE 128
+#define RWMUTEX_READER_SLOTS 64
+
+/* Values of RWMutex.biasState, only used by J9THREAD_RWMUTEX_READER_BIASED mutexes */
+#define RWMUTEX_BIAS_NO_WRITER 0
+#define RWMUTEX_BIAS_WRITER_DRAINING 1
+#define RWMUTEX_BIAS_WRITER_ACTIVE 2
+
+/* Number of times a writer yields while waiting for readers to drain before it starts sleeping */
+#define RWMUTEX_DRAIN_YIELDS 64
+
+/**
+ * Reader indicator for a reader-biased mutex. Each indicator sits on its own cache line
+ * so that readers hashed to different slots never write to the same line.
+ */
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_CACHE_LINE_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t biasState;
+	RWMutexReaderSlot *readerSlots;
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,10 +67,21 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_IS_READER_BIASED(m) (J9THREAD_RWMUTEX_READER_BIASED == ((m)->flags & J9THREAD_RWMUTEX_READER_BIASED))
+
+static RWMutexReaderSlot *readerSlot(omrthread_rwmutex_t mutex, omrthread_t self);
+static BOOLEAN readersPresent(omrthread_rwmutex_t mutex);
+static void biasedEnterRead(omrthread_rwmutex_t mutex, omrthread_t self);
+static void biasedDrainReaders(omrthread_rwmutex_t mutex);
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * If J9THREAD_RWMUTEX_READER_BIASED is set in flags, readers announce themselves
+ * in one of a set of per-cache-line indicators selected by the reading thread rather
+ * than in the shared status field, so uncontended read acquires never take syncMon.
+ * Writers pay for this by draining all indicators before they proceed.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -69,6 +106,28 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
+		mutex->flags = flags;
+		mutex->biasState = RWMUTEX_BIAS_NO_WRITER;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+
+		if (RWMUTEX_IS_READER_BIASED(mutex)) {
+			uintptr_t size = (RWMUTEX_READER_SLOTS + 1) * sizeof(RWMutexReaderSlot);
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, size, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			memset(mutex->readerSlotsMemory, 0, size);
+			mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(RWMUTEX_CACHE_LINE_SIZE - 1));
+		}
+
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
@@ -103,6 +162,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +204,14 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		biasedEnterRead(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +238,15 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		/* the writer polls the indicators while draining, so there is nobody to notify */
+		subtractAtomic(&readerSlot(mutex, self)->count, 1);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -234,6 +309,13 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 
 	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
 
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		mutex->biasState = RWMUTEX_BIAS_WRITER_DRAINING;
+		omrthread_monitor_exit(mutex->syncMon);
+		biasedDrainReaders(mutex);
+		return J9THREAD_RWMUTEX_OK;
+	}
+
 	omrthread_monitor_exit(mutex->syncMon);
 
 	return J9THREAD_RWMUTEX_OK;
@@ -273,6 +355,19 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 
 	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
 
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		mutex->biasState = RWMUTEX_BIAS_WRITER_ACTIVE;
+		issueReadWriteBarrier();
+		if (readersPresent(mutex)) {
+			mutex->biasState = RWMUTEX_BIAS_NO_WRITER;
+			mutex->writer = NULL;
+			mutex->status++;
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+	}
+
 	omrthread_monitor_exit(mutex->syncMon);
 
 	return J9THREAD_RWMUTEX_OK;
@@ -299,6 +394,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->biasState = RWMUTEX_BIAS_NO_WRITER;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -330,7 +426,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_IS_READER_BIASED(rwmutex) && readersPresent(rwmutex))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,6 +437,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->biasState = RWMUTEX_BIAS_NO_WRITER;
 	}
 }
 
@@ -352,3 +449,112 @@ omrthread_rwmutex_init_pool(omrthread_library_t library)
 
 #endif /* defined(OMR_THR_FORK_SUPPORT) */
 
+
+/**
+ * Select the reader indicator used by a thread. The choice only depends on the
+ * thread so that nested reads and the matching exits use the same indicator.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the reading thread
+ * @return the thread's reader indicator
+ */
+static RWMutexReaderSlot *
+readerSlot(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	uintptr_t hash = (uintptr_t)self;
+	hash ^= hash >> 17;
+	hash ^= hash >> 9;
+	return &mutex->readerSlots[(hash >> 4) & (RWMUTEX_READER_SLOTS - 1)];
+}
+
+/**
+ * @param[in] mutex a reader-biased mutex
+ * @return TRUE if any reader indicator is non-zero
+ */
+static BOOLEAN
+readersPresent(omrthread_rwmutex_t mutex)
+{
+	uintptr_t i = 0;
+	for (i = 0; i < RWMUTEX_READER_SLOTS; i++) {
+		if (0 != mutex->readerSlots[i].count) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Read acquire for a reader-biased mutex.
+ *
+ * The reader publishes itself in its indicator and then checks whether a writer
+ * owns the mutex. Readers are only turned away once a writer has finished
+ * draining (RWMUTEX_BIAS_WRITER_ACTIVE); while the writer is still draining new
+ * and nested reads proceed, which preserves the reader preference of the
+ * monitor-based mutex and means a thread can never block on a read it already
+ * holds.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the reading thread
+ */
+static void
+biasedEnterRead(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	volatile uintptr_t *count = &readerSlot(mutex, self)->count;
+
+	for (;;) {
+		addAtomic(count, 1);
+		/* the indicator update must be visible before biasState is read; pairs with biasedDrainReaders */
+		issueReadWriteBarrier();
+		if (RWMUTEX_BIAS_WRITER_ACTIVE != mutex->biasState) {
+			break;
+		}
+
+		subtractAtomic(count, 1);
+		omrthread_monitor_enter(mutex->syncMon);
+		while (RWMUTEX_BIAS_WRITER_ACTIVE == mutex->biasState) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Called by a writer that has claimed a reader-biased mutex (status and writer
+ * are set, biasState is RWMUTEX_BIAS_WRITER_DRAINING) to wait until all readers
+ * have left. Returns with biasState set to RWMUTEX_BIAS_WRITER_ACTIVE and no
+ * reader inside the mutex.
+ *
+ * @param[in] mutex a reader-biased mutex
+ */
+static void
+biasedDrainReaders(omrthread_rwmutex_t mutex)
+{
+	uintptr_t yields = 0;
+
+	for (;;) {
+		while (readersPresent(mutex)) {
+			if (yields < RWMUTEX_DRAIN_YIELDS) {
+				yields += 1;
+				omrthread_yield();
+			} else {
+				omrthread_sleep(1);
+			}
+		}
+
+		mutex->biasState = RWMUTEX_BIAS_WRITER_ACTIVE;
+		/* biasState must be visible before the indicators are re-read; pairs with biasedEnterRead */
+		issueReadWriteBarrier();
+		if (!readersPresent(mutex)) {
+			break;
+		}
+
+		/* A reader arrived between the scan and the state change. It may have seen the
+		 * draining state and be inside the mutex, so go back to draining and wake any
+		 * readers that backed off when they saw the active state.
+		 */
+		omrthread_monitor_enter(mutex->syncMon);
+		mutex->biasState = RWMUTEX_BIAS_WRITER_DRAINING;
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
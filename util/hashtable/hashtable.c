@@ -235,6 +235,14 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is set, entries are stored inline in a
+ *  power-of-two sized array probed a group of control bytes at a time (see
+ *  openaddressing.c) and tableSize is rounded up accordingly. Entries move
+ *  when such a table grows or is rehashed, so pointers returned by
+ *  hashTableAdd() and hashTableFind() are only stable while the table is
+ *  marked J9HASH_TABLE_DO_NOT_GROW. The flag is ignored in combination with
+ *  J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 on 64-bit platforms.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -311,6 +319,24 @@ hashTableNewImpl(
 	}
 	hashTable->nodeAlignment = entryAlignment;
 
+	if (hashTableIsOpenAddressing(hashTable)) {
+		if ((J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT))
+#if defined(OMR_ENV_DATA64)
+			|| (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
+#endif /* OMR_ENV_DATA64 */
+		) {
+			/* entries are stored inline, which cannot honour these options: use a chained table instead */
+			hashTableResetFlag(hashTable, J9HASH_TABLE_OPEN_ADDRESSING);
+		} else {
+			hashTable->equalFnUserData = functionUserData;
+			hashTable->hashEqualFn = hashEqualFn;
+			if (0 != openAddressingTableInit(hashTable, tableSize)) {
+				goto error;
+			}
+			return hashTable;
+		}
+	}
+
 	if (J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION == ((flags & J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION))
 		&& (hashTable->listNodeSize == (2 * sizeof(uintptr_t)))
 		&& (hashTable->tableSize <= SPACE_OPT_LIMIT)
@@ -441,22 +467,28 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
-	if (NULL == table->listNodePool) {
-		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
-		findNode = (NULL != *node) ? node : NULL;
-	} else if (NULL == *head) {
-		findNode =  NULL;
-	} else if (AVL_TREE_TAGGED(*head)) {
-		findNode = hashTableFindNodeInTree(table, entry, head);
+	if (hashTableIsOpenAddressing(table)) {
+		findNode = openAddressingTableFind(table, entry);
 	} else {
-		findNode = *hashTableFindNodeInList(table, entry, head);
+		hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+		head = &table->nodes[hash];
+		if (NULL == table->listNodePool) {
+			void **node = hashTableFindNodeSpaceOpt(table, entry, head);
+			findNode = (NULL != *node) ? node : NULL;
+		} else if (NULL == *head) {
+			findNode =  NULL;
+		} else if (AVL_TREE_TAGGED(*head)) {
+			findNode = hashTableFindNodeInTree(table, entry, head);
+		} else {
+			findNode = *hashTableFindNodeInList(table, entry, head);
+		}
 	}
 	return findNode;
 }
@@ -516,14 +548,22 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		addNode = openAddressingTableAdd(table, entry);
+		goto done;
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,13 +742,19 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingTableRemove(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -821,7 +867,7 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 
 	hashTable_printf("hashTableForEachDo <%s>: table=%p\n", table->tableName, table);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsSpaceOptimized(table)) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
@@ -854,6 +900,11 @@ hashTableRehash(J9HashTable *table)
 	void  *tail = NULL;
 	uintptr_t tableSize = table->tableSize;
 
+	if (hashTableIsOpenAddressing(table)) {
+		openAddressingTableRehash(table);
+		return;
+	}
+
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
@@ -1005,6 +1056,10 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	uint32_t numberOfListNodes = table->numberOfNodes - table->numberOfTreeNodes;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingTableStartDo(table, handle);
+	}
+
 	memset(handle, 0, sizeof(J9HashTableState));
 	handle->table = table;
 	handle->bucketIndex = 0;
@@ -1071,7 +1126,9 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openAddressingTableNextDo(handle);
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1158,8 +1215,10 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		rc = openAddressingTableDoRemove(handle);
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
@@ -39,6 +39,40 @@
 extern "C" {
 #endif
 
+/* Number of control bytes examined per probe step by open addressing tables */
+#define OPEN_ADDRESSING_GROUP_WIDTH 16
+
+/* ---------------- openaddressing.c ---------------- */
+
+/**
+* @brief Allocate the slot and control byte arrays of an open addressing table
+* @param *table the table; entrySize, nodeAlignment and memoryCategory must be set
+* @param requestedSize number of entries the table should hold without growing
+* @return 0 on success, 1 on failure
+*/
+uintptr_t
+openAddressingTableInit(J9HashTable *table, uint32_t requestedSize);
+
+void *
+openAddressingTableFind(J9HashTable *table, void *entry);
+
+void *
+openAddressingTableAdd(J9HashTable *table, void *entry);
+
+uint32_t
+openAddressingTableRemove(J9HashTable *table, void *entry);
+
+void
+openAddressingTableRehash(J9HashTable *table);
+
+void *
+openAddressingTableStartDo(J9HashTable *table, J9HashTableState *handle);
+
+void *
+openAddressingTableNextDo(J9HashTableState *handle);
+
+uintptr_t
+openAddressingTableDoRemove(J9HashTableState *handle);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,444 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * file    : openaddressing.c
+ *
+ *  Open addressing hash table flavour (J9HASH_TABLE_OPEN_ADDRESSING)
+ *
+ *  Entries are stored inline in a power-of-two sized slot array. Each slot
+ *  has a one byte control value: EMPTY, DELETED, or the low 7 bits of the
+ *  (mixed) hash of the entry it holds. Lookups probe the control bytes a
+ *  group of OPEN_ADDRESSING_GROUP_WIDTH slots at a time, so on SSE2 capable
+ *  hardware one compare finds every candidate in a group and the equality
+ *  function is only called for slots whose control byte already matches.
+ *
+ *  The control byte array is followed by a copy of its first group so a
+ *  group load starting near the end of the table never needs to wrap.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "ut_hashtable.h"
+#include "omrutilbase.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define OPEN_ADDRESSING_USE_SSE2
+#include <emmintrin.h>
+#endif /* defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) */
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif /* defined(_MSC_VER) */
+
+#define CTRL_EMPTY ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xFE)
+#define CTRL_IS_FULL(c) (0 == ((c) & 0x80))
+
+#define OPEN_ADDRESSING_MIN_CAPACITY OPEN_ADDRESSING_GROUP_WIDTH
+#define OPEN_ADDRESSING_MAX_CAPACITY ((uint32_t)1 << 30)
+
+/* maximum load (including deleted slots) is 7/8 of the capacity */
+#define MAX_LOAD(capacity) ((capacity) - ((capacity) / 8))
+
+#define SLOT(table, index) ((void *)((table)->slots + ((uintptr_t)(index) * (table)->slotSize)))
+
+#define ROUND_TO_SIZEOF_UDATA(number) (((number) + (sizeof(uintptr_t) - 1)) & (~(sizeof(uintptr_t) - 1)))
+
+static uintptr_t allocateSlots(J9HashTable *table, uint32_t capacity, void **memory, uint8_t **controlBytes, uint8_t **slots);
+static uintptr_t resize(J9HashTable *table, uint32_t newCapacity);
+static uint32_t capacityForCount(uint32_t count);
+static void *findSlot(J9HashTable *table, void *entry, uintptr_t hash);
+static uint32_t findInsertIndex(J9HashTable *table, uintptr_t hash);
+static void setControl(J9HashTable *table, uint32_t index, uint8_t control);
+
+/**
+ * Spread the bits of the user hash so that both the 7 bit control value and
+ * the probe start are usable even for weak hash functions (e.g. identity
+ * hashes of aligned pointers).
+ */
+static VMINLINE uintptr_t
+mixHash(uintptr_t hash)
+{
+#if defined(OMR_ENV_DATA64)
+	hash *= (uintptr_t)J9CONST64(0x9E3779B97F4A7C15);
+	hash ^= hash >> 32;
+#else /* OMR_ENV_DATA64 */
+	hash *= (uintptr_t)0x9E3779B9;
+	hash ^= hash >> 16;
+#endif /* OMR_ENV_DATA64 */
+	return hash;
+}
+
+#define H1(hash) ((hash) >> 7)
+#define H2(hash) ((uint8_t)((hash) & 0x7F))
+
+static VMINLINE uint32_t
+lowestSetBit(uint32_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint32_t)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward(&index, mask);
+	return (uint32_t)index;
+#else
+	uint32_t index = 0;
+	while (0 == (mask & 1)) {
+		mask >>= 1;
+		index += 1;
+	}
+	return index;
+#endif
+}
+
+/**
+ * Returns a bit mask with bit i set for every control byte group[i] equal to control.
+ */
+static VMINLINE uint32_t
+groupMatch(const uint8_t *group, uint8_t control)
+{
+#if defined(OPEN_ADDRESSING_USE_SSE2)
+	__m128i bytes = _mm_loadu_si128((const __m128i *)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)control)));
+#else /* OPEN_ADDRESSING_USE_SSE2 */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (group[i] == control) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* OPEN_ADDRESSING_USE_SSE2 */
+}
+
+/**
+ * Returns a bit mask with bit i set for every control byte group[i] that is EMPTY or DELETED.
+ */
+static VMINLINE uint32_t
+groupMatchAvailable(const uint8_t *group)
+{
+#if defined(OPEN_ADDRESSING_USE_SSE2)
+	/* EMPTY and DELETED are the only control values with the sign bit set */
+	return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else /* OPEN_ADDRESSING_USE_SSE2 */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (!CTRL_IS_FULL(group[i])) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* OPEN_ADDRESSING_USE_SSE2 */
+}
+
+uintptr_t
+openAddressingTableInit(J9HashTable *table, uint32_t requestedSize)
+{
+	uint32_t slotSize = ROUND_TO_SIZEOF_UDATA(table->entrySize);
+	uint32_t capacity = capacityForCount(requestedSize);
+
+	if (table->nodeAlignment > sizeof(uintptr_t)) {
+		slotSize = ((slotSize + table->nodeAlignment - 1) / table->nodeAlignment) * table->nodeAlignment;
+	}
+	table->slotSize = slotSize;
+	table->numberOfDeletedNodes = 0;
+
+	if (0 == capacity) {
+		return 1;
+	}
+	if (0 != allocateSlots(table, capacity, (void **)&table->nodes, &table->controlBytes, &table->slots)) {
+		return 1;
+	}
+	table->tableSize = capacity;
+	return 0;
+}
+
+static uint32_t
+capacityForCount(uint32_t count)
+{
+	uint32_t capacity = OPEN_ADDRESSING_MIN_CAPACITY;
+
+	while (MAX_LOAD(capacity) < count) {
+		if (capacity >= OPEN_ADDRESSING_MAX_CAPACITY) {
+			return 0;
+		}
+		capacity <<= 1;
+	}
+	return capacity;
+}
+
+static uintptr_t
+allocateSlots(J9HashTable *table, uint32_t capacity, void **memory, uint8_t **controlBytes, uint8_t **slots)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t alignment = OMR_MAX(table->nodeAlignment, sizeof(uintptr_t));
+	uintptr_t slotBytes = (uintptr_t)capacity * table->slotSize;
+	uintptr_t controlLength = (uintptr_t)capacity + OPEN_ADDRESSING_GROUP_WIDTH;
+	uint8_t *base = NULL;
+
+	*memory = omrmem_allocate_memory(alignment + slotBytes + controlLength, table->memoryCategory);
+	if (NULL == *memory) {
+		return 1;
+	}
+
+	base = (uint8_t *)((((uintptr_t)*memory + alignment - 1) / alignment) * alignment);
+	*slots = base;
+	*controlBytes = base + slotBytes;
+	memset(*controlBytes, CTRL_EMPTY, controlLength);
+	return 0;
+}
+
+static void
+setControl(J9HashTable *table, uint32_t index, uint8_t control)
+{
+	table->controlBytes[index] = control;
+	/* keep the mirrored first group in sync */
+	if (index < OPEN_ADDRESSING_GROUP_WIDTH) {
+		table->controlBytes[table->tableSize + index] = control;
+	}
+}
+
+static void *
+findSlot(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uint32_t mask = table->tableSize - 1;
+	uint32_t position = (uint32_t)H1(hash) & mask;
+	uint32_t stride = 0;
+	uint8_t h2 = H2(hash);
+
+	for (;;) {
+		const uint8_t *group = &table->controlBytes[position];
+		uint32_t matches = groupMatch(group, h2);
+
+		while (0 != matches) {
+			uint32_t index = (position + lowestSetBit(matches)) & mask;
+			void *slot = SLOT(table, index);
+			if (0 != table->hashEqualFn(slot, entry, table->equalFnUserData)) {
+				return slot;
+			}
+			matches &= matches - 1;
+		}
+		if (0 != groupMatch(group, CTRL_EMPTY)) {
+			return NULL;
+		}
+		/* triangular probing over groups visits every group of a power-of-two table */
+		stride += OPEN_ADDRESSING_GROUP_WIDTH;
+		position = (position + stride) & mask;
+	}
+}
+
+static uint32_t
+findInsertIndex(J9HashTable *table, uintptr_t hash)
+{
+	uint32_t mask = table->tableSize - 1;
+	uint32_t position = (uint32_t)H1(hash) & mask;
+	uint32_t stride = 0;
+
+	for (;;) {
+		uint32_t available = groupMatchAvailable(&table->controlBytes[position]);
+		if (0 != available) {
+			return (position + lowestSetBit(available)) & mask;
+		}
+		stride += OPEN_ADDRESSING_GROUP_WIDTH;
+		position = (position + stride) & mask;
+	}
+}
+
+void *
+openAddressingTableFind(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	return findSlot(table, entry, hash);
+}
+
+void *
+openAddressingTableAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	void *slot = findSlot(table, entry, hash);
+
+	if (NULL == slot) {
+		uint32_t index = findInsertIndex(table, hash);
+
+		if ((CTRL_EMPTY == table->controlBytes[index])
+			&& ((table->numberOfNodes + table->numberOfDeletedNodes + 1) > MAX_LOAD(table->tableSize))
+		) {
+			/* Out of never-used slots: rebuild, dropping DELETED markers, and grow if the live entries need it */
+			uint32_t newCapacity = capacityForCount(table->numberOfNodes + 1);
+
+			if (newCapacity < table->tableSize) {
+				newCapacity = table->tableSize;
+			}
+			/* Entries move during a rebuild, which is not allowed while the table is marked as not growable */
+			if ((0 == newCapacity)
+				|| !hashTableCanGrow(table)
+				|| !hashTableCanRehash(table)
+				|| (0 != resize(table, newCapacity))
+			) {
+				return NULL;
+			}
+			index = findInsertIndex(table, hash);
+		}
+
+		if (CTRL_DELETED == table->controlBytes[index]) {
+			table->numberOfDeletedNodes -= 1;
+		}
+		slot = SLOT(table, index);
+		memcpy(slot, entry, table->entrySize);
+		if (!hashTableCanGrow(table)) {
+			/* Publish the entry before its control byte for lock-free readers of non-growing tables */
+			issueWriteBarrier();
+		}
+		setControl(table, index, H2(hash));
+		table->numberOfNodes += 1;
+	}
+	return slot;
+}
+
+uint32_t
+openAddressingTableRemove(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	void *slot = findSlot(table, entry, hash);
+	uint32_t rc = 1;
+
+	if (NULL != slot) {
+		uint32_t index = (uint32_t)(((uint8_t *)slot - table->slots) / table->slotSize);
+		/* A DELETED marker keeps probe sequences passing through this slot intact */
+		setControl(table, index, CTRL_DELETED);
+		table->numberOfNodes -= 1;
+		table->numberOfDeletedNodes += 1;
+		rc = 0;
+	}
+	return rc;
+}
+
+static uintptr_t
+resize(J9HashTable *table, uint32_t newCapacity)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	void *oldMemory = table->nodes;
+	uint8_t *oldControlBytes = table->controlBytes;
+	uint8_t *oldSlots = table->slots;
+	uint32_t oldCapacity = table->tableSize;
+	void *newMemory = NULL;
+	uint8_t *newControlBytes = NULL;
+	uint8_t *newSlots = NULL;
+	uint32_t numberOfNodes = 0;
+	uint32_t i = 0;
+
+	if (0 != allocateSlots(table, newCapacity, &newMemory, &newControlBytes, &newSlots)) {
+		return 1;
+	}
+
+	table->nodes = newMemory;
+	table->controlBytes = newControlBytes;
+	table->slots = newSlots;
+	table->tableSize = newCapacity;
+	table->numberOfDeletedNodes = 0;
+
+	for (i = 0; i < oldCapacity; i++) {
+		if (CTRL_IS_FULL(oldControlBytes[i])) {
+			void *oldSlot = oldSlots + ((uintptr_t)i * table->slotSize);
+			uintptr_t hash = mixHash(table->hashFn(oldSlot, table->hashFnUserData));
+			uint32_t index = findInsertIndex(table, hash);
+
+			memcpy(SLOT(table, index), oldSlot, table->entrySize);
+			setControl(table, index, H2(hash));
+			numberOfNodes += 1;
+		}
+	}
+	Assert_hashTable_true(numberOfNodes == table->numberOfNodes);
+
+	omrmem_free_memory(oldMemory);
+	return 0;
+}
+
+void
+openAddressingTableRehash(J9HashTable *table)
+{
+	/* Rebuilding at the current capacity recomputes every hash and drops DELETED markers */
+	if (0 != resize(table, table->tableSize)) {
+		/* Entries would be unreachable if left in their old slots */
+		Assert_hashTable_unreachable();
+	}
+}
+
+static void *
+nextFullSlot(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+
+	while (handle->bucketIndex < table->tableSize) {
+		if (CTRL_IS_FULL(table->controlBytes[handle->bucketIndex])) {
+			return SLOT(table, handle->bucketIndex);
+		}
+		handle->bucketIndex += 1;
+	}
+	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+	return NULL;
+}
+
+void *
+openAddressingTableStartDo(J9HashTable *table, J9HashTableState *handle)
+{
+	memset(handle, 0, sizeof(J9HashTableState));
+	handle->table = table;
+	handle->bucketIndex = 0;
+	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
+	return nextFullSlot(handle);
+}
+
+void *
+openAddressingTableNextDo(J9HashTableState *handle)
+{
+	if (J9HASH_TABLE_ITERATE_STATE_FINISHED == handle->iterateState) {
+		return NULL;
+	}
+	handle->bucketIndex += 1;
+	handle->didDeleteCurrentNode = FALSE;
+	return nextFullSlot(handle);
+}
+
+uintptr_t
+openAddressingTableDoRemove(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+	uintptr_t rc = 1;
+
+	if ((J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState)
+		&& (FALSE == handle->didDeleteCurrentNode)
+		&& CTRL_IS_FULL(table->controlBytes[handle->bucketIndex])
+	) {
+		/* Entries never move on removal, so the iteration can simply continue past this slot */
+		setControl(table, handle->bucketIndex, CTRL_DELETED);
+		table->numberOfNodes -= 1;
+		table->numberOfDeletedNodes += 1;
+		handle->didDeleteCurrentNode = TRUE;
+		rc = 0;
+	}
+	return rc;
+}
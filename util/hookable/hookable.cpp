@@ -86,6 +86,16 @@ static const J9HookInterface hookFunctionTable = {
 #define HOOK_INVALID_ID(id) ((id) | 1)
 #define HOOK_VALID_ID(id) ( (((id) | 1) + 1) )
 
+/* shards are padded to a cache line so that threads updating different shards do not share a line */
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define HOOK_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define HOOK_CACHE_LINE_SIZE 256
+#else
+#define HOOK_CACHE_LINE_SIZE 64
+#endif
+#define HOOK_MAX_SHARDS 64
+
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value)
@@ -164,43 +174,139 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 	if (commonInterface->pool) {
 		pool_kill(commonInterface->pool);
 	}
-}
 
+	if (NULL != commonInterface->shardMemory) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		omrmem_free_memory(commonInterface->shardMemory);
+		commonInterface->shardMemory = NULL;
+		commonInterface->shards = NULL;
+	}
+}
 
 /*
- * Inform all registered listeners that the specified event has occurred. Details about the
- * event should be available through eventData.
+ * Select how listener statistics are gathered for the specified hook interface.
  *
- * If the J9HOOK_TAG_ONCE bit is set in the taggedEventNum, then the event is disabled
- * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
- * once it has been reported will fail.
+ * J9HOOK_STATISTICS_SHARDED keeps the count, total time, last and longest listener of
+ * each event in one of several cache line aligned shards, chosen by the dispatching
+ * thread, instead of in the OMREventInfo4Dump shared by all threads. The shards are
+ * folded into the OMREventInfo4Dump by J9HookAggregateStatistics().
  *
- * This function should not be called directly. It should be called through the hook interface
+ * J9HOOK_STATISTICS_SAMPLED_EVENTS_ONLY dispatches events which are not tagged with a
+ * sampling interval without touching any statistics.
+ *
+ * This function may be called directly, before any event is dispatched.
  *
+ * Returns 0 on success, J9HOOK_ERR_NOMEM if the shards could not be allocated
  */
-static void
-J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, void *eventData)
+intptr_t
+J9HookConfigureStatistics(struct J9HookInterface **hookInterface, uintptr_t flags)
 {
-	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
-	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
-	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
-	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
-	bool sampling = false;
 
-	if (taggedEventNum & J9HOOK_TAG_ONCE) {
-		uint8_t oldFlags;
+	if (OMR_ARE_ANY_BITS_SET(flags, J9HOOK_STATISTICS_SHARDED) && (NULL == commonInterface->shards)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		uintptr_t cpus = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+		uintptr_t shardCount = 1;
+		uintptr_t stride = commonInterface->eventSize * sizeof(OMREventInfo4Dump);
+		void *memory = NULL;
 
-		omrthread_monitor_enter(commonInterface->lock);
-		oldFlags = HOOK_FLAGS(commonInterface, eventNum);
-		/* clear the HOOKED and RESERVED flags and set the DISABLED flag */
-		HOOK_FLAGS(commonInterface, eventNum) = (oldFlags | J9HOOK_FLAG_DISABLED) & ~(J9HOOK_FLAG_RESERVED | J9HOOK_FLAG_HOOKED);
-		omrthread_monitor_exit(commonInterface->lock);
+		/* twice as many shards as CPUs makes it unlikely that two running threads share a shard */
+		while ((shardCount < (2 * cpus)) && (shardCount < HOOK_MAX_SHARDS)) {
+			shardCount *= 2;
+		}
+		stride = (stride + HOOK_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(HOOK_CACHE_LINE_SIZE - 1);
 
-		if (oldFlags & J9HOOK_FLAG_DISABLED) {
-			/* already reported */
-			return;
+		memory = omrmem_allocate_memory((shardCount * stride) + HOOK_CACHE_LINE_SIZE, OMRMEM_CATEGORY_VM);
+		if (NULL == memory) {
+			return J9HOOK_ERR_NOMEM;
 		}
+		memset(memory, 0, (shardCount * stride) + HOOK_CACHE_LINE_SIZE);
+
+		commonInterface->shardMemory = memory;
+		commonInterface->shardMask = shardCount - 1;
+		commonInterface->shardStride = stride;
+		commonInterface->shards = (OMREventInfo4Dump *)(((uintptr_t)memory + HOOK_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(HOOK_CACHE_LINE_SIZE - 1));
+	}
+	commonInterface->statisticsFlags = flags;
+
+	return 0;
+}
+
+/*
+ * Fold the sharded statistics of every event into its OMREventInfo4Dump: counts and
+ * times are summed, the longest listener is the longest of any shard and the last
+ * listener is the one which started most recently.
+ *
+ * Dispatching threads may update the shards concurrently, in which case the result
+ * may miss their most recent updates. Calling this again accounts for them.
+ *
+ * This function may be called directly.
+ */
+void
+J9HookAggregateStatistics(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uint8_t *shards = (uint8_t *)commonInterface->shards;
+
+	if (NULL != shards) {
+		for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
+			uintptr_t count = 0;
+			uintptr_t totalTime = 0;
+
+			for (uintptr_t shard = 0; shard <= commonInterface->shardMask; shard++) {
+				OMREventInfo4Dump *shardDump = &((OMREventInfo4Dump *)(shards + (shard * commonInterface->shardStride)))[eventNum];
+
+				count += shardDump->count;
+				totalTime += shardDump->totalTime;
+				if ((0 != shardDump->longestHook.startTime)
+					&& ((0 == eventDump->longestHook.startTime) || (eventDump->longestHook.duration < shardDump->longestHook.duration))
+				) {
+					eventDump->longestHook = shardDump->longestHook;
+				}
+				if (eventDump->lastHook.startTime < shardDump->lastHook.startTime) {
+					eventDump->lastHook = shardDump->lastHook;
+				}
+			}
+			eventDump->count = count;
+			eventDump->totalTime = totalTime;
+		}
+	}
+}
+
+/*
+ * Returns the statistics which the current thread updates when listeners of eventNum are called.
+ */
+static VMINLINE OMREventInfo4Dump *
+eventStatistics(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	uint8_t *shards = (uint8_t *)commonInterface->shards;
+
+	if (NULL != shards) {
+		/* omrthread_t structures are heap allocated, so discard the low bits before masking */
+		uintptr_t self = (uintptr_t)omrthread_self();
+		uintptr_t shard = ((self >> 6) ^ (self >> 14)) & commonInterface->shardMask;
+
+		return &((OMREventInfo4Dump *)(shards + (shard * commonInterface->shardStride)))[eventNum];
+	}
+	return J9HOOK_DUMPINFO(commonInterface, eventNum);
+}
+
+/*
+ * Call every valid listener registered for eventNum. When collectStatistics is false the
+ * listeners are called without counting or timing them. Always called with a constant
+ * collectStatistics so that each caller inlines a loop specialized for it.
+ */
+static VMINLINE void
+dispatchToListeners(struct J9HookInterface **hookInterface, uintptr_t eventNum, void *eventData, uintptr_t samplingInterval, bool collectStatistics)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
+	OMREventInfo4Dump *eventDump = NULL;
+	bool sampling = false;
+
+	if (collectStatistics) {
+		eventDump = eventStatistics(commonInterface, eventNum);
 	}
 
 	while (record) {
@@ -219,49 +325,53 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 			/* now read the id again to make sure that nothing has changed */
 			VM_AtomicSupport::readBarrier();
 			if (record->id == id) {
-				uint64_t startTime = 0;
-				uintptr_t count = 0;
-				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
-					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+				if (!collectStatistics) {
+					function(hookInterface, eventNum, eventData, userData);
 				} else {
-					sampling =  false;
-				}
-				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
-				if (sampling) {
-					startTime = omrtime_usec_clock(); 
-				}
+					uint64_t startTime = 0;
+					uintptr_t count = 0;
+					if (NULL != eventDump) {
+						count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
+						sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+					} else {
+						sampling =  false;
+					}
+					OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+					if (sampling) {
+						startTime = omrtime_usec_clock(); 
+					}
 
-				function(hookInterface, eventNum, eventData, userData);
+					function(hookInterface, eventNum, eventData, userData);
 
-				if (sampling) {
-					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+					if (sampling) {
+						uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+						eventDump->lastHook.startTime = startTime;
+						eventDump->lastHook.callsite = record->callsite;
+						eventDump->lastHook.func_ptr = (void *)record->function;
+						eventDump->lastHook.duration = timeDelta;
+						VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
 
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
-					}
+						if ((eventDump->longestHook.duration < timeDelta) ||
+							(0 == eventDump->longestHook.startTime)) {
+								eventDump->longestHook.startTime = startTime;
+								eventDump->longestHook.callsite = record->callsite;
+								eventDump->longestHook.func_ptr = (void *)record->function;
+								eventDump->longestHook.duration = timeDelta;
+						}
 
-					if (commonInterface->threshold4Trace <= timeDelta) {
-						const char *callsite = "UNKNOWN";
-						char buffer[32];
-						if (NULL != record->callsite) {
-							callsite = record->callsite;
-						} else {
-							/* if the callsite info can not be retrieved, use callback function pointer instead  */
-							omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
-							callsite = buffer;
+						if (commonInterface->threshold4Trace <= timeDelta) {
+							const char *callsite = "UNKNOWN";
+							char buffer[32];
+							if (NULL != record->callsite) {
+								callsite = record->callsite;
+							} else {
+								/* if the callsite info can not be retrieved, use callback function pointer instead  */
+								omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
+								callsite = buffer;
+							}
+							Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
 						}
-						Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
 					}
 				}
 			} else {
@@ -274,6 +384,47 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 }
 
 
+/*
+ * Inform all registered listeners that the specified event has occurred. Details about the
+ * event should be available through eventData.
+ *
+ * If the J9HOOK_TAG_ONCE bit is set in the taggedEventNum, then the event is disabled
+ * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
+ * once it has been reported will fail.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ *
+ */
+static void
+J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, void *eventData)
+{
+	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
+
+	if (taggedEventNum & J9HOOK_TAG_ONCE) {
+		uint8_t oldFlags;
+
+		omrthread_monitor_enter(commonInterface->lock);
+		oldFlags = HOOK_FLAGS(commonInterface, eventNum);
+		/* clear the HOOKED and RESERVED flags and set the DISABLED flag */
+		HOOK_FLAGS(commonInterface, eventNum) = (oldFlags | J9HOOK_FLAG_DISABLED) & ~(J9HOOK_FLAG_RESERVED | J9HOOK_FLAG_HOOKED);
+		omrthread_monitor_exit(commonInterface->lock);
+
+		if (oldFlags & J9HOOK_FLAG_DISABLED) {
+			/* already reported */
+			return;
+		}
+	}
+
+	if ((0 == samplingInterval) && OMR_ARE_ANY_BITS_SET(commonInterface->statisticsFlags, J9HOOK_STATISTICS_SAMPLED_EVENTS_ONLY)) {
+		dispatchToListeners(hookInterface, eventNum, eventData, samplingInterval, false);
+	} else {
+		dispatchToListeners(hookInterface, eventNum, eventData, samplingInterval, true);
+	}
+}
+
+
 
 /*
  * Mark this event as disabled. Any future attempts to add a hook for this event
@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "omrutilbase.h"
 #include "pool_internal.h"
 #include "ut_pool.h"
 
@@ -248,6 +249,39 @@ poolPuddle_delete(J9Pool *pool, J9PoolPuddle *puddle)
 
 }
 
+/**
+ * Free the depot of a POOL_CONCURRENT pool together with the magazines it holds.
+ * Magazines still loaded in thread caches are not freed.
+ *
+ * @param[in] pool The pool, its depot may be NULL
+ *
+ * @return none
+ */
+static void
+pool_killDepot(J9Pool *pool)
+{
+	J9PoolDepot *depot = pool->depot;
+
+	if (NULL != depot) {
+		J9PoolMagazine *lists[2];
+		uintptr_t i;
+
+		lists[0] = depot->fullMagazines;
+		lists[1] = depot->emptyMagazines;
+		for (i = 0; i < 2; i++) {
+			J9PoolMagazine *walk = lists[i];
+			while (NULL != walk) {
+				J9PoolMagazine *next = walk->next;
+				pool->memFree(pool->userData, walk, POOL_ALLOC_TYPE_MAGAZINE);
+				walk = next;
+			}
+		}
+		MUTEX_DESTROY(depot->mutex);
+		pool->memFree(pool->userData, depot, POOL_ALLOC_TYPE_MAGAZINE);
+		pool->depot = NULL;
+	}
+}
+
 /**
  *	Returns a handle to a variable sized pool of structures.
  *	This handle should be passed into all other pool functions.
@@ -262,6 +296,10 @@ poolPuddle_delete(J9Pool *pool, J9PoolPuddle *puddle)
  * @param[in] memFree  Free function pointer for J9Pools
  * @param[in] userData Passed as first parameter into allocation and free calls
  *
+ * If POOL_CONCURRENT is set in poolFlags the pool does its own locking, and
+ * threads may keep a cache of free elements for it (see @ref pool_newElementCached).
+ * Such a pool never frees its puddles and must not share its puddle list.
+ *
  * @return pointer to a new pool, or NULL if the pool could not be created.
  *
  */
@@ -377,8 +415,31 @@ pool_new(uintptr_t structSizeArg,
 		return NULL;
 	}
 
+	if (poolFlags & POOL_CONCURRENT) {
+		/* Free elements sit in magazines without being on a puddle free list, so puddles must stay. */
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+	}
+
 	pool = memAlloc(userData, sizeof(J9Pool), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_POOL, &doInit);
 
+	if ((NULL != pool) && (poolFlags & POOL_CONCURRENT)) {
+		doInit = 1;
+		pool->depot = memAlloc(userData, sizeof(J9PoolDepot), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_MAGAZINE, &doInit);
+		if ((NULL != pool->depot) && !MUTEX_INIT(pool->depot->mutex)) {
+			memFree(userData, pool->depot, POOL_ALLOC_TYPE_MAGAZINE);
+			pool->depot = NULL;
+		}
+		if (NULL == pool->depot) {
+			memFree(userData, pool, POOL_ALLOC_TYPE_POOL);
+			pool = NULL;
+		} else {
+			pool->depot->fullMagazines = NULL;
+			pool->depot->emptyMagazines = NULL;
+		}
+	} else if (NULL != pool) {
+		pool->depot = NULL;
+	}
+
 	if (NULL != pool) {
 		J9PoolPuddleList *puddleList;
 
@@ -407,11 +468,13 @@ pool_new(uintptr_t structSizeArg,
 					NNWSRP_SET(puddleList->nextAvailablePuddle, firstPuddle);
 				} else {
 					memFree(userData, puddleList, POOL_ALLOC_TYPE_PUDDLE_LIST);
+					pool_killDepot(pool);
 					memFree(userData, pool, POOL_ALLOC_TYPE_POOL);
 					pool = NULL;
 				}
 			}
 		} else {
+			pool_killDepot(pool);
 			memFree(userData, pool, POOL_ALLOC_TYPE_POOL);
 			pool = NULL;
 		}
@@ -425,6 +488,8 @@ pool_new(uintptr_t structSizeArg,
 /**
  *	Deallocates all memory associated with a pool.
  *
+ * All thread caches of a POOL_CONCURRENT pool must have been flushed.
+ *
  * @param[in] pool Pool to be deallocated
  *
  * @return none
@@ -447,6 +512,7 @@ pool_kill(J9Pool *pool)
 		}
 
 		pool->memFree(pool->userData, puddleList, POOL_ALLOC_TYPE_PUDDLE_LIST);
+		pool_killDepot(pool);
 		pool->memFree(pool->userData, pool, POOL_ALLOC_TYPE_POOL);
 	}
 
@@ -454,53 +520,113 @@ pool_kill(J9Pool *pool)
 }
 
 /**
- *	Asks for the address of a new pool element.
- *
- *	If it succeeds, the address returned will have space for
- *	one element of the correct structure size.
- *
- *	The contents of the element will be set to 0's unless the
- *  POOL_NO_ZERO flag is set on the pool, in which case the
- *  contents are undefined.
+ * Put a slot back on the free list of its puddle, and free the puddle if it is
+ * now empty and the pool allows it. The slot must already be marked as free.
  *
- *	If all puddles in the pool are full, a new puddle will be
- *  grafted onto the end of the pool's puddle chain and the
- *  element returned will come from this puddle.
+ * For POOL_CONCURRENT pools the depot mutex must be held.
  *
  * @param[in] pool
+ * @param[in] puddle The puddle containing the slot
+ * @param[in] freeSlot The slot
  *
- * @return NULL on error
- * @return pointer to a new element otherwise
+ * @return none
+ */
+static void
+pool_returnFreeSlot(J9Pool *pool, J9PoolPuddle *puddle, void *freeSlot)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	void *freeLocation = (void *) J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+
+	SRP_SET(puddle->firstFreeSlot, freeSlot);
+	LINK_TO_FREE_LIST(freeSlot, freeLocation);
+
+	/* If the puddle's empty, and we're allowed to free it, then remove it. */
+	if ((puddle->usedElements == 0) && !(pool->flags & POOL_NEVER_FREE_PUDDLES)) {
+		poolPuddle_delete(pool, puddle);
+	} else if (NULL == freeLocation) {
+		/* It was full before - but not anymore - add it to the top of the available puddles list. */
+		J9PoolPuddle *next = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+
+		WSRP_SET(puddleList->nextAvailablePuddle, puddle);
+		WSRP_SET(puddle->prevAvailablePuddle, NULL);
+		WSRP_SET(puddle->nextAvailablePuddle, next);
+		if (NULL != next) {
+			WSRP_SET(next->prevAvailablePuddle, puddle);
+		}
+	}
+}
+
+/**
+ * Return the rounds of a magazine to their puddles and put the magazine on the
+ * depot's list of empty magazines. The depot mutex must be held.
+ *
+ * @param[in] pool A POOL_CONCURRENT pool
+ * @param[in] magazine The magazine, may be NULL
  *
+ * @return none
  */
-void *
-pool_newElement(J9Pool *pool)
+static void
+pool_drainMagazine(J9Pool *pool, J9PoolMagazine *magazine)
 {
-	int32_t slot;
-	void *newElement;
-	void *nextFreeElement;
-	J9SRP *puddleSRP;
-	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
+	J9PoolDepot *depot = pool->depot;
 
-	Trc_pool_newElement_Entry(pool);
+	if (NULL != magazine) {
+		while (0 != magazine->rounds) {
+			void *freeSlot;
+			J9SRP *puddleSRP;
 
-	if (NULL == pool) {
-		Trc_pool_newElement_ExitNoop();
-		return NULL;
+			magazine->rounds -= 1;
+			freeSlot = magazine->elements[magazine->rounds];
+			puddleSRP = pool_getElementPuddleSRP(pool, freeSlot);
+			pool_returnFreeSlot(pool, NNSRP_GET(*puddleSRP, J9PoolPuddle *), freeSlot);
+		}
+		magazine->next = depot->emptyMagazines;
+		depot->emptyMagazines = magazine;
 	}
+}
 
-	/* Check if there is a puddle with free slots - if so use it. */
-	puddleList = J9POOL_PUDDLELIST(pool);
+/**
+ * Take a free slot off the free list of the first available puddle, allocating
+ * a new puddle if there is none (after returning the rounds of any full magazines
+ * in the depot to their puddles). The slot is not marked as used.
+ *
+ * The puddle SRP of the slot is set, so that the puddle can be found from the
+ * slot while it sits in a magazine of a POOL_CONCURRENT pool.
+ *
+ * For POOL_CONCURRENT pools the depot mutex must be held.
+ *
+ * @param[in] pool
+ *
+ * @return NULL if a new puddle could not be allocated
+ * @return pointer to a free slot otherwise
+ */
+static void *
+pool_takeFreeSlot(J9Pool *pool)
+{
+	void *freeSlot;
+	void *nextFreeSlot;
+	J9SRP *puddleSRP;
+	J9PoolPuddle *puddle;
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
 
+	/* Check if there is a puddle with free slots - if so use it. */
 	puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+	if ((NULL == puddle) && (NULL != pool->depot)) {
+		/* Before growing, reclaim the free elements parked in the depot. */
+		J9PoolDepot *depot = pool->depot;
+		while (NULL != depot->fullMagazines) {
+			J9PoolMagazine *magazine = depot->fullMagazines;
+			depot->fullMagazines = magazine->next;
+			pool_drainMagazine(pool, magazine);
+		}
+		puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+	}
 	if (NULL == puddle) {
 		J9PoolPuddle *head;
 
 		/* No available puddles. Allocate a new one. */
 		puddle = poolPuddle_new(pool);
 		if (NULL == puddle) {
-			Trc_pool_newElement_Exit(NULL);
 			return NULL;
 		}
 
@@ -513,22 +639,14 @@ pool_newElement(J9Pool *pool)
 		NNWSRP_SET(puddleList->nextAvailablePuddle, puddle);
 	}
 
-	newElement = J9POOLPUDDLE_FIRSTFREESLOT(puddle);
-	nextFreeElement = NEXT_FREE_SLOT(newElement);
-
-	SRP_SET(puddle->firstFreeSlot, nextFreeElement);
-	slot = pool_getElementPuddleSlot(pool, puddle, newElement);
-	MARK_SLOT_USED(puddle, slot);
-	puddle->usedElements++;
-	puddleList->numElements++;
-	if (!(pool->flags & POOL_NO_ZERO)) {
-		memset(newElement, 0, pool->elementSize);
-	}
-	puddleSRP = pool_getElementPuddleSRP(pool, newElement);
+	freeSlot = J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+	nextFreeSlot = NEXT_FREE_SLOT(freeSlot);
+	SRP_SET(puddle->firstFreeSlot, nextFreeSlot);
+	puddleSRP = pool_getElementPuddleSRP(pool, freeSlot);
 	NNSRP_SET(*puddleSRP, puddle);
 
 	/* If the puddle is full, remove it from the list of available puddles. */
-	if (NULL == nextFreeElement) {
+	if (NULL == nextFreeSlot) {
 		J9PoolPuddle *next = J9POOLPUDDLE_NEXTAVAILABLEPUDDLE(puddle);
 		J9PoolPuddle *prev = J9POOLPUDDLE_PREVAVAILABLEPUDDLE(puddle);
 
@@ -547,6 +665,168 @@ pool_newElement(J9Pool *pool)
 		WSRP_SET(puddle->prevAvailablePuddle, NULL);
 	}
 
+	return freeSlot;
+}
+
+/**
+ * Flip the used/free bit of a slot and adjust the puddle and pool element counts.
+ *
+ * Slots of POOL_CONCURRENT pools are claimed and released by threads that do not
+ * hold the depot mutex, so their bits and counts are updated atomically.
+ *
+ * @param[in] pool
+ * @param[in] puddle The puddle containing the slot
+ * @param[in] slot The slot index
+ * @param[in] used TRUE to mark the slot as used, FALSE to mark it as free
+ *
+ * @return FALSE if the slot was already in the requested state, TRUE otherwise
+ */
+static BOOLEAN
+poolPuddle_setSlotUsed(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot, BOOLEAN used)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+
+	if (pool->flags & POOL_CONCURRENT) {
+		uint32_t *bits = PUDDLE_BITS(puddle) + (((uint32_t)slot) >> 5);
+		uint32_t freeBit = (uint32_t)1 << (31 - (((uint32_t)slot) & 31));
+		uint32_t oldBits;
+		uint32_t newBits;
+
+		do {
+			oldBits = *(volatile uint32_t *)bits;
+			if (used != (0 != (oldBits & freeBit))) {
+				return FALSE;
+			}
+			newBits = used ? (oldBits & ~freeBit) : (oldBits | freeBit);
+		} while (oldBits != compareAndSwapU32(bits, oldBits, newBits));
+
+		if (used) {
+			addAtomic(&puddle->usedElements, 1);
+			addAtomic(&puddleList->numElements, 1);
+		} else {
+			subtractAtomic(&puddle->usedElements, 1);
+			subtractAtomic(&puddleList->numElements, 1);
+		}
+	} else {
+		if (used != (0 != PUDDLE_SLOT_FREE(puddle, slot))) {
+			return FALSE;
+		}
+
+		if (used) {
+			MARK_SLOT_USED(puddle, slot);
+			puddle->usedElements++;
+			puddleList->numElements++;
+		} else {
+			MARK_SLOT_FREE(puddle, slot);
+			puddle->usedElements--;
+			puddleList->numElements--;
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * Hand out a free slot taken by @ref pool_takeFreeSlot: mark it as used and clear
+ * its contents unless the pool is POOL_NO_ZERO.
+ *
+ * @param[in] pool
+ * @param[in] newElement The slot
+ *
+ * @return none
+ */
+static void
+pool_claimElement(J9Pool *pool, void *newElement)
+{
+	J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, newElement);
+	J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+	int32_t slot = pool_getElementPuddleSlot(pool, puddle, newElement);
+
+	if (!(pool->flags & POOL_NO_ZERO)) {
+		memset(newElement, 0, pool->elementSize);
+	}
+	/* Clearing the element may have cleared the puddle SRP as well. */
+	NNSRP_SET(*puddleSRP, puddle);
+	poolPuddle_setSlotUsed(pool, puddle, slot, TRUE);
+}
+
+/**
+ * Validate an element being removed from a pool and mark its slot as free.
+ *
+ * @param[in] pool
+ * @param[in] anElement The element
+ * @param[out] puddleOut The puddle containing the element
+ *
+ * @return FALSE if the element does not belong to the pool or is already free, TRUE otherwise
+ */
+static BOOLEAN
+pool_releaseElement(J9Pool *pool, void *anElement, J9PoolPuddle **puddleOut)
+{
+	J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, anElement);
+	J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+	int32_t slot = pool_getElementPuddleSlot(pool, puddle, anElement);
+
+	if (slot < 0) {
+		Trc_pool_removeElement_NotFound(anElement, J9POOLPUDDLELIST_NEXTPUDDLE(J9POOL_PUDDLELIST(pool)));
+		return FALSE;		/* this is an error...  we were passed a bogus data pointer. */
+	}
+
+	if (!poolPuddle_setSlotUsed(pool, puddle, slot, FALSE)) {
+		Trc_pool_removeElement_NotFound(anElement, puddle);
+		return FALSE;		/* this is an error... the slot was already free. */
+	}
+
+	*puddleOut = puddle;
+	return TRUE;
+}
+
+/**
+ *	Asks for the address of a new pool element.
+ *
+ *	If it succeeds, the address returned will have space for
+ *	one element of the correct structure size.
+ *
+ *	The contents of the element will be set to 0's unless the
+ *  POOL_NO_ZERO flag is set on the pool, in which case the
+ *  contents are undefined.
+ *
+ *	If all puddles in the pool are full, a new puddle will be
+ *  grafted onto the end of the pool's puddle chain and the
+ *  element returned will come from this puddle.
+ *
+ *  POOL_CONCURRENT pools do their own locking; all other pools
+ *  must be locked by the caller.
+ *
+ * @param[in] pool
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ *
+ */
+void *
+pool_newElement(J9Pool *pool)
+{
+	void *newElement;
+
+	Trc_pool_newElement_Entry(pool);
+
+	if (NULL == pool) {
+		Trc_pool_newElement_ExitNoop();
+		return NULL;
+	}
+
+	if (pool->flags & POOL_CONCURRENT) {
+		MUTEX_ENTER(pool->depot->mutex);
+		newElement = pool_takeFreeSlot(pool);
+		MUTEX_EXIT(pool->depot->mutex);
+	} else {
+		newElement = pool_takeFreeSlot(pool);
+	}
+
+	if (NULL != newElement) {
+		pool_claimElement(pool, newElement);
+	}
+
 	Trc_pool_newElement_Exit(newElement);
 
 	return newElement;
@@ -559,6 +839,9 @@ pool_newElement(J9Pool *pool)
  * pool with @ref pool_startDo / @ref pool_nextDo on the element
  * returned by those calls.
  *
+ * POOL_CONCURRENT pools do their own locking; all other pools
+ * must be locked by the caller.
+ *
  * @param[in] pool
  * @param[in] anElement Pointer to the element to be removed
  *
@@ -568,11 +851,7 @@ pool_newElement(J9Pool *pool)
 void
 pool_removeElement(J9Pool *pool, void *anElement)
 {
-	J9SRP *puddleSRP;
-	int32_t slot;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
-	void *freeLocation;
 
 	Trc_pool_removeElement_Entry(pool, anElement);
 
@@ -581,45 +860,277 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;
 	}
 
-	puddleList = J9POOL_PUDDLELIST(pool);
-	puddleSRP = pool_getElementPuddleSRP(pool, anElement);
-	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
-	slot = pool_getElementPuddleSlot(pool, puddle, anElement);
-	if (slot < 0) {
-		Trc_pool_removeElement_NotFound(anElement, J9POOLPUDDLELIST_NEXTPUDDLE(puddleList));
-		Trc_pool_removeElement_Exit();
-		return;		/* this is an error...  we were passed a bogus data pointer. */
+	if (pool_releaseElement(pool, anElement, &puddle)) {
+		if (pool->flags & POOL_CONCURRENT) {
+			MUTEX_ENTER(pool->depot->mutex);
+			pool_returnFreeSlot(pool, puddle, anElement);
+			MUTEX_EXIT(pool->depot->mutex);
+		} else {
+			pool_returnFreeSlot(pool, puddle, anElement);
+		}
 	}
 
-	if (PUDDLE_SLOT_FREE(puddle, slot)) {
-		Trc_pool_removeElement_NotFound(anElement, puddle);
-		Trc_pool_removeElement_Exit();
-		return;		/* this is an error... the slot was already free. */
+	Trc_pool_removeElement_Exit();
+}
+
+/**
+ * Get an empty magazine from the depot, allocating a new one if there is none.
+ * The depot mutex must be held.
+ *
+ * @param[in] pool A POOL_CONCURRENT pool
+ *
+ * @return NULL if a magazine could not be allocated
+ * @return pointer to an empty magazine otherwise
+ */
+static J9PoolMagazine *
+pool_getEmptyMagazine(J9Pool *pool)
+{
+	J9PoolDepot *depot = pool->depot;
+	J9PoolMagazine *magazine = depot->emptyMagazines;
+
+	if (NULL != magazine) {
+		depot->emptyMagazines = magazine->next;
+	} else {
+		uint32_t doInit = 1;
+		magazine = pool->memAlloc(pool->userData, sizeof(J9PoolMagazine), pool->poolCreatorCallsite, pool->memoryCategory, POOL_ALLOC_TYPE_MAGAZINE, &doInit);
+		if (NULL == magazine) {
+			return NULL;
+		}
+		magazine->rounds = 0;
 	}
+	magazine->next = NULL;
 
-	MARK_SLOT_FREE(puddle, slot);
-	puddle->usedElements--;
-	puddleList->numElements--;
-	freeLocation = (void *) J9POOLPUDDLE_FIRSTFREESLOT(puddle);
-	SRP_SET(puddle->firstFreeSlot, anElement);
-	LINK_TO_FREE_LIST(anElement, freeLocation);
+	return magazine;
+}
 
-	/* If the puddle's empty, and we're allowed to free it, then remove it. */
-	if ((puddle->usedElements == 0) && !(pool->flags & POOL_NEVER_FREE_PUDDLES)) {
-		poolPuddle_delete(pool, puddle);
-	} else if (NULL == freeLocation) {
-		/* It was full before - but not anymore - add it to the top of the available puddles list. */
-		J9PoolPuddle *next = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+/**
+ * Make sure the loaded magazine of a thread cache has at least one round, either
+ * by swapping in the previous magazine, by exchanging an empty magazine for a full
+ * one from the depot, or by filling the loaded magazine from the puddles.
+ *
+ * @param[in] pool A POOL_CONCURRENT pool
+ * @param[in] cache The thread cache
+ *
+ * @return NULL if no magazine with rounds could be provided
+ * @return the loaded magazine otherwise
+ */
+static J9PoolMagazine *
+pool_reloadMagazine(J9Pool *pool, J9PoolThreadCache *cache)
+{
+	J9PoolDepot *depot = pool->depot;
+	J9PoolMagazine *previous = cache->previous;
+	J9PoolMagazine *loaded = NULL;
+
+	if ((NULL != previous) && (0 != previous->rounds)) {
+		cache->previous = cache->loaded;
+		cache->loaded = previous;
+		return previous;
+	}
 
-		WSRP_SET(puddleList->nextAvailablePuddle, puddle);
-		WSRP_SET(puddle->prevAvailablePuddle, NULL);
-		WSRP_SET(puddle->nextAvailablePuddle, next);
-		if (NULL != next) {
-			WSRP_SET(next->prevAvailablePuddle, puddle);
+	MUTEX_ENTER(depot->mutex);
+	if (NULL != depot->fullMagazines) {
+		J9PoolMagazine *full = depot->fullMagazines;
+
+		depot->fullMagazines = full->next;
+		/* The previous magazine is empty here, hand it back to the depot. */
+		if (NULL != previous) {
+			previous->next = depot->emptyMagazines;
+			depot->emptyMagazines = previous;
+		}
+		cache->previous = cache->loaded;
+		cache->loaded = full;
+	} else {
+		J9PoolMagazine *magazine = cache->loaded;
+
+		if (NULL == magazine) {
+			magazine = pool_getEmptyMagazine(pool);
+			cache->loaded = magazine;
+		}
+		if (NULL != magazine) {
+			while (magazine->rounds < J9POOL_MAGAZINE_SIZE) {
+				void *freeSlot = pool_takeFreeSlot(pool);
+				if (NULL == freeSlot) {
+					break;
+				}
+				magazine->elements[magazine->rounds] = freeSlot;
+				magazine->rounds += 1;
+			}
 		}
 	}
+	MUTEX_EXIT(depot->mutex);
 
-	Trc_pool_removeElement_Exit();
+	loaded = cache->loaded;
+	if ((NULL == loaded) || (0 == loaded->rounds)) {
+		loaded = NULL;
+	}
+
+	return loaded;
+}
+
+/**
+ * Make sure the loaded magazine of a thread cache has room for at least one round,
+ * either by swapping in the previous magazine or by handing a full magazine to the
+ * depot in exchange for an empty one.
+ *
+ * @param[in] pool A POOL_CONCURRENT pool
+ * @param[in] cache The thread cache
+ *
+ * @return NULL if no magazine with room could be provided
+ * @return the loaded magazine otherwise
+ */
+static J9PoolMagazine *
+pool_unloadMagazine(J9Pool *pool, J9PoolThreadCache *cache)
+{
+	J9PoolDepot *depot = pool->depot;
+	J9PoolMagazine *previous = cache->previous;
+
+	if ((NULL != previous) && (J9POOL_MAGAZINE_SIZE != previous->rounds)) {
+		cache->previous = cache->loaded;
+		cache->loaded = previous;
+		return previous;
+	}
+
+	MUTEX_ENTER(depot->mutex);
+	/* The previous magazine is full here, hand it to the depot. */
+	if (NULL != previous) {
+		previous->next = depot->fullMagazines;
+		depot->fullMagazines = previous;
+	}
+	cache->previous = cache->loaded;
+	cache->loaded = pool_getEmptyMagazine(pool);
+	MUTEX_EXIT(depot->mutex);
+
+	return cache->loaded;
+}
+
+/**
+ * Asks for the address of a new pool element, using a per-thread cache of free
+ * elements for POOL_CONCURRENT pools.
+ *
+ * The element is taken from the thread's loaded magazine without any locking.
+ * Only when both magazines of the cache are empty does the thread take the depot
+ * mutex, to exchange an empty magazine for a full one or to refill a magazine
+ * from the puddles.
+ *
+ * For other pools, or if cache is NULL, this is the same as @ref pool_newElement.
+ *
+ * @param[in] pool
+ * @param[in] cache The calling thread's cache for this pool
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ *
+ * @see pool_removeElementCached, pool_flushThreadCache
+ */
+void *
+pool_newElementCached(J9Pool *pool, J9PoolThreadCache *cache)
+{
+	void *newElement = NULL;
+
+	Trc_pool_newElementCached_Entry(pool, cache);
+
+	if ((NULL == pool) || (NULL == cache) || !(pool->flags & POOL_CONCURRENT)) {
+		newElement = pool_newElement(pool);
+	} else {
+		J9PoolMagazine *loaded = cache->loaded;
+
+		if ((NULL == loaded) || (0 == loaded->rounds)) {
+			loaded = pool_reloadMagazine(pool, cache);
+		}
+
+		if (NULL != loaded) {
+			loaded->rounds -= 1;
+			newElement = loaded->elements[loaded->rounds];
+			pool_claimElement(pool, newElement);
+		} else {
+			/* out of memory for magazines, the puddles may still have room */
+			newElement = pool_newElement(pool);
+		}
+	}
+
+	Trc_pool_newElementCached_Exit(newElement);
+
+	return newElement;
+}
+
+/**
+ * Deallocates an element from a pool, using a per-thread cache of free elements
+ * for POOL_CONCURRENT pools.
+ *
+ * The element is marked as free immediately, so it is no longer visited by pool
+ * walks, but it stays in the thread's cache for reuse until the cache is flushed
+ * or a full magazine is handed to the depot.
+ *
+ * For other pools, or if cache is NULL, this is the same as @ref pool_removeElement.
+ *
+ * @param[in] pool
+ * @param[in] cache The calling thread's cache for this pool
+ * @param[in] anElement Pointer to the element to be removed
+ *
+ * @return none
+ *
+ * @see pool_newElementCached, pool_flushThreadCache
+ */
+void
+pool_removeElementCached(J9Pool *pool, J9PoolThreadCache *cache, void *anElement)
+{
+	Trc_pool_removeElementCached_Entry(pool, cache, anElement);
+
+	if ((NULL == pool) || (NULL == cache) || !(pool->flags & POOL_CONCURRENT)) {
+		pool_removeElement(pool, anElement);
+	} else if (NULL != anElement) {
+		J9PoolPuddle *puddle;
+
+		if (pool_releaseElement(pool, anElement, &puddle)) {
+			J9PoolMagazine *loaded = cache->loaded;
+
+			if ((NULL == loaded) || (J9POOL_MAGAZINE_SIZE == loaded->rounds)) {
+				loaded = pool_unloadMagazine(pool, cache);
+			}
+
+			if (NULL != loaded) {
+				loaded->elements[loaded->rounds] = anElement;
+				loaded->rounds += 1;
+			} else {
+				/* out of memory for magazines, return the element straight to its puddle */
+				MUTEX_ENTER(pool->depot->mutex);
+				pool_returnFreeSlot(pool, puddle, anElement);
+				MUTEX_EXIT(pool->depot->mutex);
+			}
+		}
+	}
+
+	Trc_pool_removeElementCached_Exit();
+}
+
+/**
+ * Return the free elements held by a thread cache to their puddles, and its
+ * magazines to the depot.
+ *
+ * A thread must flush its cache before it stops using the pool (for example when
+ * the thread exits), and all caches must be flushed before the pool is cleared
+ * or killed.
+ *
+ * @param[in] pool
+ * @param[in] cache The thread cache to flush
+ *
+ * @return none
+ */
+void
+pool_flushThreadCache(J9Pool *pool, J9PoolThreadCache *cache)
+{
+	Trc_pool_flushThreadCache_Entry(pool, cache);
+
+	if ((NULL != pool) && (NULL != cache) && (pool->flags & POOL_CONCURRENT)) {
+		MUTEX_ENTER(pool->depot->mutex);
+		pool_drainMagazine(pool, cache->loaded);
+		pool_drainMagazine(pool, cache->previous);
+		MUTEX_EXIT(pool->depot->mutex);
+		cache->loaded = NULL;
+		cache->previous = NULL;
+	}
+
+	Trc_pool_flushThreadCache_Exit();
 }
 
 /**
@@ -841,6 +1352,7 @@ pool_nextDo(pool_state *state)
  * Clear the contents of a pool, but do not de-allocate the puddles or the pool.
  *
  * @note Make no assumptions about the contents of the pool after invoking this method (it currently does not zero the memory)
+ * @note All thread caches of a POOL_CONCURRENT pool must have been flushed.
  *
  * @param[in] pool The pool to clear
  *
@@ -868,6 +1380,18 @@ pool_clear(J9Pool *pool)
 		}
 
 		puddleList->numElements = 0;
+
+		if (NULL != pool->depot) {
+			/* The rounds in the depot are back on the puddle free lists now. */
+			J9PoolDepot *depot = pool->depot;
+			while (NULL != depot->fullMagazines) {
+				J9PoolMagazine *magazine = depot->fullMagazines;
+				depot->fullMagazines = magazine->next;
+				magazine->rounds = 0;
+				magazine->next = depot->emptyMagazines;
+				depot->emptyMagazines = magazine;
+			}
+		}
 	}
 
 	Trc_pool_clear_Exit();
@@ -33,12 +33,23 @@
 */
 
 #include "omrcomp.h"
+#include "omrmutex.h"
 #include "pool_api.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Shared state of a POOL_CONCURRENT pool. The mutex protects the magazine lists
+ * as well as the puddle free lists and the available puddle list of the pool.
+ */
+typedef struct J9PoolDepot {
+	MUTEX mutex;
+	J9PoolMagazine *fullMagazines;
+	J9PoolMagazine *emptyMagazines;
+} J9PoolDepot;
+
 
 #ifdef __cplusplus
 }